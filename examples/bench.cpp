@@ -1098,6 +1098,78 @@ bool cxx_string_cat(size_t count, int tid)
 	return true;
 }
 
+/*
+ * Small message compression: records of ~200 bytes (cat_test) and 4 KiB,
+ * compressed one by one, with and without reusable context
+ */
+static bool libsrt_string_enc_lz_small_aux(size_t count, int tid,
+					  bool use_ctx)
+{
+	RETURN_IF(!TIdTest(tid, TId_Base), false);
+	srt_string *s[cat_test_ops + 1], *out = NULL;
+	srt_lz_ctx *ctx = use_ctx ? ss_lz_ctx_alloc(0) : NULL;
+	s[cat_test_ops] = ss_alloc(4096);
+	for (size_t i = 0; i < cat_test_ops; i++)
+		s[i] = ss_dup_c(cat_test[i]);
+	while (ss_size(s[cat_test_ops]) < 4096)
+		ss_cat(&s[cat_test_ops], s[0], s[1], s[2], s[3], s[4], s[5],
+		       s[6]);
+	ss_resize(&s[cat_test_ops], 4096, ' ');
+	for (size_t i = 0; i < count; i++)
+		for (size_t j = 0; j <= cat_test_ops; j++)
+			if (use_ctx)
+				ss_enc_lz_ctx(&out, s[j], ctx);
+			else
+				ss_enc_lz(&out, s[j]);
+	for (size_t i = 0; i <= cat_test_ops; i++)
+		ss_free(&s[i]);
+	ss_free(&out);
+	ss_lz_ctx_free(&ctx);
+	return true;
+}
+
+bool libsrt_string_enc_lz_small(size_t count, int tid)
+{
+	return libsrt_string_enc_lz_small_aux(count, tid, false);
+}
+
+bool libsrt_string_enc_lz_ctx_small(size_t count, int tid)
+{
+	return libsrt_string_enc_lz_small_aux(count, tid, true);
+}
+
+/*
+ * Checksums of a 16 KiB buffer (in cache)
+ */
+static bool libsrt_string_csum32_aux(size_t count, int tid,
+				     uint32_t (*f)(const srt_string *))
+{
+	RETURN_IF(!TIdTest(tid, TId_Base), false);
+	uint32_t acc = 0;
+	srt_string *s = ss_alloc(16384);
+	for (size_t i = 0; i < 16384; i++)
+		ss_cat_char(&s, (int)(i * 7 + (i >> 9)) & 0x7f);
+	for (size_t i = 0; i < count; i++)
+		acc += f(s);
+	ss_free(&s);
+	return acc != 0;
+}
+
+bool libsrt_string_crc32(size_t count, int tid)
+{
+	return libsrt_string_csum32_aux(count, tid, ss_crc32);
+}
+
+bool libsrt_string_crc32c(size_t count, int tid)
+{
+	return libsrt_string_csum32_aux(count, tid, ss_crc32c);
+}
+
+bool libsrt_string_adler32(size_t count, int tid)
+{
+	return libsrt_string_csum32_aux(count, tid, ss_adler32);
+}
+
 #if 0 /* it is too low (2 orders of magnitude slower tan plain std::string) */
 bool cxx_stringstream_cat(size_t count, int tid)
 {
@@ -1309,6 +1381,11 @@ int main(int argc, char *argv[])
 		BENCH_FN(libsrt_string_cat, count[i] / 10, tid[i]);
 		BENCH_FN(c_string_cat, count[i] / 10, tid[i]);
 		BENCH_FN(cxx_string_cat, count[i] / 10, tid[i]);
+		BENCH_FN(libsrt_string_enc_lz_small, count[i] / 10, tid[i]);
+		BENCH_FN(libsrt_string_enc_lz_ctx_small, count[i] / 10, tid[i]);
+		BENCH_FN(libsrt_string_crc32, count[i] / 10, tid[i]);
+		BENCH_FN(libsrt_string_crc32c, count[i] / 10, tid[i]);
+		BENCH_FN(libsrt_string_adler32, count[i] / 10, tid[i]);
 	}
 	return 0;
 }
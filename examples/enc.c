@@ -9,10 +9,7 @@
 
 #include "../src/libsrt.h"
 
-#define LZHBUF_SIZE S_NPOS /* -ezh high compression: infinite buffer size */
-#define LZBUF_SIZE 1000000 /* -ez fast compression: 1 MB buffer size */
-#define IBUF_SIZE (3 * 4 * 2 * 1024) /* 3 * 4 because of LCM for base64 */
-#define ESC_MAX_SIZE 16 /* maximum size for an escape sequence: 16 bytes */
+#define IBUF_SIZE (64 * 1024) /* any size: streaming codecs */
 
 #if SZ_DEBUG_STATS
 extern size_t lz_st_lit[9], lz_st_lit_bytes;
@@ -24,45 +21,131 @@ static int syntax_error(const char **argv, const int exit_code)
 	const char *v0 = argv[0];
 	fprintf(stderr,
 		"Buffer encoding/decoding (libsrt example)\n\n"
-		"Syntax: %s [-eb|-db|-eh|-eH|-dh|-ex|-dx|-ej|-dj|"
-		"-eu|-du|-ez|-dz|-crc32|-adler32]\n\nExamples:\n"
+		"Syntax: %s [-eb|-db|-ebu|-dbu|-eh|-eH|-dh|-ex|-dx|-ej|-dj|"
+		"-eu|-du|-ez|-dz|-ezh|-ez2..-ez9|-ezf|-eze|-dzf|-dzr|-crc32|"
+		"-crc32c|-adler32|-cdc] [threads|offset|avg] [level|length]\n\n"
+		"Examples:\n"
 		"%s -eb <in >out.b64\n%s -db <in.b64 >out\n"
+		"%s -ebu <in >out.b64url\n%s -dbu <in.b64url >out\n"
 		"%s -eh <in >out.hex\n%s -eH <in >out.HEX\n"
 		"%s -dh <in.hex >out\n%s -dh <in.HEX >out\n"
 		"%s -ex <in >out.xml.esc\n%s -dx <in.xml.esc >out\n"
-		"%s -ej <in >out.json.esc\n%s -dx <in.json.esc >out\n"
+		"%s -ej <in >out.json.esc\n%s -dj <in.json.esc >out\n"
 		"%s -eu <in >out.url.esc\n%s -du <in.url.esc >out\n"
 		"%s -ez <in >in.lz\n%s -dz <in.lz >out\n"
 		"%s -ezh <in >in.lz\n%s -dz <in.lz >out\n"
+		"%s -ez9 <in >in.lz\n%s -dz <in.lz >out\n"
+		"%s -ezf 8 <in >in.lzf\n%s -dzf 8 <in.lzf >out\n"
+		"%s -ezf 8 6 <in >in.lzf\n%s -dzf 8 <in.lzf >out\n"
+		"%s -eze 8 6 <in >in.lzf\n%s -dzf 8 <in.lzf >out\n"
+		"%s -dzr 1000000 4096 <in.lzf >out\n"
 		"%s -crc32 <in\n%s -crc32 <in >out\n"
-		"%s -adler32 <in\n%s -adler32 <in >out\n",
+		"%s -crc32c <in\n"
+		"%s -adler32 <in\n%s -adler32 <in >out\n"
+		"%s -cdc 8192 <in >chunks.txt\n",
 		v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0,
-		v0, v0, v0, v0, v0);
+		v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0, v0,
+		v0, v0);
 	return exit_code;
 }
 
-int main(int argc, const char **argv)
+/*
+ * -ezh, -ez2 ... -ez9: whole input as one LZ block, with the given
+ * compression level (same format as the SC_ENC_LZ blocks)
+ */
+static int lzl(const int level, size_t *li, size_t *lo)
 {
+	uint8_t dle[S_PK_U64_MAX_BYTES], *dlep = dle;
+	srt_string *in = NULL, *out = NULL;
 	int exit_code = 0;
-	uint8_t esc, dle[S_PK_U64_MAX_BYTES], *dlep;
-	const uint8_t *dlepc;
+	ss_read(&in, stdin, S_NPOS);
+	*li = ss_size(in);
+	ss_enc_lz_level(&out, in, level);
+	if (ss_size(out) > 0) {
+		s_st_pk_u64(&dlep, ss_size(out));
+		*lo = (size_t)(dlep - dle) + ss_size(out);
+		if (!fwrite(dle, 1, (size_t)(dlep - dle), stdout)
+		    || ss_write(stdout, out, 0, S_NPOS) < 0)
+			exit_code = 6;
+	}
+	ss_free(&in, &out);
+	return exit_code;
+}
+
+/*
+ * -dzr: decode a range of framed LZ (only the blocks covering it), having
+ * the whole input in memory (e.g. a memory-mapped file could be used, too)
+ */
+static int lzr(const size_t off, const size_t len, size_t *li, size_t *lo)
+{
+	srt_string *in = NULL, *out = NULL;
+	int exit_code = 0;
+	ss_read(&in, stdin, S_NPOS);
+	*li = ss_size(in);
+	/* BEHAVIOR: empty input, empty output */
+	if (*li > 0) {
+		ss_dec_lz_range(&out, in, off, len);
+		*lo = ss_size(out);
+		if (!*lo) {
+			fprintf(stderr, "Format error\n");
+			exit_code = 2;
+		} else if (ss_write(stdout, out, 0, S_NPOS) < 0) {
+			fprintf(stderr, "Write error\n");
+			exit_code = 6;
+		}
+	}
+	ss_free(&in, &out);
+	return exit_code;
+}
+
+/*
+ * -cdc: content-defined chunking of the input stream (read in blocks),
+ * printing the offset, size, and 64-bit hash of every chunk (minimum and
+ * maximum chunk sizes: 1/4 and 8 times the average)
+ */
+static int cdc(const size_t avg)
+{
+	size_t off = 0, pos = 0, n, n0;
+	uint64_t h;
+	srt_bool last = S_FALSE;
 	srt_string_ref ref;
-	size_t lmax = 0;
-	size_t li = 0, lo = 0, j, l, l2, ss0, off;
-	const char *b;
-	int cf;
-	srt_bool done;
+	srt_string *in = ss_alloc(IBUF_SIZE);
+	while (!last) {
+		n0 = ss_size(in);
+		ss_cat_read(&in, stdin, IBUF_SIZE);
+		last = ss_size(in) == n0;
+		while ((n = ss_cdc_next(in, off, avg / 4, avg, avg * 8, last))
+		       > 0) {
+			h = ss_hash64(ss_ref_buf(&ref, ss_get_buffer_r(in) + off,
+						 n));
+			printf("%zu\t%zu\t%08x%08x\n", pos, n,
+			       (unsigned)(h >> 32), (unsigned)h);
+			off += n;
+			pos += n;
+		}
+		ss_erase(&in, 0, off);
+		off = 0;
+	}
+	ss_free(&in);
+	return 0;
+}
+
+int main(int argc, const char **argv)
+{
+	int exit_code = 0, lzf_flags = 0;
+	size_t li = 0, lo = 0, nthreads = 1;
 	uint32_t acc;
 	uint32_t (*f32)(const srt_string *, uint32_t, size_t, size_t) = NULL;
 	srt_string *in = NULL, *out = NULL;
-	srt_string *(*ss_codec1_f)(srt_string **, const srt_string *) = NULL;
-	srt_string *(*ss_codec2_f)(srt_string **, const srt_string *) = NULL;
-	srt_string *(*ss_codec3_f)(srt_string **, const srt_string *) = NULL;
-	srt_string *(*ss_codec4_f)(srt_string **, const srt_string *) = NULL;
-	size_t lzbufsize = LZBUF_SIZE;
+	srt_codec *c;
+	enum eSCodec t;
+	srt_bool done;
 	if (argc < 2)
 		return syntax_error(argv, 1);
-	if (!strncmp(argv[1], "-crc32", 6)) {
+	if (!strncmp(argv[1], "-crc32c", 8)) {
+		acc = S_CRC32C_INIT;
+		f32 = ss_crc32cr;
+	} else if (!strncmp(argv[1], "-crc32", 6)) {
 		acc = S_CRC32_INIT;
 		f32 = ss_crc32r;
 	} else if (!strncmp(argv[1], "-adler32", 8)) {
@@ -76,147 +159,88 @@ int main(int argc, const char **argv)
 		printf("%08x\n", acc);
 		return 0;
 	}
-	if (!strncmp(argv[1], "-eb", 3))
-		ss_codec1_f = ss_enc_b64;
+	if (!strncmp(argv[1], "-cdc", 5))
+		return cdc(argc > 2 ? (size_t)atol(argv[2]) : 8192);
+	if (!strncmp(argv[1], "-ebu", 5))
+		t = SC_ENC_B64URL;
+	else if (!strncmp(argv[1], "-dbu", 5))
+		t = SC_DEC_B64URL;
+	else if (!strncmp(argv[1], "-eb", 4))
+		t = SC_ENC_B64;
 	else if (!strncmp(argv[1], "-db", 4))
-		ss_codec1_f = ss_dec_b64;
+		t = SC_DEC_B64;
 	else if (!strncmp(argv[1], "-eh", 4))
-		ss_codec1_f = ss_enc_hex;
+		t = SC_ENC_HEX;
 	else if (!strncmp(argv[1], "-eH", 4))
-		ss_codec1_f = ss_enc_HEX;
+		t = SC_ENC_HEX_UPPER;
 	else if (!strncmp(argv[1], "-dh", 4))
-		ss_codec1_f = ss_dec_hex;
+		t = SC_DEC_HEX;
 	else if (!strncmp(argv[1], "-ex", 4))
-		ss_codec1_f = ss_enc_esc_xml;
+		t = SC_ENC_ESC_XML;
 	else if (!strncmp(argv[1], "-dx", 4))
-		ss_codec2_f = ss_dec_esc_xml;
+		t = SC_DEC_ESC_XML;
 	else if (!strncmp(argv[1], "-ej", 4))
-		ss_codec1_f = ss_enc_esc_json;
+		t = SC_ENC_ESC_JSON;
 	else if (!strncmp(argv[1], "-dj", 4))
-		ss_codec2_f = ss_dec_esc_json;
+		t = SC_DEC_ESC_JSON;
 	else if (!strncmp(argv[1], "-eu", 4))
-		ss_codec1_f = ss_enc_esc_url;
+		t = SC_ENC_ESC_URL;
 	else if (!strncmp(argv[1], "-du", 4))
-		ss_codec2_f = ss_dec_esc_url;
-	else if (!strncmp(argv[1], "-ezh", 5)) {
-		ss_codec3_f = ss_enc_lzh;
-		lzbufsize = LZHBUF_SIZE;
+		t = SC_DEC_ESC_URL;
+	else if (!strncmp(argv[1], "-ezh", 5)
+		 || (!strncmp(argv[1], "-ez", 3) && argv[1][3] >= '2'
+		     && argv[1][3] <= '9' && !argv[1][4])) {
+		exit_code = lzl(argv[1][3] == 'h' ? 1 : argv[1][3] - '0', &li,
+				&lo);
+		if (exit_code)
+			fprintf(stderr, "Write error\n");
+		fprintf(stderr, "in: %zu bytes, out: %zu bytes\n", li, lo);
+		return exit_code;
+	} else if (!strncmp(argv[1], "-ezf", 5) || !strncmp(argv[1], "-eze", 5)
+		   || !strncmp(argv[1], "-dzf", 5)) {
+		/*
+		 * Framed LZ (-eze: entropy-coded blocks), one frame every
+		 * nthreads blocks, so memory usage is nthreads x 1 MiB
+		 */
+		t = argv[1][1] == 'e' ? SC_ENC_LZF : SC_DEC_LZF;
+		nthreads = argc > 2 ? (size_t)atoi(argv[2]) : 1;
+		lzf_flags = S_LZF_CRC32 | S_LZF_INDEX
+			    | S_LZF_LEVEL(argc > 3 ? atoi(argv[3]) : 0)
+			    | (argv[1][3] == 'e' ? S_LZF_ENTROPY : 0);
+	} else if (!strncmp(argv[1], "-dzr", 5)) {
+		if (argc < 4)
+			return syntax_error(argv, 2);
+		exit_code = lzr((size_t)atol(argv[2]), (size_t)atol(argv[3]),
+				&li, &lo);
+		fprintf(stderr, "in: %zu bytes, out: %zu bytes\n", li, lo);
+		return exit_code;
 	} else if (!strncmp(argv[1], "-ez", 4))
-		ss_codec3_f = ss_enc_lz;
+		t = SC_ENC_LZ;
 	else if (!strncmp(argv[1], "-dz", 4))
-		ss_codec4_f = ss_dec_lz;
+		t = SC_DEC_LZ;
 	else
 		return syntax_error(argv, 2);
-	esc = ss_codec2_f == ss_dec_esc_xml
-		      ? '&'
-		      : ss_codec2_f == ss_dec_esc_json ? '\\' : '%';
-	cf = ss_codec1_f
-		     ? 1
-		     : ss_codec2_f ? 2 : ss_codec3_f ? 3 : ss_codec4_f ? 4 : 0;
-	done = S_FALSE;
-	ss_reserve(&in, IBUF_SIZE);
-	while (!done) {
-		switch (cf) {
-		case 1:
-		case 2:
-			ss0 = ss_size(in);
-			ss_cat_read(&in, stdin, IBUF_SIZE);
-			l = ss_size(in);
-			li += (l - ss0);
-			if (!l) {
-				done = S_TRUE;
-				continue;
-			}
-			if (ss_codec1_f) {
-				ss_codec1_f(&out, in);
-				ss_clear(in);
-				break;
-			}
-			/* For codecs handling escape characters it is
-			 * necessary to check the escape sequence is not cut
-			 * at boundaries.
-			 */
-			b = ss_get_buffer_r(in);
-			off = 0;
-			if (l > ESC_MAX_SIZE)
-				for (j = (size_t)(l - ESC_MAX_SIZE + 1); j < l;
-				     j++)
-					if (b[j] == esc && b[j - 1] != esc) {
-						off = (size_t)(l - j);
-						break;
-					}
-			l -= off;
-			ss_codec2_f(&out, ss_ref_buf(&ref, b, l));
-			if (off > 0)
-				ss_cpy_substr(&in, in, l, S_NPOS);
-			else
-				ss_clear(in);
-			break;
-		case 3: /* data compression */
-			ss_cpy_read(&in, stdin, lzbufsize);
-			l = ss_size(in);
-			if (!l) {
-				done = S_TRUE;
-				continue;
-			}
-			li += l;
-			ss_codec3_f(&out, in);
-			lmax = ss_size(out);
-			dlep = dle;
-			s_st_pk_u64(&dlep, lmax);
-			l = (dlep - dle); /* dyn LE size */
-			if (!fwrite(dle, 1, l, stdout) || ferror(stdout)) {
-				fprintf(stderr, "Write error\n");
-				exit_code = 6;
-				done = S_TRUE;
-				continue;
-			}
-			lo += l;
-			ss_clear(in);
-			break;
-		case 4: /* data decompression */
-			l = fread(dle, 1, 1, stdin);
-			if (!l || ferror(stdin)) {
-				done = S_TRUE;
-				continue;
-			}
-			li += l;
-			l = s_pk_u64_size(dle);
-			if (!l) {
-				done = S_TRUE;
-				continue;
-			}
-			if (l > 1) {
-				l2 = fread(dle + 1, 1, l - 1, stdin);
-				li += l2;
-				if (l != (l2 + 1)) {
-					exit_code = 2;
-					fprintf(stderr, "Format error\n");
-					done = S_TRUE;
-					continue;
-				}
-				l = l2 + 1;
-			}
-			dlepc = dle;
-			lmax = s_ld_pk_u64(&dlepc, l);
-			ss_cpy_read(&in, stdin, lmax);
-			l = ss_size(in);
-			li += l;
-			if (l != lmax || ferror(stdin)) {
-				fprintf(stderr, "Read error\n");
-				exit_code = 4;
-				done = S_TRUE;
-				continue;
-			}
-			ss_codec4_f(&out, in);
-			break;
-		default:
-			fprintf(stderr, "Logic error\n");
-			exit_code = 8;
+	c = t == SC_ENC_LZF || t == SC_DEC_LZF
+		    ? ss_codec_alloc_lzf(t, 0, lzf_flags, nthreads)
+		    : ss_codec_alloc(t);
+	if (!c) {
+		fprintf(stderr, "Not enough memory\n");
+		return 8;
+	}
+	for (done = S_FALSE; !done;) {
+		if (ss_read(&in, stdin, IBUF_SIZE) > 0) {
+			li += ss_size(in);
+			ss_codec_update(&out, c, in);
+		} else {
+			ss_codec_final(&out, c);
 			done = S_TRUE;
-			continue;
 		}
-		if (ss_write(stdout, out, 0, S_NPOS) < 0) {
+		if (ss_codec_error(c)) {
+			fprintf(stderr, "Format error\n");
+			exit_code = 2;
+			break;
+		}
+		if (ss_size(out) > 0 && ss_write(stdout, out, 0, S_NPOS) < 0) {
 			fprintf(stderr, "Write error\n");
 			exit_code = 6;
 			break;
@@ -237,6 +261,7 @@ int main(int argc, const char **argv)
 		lz_st_ref[4], lz_st_ref[5], lz_st_ref[6], lz_st_ref[7],
 		lz_st_ref[8], lz_st_ref_bytes);
 #endif
+	ss_codec_free(&c);
 	ss_free(&in, &out);
 	return exit_code;
 }
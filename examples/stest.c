@@ -10,6 +10,8 @@
 #include "../src/libsrt.h"
 #include "../src/saux/schar.h"
 #include "../src/saux/sdbg.h"
+#include "../src/saux/senc.h"
+#include "../src/saux/shash.h"
 #include "utf8_examples.h"
 #include <locale.h>
 
@@ -165,18 +167,24 @@ static int cmp_pp(const void *a, const void *b)
 	MK_TEST_SS_CAT_CODEC(codec)
 
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_b64)
+MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_b64url)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_hex)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_HEX)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_lz)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_lzh)
+MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_utf16le)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_esc_xml)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_esc_json)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_esc_url)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_esc_dquote)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(enc_esc_squote)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_b64)
+MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_b64_strict)
+MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_b64url)
+MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_b64url_strict)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_hex)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_lz)
+MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_utf16le)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_esc_xml)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_esc_json)
 MK_TEST_SS_DUP_CPY_CAT_CODEC(dec_esc_url)
@@ -488,6 +496,46 @@ static int test_ss_dup_substr_u()
 	return res;
 }
 
+static int test_ss_index_u()
+{
+	int res = 0;
+	size_t i, j, offs[] = {0, 1, 63, 64, 65, 127, 128, 700, 1199, 1200};
+	srt_string *a = NULL, *b, *x = NULL, *y = NULL;
+	for (i = 0; i < 300; i++) /* 1200 code points, 3000 bytes */
+		ss_cat_c(&a, "a" U8_C_N_TILDE_D1 U8_HAN_611B U8_HAN_24B62);
+	ss_shrink(&a); /* no space for the index */
+	b = ss_dup(a);
+	res |= ss_index_u(&a) ? 0 : 1;
+	res |= !ss_index_u(&x) ? 0 : 2; /* x is empty */
+	for (i = 0; i < sizeof(offs) / sizeof(offs[0]) && !res; i++) {
+		for (j = 0; j < 3 && !res; j++) {
+			ss_cpy_substr_u(&x, a, offs[i], offs[j * 4]);
+			ss_cpy_substr_u(&y, b, offs[i], offs[j * 4]);
+			res |= ss_equal(x, y) ? 0 : 4;
+			ss_cpy_erase_u(&x, a, offs[i], offs[j * 4 + 1]);
+			ss_cpy_erase_u(&y, b, offs[i], offs[j * 4 + 1]);
+			res |= ss_equal(x, y) ? 0 : 8;
+			ss_cpy_resize_u(&x, a, offs[i], '_');
+			ss_cpy_resize_u(&y, b, offs[i], '_');
+			res |= ss_equal(x, y) ? 0 : 16;
+		}
+	}
+	/* Hashing keeps the index ('sub_type' bit 1, see sstring.h) */
+	(void)ss_hash(a);
+	res |= (a->d.sub_type & 3) == 3 ? 0 : 128;
+	/* Index invalidation after modification */
+	ss_erase_u(&a, 1, 3);
+	ss_erase_u(&b, 1, 3);
+	ss_cpy_substr_u(&x, a, 700, 10);
+	ss_cpy_substr_u(&y, b, 700, 10);
+	res |= ss_equal(x, y) && ss_len_u(x) == 10 ? 0 : 32;
+	ss_erase_u(&a, 500, 100);
+	ss_erase_u(&b, 500, 100);
+	res |= ss_equal(a, b) && ss_len_u(a) == 1097 ? 0 : 64;
+	ss_free(&a, &b, &x, &y);
+	return res;
+}
+
 static int test_ss_dup_cn()
 {
 	srt_string *a = ss_dup_cn("hello123", 5);
@@ -807,7 +855,7 @@ static int test_ss_cpy_wn()
 				0x15f,
 				0xa2,
 				0x20ac,
-				0xd800 | (uint16_t)(0x24b62 >> 10),
+				0xd800 | (uint16_t)((0x24b62 - 0x10000) >> 10),
 				0xdc00 | (uint16_t)(0x24b62 & 0x3ff),
 				0};
 	const wchar_t *t = (wchar_t *)t16;
@@ -1396,6 +1444,36 @@ static int test_ss_toupper(const char *a, const char *b)
 	return res;
 }
 
+static int test_ss_normalize(const char *in, const char *nfc, const char *nfd,
+			     const char *nfkc, const char *nfkd)
+{
+	int res;
+	srt_string *a = ss_dup_c(in), *b = ss_dup_c(in), *c = ss_dup_c(in),
+		   *d = ss_dup_c(in), *a0 = a;
+	ss_normalize_nfc(&a);
+	ss_normalize_nfd(&b);
+	ss_normalize_nfkc(&c);
+	ss_normalize_nfkd(&d);
+	res = (ss_cmp(a, ss_crefa(nfc)) ? 1 : 0)
+	      | (ss_cmp(b, ss_crefa(nfd)) ? 2 : 0)
+	      | (ss_cmp(c, ss_crefa(nfkc)) ? 4 : 0)
+	      | (ss_cmp(d, ss_crefa(nfkd)) ? 8 : 0)
+	      | (!strcmp(in, nfc) && a != a0 ? 16 : 0); /* no alloc if NFC */
+	ss_free(&a, &b, &c, &d);
+	return res;
+}
+
+static int test_ss_casefold(const char *in, const char *expected)
+{
+	int res;
+	srt_string *a = ss_dup_c(in), *a0 = a;
+	ss_casefold(&a);
+	res = (ss_cmp(a, ss_crefa(expected)) ? 1 : 0)
+	      | (!strcmp(in, expected) && a != a0 ? 2 : 0);
+	ss_free(&a);
+	return res;
+}
+
 static int test_ss_clear(const char *in)
 {
 	srt_string *sa = ss_dup_c(in);
@@ -1459,6 +1537,923 @@ static int test_ss_to_w(const char *in)
 	return res;
 }
 
+#define U8_FFFD "\xef\xbf\xbd"
+
+static int test_ss_utf16()
+{
+	size_t i, k, n = 0;
+	wchar_t w[8];
+	int res = 0;
+	srt_string *a = ss_alloca(1024), *b = NULL, *c = NULL, *d = NULL;
+	static const char *u8bad[][2] = {
+		{"a\xe4\xb8"
+		 "b",
+		 "a" U8_FFFD "b"},
+		{"\xc3"
+		 "A",
+		 U8_FFFD "A"},
+		{"\xc0\xaf", U8_FFFD U8_FFFD},
+		{"\xe0\x80\xaf", U8_FFFD U8_FFFD U8_FFFD},
+		{"\xed\xa0\x80", U8_FFFD U8_FFFD U8_FFFD},
+		{"\xf4\x90\x80\x80", U8_FFFD U8_FFFD U8_FFFD U8_FFFD},
+		{"\xd0"
+		 "A",
+		 U8_FFFD "A"},
+		{"\xed\xbf\xbf", U8_FFFD U8_FFFD U8_FFFD},
+		{"\xc1\x80", U8_FFFD U8_FFFD},
+		{"\xe0\x9f\x80", U8_FFFD U8_FFFD U8_FFFD},
+		{"\xf0\x8f\xbf\xbf", U8_FFFD U8_FFFD U8_FFFD U8_FFFD},
+		{"\xe4\xb8", U8_FFFD}};
+	/* Round trip crossing internal chunk boundaries */
+	for (i = 0; i < 100; i++)
+		ss_cat_c(&a, "abc" U8_C_N_TILDE_D1 U8_HAN_24B62);
+	ss_cpy_enc_utf16le(&b, a);
+	ss_cpy_dec_utf16le(&c, b);
+	res |= ss_size(b) == 100 * 12 ? 0 : 1;
+	res |= !ss_cmp(a, c) && ss_len_u(c) == 500 ? 0 : 2;
+	/* Unpaired surrogates are dropped, odd trailing byte ignored */
+	ss_cpy_dec_utf16le(&c, ss_refa_buf("\0\xd8\x61\0\x62", 5));
+	res |= !ss_cmp(c, ss_crefa("a")) ? 0 : 4;
+	ss_cpy_dec_utf16le(&c, ss_refa_buf("\x62\0\x62\xdc", 4));
+	res |= !ss_cmp(c, ss_crefa("b")) ? 0 : 8;
+	/* Broken UTF-8 is encoded as U+FFFD */
+	ss_cpy_enc_utf16le(&b, ss_crefa("\xff"));
+	res |= !ss_cmp(b, ss_refa_buf("\xfd\xff", 2)) ? 0 : 16;
+	/* Wide char output is limited by the output buffer units */
+	ss_cpy_c(&a, "hello");
+	res |= ss_to_w(a, w, 3, &n) && n == 2 && w[0] == 'h' && w[1] == 'e'
+			       && !w[2]
+		       ? 0
+		       : 32;
+	ss_cpy_c(&a, "a" U8_HAN_24B62 "b");
+	res |= ss_to_w(a, w, 8, &n) && n == (sizeof(wchar_t) == 2 ? 4 : 3)
+		       ? 0
+		       : 64;
+	ss_cpy_wn(&c, w, n);
+	res |= !ss_cmp(a, c) && ss_len_u(c) == 3 ? 0 : 128;
+	/*
+	 * Not valid UTF-8 (cut sequences, bad continuation bytes, overlong
+	 * forms, surrogates, above U+10FFFF): U+FFFD for every maximal
+	 * subpart, also in the middle of 2 and 3-byte sequence blocks
+	 */
+	for (i = 0; i < sizeof(u8bad) / sizeof(u8bad[0]); i++) {
+		ss_cpy_c(&a, "");
+		ss_cpy_c(&d, "");
+		for (k = 0; k < (i < 6 ? 1 : 20); k++) {
+			ss_cat_c(&a, i % 2 ? "\xd0\x96" : "\xe4\xb8\xad");
+			ss_cat_c(&d, i % 2 ? "\xd0\x96" : "\xe4\xb8\xad");
+			if (k == 9) {
+				ss_cat_c(&a, u8bad[i][0]);
+				ss_cat_c(&d, u8bad[i][1]);
+			}
+		}
+		ss_cpy_enc_utf16le(&b, a);
+		ss_cpy_enc_utf16le(&c, d);
+		res |= !ss_cmp(b, c) ? 0 : 256;
+		ss_cpy_dec_utf16le(&c, b);
+		res |= !ss_cmp(c, d) ? 0 : 512;
+	}
+	ss_free(&b, &c, &d);
+	return res;
+}
+
+/* Decoding "A-Za-z0-9+/" */
+static const char b64abc[] = "\x00\x10\x83\x10\x51\x87\x20\x92\x8b\x30\xd3\x8f"
+			     "\x41\x14\x93\x51\x55\x97\x61\x96\x9b\x71\xd7\x9f"
+			     "\x82\x18\xa3\x92\x59\xa7\xa2\x9a\xab\xb2\xdb\xaf"
+			     "\xc3\x1c\xb3\xd3\x5d\xb7\xe3\x9e\xbb\xf3\xdf\xbf";
+
+static int test_ss_b64()
+{
+	size_t i;
+	int res = 0;
+	char buf[100];
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0);
+	/* Round trip for every size (word-sized loops and tails) */
+	for (i = 0; i < sizeof(buf); i++)
+		buf[i] = (char)(i * 73 + 11);
+	for (i = 0; i <= sizeof(buf) && !res; i++) {
+		ss_cpy_cn(&a, buf, i);
+		ss_cpy_enc_b64(&b, a);
+		ss_cpy_dec_b64_strict(&c, b);
+		res |= ss_size(b) == (i + 2) / 3 * 4 && !ss_cmp(a, c) ? 0 : 1;
+		ss_cpy_enc_b64url(&b, a);
+		ss_cpy_dec_b64url_strict(&c, b);
+		res |= ss_size(b) == (i * 4 + 2) / 3 && !ss_cmp(a, c) ? 0 : 2;
+	}
+	/* Padding: required in strict base64, optional for the rest */
+	ss_cpy_dec_b64(&c, ss_crefa("QUI"));
+	res |= !ss_cmp(c, ss_crefa("AB")) ? 0 : 4;
+	ss_cpy_dec_b64_strict(&c, ss_crefa("QUI"));
+	res |= !ss_size(c) ? 0 : 8;
+	ss_cpy_dec_b64url_strict(&c, ss_crefa("QUI="));
+	res |= !ss_cmp(c, ss_crefa("AB")) ? 0 : 16;
+	/* Strict mode: invalid characters, size, padding, unused bits */
+	ss_cpy_dec_b64_strict(&c, ss_crefa("QUJDQUJD QUI="));
+	res |= !ss_size(c) ? 0 : 32;
+	ss_cpy_dec_b64_strict(&c, ss_crefa("QUJDQUJDQUJD\x80UJD"));
+	res |= !ss_size(c) ? 0 : 64;
+	ss_cpy_dec_b64_strict(&c, ss_crefa("QUI=="));
+	res |= !ss_size(c) ? 0 : 128;
+	ss_cpy_dec_b64_strict(&c, ss_crefa("QQ=A"));
+	res |= !ss_size(c) ? 0 : 256;
+	ss_cpy_dec_b64_strict(&c, ss_crefa("QUJ="));
+	res |= !ss_size(c) ? 0 : 512;
+	ss_cpy_dec_b64url_strict(&c, ss_crefa("QUJDQ"));
+	res |= !ss_size(c) ? 0 : 1024;
+	/* Alphabets are not mixed */
+	ss_cpy_dec_b64_strict(&c, ss_crefa("-_8="));
+	res |= !ss_size(c) ? 0 : 2048;
+	ss_cpy_dec_b64url_strict(&c, ss_crefa("+/8="));
+	res |= !ss_size(c) ? 0 : 4096;
+	/* Non-strict mode: invalid characters are decoded as zero */
+	ss_cpy_dec_b64(&c, ss_crefa("QUJD\xffUJDQUJD"));
+	res |= !ss_cmp(c, ss_crefa("ABC\x01" "BCABC")) ? 0 : 8192;
+	/* Concatenation of invalid input keeps the string unchanged */
+	ss_cpy_c(&c, "abc");
+	ss_cat_dec_b64_strict(&c, ss_crefa("QUJD!"));
+	res |= !ss_cmp(c, ss_crefa("abc")) ? 0 : 16384;
+	/* Whole alphabet, long enough for the SIMD loops (x86) */
+	ss_cpy_cn(&a, b64abc, 48);
+	ss_cat(&a, a);
+	ss_cat(&a, a);
+	ss_cpy_enc_b64(&b, a);
+	ss_cpy_c(&c, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+		     "0123456789+/");
+	ss_cat(&c, c);
+	ss_cat(&c, c);
+	res |= !ss_cmp(b, c) ? 0 : 1 << 15;
+	ss_cpy_dec_b64_strict(&b, c);
+	res |= !ss_cmp(a, b) ? 0 : 1 << 16;
+	ss_cpy_enc_b64url(&b, a);
+	ss_cpy_c(&c, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+		     "0123456789-_");
+	ss_cat(&c, c);
+	ss_cat(&c, c);
+	res |= !ss_cmp(b, c) ? 0 : 1 << 17;
+	ss_cpy_dec_b64url_strict(&b, c);
+	res |= !ss_cmp(a, b) ? 0 : 1 << 18;
+	/* In-place */
+	ss_cpy(&b, a);
+	ss_cpy_enc_b64(&b, b);
+	ss_cpy_dec_b64(&b, b);
+	res |= !ss_cmp(a, b) ? 0 : 1 << 19;
+	/* Invalid characters in every position */
+	ss_cpy_enc_b64(&b, a);
+	for (i = 0; i < ss_size(b) && !res; i++) {
+		ss_cpy(&c, b);
+		ss_get_buffer(c)[i] = '*';
+		ss_cpy_dec_b64_strict(&a, c);
+		res |= !ss_size(a) ? 0 : 1 << 20;
+		ss_cpy_dec_b64(&a, c);
+		ss_get_buffer(c)[i] = 'A';
+		ss_cpy_dec_b64(&c, c);
+		res |= ss_size(a) == 192 && !ss_cmp(a, c) ? 0 : 1 << 21;
+	}
+	ss_free(&a, &b, &c);
+	return res;
+}
+
+static int test_ss_hex()
+{
+	size_t i;
+	int res = 0;
+	char buf[40];
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0);
+	/* Round trip for every size (word-sized loops and tails) */
+	for (i = 0; i < sizeof(buf); i++)
+		buf[i] = (char)(i * 73 + 11);
+	for (i = 0; i <= sizeof(buf) && !res; i++) {
+		ss_cpy_cn(&a, buf, i);
+		ss_cpy_enc_hex(&b, a);
+		ss_cpy_dec_hex(&c, b);
+		res |= ss_size(b) == i * 2 && !ss_cmp(a, c) ? 0 : 1;
+		ss_cpy_enc_HEX(&b, a);
+		ss_cpy_dec_hex(&c, b);
+		res |= ss_size(b) == i * 2 && !ss_cmp(a, c) ? 0 : 2;
+	}
+	/* Mixed case, odd trailing character ignored */
+	ss_cpy_dec_hex(&c, ss_crefa("00fFaB09c"));
+	res |= !ss_cmp(c, ss_refa_buf("\x00\xff\xab\x09", 4)) ? 0 : 4;
+	/* Non-hex characters: no output, in both the 8-digit loop and tail */
+	ss_cpy_dec_hex(&c, ss_crefa("0123456g"));
+	res |= !ss_size(c) ? 0 : 8;
+	ss_cpy_dec_hex(&c, ss_crefa("01234567 9"));
+	res |= !ss_size(c) ? 0 : 16;
+	ss_cpy_dec_hex(&c, ss_crefa("01:3"));
+	res |= !ss_size(c) ? 0 : 32;
+	ss_cpy_dec_hex(&c, ss_crefa("0123\xb0\xb1"));
+	res |= !ss_size(c) ? 0 : 64;
+	ss_cpy_c(&c, "abc");
+	ss_cat_dec_hex(&c, ss_crefa("0x41"));
+	res |= !ss_cmp(c, ss_crefa("abc")) ? 0 : 128;
+	/* Every byte value, long enough for the SIMD loops (x86) */
+	ss_clear(a);
+	ss_clear(c);
+	for (i = 0; i < 256; i++) {
+		buf[0] = (char)i;
+		ss_cat_cn(&a, buf, 1);
+		sprintf(buf, "%02X", (unsigned)i);
+		ss_cat_c(&c, buf);
+	}
+	ss_cpy_enc_HEX(&b, a);
+	res |= !ss_cmp(b, c) ? 0 : 256;
+	ss_cpy_enc_hex(&b, a);
+	ss_tolower(&c);
+	res |= !ss_cmp(b, c) ? 0 : 512;
+	ss_cpy_dec_hex(&c, b);
+	res |= !ss_cmp(a, c) ? 0 : 1024;
+	/* In-place */
+	ss_cpy(&c, a);
+	ss_cpy_enc_hex(&c, c);
+	ss_cpy_dec_hex(&c, c);
+	res |= !ss_cmp(a, c) ? 0 : 2048;
+	/* Non-hex characters in every position */
+	for (i = 0; i < 128 && !res; i++) {
+		ss_cpy(&c, b);
+		ss_get_buffer(c)[i] = i % 2 ? 'g' : '/';
+		ss_cpy_dec_hex(&a, c);
+		res |= !ss_size(a) ? 0 : 4096;
+	}
+	ss_free(&a, &b, &c);
+	return res;
+}
+
+static int test_ss_esc()
+{
+	char buf[100];
+	size_t i, n = sizeof(buf);
+	int res = 0;
+	const char *x = "a\"b&c<d>e'f\\g\nh";
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0);
+	/* One escape in every position of a clean run (SIMD, words, tails) */
+	for (i = 0; i < sizeof(buf); i++)
+		buf[i] = (char)('a' + i % 26);
+	for (i = 0; i < sizeof(buf) && !res; i++) {
+		buf[i] = '"';
+		ss_cpy_cn(&a, buf, sizeof(buf));
+		ss_cpy_enc_esc_json(&b, a);
+		ss_cpy_dec_esc_json(&c, b);
+		res |= ss_size(b) == n + 1 && ss_at(b, i) == '\\'
+				       && !ss_cmp(a, c)
+			       ? 0
+			       : 1;
+		ss_cpy_enc_esc_xml(&b, a);
+		ss_cpy_dec_esc_xml(&c, b);
+		res |= ss_size(b) == n + 5 && ss_at(b, i + 5) == ';'
+				       && !ss_cmp(a, c)
+			       ? 0
+			       : 2;
+		ss_cpy_enc_esc_url(&b, a);
+		ss_cpy_dec_esc_url(&c, b);
+		res |= ss_size(b) == n + 2 && ss_at(b, i) == '%' && !ss_cmp(a, c)
+			       ? 0
+			       : 4;
+		ss_cpy_enc_esc_dquote(&b, a);
+		ss_cpy_dec_esc_dquote(&c, b);
+		res |= ss_size(b) == n + 1 && ss_at(b, i + 1) == '"'
+				       && !ss_cmp(a, c)
+			       ? 0
+			       : 8;
+		buf[i] = (char)('a' + i % 26);
+	}
+	/* In-place escaping and unescaping (aliasing) */
+	ss_cpy_c(&a, x);
+	ss_cat(&a, a, a, a);
+	ss_cpy(&c, a);
+	ss_cpy_enc_esc_json(&a, a);
+	res |= ss_size(a) == ss_size(c) + 4 * 3 ? 0 : 16;
+	ss_cpy_dec_esc_json(&a, a);
+	res |= !ss_cmp(a, c) ? 0 : 32;
+	ss_cpy_enc_esc_xml(&a, a);
+	ss_cpy_dec_esc_xml(&a, a);
+	res |= !ss_cmp(a, c) ? 0 : 64;
+	/* Not terminated escapes at the end are kept */
+	ss_cpy_dec_esc_xml(&b, ss_crefa("0123456789&amp"));
+	res |= !ss_cmp(b, ss_crefa("0123456789&amp")) ? 0 : 128;
+	ss_cpy_dec_esc_json(&b, ss_crefa("0123456789\\"));
+	res |= !ss_cmp(b, ss_crefa("0123456789\\")) ? 0 : 256;
+	/* Bytes >= 128: escaped for URL only */
+	memset(buf, 0xc3, sizeof(buf));
+	ss_cpy_cn(&a, buf, sizeof(buf));
+	ss_cpy_enc_esc_json(&b, a);
+	res |= !ss_cmp(a, b) ? 0 : 512;
+	ss_cpy_enc_esc_xml(&b, a);
+	res |= !ss_cmp(a, b) ? 0 : 1024;
+	ss_cpy_enc_esc_url(&b, a);
+	ss_cpy_dec_esc_url(&c, b);
+	res |= ss_size(b) == n * 3 && !ss_cmp(a, c) ? 0 : 2048;
+	ss_free(&a, &b, &c);
+	return res;
+}
+
+static int test_ss_codec()
+{
+	size_t i, j, n;
+	int res = 0, k;
+	srt_codec *c;
+	srt_string *in = ss_alloc(0), *out = ss_alloc(0), *ref = ss_alloc(0),
+		   *z = ss_alloc(0), *chunk = ss_alloc(0), *fixed = ss_alloca(8);
+	static const enum eSCodec t[] = {
+		SC_ENC_B64,	SC_DEC_B64,	 SC_ENC_B64URL,	  SC_DEC_B64URL,
+		SC_ENC_HEX,	SC_ENC_HEX_UPPER, SC_DEC_HEX,	  SC_ENC_ESC_XML,
+		SC_DEC_ESC_XML, SC_ENC_ESC_JSON, SC_DEC_ESC_JSON, SC_ENC_ESC_URL,
+		SC_DEC_ESC_URL};
+	static const char *src[] = {
+		"aGVsbG8gd29ybGQh",  "aGVsbG8gd29ybGQh",  "hello world!",
+		"aGVsbG8_d29y-GQ",   "hello world!",	  "hello world!",
+		"68656c6c6f20776f",  "a<b>&\"c'd\"",	  "&lt;a&amp;b&quot;",
+		"a\"b\\c\nd",	     "\\n\\\"x\\\\",	  "a b%c&d",
+		"a%20b%25c%26d"};
+	/* Same output as the one-shot codecs, for any chunk size */
+	for (k = 0; k < (int)(sizeof(t) / sizeof(t[0])); k++) {
+		ss_cpy_c(&in, src[k]);
+		switch (t[k]) {
+		case SC_ENC_B64: ss_cpy_enc_b64(&ref, in); break;
+		case SC_DEC_B64: ss_cpy_dec_b64(&ref, in); break;
+		case SC_ENC_B64URL: ss_cpy_enc_b64url(&ref, in); break;
+		case SC_DEC_B64URL: ss_cpy_dec_b64url(&ref, in); break;
+		case SC_ENC_HEX: ss_cpy_enc_hex(&ref, in); break;
+		case SC_ENC_HEX_UPPER: ss_cpy_enc_HEX(&ref, in); break;
+		case SC_DEC_HEX: ss_cpy_dec_hex(&ref, in); break;
+		case SC_ENC_ESC_XML: ss_cpy_enc_esc_xml(&ref, in); break;
+		case SC_DEC_ESC_XML: ss_cpy_dec_esc_xml(&ref, in); break;
+		case SC_ENC_ESC_JSON: ss_cpy_enc_esc_json(&ref, in); break;
+		case SC_DEC_ESC_JSON: ss_cpy_dec_esc_json(&ref, in); break;
+		case SC_ENC_ESC_URL: ss_cpy_enc_esc_url(&ref, in); break;
+		default: ss_cpy_dec_esc_url(&ref, in); break;
+		}
+		for (n = 1; n <= 5; n++) {
+			c = ss_codec_alloc(t[k]);
+			ss_clear(out);
+			for (i = 0; i < ss_size(in); i += n) {
+				ss_cpy_substr(&chunk, in, i, n);
+				ss_codec_update(&out, c, chunk);
+			}
+			ss_codec_final(&out, c);
+			if (ss_cmp(out, ref) || ss_codec_error(c))
+				res |= 1 << k;
+			ss_codec_free(&c);
+		}
+	}
+	/* LZ: more than one block, decoded in chunks not aligned to blocks */
+	ss_reserve(&in, (2 << 20) + 1000);
+	ss_clear(in);
+	for (i = 0; i < (2 << 20) + 1000; i++)
+		ss_cat_char(&in, (int)('a' + (i * i) % 7));
+	c = ss_codec_alloc(SC_ENC_LZ);
+	ss_clear(z);
+	for (i = 0; i < ss_size(in); i += 100000) {
+		ss_cpy_substr(&chunk, in, i, 100000);
+		ss_codec_update(&z, c, chunk);
+	}
+	ss_codec_final(&z, c);
+	ss_codec_free(&c);
+	c = ss_codec_alloc(SC_DEC_LZ);
+	ss_clear(out);
+	for (i = 0, j = 1; i < ss_size(z); i += j, j = j * 3 + 1) {
+		ss_cpy_substr(&chunk, z, i, j);
+		ss_codec_update(&out, c, chunk);
+	}
+	ss_codec_final(&out, c);
+	res |= !ss_cmp(in, out) && !ss_codec_error(c) ? 0 : 1 << 14;
+	ss_codec_free(&c);
+	/* LZ: 1-byte last block (3 bytes once encoded) */
+	for (n = 1; n <= (1 << 20) + 1; n += 1 << 20) {
+		ss_cpy_substr(&ref, in, 0, n);
+		c = ss_codec_alloc(SC_ENC_LZ);
+		ss_clear(chunk);
+		ss_codec_update(&chunk, c, ref);
+		ss_codec_final(&chunk, c);
+		ss_codec_free(&c);
+		c = ss_codec_alloc(SC_DEC_LZ);
+		ss_clear(out);
+		ss_codec_update(&out, c, chunk);
+		ss_codec_final(&out, c);
+		res |= !ss_cmp(ref, out) && !ss_codec_error(c) ? 0 : 1 << 17;
+		ss_codec_free(&c);
+	}
+	/* Truncated LZ stream */
+	c = ss_codec_alloc(SC_DEC_LZ);
+	ss_cpy_substr(&chunk, z, 0, ss_size(z) - 1);
+	ss_codec_update(&out, c, chunk);
+	ss_codec_final(&out, c);
+	res |= ss_codec_error(c) ? 0 : 1 << 15;
+	ss_codec_free(&c);
+	/* Invalid hex digit in a later chunk */
+	c = ss_codec_alloc(SC_DEC_HEX);
+	ss_clear(out);
+	ss_codec_update(&out, c, ss_crefa("414"));
+	ss_codec_update(&out, c, ss_crefa("2zz"));
+	ss_codec_final(&out, c);
+	res |= ss_codec_error(c) ? 0 : 1 << 16;
+	ss_codec_free(&c);
+	/* Output not growable (e.g. out of memory) */
+	c = ss_codec_alloc(SC_ENC_ESC_XML);
+	ss_codec_update(&fixed, c, ss_crefa("<a>"));
+	res |= ss_codec_error(c) && ss_size(fixed) == 0 ? 0 : 1 << 18;
+	ss_codec_free(&c);
+	ss_free(&in, &out, &ref, &z, &chunk);
+	return res;
+}
+
+static int test_ss_lz_level()
+{
+	int res = 0, level;
+	size_t i, s0 = 0;
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0);
+	for (i = 0; i < 50000; i++)
+		ss_cat_char(&a, (int)(i % 2000 < 1500 ? 'a' + (i * i) % 11
+						      : (i * 7919) % 251));
+	/* Out of range levels are clamped (same format for every level) */
+	for (level = -1; level <= S_LZ_LEVEL_MAX + 1; level++) {
+		ss_enc_lz_level(&b, a, level);
+		ss_dec_lz(&c, b);
+		res |= !ss_cmp(a, c) ? 0 : 1;
+		if (level == 0)
+			s0 = ss_size(b);
+	}
+	/* Higher level, not worse compression */
+	res |= ss_size(b) > 0 && ss_size(b) <= s0 ? 0 : 2;
+	res |= ss_size(ss_enc_lz_level(&b, a, 1)) == ss_size(ss_enc_lzh(&c, a))
+		       ? 0
+		       : 4;
+	/* Aliasing, and empty input */
+	ss_cpy(&b, a);
+	ss_enc_lz_level(&b, b, 6);
+	ss_dec_lz(&b, b);
+	res |= !ss_cmp(a, b) ? 0 : 8;
+	ss_enc_lz_level(&b, ss_void, 9);
+	ss_dec_lz(&c, b);
+	res |= ss_size(c) == 0 ? 0 : 16;
+	ss_free(&a, &b, &c);
+	return res;
+}
+
+static int test_ss_lz_ctx()
+{
+	int res = 0;
+	size_t i, j;
+	const size_t sizes[] = {0, 1, 7, 8, 9, 200, 1000, 4096, 20000};
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0),
+		   *d = ss_alloc(0);
+	srt_lz_ctx *x = ss_lz_ctx_alloc(0), *y = ss_lz_ctx_alloc(10);
+	if (!x || !y) {
+		res = 1;
+	} else {
+		for (i = 0; i < 20000; i++)
+			ss_cat_char(&a, (int)(i % 300 < 200 ? 'a' + (i * i) % 9
+							    : (i * 7919) % 251));
+		for (j = 0; j < 3; j++)
+			for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+				ss_cpy_substr(&b, a, i * 7, sizes[i]);
+				ss_enc_lz_ctx(&c, b, x);
+				ss_dec_lz(&d, c);
+				res |= !ss_cmp(b, d) ? 0 : 2;
+				ss_enc_lz_ctx(&d, b, y);
+				ss_dec_lz(&d, d); /* aliasing */
+				res |= !ss_cmp(b, d) ? 0 : 4;
+			}
+		/* Output depends only on the input (not on previous calls) */
+		ss_enc_lz_ctx(&c, a, x);
+		ss_lz_ctx_free(&x);
+		x = ss_lz_ctx_alloc(0);
+		ss_enc_lz_ctx(&d, a, x);
+		res |= !ss_cmp(c, d) ? 0 : 8;
+		/* Append mode, and NULL context (same as ss_enc_lz()) */
+		ss_cpy_c(&d, "abc");
+		ss_cat_enc_lz_ctx(&d, a, x);
+		res |= ss_size(d) == ss_size(c) + 3
+			       && !memcmp(ss_get_buffer_r(d) + 3,
+					  ss_get_buffer_r(c), ss_size(c))
+			       ? 0
+			       : 16;
+		ss_enc_lz_ctx(&c, a, NULL);
+		res |= !ss_cmp(c, ss_enc_lz(&d, a)) ? 0 : 32;
+	}
+	ss_lz_ctx_free(&x);
+	ss_lz_ctx_free(&y);
+	res |= !x && !y ? 0 : 64;
+	ss_free(&a, &b, &c, &d);
+	return res;
+}
+
+static int test_ss_lz_dict()
+{
+	int res = 0;
+	size_t i, n = 0, sizes[200], plain = 0, primed = 0;
+	char r[128];
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0),
+		   *d = ss_alloc(0);
+	srt_lz_dict *x = NULL, *y = NULL;
+	for (; n < 200; n++) {
+		sizes[n] = (size_t)sprintf(
+			r,
+			"{\"level\":\"%s\",\"host\":\"node-%u.example."
+			"net\",\"status\":%u,\"latency_ms\":%u}",
+			n % 3 ? "INFO" : "WARN", (unsigned)(n % 17),
+			n % 5 ? 200 : 503, (unsigned)(n * 7919) % 1000);
+		ss_cat_cn(&a, r, sizes[n]);
+	}
+	ss_lz_dict_train(&b, a, sizes, n, 1024);
+	res |= ss_size(b) > 0 && ss_size(b) <= 1024 ? 0 : 1;
+	x = ss_lz_dict_alloc(b);
+	ss_cat_c(&b, "x");
+	y = ss_lz_dict_alloc(b);
+	if (!x || !y) {
+		res |= 2;
+	} else {
+		res |= ss_lz_dict_id(x) != ss_lz_dict_id(y) ? 0 : 4;
+		for (i = 0; i < 50; i++) {
+			ss_printf(&b, 128,
+				  "{\"level\":\"INFO\",\"host\":\"node-%u."
+				  "example.net\",\"status\":200,\"latency_"
+				  "ms\":%u}",
+				  (unsigned)(i % 13), (unsigned)(i * 31));
+			ss_enc_lz_dict(&c, b, x);
+			primed += ss_size(c);
+			ss_dec_lz_dict(&d, c, x);
+			res |= !ss_cmp(b, d) ? 0 : 8;
+			ss_dec_lz_dict(&c, c, x); /* aliasing */
+			res |= !ss_cmp(b, c) ? 0 : 16;
+			plain += ss_size(ss_enc_lz(&c, b));
+		}
+		res |= primed * 2 < plain ? 0 : 32;
+		/* Other dictionary: no output */
+		ss_enc_lz_dict(&c, b, x);
+		ss_dec_lz_dict(&d, c, y);
+		res |= ss_size(d) == 0 ? 0 : 64;
+		ss_enc_lz_dict(&c, ss_void, x);
+		ss_dec_lz_dict(&d, c, x);
+		res |= ss_size(d) == 0 ? 0 : 128;
+	}
+	/* Sample sizes not matching the samples */
+	sizes[0] += ss_size(a);
+	ss_lz_dict_train(&b, a, sizes, n, 1024);
+	res |= ss_size(b) == 0 ? 0 : 256;
+	ss_lz_dict_free(&x);
+	ss_lz_dict_free(&y);
+	res |= !x && !y ? 0 : 512;
+	ss_free(&a, &b, &c, &d);
+	return res;
+}
+
+static int test_ss_delta()
+{
+	int res = 0;
+	size_t i;
+	uint32_t r = 1;
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0),
+		   *d = ss_alloc(0);
+	/* Not compressible base, with sparse changes */
+	for (i = 0; i < 65536; i++) {
+		r = r * 1103515245 + 12345;
+		ss_cat_cn(&a, (const char *)&r + 2, 1);
+	}
+	ss_cpy(&b, a);
+	for (i = 500; i < 65536; i += 1000)
+		ss_get_buffer(b)[i] ^= 0x5a;
+	ss_enc_delta(&c, a, b);
+	res |= ss_size(c) > 0 && ss_size(c) < 1024 ? 0 : 1;
+	ss_dec_delta(&d, a, c);
+	res |= !ss_cmp(b, d) ? 0 : 2;
+	/* Insertion, deletion, and appended data */
+	ss_cpy_cn(&b, ss_get_buffer_r(a), 20000);
+	ss_cat_c(&b, "inserted data, inserted data");
+	ss_cat_cn(&b, ss_get_buffer_r(a) + 30000, 35536);
+	ss_cat(&b, b);
+	ss_enc_delta(&c, a, b);
+	res |= ss_size(c) > 0 && ss_size(c) < 256 ? 0 : 4;
+	ss_dec_delta(&d, a, c);
+	res |= !ss_cmp(b, d) ? 0 : 8;
+	/* Other base: no output */
+	ss_cat_c(&a, "x");
+	ss_dec_delta(&d, a, c);
+	res |= ss_size(d) == 0 ? 0 : 16;
+	/* Empty base or target */
+	ss_enc_delta(&c, ss_void, b);
+	ss_dec_delta(&d, ss_void, c);
+	res |= ss_size(c) > 0 && !ss_cmp(b, d) ? 0 : 32;
+	ss_enc_delta(&c, a, ss_void);
+	ss_dec_delta(&d, a, c);
+	res |= ss_size(c) == 0 && ss_size(d) == 0 ? 0 : 64;
+	/* Aliasing */
+	ss_cpy(&d, a);
+	ss_enc_delta(&c, a, b);
+	ss_enc_delta(&d, d, b);
+	res |= !ss_cmp(c, d) ? 0 : 128;
+	ss_dec_delta(&c, a, c);
+	res |= !ss_cmp(b, c) ? 0 : 256;
+	ss_free(&a, &b, &c, &d);
+	return res;
+}
+
+static int test_ss_lze()
+{
+	int res = 0, level;
+	size_t i;
+	const size_t sizes[] = {1, 7, 8, 9, 100, 1000, 50000};
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0),
+		   *d = ss_alloc(0);
+	for (i = 0; i < 50000; i++)
+		ss_cat_char(&a, (int)(i % 2000 < 1500 ? 'a' + (i * i) % 11
+						      : (i * 7919) % 251));
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+		for (level = 0; level <= S_LZ_LEVEL_MAX; level += 3) {
+			ss_cpy_substr(&b, a, i, sizes[i]);
+			ss_enc_lze(&c, b, level);
+			ss_dec_lze(&d, c);
+			res |= !ss_cmp(b, d) ? 0 : 1;
+		}
+	/* Better compression than LZ with the same level */
+	res |= ss_size(ss_enc_lze(&b, a, 0)) < ss_size(ss_enc_lz(&c, a))
+		       && ss_size(ss_enc_lze(&b, a, 9))
+				  < ss_size(ss_enc_lz_level(&c, a, 9))
+		       ? 0
+		       : 2;
+	/* Several blocks, and framed LZ with entropy-coded blocks */
+	ss_cpy(&b, a);
+	for (i = 0; i < 5; i++)
+		ss_cat(&b, b);
+	ss_enc_lze(&c, b, 0);
+	ss_dec_lze(&d, c);
+	res |= !ss_cmp(b, d) ? 0 : 4;
+	ss_enc_lzf(&c, a, 0, S_LZF_CRC32 | S_LZF_ENTROPY, 2);
+	ss_dec_lzf(&d, c, 2);
+	ss_enc_lzf(&b, a, 0, S_LZF_CRC32, 2);
+	res |= !ss_cmp(a, d) && ss_size(c) < ss_size(b) ? 0 : 8;
+	/* Aliasing, empty input, and truncated input */
+	ss_cpy(&b, a);
+	ss_enc_lze(&b, b, 2);
+	ss_cpy_substr(&c, b, 0, ss_size(b) - 1);
+	ss_dec_lze(&b, b);
+	res |= !ss_cmp(a, b) ? 0 : 16;
+	ss_enc_lze(&b, ss_void, 0);
+	ss_dec_lze(&d, b);
+	res |= ss_size(b) == 0 && ss_size(d) == 0 ? 0 : 32;
+	ss_dec_lze(&d, c);
+	res |= ss_size(d) == 0 ? 0 : 64;
+	ss_free(&a, &b, &c, &d);
+	return res;
+}
+
+static int test_ss_lzf()
+{
+	size_t i, j;
+	int res = 0, flags;
+	srt_codec *z;
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0),
+		   *d = ss_alloc(0);
+	for (i = 0; i < 100000; i++)
+		ss_cat_char(&a, (int)(i % 1000 < 500 ? 'a' + (i * i) % 7
+						     : (i * 7919) % 251));
+	for (flags = 0; flags < 8; flags++) {
+		/* Same output, regardless of the number of threads */
+		ss_enc_lzf(&b, a, 4000, flags, 1);
+		ss_enc_lzf(&c, a, 4000, flags, 4);
+		res |= ss_size(b) > 0 && ss_size(b) < ss_size(a) && !ss_cmp(b, c)
+			       ? 0
+			       : 1;
+		ss_dec_lzf(&d, b, 3);
+		res |= !ss_cmp(a, d) ? 0 : 2;
+	}
+	/* One block, in-place (aliasing), and empty input */
+	ss_cpy(&b, a);
+	ss_enc_lzf(&b, b, 0, S_LZF_CRC32, 2);
+	ss_dec_lzf(&b, b, 2);
+	res |= !ss_cmp(a, b) ? 0 : 4;
+	ss_enc_lzf(&b, ss_void, 0, S_LZF_CRC32, 2);
+	ss_dec_lzf(&c, b, 2);
+	res |= ss_size(b) > 0 && ss_size(c) == 0 ? 0 : 8;
+	/* Not valid input: corrupted data (CRC-32 error), and truncated */
+	ss_enc_lzf(&b, a, 1000, S_LZF_CRC32, 1);
+	ss_dec_lzf(&c, b, 1);
+	res |= !ss_cmp(a, c) ? 0 : 16;
+	ss_cpy(&c, b);
+	ss_get_buffer(c)[ss_size(c) / 2] ^= 0x10;
+	ss_dec_lzf(&d, c, 4);
+	res |= ss_size(d) == 0 ? 0 : 32;
+	ss_cpy_substr(&c, b, 0, ss_size(b) - 1);
+	ss_dec_lzf(&d, c, 4);
+	res |= ss_size(d) == 0 ? 0 : 64;
+	/* Streaming: one frame every 3 blocks, input in any chunk size */
+	z = ss_codec_alloc_lzf(SC_ENC_LZF, 3000, S_LZF_CRC32 | S_LZF_INDEX, 3);
+	ss_clear(b);
+	for (i = 0; i < ss_size(a); i += 7777) {
+		ss_cpy_substr(&c, a, i, 7777);
+		ss_codec_update(&b, z, c);
+	}
+	ss_codec_final(&b, z);
+	res |= !ss_codec_error(z) ? 0 : 128;
+	ss_codec_free(&z);
+	ss_cpy_substr(&c, a, 0, 9000);
+	ss_enc_lzf(&d, c, 3000, S_LZF_CRC32 | S_LZF_INDEX, 1);
+	res |= !ss_ncmp(b, 0, d, ss_size(d)) ? 0 : 256;
+	z = ss_codec_alloc_lzf(SC_DEC_LZF, 0, 0, 2);
+	ss_clear(d);
+	for (i = 0, j = 1; i < ss_size(b); i += j, j = j * 2 + 1) {
+		ss_cpy_substr(&c, b, i, j);
+		ss_codec_update(&d, z, c);
+	}
+	ss_codec_final(&d, z);
+	res |= !ss_cmp(a, d) && !ss_codec_error(z) ? 0 : 512;
+	/* Concatenated frames: one-shot and range decoding */
+	ss_dec_lzf(&d, b, 4);
+	res |= !ss_cmp(a, d) ? 0 : 1024;
+	ss_dec_lz_range(&d, b, 8000, 20000);
+	ss_cpy_substr(&c, a, 8000, 20000);
+	res |= !ss_cmp(c, d) ? 0 : 2048;
+	/* Truncated stream, and not valid frame after the first one */
+	ss_cpy_substr(&c, b, 0, ss_size(b) - 1);
+	ss_codec_update(&d, z, c);
+	ss_codec_final(&d, z);
+	res |= ss_codec_error(z) ? 0 : 4096;
+	ss_codec_free(&z);
+	z = ss_codec_alloc_lzf(SC_DEC_LZF, 0, 0, 2);
+	ss_cpy(&c, b);
+	ss_cat_c(&c, "sLZX");
+	ss_clear(d);
+	ss_codec_update(&d, z, c);
+	res |= ss_codec_error(z) && ss_size(d) == 0 ? 0 : 8192;
+	ss_dec_lzf(&d, c, 1);
+	res |= ss_size(d) == 0 ? 0 : 16384;
+	ss_codec_free(&z);
+	ss_free(&a, &b, &c, &d);
+	return res;
+}
+
+/*
+ * Not valid input: short inputs (incomplete size header), and corrupted
+ * streams, decoded from/into exact-size buffers plus an output guard area
+ */
+static int test_ss_lz_corrupted()
+{
+	int res = 0;
+	uint8_t *in, *o;
+	size_t i, j, n, max_size;
+	const size_t guard = 64;
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0);
+	for (n = 1; n <= 9; n++)
+		for (i = 0; i < 256; i++) {
+			in = (uint8_t *)s_malloc(n);
+			if (!in) {
+				res |= 1;
+				break;
+			}
+			memset(in, 0xff, n);
+			in[0] = (uint8_t)i;
+			sdec_lz(in, n, NULL);
+			sdec_lze(in, n, NULL);
+			s_free(in);
+		}
+	for (i = 0; i < 3000; i++)
+		ss_cat_char(&a, (int)(i % 1000 < 500 ? 'a' + (i % 23) * 7 % 26
+						     : (i * 7919) % 251));
+	ss_enc_lz(&b, a);
+	for (i = 0; i < ss_size(b) && !res; i++) {
+		n = ss_size(b);
+		in = (uint8_t *)s_malloc(n);
+		if (!in) {
+			res |= 1;
+			break;
+		}
+		memcpy(in, ss_get_buffer_r(b), n);
+		in[i] ^= (uint8_t)(0x5a + i);
+		max_size = sdec_lz(in, n, NULL);
+		o = max_size <= 1000000
+			    ? (uint8_t *)s_malloc(max_size + guard)
+			    : NULL;
+		if (o) {
+			memset(o + max_size, 0xa5, guard);
+			res |= sdec_lz(in, n, o) <= max_size - 16 ? 0 : 2;
+			for (j = 0; j < guard; j++)
+				res |= o[max_size + j] == 0xa5 ? 0 : 4;
+			s_free(o);
+		}
+		s_free(in);
+	}
+	/* Framed, with parallel decoding */
+	ss_enc_lzf(&b, a, 1000, 0, 1);
+	for (i = 0; i < ss_size(b); i++) {
+		ss_cpy(&c, b);
+		ss_get_buffer(c)[i] ^= (char)(0x5a + i);
+		ss_dec_lzf(&c, c, 3);
+		ss_cpy_substr(&c, b, 0, i);
+		ss_dec_lzf(&c, c, 3);
+	}
+	ss_free(&a, &b, &c);
+	return res;
+}
+
+static int test_ss_lz_range()
+{
+	int res = 0;
+	size_t i, j;
+	const int flags[] = {0, S_LZF_INDEX,
+			     S_LZF_INDEX | S_LZF_CRC32 | S_LZF_ENTROPY};
+	const size_t r[][2] = {{0, 1},	   {0, 4000},	 {3999, 2},
+			       {4000, 4000}, {12345, 10000}, {99995, 100},
+			       {0, S_NPOS}};
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0),
+		   *d = ss_alloc(0);
+	for (i = 0; i < 100000; i++)
+		ss_cat_char(&a, (int)(i % 1000 < 500 ? 'a' + (i * i) % 7
+						     : 'a' + (i * 7919) % 26));
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		ss_enc_lzf(&b, a, 4000, flags[i], 2);
+		ss_dec_lzf(&c, b, 2);
+		res |= !ss_cmp(a, c) ? 0 : 1;
+		for (j = 0; j < sizeof(r) / sizeof(r[0]); j++) {
+			ss_dec_lz_range(&c, b, r[j][0], r[j][1]);
+			ss_cpy_substr(&d, a, r[j][0], r[j][1]);
+			res |= ss_size(c) > 0 && !ss_cmp(c, d) ? 0 : 2;
+		}
+		/* Out of range */
+		ss_dec_lz_range(&c, b, ss_size(a), 10);
+		res |= ss_size(c) == 0 ? 0 : 4;
+	}
+	/* Input reference (e.g. memory-mapped file), and aliasing */
+	ss_dec_lz_range(&c, ss_refa_buf(ss_get_buffer_r(b), ss_size(b)), 50000,
+			3);
+	ss_dec_lz_range(&b, b, 50000, 3);
+	res |= !ss_cmp(c, ss_cpy_substr(&d, a, 50000, 3)) && !ss_cmp(b, d)
+		       ? 0
+		       : 8;
+	/* Not valid block index */
+	ss_enc_lzf(&b, a, 4000, S_LZF_INDEX, 1);
+	ss_get_buffer(b)[ss_size(b) - 8] ^= 1;
+	ss_dec_lzf(&c, b, 1);
+	res |= ss_size(c) == 0 ? 0 : 16;
+	/* Truncated frame without block index */
+	ss_enc_lzf(&b, a, 4000, 0, 1);
+	ss_cpy_substr(&c, b, 0, ss_size(b) / 2);
+	ss_dec_lz_range(&d, c, 90000, 10);
+	res |= ss_size(d) == 0 ? 0 : 32;
+	/* Periodic data (long overlapped references), partial blocks */
+	for (j = 9; j <= 200; j += 19) {
+		ss_clear(a);
+		for (i = 0; i < 20000; i++)
+			ss_cat_char(&a, (int)('a' + (i % j) * 7 % 26));
+		ss_enc_lzf(&b, a, 4000, 0, 1);
+		for (i = 0; i < 20000; i += 3999) {
+			ss_dec_lz_range(&c, b, i, 4001);
+			ss_cpy_substr(&d, a, i, 4001);
+			res |= !ss_cmp(c, d) ? 0 : 64;
+		}
+	}
+	ss_free(&a, &b, &c, &d);
+	return res;
+}
+
+/*
+ * Periodic data (long overlapped references) decoded into a buffer of the
+ * size given by the decoder, plus a guard area that must stay untouched
+ */
+static int test_ss_lz_periodic()
+{
+	int res = 0;
+	uint8_t *o;
+	const uint8_t *e;
+	size_t i, p, n, k, max_size;
+	const size_t guard = 64;
+	size_t (*dec)(const uint8_t *, const size_t, uint8_t *);
+	srt_string *a = ss_alloc(0), *b = ss_alloc(0), *c = ss_alloc(0);
+	for (p = 1; p <= 200 && !res; p++) {
+		n = 1000 + p * 3;
+		ss_clear(a);
+		for (i = 0; i < n; i++)
+			ss_cat_char(&a, (int)('a' + (i % p) * 7 % 26));
+		for (k = 0; k < 3; k++) {
+			if (k < 2)
+				ss_enc_lz_level(&b, a, k == 0 ? 0 : 9);
+			else
+				ss_enc_lze(&b, a, 0);
+			dec = k < 2 ? sdec_lz : sdec_lze;
+			e = (const uint8_t *)ss_get_buffer_r(b);
+			max_size = dec(e, ss_size(b), NULL);
+			o = (uint8_t *)s_malloc(max_size + guard);
+			if (!o) {
+				res |= 1;
+				break;
+			}
+			memset(o + max_size, 0xa5, guard);
+			i = dec(e, ss_size(b), o);
+			res |= i == n && !memcmp(o, ss_get_buffer_r(a), n) ? 0
+									   : 2;
+			for (i = 0; i < guard; i++)
+				res |= o[max_size + i] == 0xa5 ? 0 : 4;
+			s_free(o);
+			if (k < 2)
+				ss_dec_lz(&c, b);
+			else
+				ss_dec_lze(&c, b);
+			res |= !ss_cmp(a, c) ? 0 : 8;
+		}
+	}
+	ss_free(&a, &b, &c);
+	return res;
+}
+
 static int test_ss_find(const char *a, const char *b, const size_t expected_loc)
 {
 	srt_string *sa = ss_dup_c(a), *sb = ss_dup_c(b);
@@ -1521,6 +2516,194 @@ static int test_ss_split()
 	return res;
 }
 
+static int test_ss_edit_distance(const char *a, const char *b,
+				  const size_t expected_b,
+				  const size_t expected_u)
+{
+	const srt_string *sa = ss_crefa(a), *sb = ss_crefa(b);
+	int res = 0;
+	if (ss_edit_distance(sa, sb) != expected_b
+	    || ss_edit_distance(sb, sa) != expected_b)
+		res |= 1;
+	if (ss_edit_distance_u(sa, sb) != expected_u
+	    || ss_edit_distance_u(sb, sa) != expected_u)
+		res |= 2;
+	if (ss_edit_distance_k(sa, sb, expected_b) != expected_b
+	    || (expected_b > 0
+		&& ss_edit_distance_k(sa, sb, expected_b - 1) != S_NPOS))
+		res |= 4;
+	if (ss_edit_distance_k_u(sa, sb, expected_u) != expected_u
+	    || (expected_u > 0
+		&& ss_edit_distance_k_u(sa, sb, expected_u - 1) != S_NPOS))
+		res |= 8;
+	return res;
+}
+
+static int test_ss_find_fuzzy(const char *s, const char *t,
+			      const size_t max_dist, const srt_bool utf8,
+			      const size_t expected_loc,
+			      const char *expected_match)
+{
+	size_t loc, ms = 0;
+	const srt_string *ss = ss_crefa(s), *st = ss_crefa(t);
+	int res = 0;
+	loc = utf8 ? ss_find_fuzzy_u(ss, 0, st, max_dist, &ms)
+		   : ss_find_fuzzy(ss, 0, st, max_dist, &ms);
+	if (loc != expected_loc)
+		res |= 1;
+	else if (loc != S_NPOS
+		 && (ms != strlen(expected_match)
+		     || memcmp(s + loc, expected_match, ms)))
+		res |= 2;
+	return res;
+}
+
+static int test_ss_edit_distance_long()
+{
+	size_t i;
+	srt_string *a = ss_alloc(300), *b = ss_alloc(300);
+	int res = 0;
+	for (i = 0; i < 300; i++)
+		ss_cat_char(&a, (char)('a' + i % 23));
+	ss_cpy(&b, a);
+	ss_erase(&b, 250, 1);
+	ss_erase(&b, 100, 1);
+	ss_cat_c(&b, "xy");
+	ss_get_buffer(b)[5] = '#';
+	if (ss_edit_distance(a, b) != 5 || ss_edit_distance_u(a, b) != 5
+	    || ss_edit_distance_k(a, b, 4) != S_NPOS)
+		res |= 1;
+	if (ss_find_fuzzy(a, 0, ss_crefa("qrsuvw"), 1, NULL) != 16
+	    || ss_find_fuzzy(a, 20, ss_crefa("qrsuvw"), 1, NULL) != 39
+	    || ss_find_fuzzy(b, 0, a, 2, NULL) != S_NPOS
+	    || ss_find_fuzzy(b, 0, a, 3, NULL) != 0)
+		res |= 2;
+	ss_free(&a, &b);
+	return res;
+}
+
+static int test_ss_regex_find(const char *pattern, const char *in,
+			      const size_t off, const size_t expected_loc,
+			      const char *expected_g0, const char *expected_g1)
+{
+	srt_string_ref caps[3];
+	srt_regex *r = ss_regex_alloc(ss_crefa(pattern));
+	const srt_string *s = ss_crefa(in);
+	size_t loc;
+	int res = 0;
+	if (!r)
+		return expected_loc == S_NPOS && !expected_g0 ? 0 : 1;
+	loc = ss_regex_find(s, off, r, caps, 3);
+	if (loc != expected_loc)
+		res |= 2;
+	else if (loc != S_NPOS) {
+		if (ss_size(ss_ref(&caps[0])) != strlen(expected_g0)
+		    || ss_cmp(ss_ref(&caps[0]), ss_crefa(expected_g0)))
+			res |= 4;
+		if (expected_g1
+		    && (ss_size(ss_ref(&caps[1])) != strlen(expected_g1)
+			|| ss_cmp(ss_ref(&caps[1]), ss_crefa(expected_g1))))
+			res |= 8;
+		/* Match location without captures must be the same */
+		if (ss_regex_find(s, off, r, NULL, 0) != loc)
+			res |= 16;
+	}
+	ss_regex_free(&r);
+	return res;
+}
+
+static int test_ss_regex_misc()
+{
+	size_t i, n = 100000;
+	uint32_t h;
+	srt_string_ref caps[2];
+	srt_string *s = ss_alloc(n + 1);
+	srt_regex *r1 = ss_regex_alloc(ss_crefa("(a*)*b")),
+		  *r2 = ss_regex_alloc(ss_crefa("(a|b)*a(a|b){12}c")),
+		  *r3 = ss_regex_alloc(ss_crefa("(x+x+)+y"));
+	int res = 0;
+	if (!s || !r1 || !r2 || !r3) {
+		res |= 1;
+	} else {
+		/* Pathological patterns for backtracking engines */
+		ss_cat_char(&s, 'a');
+		for (i = 1; i < n; i *= 2)
+			ss_cat(&s, s);
+		if (ss_regex_find(s, 0, r1, caps, 2) != S_NPOS)
+			res |= 2;
+		ss_cat_c(&s, "b");
+		if (ss_regex_find(s, 0, r1, caps, 2) != 0
+		    || ss_size(ss_ref(&caps[0])) != ss_size(s)
+		    || ss_size(ss_ref(&caps[1])) != ss_size(s) - 1)
+			res |= 4;
+		if (ss_regex_find(s, 0, r3, NULL, 0) != S_NPOS)
+			res |= 8;
+		/* DFA cache overflow (exponential states): NFA fallback */
+		ss_clear(s);
+		for (i = 0, h = 1; i < 2 * n; i++) {
+			h = h * 1103515245 + 12345;
+			ss_cat_char(&s, (h >> 16) & 1 ? 'a' : 'b');
+		}
+		ss_cat_c(&s, "babbbbbbbbbbbbc");
+		if (ss_regex_find(s, 0, r2, caps, 2) != 0
+		    || ss_size(ss_ref(&caps[0])) != ss_size(s)
+		    || ss_cmp(ss_ref(&caps[1]), ss_crefa("b")))
+			res |= 16;
+	}
+	ss_free(&s);
+	ss_regex_free(&r1);
+	ss_regex_free(&r2);
+	ss_regex_free(&r3);
+	return res;
+}
+
+static int test_ss_regex_split()
+{
+	const char *in = "how  are,you\xc3\xb1 , doing";
+	srt_regex *r = ss_regex_alloc(ss_crefa("\\s*,\\s*|\\s+")),
+		  *r2 = ss_regex_alloc(ss_crefa("x*")),
+		  *r3 = ss_regex_alloc(ss_crefa("(?:a*c)?|b"));
+	srt_string *s = NULL;
+	srt_string_ref subs[TSS_SPLIT_MAX_SUBS];
+	size_t elems;
+	int res = 0;
+	if (!r || !r2 || !r3) {
+		res |= 1;
+	} else {
+		elems = ss_regex_split(ss_crefa(in), r, subs,
+				       TSS_SPLIT_MAX_SUBS);
+		if (elems != 4 || ss_cmp(ss_ref(&subs[0]), ss_crefa("how"))
+		    || ss_cmp(ss_ref(&subs[1]), ss_crefa("are"))
+		    || ss_cmp(ss_ref(&subs[2]), ss_crefa("you\xc3\xb1"))
+		    || ss_cmp(ss_ref(&subs[3]), ss_crefa("doing")))
+			res |= 2;
+		elems = ss_regex_split(ss_crefa("abxxc"), r2, subs,
+				       TSS_SPLIT_MAX_SUBS);
+		if (elems != 2 || ss_cmp(ss_ref(&subs[0]), ss_crefa("ab"))
+		    || ss_cmp(ss_ref(&subs[1]), ss_crefa("c")))
+			res |= 4;
+		if (ss_regex_split(ss_crefa(""), r, subs, TSS_SPLIT_MAX_SUBS)
+		    || ss_regex_split(ss_crefa("a b"), r, subs, 1) != 1)
+			res |= 8;
+		/*
+		 * Empty matches everywhere, each one found after scanning
+		 * the whole 'a' run: O(n) (O(n^2) if searching again after
+		 * every empty match)
+		 */
+		ss_resize(&s, 200000, 'a');
+		ss_cat_c(&s, "ba");
+		elems = ss_regex_split(s, r3, subs, TSS_SPLIT_MAX_SUBS);
+		if (elems != 2 || ss_size(ss_ref(&subs[0])) != 200000
+		    || ss_cmp(ss_ref(&subs[1]), ss_crefa("a")))
+			res |= 16;
+	}
+	ss_regex_free(&r);
+	ss_regex_free(&r2);
+	ss_regex_free(&r3);
+	ss_free(&s);
+	return res;
+}
+
 static int validate_cmp(int res1, int res2)
 {
 	return (res1 == 0 && res2 == 0) || (res1 < 0 && res2 < 0)
@@ -1578,6 +2761,19 @@ static int test_ss_ncmpi(const char *a, const size_t a_off, const char *b,
 	return res;
 }
 
+static int test_ss_equal(const char *a, const char *b, srt_bool expected)
+{
+	srt_string *sa = ss_dup_c(a), *sb = ss_dup_c(b);
+	int res = (!sa || !sb) ? 1 : ss_equal(sa, sb) != expected ? 2 : 0;
+	ss_resize(&sa, 300, 'x');
+	ss_resize(&sb, 300, 'x');
+	(void)ss_hash(sa); /* cached hash (full container) */
+	(void)ss_hash(sb);
+	res |= ss_equal(sa, sb) != expected ? 4 : 0;
+	ss_free(&sa, &sb);
+	return res;
+}
+
 static int test_ss_printf()
 {
 	int res;
@@ -1653,13 +2849,340 @@ static int test_ss_read_write()
 }
 /* clang-format on */
 
+static int test_ss_lr_lines(FILE *f, size_t buf_size, size_t max_line_size,
+			    const char **expected, size_t nexpected)
+{
+	int res = 0;
+	size_t i;
+	srt_string_ref line, eref;
+	const srt_string *l;
+	srt_line_reader *lr;
+	if (fseek(f, 0, SEEK_SET) != 0)
+		return 1;
+	lr = ss_lr_alloc(f, buf_size, max_line_size);
+	if (!lr)
+		return 2;
+	for (i = 0; (l = ss_lr_next(lr, &line)) != NULL; i++)
+		if (i >= nexpected || ss_cmp(l, ss_cref(&eref, expected[i])))
+			res |= 4;
+	if (i != nexpected)
+		res |= 8;
+	if (ss_lr_error(lr) || ss_lr_next(lr, &line) != NULL)
+		res |= 16;
+	ss_lr_free(&lr);
+	return res | (lr != NULL ? 32 : 0);
+}
+
+static int test_ss_lr()
+{
+	int res = 1; /* Error: can not open file */
+	FILE *f;
+	srt_string *x300 = NULL, *x100 = NULL, *sa = NULL;
+	const char *exp1[5], *exp2[7];
+	remove(STEST_FILE);
+	f = fopen(STEST_FILE, S_FOPEN_BINARY_RW_TRUNC);
+	if (f) {
+		ss_cpy_char(&x300, 'x');
+		ss_cpy_char(&x100, 'x');
+		ss_resize(&x300, 300, 'x');
+		ss_resize(&x100, 100, 'x');
+		ss_cpy_c(&sa, "a\r\nbb\n\n");
+		ss_cat(&sa, x300);
+		ss_cat_c(&sa, "\r\nlast");
+		exp1[0] = exp2[0] = "a";
+		exp1[1] = exp2[1] = "bb";
+		exp1[2] = exp2[2] = "";
+		exp1[3] = ss_to_c(x300);
+		exp1[4] = exp2[6] = "last";
+		exp2[3] = exp2[4] = exp2[5] = ss_to_c(x100);
+		res = ss_write(f, sa, 0, S_NPOS) != (ssize_t)ss_size(sa) ? 2
+									  : 0;
+		if (!res) {
+			res = test_ss_lr_lines(f, 0, 0, exp1, 5) << 2;
+			res |= test_ss_lr_lines(f, 8, 0, exp1, 5) << 8;
+			res |= test_ss_lr_lines(f, 8, 100, exp2, 7) << 14;
+			res |= test_ss_lr_lines(f, 1000, 300, exp1, 5) << 20;
+		}
+		ss_free(&sa, &x300, &x100);
+		fclose(f);
+		if (remove(STEST_FILE) != 0)
+			res |= 1 << 30;
+	}
+	return res;
+}
+
+static uint32_t crc32_bitwise(uint32_t crc, const srt_string *s,
+			      const uint32_t poly)
+{
+	size_t i, j;
+	const unsigned char *p = (const unsigned char *)ss_get_buffer_r(s);
+	crc = ~crc;
+	for (i = 0; i < ss_size(s); i++)
+		for (crc ^= p[i], j = 0; j < 8; j++)
+			crc = (crc >> 1) ^ (crc & 1 ? poly : 0);
+	return ~crc;
+}
+
+static uint32_t adler32_bytewise(uint32_t adler, const srt_string *s)
+{
+	size_t i;
+	uint32_t s1 = adler & 0xffff, s2 = adler >> 16;
+	const unsigned char *p = (const unsigned char *)ss_get_buffer_r(s);
+	for (i = 0; i < ss_size(s); i++) {
+		s1 = (s1 + p[i]) % 65521;
+		s2 = (s2 + s1) % 65521;
+	}
+	return (s2 << 16) | s1;
+}
+
 static int test_ss_csum32()
 {
 	const char *a = "hola";
-	uint32_t a_crc32 = 0x6fa0f988;
-	srt_string *sa = ss_dup_c(a);
+	uint32_t a_crc32 = 0x6fa0f988, c, cc;
+	size_t i;
+	srt_string *sa = ss_dup_c(a), *sb = ss_dup_c("123456789"),
+		   *sc = ss_alloc(0);
 	int res = ss_crc32(sa) != a_crc32 ? 1 : 0;
-	ss_free(&sa);
+	res |= ss_adler32(sa) == 0x042a01a5 ? 0 : 32;
+	res |= ss_crc32(sb) == 0xcbf43926 && ss_crc32c(sb) == 0xe3069283
+		       ? 0
+		       : 2;
+	/* Sizes covering the wide paths (e.g. CPU-specific) and their tails */
+	for (i = 0; i < 30000 && !res; i += i < 200 ? 1 : 997) {
+		ss_resize(&sc, i, 0);
+		if (i > 0)
+			ss_get_buffer(sc)[i - 1] = (char)(i * 7);
+		res |= ss_crc32(sc) == crc32_bitwise(0, sc, 0xedb88320) ? 0 : 4;
+		res |= ss_crc32c(sc) == crc32_bitwise(0, sc, 0x82f63b78) ? 0
+									 : 8;
+		res |= ss_crc32cr(sc, ss_crc32cr(sc, 0, 0, i / 3), i / 3,
+				  S_NPOS)
+				       == ss_crc32c(sc)
+			       ? 0
+			       : 16;
+		res |= ss_adler32(sc) == adler32_bytewise(1, sc) ? 0 : 64;
+	}
+	/* Adler32 worst case for the SIMD lane sums (all bytes 0xff) */
+	ss_clear(sc);
+	ss_resize(&sc, 30000, (char)0xff);
+	res |= ss_adler32r(sc, 0xfff0fff0, 0, S_NPOS)
+			       == adler32_bytewise(0xfff0fff0, sc)
+		       ? 0
+		       : 128;
+	/* Chaining with empty ranges (checksum not changed) */
+	c = ss_crc32r(sb, ss_crc32r(sb, 0, 0, 4), 4, 4);
+	c = ss_crc32r(sb, ss_crc32r(sb, c, 9, S_NPOS), 4, 100);
+	cc = ss_crc32cr(sb, ss_crc32cr(sb, 0, 0, 4), 5, 5);
+	cc = ss_crc32cr(sb, ss_crc32cr(sb, cc, 100, 200), 4, S_NPOS);
+	res |= c == ss_crc32(sb) && cc == ss_crc32c(sb) ? 0 : 256;
+	ss_free(&sa, &sb, &sc);
+	return res;
+}
+
+static int test_ss_csum32_par()
+{
+	int res = 0;
+	size_t i, n = 3 * 1024 * 1024 + 12345, nt;
+	const size_t k[] = {1, 100, 65536, 1000001};
+	uint32_t r = 1, c32, c32c, a32;
+	srt_string *a = ss_alloc(n);
+	for (i = 0; i < n; i++) {
+		r = r * 1103515245 + 12345;
+		ss_cat_cn(&a, (const char *)&r + 2, 1);
+	}
+	c32 = ss_crc32(a);
+	c32c = ss_crc32c(a);
+	a32 = ss_adler32(a);
+	for (i = 0; i < sizeof(k) / sizeof(k[0]); i++) {
+		res |= ss_crc32_combine(ss_crc32r(a, 0, 0, k[i]),
+					ss_crc32r(a, 0, k[i], S_NPOS),
+					n - k[i])
+				       == c32
+			       ? 0
+			       : 1;
+		res |= ss_crc32c_combine(ss_crc32cr(a, 0, 0, k[i]),
+					 ss_crc32cr(a, 0, k[i], S_NPOS),
+					 n - k[i])
+				       == c32c
+			       ? 0
+			       : 2;
+		res |= ss_adler32_combine(ss_adler32r(a, 1, 0, k[i]),
+					  ss_adler32r(a, 1, k[i], S_NPOS),
+					  n - k[i])
+				       == a32
+			       ? 0
+			       : 4;
+	}
+	res |= ss_crc32_combine(c32, 0, 0) == c32 ? 0 : 8;
+	/* Empty parts (Adler32 of empty string is 1, as zlib) */
+	res |= ss_adler32_combine(a32, ss_adler32(ss_void), 0) == a32
+			       && ss_adler32_combine(ss_adler32(NULL), a32, n)
+					  == a32
+			       && ss_adler32r(a, a32, n, S_NPOS) == a32
+		       ? 0
+		       : 8;
+	for (nt = 0; nt <= 8; nt++) {
+		res |= ss_crc32_parallel(a, nt) == c32 ? 0 : 16;
+		res |= ss_crc32c_parallel(a, nt) == c32c ? 0 : 32;
+		res |= ss_adler32_parallel(a, nt) == a32 ? 0 : 64;
+	}
+	res |= !ss_crc32_parallel(ss_void, 4)
+			       && ss_adler32_parallel(NULL, 4) == S_ADLER32_INIT
+		       ? 0
+		       : 128;
+	ss_free(&a);
+	return res;
+}
+
+static int test_ss_hash()
+{
+	int res = 0;
+	const uint64_t hello_h = ((uint64_t)0xa430d846 << 32) | 0x80aabd0b;
+	char *p;
+	srt_string *a = ss_dup_c("hello"), *b = ss_dup_c("hello"), *c;
+	res |= ss_hash(a) != hello_h ? 1 : 0;
+	res |= ss_hash(NULL) != ss_hash(ss_void) ? 2 : 0;
+	/* Cached hash invalidation after mutation (full container) */
+	ss_resize(&a, 300, 'a');
+	ss_resize(&b, 300, 'a');
+	res |= ss_hash(a) != ss_hash(b) ? 4 : 0;
+	ss_toupper(&a);
+	res |= ss_hash(a) == ss_hash(b) ? 8 : 0;
+	ss_tolower(&a);
+	res |= ss_hash(a) != ss_hash(b) ? 16 : 0;
+	ss_cat_c(&a, "b");
+	res |= ss_hash(a) == ss_hash(b) ? 32 : 0;
+	ss_resize(&a, 300, 'a');
+	res |= ss_hash(a) != ss_hash(b) ? 64 : 0;
+	ss_get_buffer(a)[0] = 'H';
+	res |= ss_hash(a) == ss_hash(b) || ss_equal(a, b) ? 128 : 0;
+	/* Raw write through a previously got buffer, then size set */
+	ss_cpy(&a, b);
+	p = ss_get_buffer(a);
+	res |= ss_hash(a) != ss_hash(b) || ss_len_u(a) != 300 ? 512 : 0;
+	p[0] = 'H';
+	ss_set_size(a, 300);
+	res |= ss_hash(a) == ss_hash(b) ? 1024 : 0;
+	ss_set_size(a, 299);
+	res |= ss_len_u(a) != 299 ? 2048 : 0;
+	ss_clear(a);
+	c = ss_dup_c("");
+	res |= ss_hash(a) != ss_hash(c) ? 256 : 0;
+	ss_free(&a, &b, &c);
+	return res;
+}
+
+static int test_ss_hash64()
+{
+	int res = 0;
+	size_t i, j, k;
+	uint64_t h[64];
+	char f[32];
+	/* wyhash (final version 4) test vectors */
+	const uint64_t h0 = ((uint64_t)0x93228a4d << 32) | 0xe0eec5a2,
+		       h3 = ((uint64_t)0x786d1f1d << 32) | 0xf3801df4,
+		       h6 = ((uint64_t)0x6cc5eab4 << 32) | 0x9a92d617;
+	const uint64_t seeds[3] = {0, 1,
+				   ((uint64_t)0xdeadbeef << 32) | 0xcafebabe};
+	const char *d = "12345678901234567890123456789012345678901234567890"
+			"123456789012345678901234567890";
+	const srt_string *e = ss_crefa(""), *m = ss_crefa("message digest");
+	srt_string *a = ss_dup_c(d);
+	res |= ss_hash64(e) == h0 ? 0 : 1;
+	res |= sh_hash64(3, "message digest", 14) == h3 ? 0 : 2;
+	res |= sh_hash64(6, d, 80) == h6 ? 0 : 4;
+	/*
+	 * Keyed hash: no seed-independent collisions for inputs starting with
+	 * the wyhash public secret (SH_WYP1, cancelling the first product)
+	 */
+	memset(f, 'x', sizeof(f));
+	memcpy(f, "\xc9\xac\x2e\x96\x93\x4b\xb8\x8b", 8);
+	for (k = 0; k < 3; k++)
+		for (i = 0; i < 8; i++) {
+			f[8] = (char)i;
+			h[k * 8 + i] = ss_hash64_seed(
+				ss_refa_buf(f, sizeof(f)), seeds[k]);
+			for (j = 0; j < k * 8 + i; j++)
+				res |= h[k * 8 + i] == h[j] ? 128 : 0;
+		}
+	res |= ss_hash64(NULL) == ss_hash64(e) && ss_hash64(m) != ss_hash64(a)
+			       && ss_hash64_seed(m, 1) != ss_hash64(m)
+		       ? 0
+		       : 8;
+	ss_clear(a);
+	/* Every size (all read paths), no collisions */
+	for (i = 0; i < 64; i++) {
+		h[i] = ss_hash64(a);
+		for (j = 0; j < i; j++)
+			res |= h[i] == h[j] ? 16 : 0;
+		ss_cat_char(&a, 'a');
+	}
+	res |= s_hash_u32(1) == 0x86d2fa73 && s_hash_u32(0) == 0 ? 0 : 32;
+	res |= s_hash_u64(1) == (((uint64_t)0x5692161d << 32) | 0x100b05e5)
+		       ? 0
+		       : 64;
+	ss_free(&a);
+	return res;
+}
+
+static int test_ss_cdc()
+{
+	int res = 0;
+	uint32_t h, r = 1;
+	size_t i, j, n, off, nc;
+	const size_t mn = 256, avg = 1024, mx = 4096;
+	srt_string_ref ref;
+	srt_vector *ends = NULL, *hs = NULL;
+	srt_string *a = ss_alloc(200000), *b = ss_alloc(0), *c = NULL;
+	for (i = 0; i < 200000; i++) {
+		r = r * 1103515245 + 12345;
+		ss_cat_char(&a, (int)((r >> 16) & (i < 100000 ? 0xff : 0x3)));
+	}
+	/* Rolling hash: same result as hashing the window */
+	h = ss_buzhash(a, 0, 48);
+	for (i = 0; i < 1000; i++) {
+		h = ss_buzhash_roll(h, ss_at(a, i), ss_at(a, i + 48), 48);
+		res |= h == ss_buzhash(a, i + 1, 48) ? 0 : 1;
+	}
+	/* Chunk sizes, hashes, and full coverage */
+	nc = ss_cdc(&ends, &hs, a, mn, avg, mx);
+	res |= nc > 100 && sv_size(ends) == nc && sv_size(hs) == nc ? 0 : 2;
+	for (i = 0, off = 0; i < nc && !res; off = sv_at_u(ends, i++)) {
+		n = (size_t)sv_at_u(ends, i) - off;
+		res |= (n > mn || i == nc - 1) && n <= mx ? 0 : 4;
+		ss_ref_buf(&ref, ss_get_buffer_r(a) + off, n);
+		res |= sv_at_u(hs, i) == ss_hash64(ss_ref(&ref)) ? 0 : 8;
+	}
+	res |= off == ss_size(a) ? 0 : 16;
+	/* Streaming (appending data) gives the same boundaries */
+	for (i = j = off = 0; i < ss_size(a); i += 1000) {
+		ss_cat_substr(&b, a, i, 1000);
+		while ((n = ss_cdc_next(b, off, mn, avg, mx,
+					ss_size(b) == ss_size(a)))
+		       > 0) {
+			off += n;
+			res |= j < nc && off == sv_at_u(ends, j++) ? 0 : 32;
+		}
+	}
+	res |= j == nc ? 0 : 64;
+	/* An insertion changes only the chunks around it */
+	ss_cpy_substr(&c, a, 0, 50000);
+	ss_cat_c(&c, "inserted");
+	ss_cat_substr(&c, a, 50000, S_NPOS);
+	n = ss_cdc(NULL, &ends, c, mn, avg, mx);
+	for (i = j = 0; i < n; i++)
+		for (off = 0; off < nc; off++)
+			if (sv_at_u(ends, i) == sv_at_u(hs, off)) {
+				j++;
+				break;
+			}
+	res |= j + 3 >= nc ? 0 : 128;
+	res |= !ss_cdc(NULL, NULL, NULL, mn, avg, mx)
+			       && !ss_cdc_next(ss_void, 0, mn, avg, mx, S_TRUE)
+		       ? 0
+		       : 256;
+	sv_free(&ends, &hs);
+	ss_free(&a, &b, &c);
 	return res;
 }
 
@@ -2858,6 +4381,57 @@ static int test_sv_sort()
 	return res;
 }
 
+/*
+ * Full range values (and values only differing in the low bits), sorted
+ * with the LSD radix sort (large heap-allocated vectors) and the in-place
+ * sort (stack-allocated vectors), for every size up to 10 and large sizes
+ */
+static int test_sv_sort_radix()
+{
+	int res = 0;
+	size_t i, n, t;
+	uint64_t x;
+	srt_bool sgn;
+	const enum eSV_Type types[] = {SV_I32, SV_U32, SV_I64, SV_U64};
+	srt_vector *v, *w;
+	for (t = 0; t < 4; t++) {
+		sgn = types[t] == SV_I32 || types[t] == SV_I64;
+		w = sv_alloca_t(types[t], 3000);
+		for (n = 2; n <= 3000; n = n < 10 ? n + 1 : n * 3) {
+			v = sv_alloc_t(types[t], n);
+			sv_clear(w);
+			for (i = 0; i < n; i++) {
+				x = s_hash_u64(i + n * 1000);
+				x = types[t] == SV_I32 || types[t] == SV_U32
+					    ? x >> 32
+					    : x;
+				x = n % 2 ? x & 0x3ff : x;
+				if (types[t] == SV_I32)
+					sv_push_i(&v, (int32_t)x);
+				else if (types[t] == SV_I64)
+					sv_push_i(&v, (int64_t)x);
+				else
+					sv_push_u(&v, x);
+			}
+			sv_cat(&w, v);
+			sv_sort(v);
+			sv_sort(w);
+			res |= sv_size(v) == n && sv_size(w) == n ? 0 : 1;
+			for (i = 1; i < n && !res; i++) {
+				res |= sv_cmp(v, i - 1, i) <= 0 ? 0 : 2;
+				res |= (sgn && sv_at_i(v, i) == sv_at_i(w, i))
+					       || (!sgn
+						   && sv_at_u(v, i)
+							      == sv_at_u(w, i))
+					       ? 0
+					       : 4;
+			}
+			sv_free(&v);
+		}
+	}
+	return res;
+}
+
 #define TEST_SV_FIND_VARS(v) srt_vector *v
 
 #define TEST_SV_FIND(v, ntest, alloc, push, check, type, CMPF, a, b)           \
@@ -4373,12 +5947,18 @@ int main()
 	char btmp1[400], btmp2[400];
 	srt_string *co;
 	int j;
-	const srt_string *ci[5] = {
+	const srt_string *ci[8] = {
 		ss_crefa("hellohellohellohellohellohellohello!"),
 		ss_crefa("111111111111111111111111111111111111"),
 		ss_crefa("121212121212121212121212121212121212"),
 		ss_crefa("123123123123123123123123123123123123"),
-		ss_crefa("123412341234123412341234123412341234")};
+		ss_crefa("123412341234123412341234123412341234"),
+		ss_crefa("z"),
+		ss_crefa("0123456789abc0123456789abc0123456789abc"
+			 "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789abc0123456789ab"
+			 "ABCDEFGHIJKLMNOPQRSTUVWXYZ"),
+		ss_crefa("1234567123456712345671234567123456712345671234567"
+			 "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!")};
 	srt_string *stmp;
 	srt_bool unicode_support = S_TRUE;
 	wint_t check[] = {0xc0, 0x23a, 0x10a0, 0x1e9e};
@@ -4482,6 +6062,7 @@ int main()
 	STEST_ASSERT(test_ss_dup());
 	STEST_ASSERT(test_ss_dup_substr());
 	STEST_ASSERT(test_ss_dup_substr_u());
+	STEST_ASSERT(test_ss_index_u());
 	STEST_ASSERT(test_ss_dup_cn());
 	STEST_ASSERT(test_ss_dup_c());
 	STEST_ASSERT(test_ss_dup_wn());
@@ -4522,6 +6103,14 @@ int main()
 			       ss_crefa("MDEyMzQ1Njc4OUFCQ0RFRg=="));
 	MK_TEST_SS_DUP_CPY_CAT(enc_b64, dec_b64, ss_crefa("01"),
 			       ss_crefa("MDE="));
+	MK_TEST_SS_DUP_CPY_CAT(enc_b64, dec_b64_strict,
+			       ss_crefa("0123456789ABCDEF\xfb\xff\xbf\xfe"),
+			       ss_crefa("MDEyMzQ1Njc4OUFCQ0RFRvv/v/4="));
+	MK_TEST_SS_DUP_CPY_CAT(enc_b64url, dec_b64url,
+			       ss_crefa("0123456789ABCDEF\xfb\xff\xbf\xfe"),
+			       ss_crefa("MDEyMzQ1Njc4OUFCQ0RFRvv_v_4"));
+	MK_TEST_SS_DUP_CPY_CAT(enc_b64url, dec_b64url_strict,
+			       ss_crefa("\xfb\xff"), ss_crefa("-_8"));
 	MK_TEST_SS_DUP_CPY_CAT(enc_hex, dec_hex, ss_crefa("\xf8"),
 			       ss_crefa("f8"));
 	MK_TEST_SS_DUP_CPY_CAT(enc_hex, dec_hex, ss_crefa("\xff\xff"),
@@ -4552,8 +6141,12 @@ int main()
 	MK_TEST_SS_DUP_CPY_CAT(enc_esc_squote, dec_esc_squote,
 			       ss_crefa("'how' are you?"),
 			       ss_crefa("''how'' are you?"));
+	MK_TEST_SS_DUP_CPY_CAT(
+		enc_utf16le, dec_utf16le,
+		ss_crefa("a" U8_C_N_TILDE_D1 U8_EURO_20AC U8_HAN_24B62),
+		ss_refa_buf("a\0\xd1\0\xac\x20\x52\xd8\x62\xdf", 10));
 	co = ss_alloca(256);
-	for (j = 0; j < 5; j++) {
+	for (j = 0; j < 8; j++) {
 		ss_enc_lz(&co, ci[j]);
 		MK_TEST_SS_DUP_CPY_CAT(enc_lz, dec_lz, ci[j], co);
 		ss_enc_lzh(&co, ci[j]);
@@ -4651,6 +6244,49 @@ int main()
 	STEST_ASSERT(test_ss_toupper(U8_S_S_CEDILLA_15F, U8_C_S_CEDILLA_15E));
 	STEST_ASSERT(!ss_set_turkish_mode(0));
 #endif
+	STEST_ASSERT(test_ss_normalize("hello", "hello", "hello", "hello",
+				       "hello"));
+	STEST_ASSERT(test_ss_normalize("caf\xc3\xa9", "caf\xc3\xa9",
+				       "cafe\xcc\x81", "caf\xc3\xa9",
+				       "cafe\xcc\x81"));
+	STEST_ASSERT(test_ss_normalize("cafe\xcc\x81", "caf\xc3\xa9",
+				       "cafe\xcc\x81", "caf\xc3\xa9",
+				       "cafe\xcc\x81"));
+	STEST_ASSERT(test_ss_normalize("\xea\xb0\x80", "\xea\xb0\x80",
+				       "\xe1\x84\x80\xe1\x85\xa1",
+				       "\xea\xb0\x80",
+				       "\xe1\x84\x80\xe1\x85\xa1"));
+	STEST_ASSERT(test_ss_normalize("\xef\xac\x81", "\xef\xac\x81",
+				       "\xef\xac\x81", "fi", "fi"));
+	STEST_ASSERT(test_ss_normalize("a\xcc\x81\xcc\xa3",
+				       "\xe1\xba\xa1\xcc\x81",
+				       "a\xcc\xa3\xcc\x81",
+				       "\xe1\xba\xa1\xcc\x81",
+				       "a\xcc\xa3\xcc\x81"));
+	STEST_ASSERT(test_ss_normalize("\xe2\x84\xab", "\xc3\x85", "A\xcc\x8a",
+				       "\xc3\x85", "A\xcc\x8a"));
+	STEST_ASSERT(test_ss_normalize("\xff\xfe", "\xff\xfe", "\xff\xfe",
+				       "\xff\xfe", "\xff\xfe"));
+	STEST_ASSERT(test_ss_casefold("hello world", "hello world"));
+	STEST_ASSERT(test_ss_casefold("Stra\xc3\x9f" "e \xc4\xb0",
+				      "strasse i\xcc\x87"));
+	STEST_ASSERT(test_ss_casefold("\xce\xa3\xcf\x82", "\xcf\x83\xcf\x83"));
+	/* Supplementary planes (UTF-16 surrogate pairs in the tables) */
+	STEST_ASSERT(test_ss_normalize("\xf0\x9d\x85\x9e",
+				       "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5",
+				       "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5",
+				       "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5",
+				       "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5"));
+	STEST_ASSERT(test_ss_normalize(
+		"\xf0\x9d\x85\xa0",
+		"\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xae",
+		"\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xae",
+		"\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xae",
+		"\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xae"));
+	STEST_ASSERT(test_ss_casefold("\xf0\x91\xa2\xa0", "\xf0\x91\xa3\x80"));
+	STEST_ASSERT(test_ss_casefold("\xf0\x90\x90\x80", "\xf0\x90\x90\xa8"));
+	STEST_ASSERT(test_ss_casefold("a\xf0\x9e\xa4\x80z",
+				      "a\xf0\x9e\xa4\xa2z"));
 	STEST_ASSERT(test_ss_clear(""));
 	STEST_ASSERT(test_ss_clear("hello"));
 	STEST_ASSERT(test_ss_check());
@@ -4666,10 +6302,88 @@ int main()
 	if (unicode_support)
 		STEST_ASSERT(test_ss_to_w("hello" U8_C_N_TILDE_D1));
 #endif
+	STEST_ASSERT(test_ss_utf16());
+	STEST_ASSERT(test_ss_b64());
+	STEST_ASSERT(test_ss_hex());
+	STEST_ASSERT(test_ss_esc());
+	STEST_ASSERT(test_ss_codec());
+	STEST_ASSERT(test_ss_lz_level());
+	STEST_ASSERT(test_ss_lz_ctx());
+	STEST_ASSERT(test_ss_lz_dict());
+	STEST_ASSERT(test_ss_delta());
+	STEST_ASSERT(test_ss_lze());
+	STEST_ASSERT(test_ss_lzf());
+	STEST_ASSERT(test_ss_lz_corrupted());
+	STEST_ASSERT(test_ss_lz_range());
+	STEST_ASSERT(test_ss_lz_periodic());
 	STEST_ASSERT(test_ss_find("full text", "text", 5));
 	STEST_ASSERT(test_ss_find("full text", "hello", S_NPOS));
 	STEST_ASSERT(test_ss_find_misc());
 	STEST_ASSERT(test_ss_split());
+	STEST_ASSERT(test_ss_edit_distance("", "", 0, 0));
+	STEST_ASSERT(test_ss_edit_distance("", "abc", 3, 3));
+	STEST_ASSERT(test_ss_edit_distance("kitten", "sitting", 3, 3));
+	STEST_ASSERT(test_ss_edit_distance("flaw", "lawn", 2, 2));
+	STEST_ASSERT(test_ss_edit_distance("hello", "hello", 0, 0));
+	STEST_ASSERT(test_ss_edit_distance("a" U8_S_N_TILDE_F1 "o",
+					   "a" U8_C_N_TILDE_D1 "o", 1, 1));
+	STEST_ASSERT(test_ss_edit_distance("ma" U8_S_N_TILDE_F1 "ana",
+					   "manana", 2, 1));
+	STEST_ASSERT(test_ss_edit_distance(U8_EURO_20AC, "", 3, 1));
+	STEST_ASSERT(test_ss_edit_distance_long());
+	STEST_ASSERT(test_ss_find_fuzzy("hello world", "wrld", 1, S_FALSE, 6,
+					"world"));
+	STEST_ASSERT(test_ss_find_fuzzy("hello world", "wordl", 2, S_FALSE, 6,
+					"worl"));
+	STEST_ASSERT(test_ss_find_fuzzy("cabccbcbcacacaaaabcbac"
+					"bbaaaaababbbcccbbbc",
+					"accaaa", 1, S_FALSE, 9, "acacaaa"));
+	STEST_ASSERT(test_ss_find_fuzzy("hello world", "xyz", 2, S_FALSE,
+					S_NPOS, NULL));
+	STEST_ASSERT(test_ss_find_fuzzy("hello world", "ab", 2, S_FALSE, 0,
+					""));
+	STEST_ASSERT(test_ss_find_fuzzy("el ma" U8_S_N_TILDE_F1 "ana",
+					"manana", 1, S_TRUE, 3,
+					"ma" U8_S_N_TILDE_F1 "ana"));
+	STEST_ASSERT(test_ss_find_fuzzy("el ma" U8_S_N_TILDE_F1 "ana",
+					"manana", 1, S_FALSE, S_NPOS, NULL));
+	STEST_ASSERT(test_ss_regex_find("world", "hello world", 0, 6, "world",
+					NULL));
+	STEST_ASSERT(test_ss_regex_find("world", "hello world", 7, S_NPOS,
+					NULL, NULL));
+	STEST_ASSERT(test_ss_regex_find("a|ab", "xab", 0, 1, "a", NULL));
+	STEST_ASSERT(test_ss_regex_find("a+", "baaab", 0, 1, "aaa", NULL));
+	STEST_ASSERT(test_ss_regex_find("a+?", "baaab", 0, 1, "a", NULL));
+	STEST_ASSERT(test_ss_regex_find("(a|)*", "aa", 0, 0, "aa", "a"));
+	STEST_ASSERT(test_ss_regex_find("(\\w+)@(\\w+)\\.com",
+					"mail: user@host.com", 0, 6,
+					"user@host.com", "user"));
+	STEST_ASSERT(test_ss_regex_find("(x)?y", "zy", 0, 1, "y", ""));
+	STEST_ASSERT(test_ss_regex_find("[0-9]{2,3}", "a1b1234", 0, 3, "123",
+					NULL));
+	STEST_ASSERT(test_ss_regex_find("^b|c$", "abc", 0, 2, "c", NULL));
+	STEST_ASSERT(test_ss_regex_find("(?m)^b", "a\nb", 0, 2, "b", NULL));
+	STEST_ASSERT(test_ss_regex_find("\\bis\\b", "this is", 0, 5, "is",
+					NULL));
+	STEST_ASSERT(test_ss_regex_find("a.c", "a" U8_S_N_TILDE_F1 "c", 0, 0,
+					"a" U8_S_N_TILDE_F1 "c", NULL));
+	STEST_ASSERT(test_ss_regex_find("(?i)hello", "say HeLLo", 0, 4,
+					"HeLLo", NULL));
+#if !defined(S_MINIMAL)
+	STEST_ASSERT(test_ss_regex_find("(?i)" U8_S_N_TILDE_F1,
+					"A" U8_C_N_TILDE_D1, 0, 1,
+					U8_C_N_TILDE_D1, NULL));
+#endif
+	STEST_ASSERT(test_ss_regex_find("[^a]", "a\xe2\x82\xac", 0, 1,
+					"\xe2\x82\xac", NULL));
+	STEST_ASSERT(test_ss_regex_find("[\\x{20ac}-\\x{20ad}]+",
+					"1\xe2\x82\xac\xe2\x82\xad", 0, 1,
+					"\xe2\x82\xac\xe2\x82\xad", NULL));
+	STEST_ASSERT(test_ss_regex_find("a(", "a", 0, S_NPOS, NULL, NULL));
+	STEST_ASSERT(test_ss_regex_find("[a", "a", 0, S_NPOS, NULL, NULL));
+	STEST_ASSERT(test_ss_regex_find("*", "a", 0, S_NPOS, NULL, NULL));
+	STEST_ASSERT(test_ss_regex_misc());
+	STEST_ASSERT(test_ss_regex_split());
 	STEST_ASSERT(test_ss_cmp("hello", "hello2", -1));
 	STEST_ASSERT(test_ss_cmp("hello2", "hello", 1));
 	STEST_ASSERT(test_ss_cmp("hello", "hello", 0));
@@ -4694,13 +6408,22 @@ int main()
 	STEST_ASSERT(test_ss_ncmpi("xxhello", 2, "HELLO2", 6, -1));
 	STEST_ASSERT(test_ss_ncmpi("xxhello2", 2, "HELLO", 6, 1));
 	STEST_ASSERT(test_ss_ncmpi("xxhello1", 2, "HELLO2", 5, 0));
+	STEST_ASSERT(test_ss_equal("hello", "hello", S_TRUE));
+	STEST_ASSERT(test_ss_equal("hello", "hellO", S_FALSE));
+	STEST_ASSERT(test_ss_equal("hello", "hello2", S_FALSE));
+	STEST_ASSERT(test_ss_equal("", "", S_TRUE));
 	STEST_ASSERT(test_ss_printf());
 	STEST_ASSERT(test_ss_getchar());
 	STEST_ASSERT(test_ss_putchar());
 	STEST_ASSERT(test_ss_cpy_read());
 	STEST_ASSERT(test_ss_cat_read());
 	STEST_ASSERT(test_ss_read_write());
+	STEST_ASSERT(test_ss_lr());
 	STEST_ASSERT(test_ss_csum32());
+	STEST_ASSERT(test_ss_csum32_par());
+	STEST_ASSERT(test_ss_hash());
+	STEST_ASSERT(test_ss_hash64());
+	STEST_ASSERT(test_ss_cdc());
 	STEST_ASSERT(test_ss_null());
 	STEST_ASSERT(test_ss_misc());
 	i = 0;
@@ -4772,6 +6495,7 @@ int main()
 	STEST_ASSERT(test_sv_erase());
 	STEST_ASSERT(test_sv_resize());
 	STEST_ASSERT(test_sv_sort());
+	STEST_ASSERT(test_sv_sort_radix());
 	STEST_ASSERT(test_sv_find());
 	STEST_ASSERT(test_sv_push_pop_set());
 	STEST_ASSERT(test_sv_push_pop_set_i());
@@ -226,8 +226,8 @@ if (($TMUX & 8)) ; then
 		fi
 		make clean
 		make -j $MJOBS CC=gcc PROFILING=1 2>/dev/null >/dev/null
-		for f in schar scommon sdata senc shash smap smset ssearch \
-			 ssort sstring stree svector stest ; do
+		for f in schar scommon sdata senc shash smap smset snorm sregex \
+			 ssearch ssort sstring stree svector stest ; do
 			gcov $f.c >/dev/null 2>/dev/null
 		done
 		rm -f $COVERAGE_OUT 2>/dev/null
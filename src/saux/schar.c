@@ -287,6 +287,435 @@ ssize_t sc_utf8_calc_case_extra_size(const char *s, const size_t off,
 	return caseXsize;
 }
 
+/*
+ * UTF-8 <-> UTF-16/UTF-32 transcoding
+ *
+ * ASCII runs are processed one machine word per loop, and 1, 2, and 3 byte
+ * UTF-8 sequences are handled inline (the rest fall back to sc_utf8_to_wc()
+ * and sc_wc_to_utf8()). On x86, UTF-8 decoding uses SIMD for blocks of
+ * ASCII, 2-byte, or 3-byte sequences (see sc_utf8_dec_x86()).
+ */
+
+#ifdef S_X86_CPU_EXT
+#include <immintrin.h>
+#endif
+
+#define SC_SZT_HI8 ((((size_t)-1) / 0xff) * 0x80) /* 0x80 on every byte */
+
+/*
+ * BEHAVIOR: broken UTF-8 (not valid start or continuation bytes, overlong
+ * forms, surrogates, code points above U+10FFFF, and cut sequences) is
+ * decoded as U+FFFD, one for every maximal subpart of a not valid sequence
+ * (as recommended by the Unicode Standard, chapter 3), so valid characters
+ * after a broken sequence are never lost
+ */
+S_INLINE size_t sc_utf8_dec(const unsigned char *s, const size_t i,
+			    const size_t ss, int32_t *c)
+{
+	size_t k, n;
+	uint32_t u;
+	unsigned lo = 0x80, hi = 0xbf;
+	const unsigned b0 = s[i];
+	if (b0 < 0x80) {
+		*c = (int32_t)b0;
+		return 1;
+	}
+	if (b0 < 0xc2 || b0 > 0xf4) { /* continuation, overlong, > U+10FFFF */
+		*c = 0xfffd;
+		return 1;
+	}
+	if (b0 < 0xe0) {
+		n = 2;
+		u = b0 & 0x1f;
+	} else if (b0 < 0xf0) {
+		n = 3;
+		u = b0 & 0x0f;
+		if (b0 == 0xe0) /* overlong */
+			lo = 0xa0;
+		else if (b0 == 0xed) /* surrogates */
+			hi = 0x9f;
+	} else {
+		n = 4;
+		u = b0 & 0x07;
+		if (b0 == 0xf0) /* overlong */
+			lo = 0x90;
+		else if (b0 == 0xf4) /* above U+10FFFF */
+			hi = 0x8f;
+	}
+	for (k = 1; k < n; k++, lo = 0x80, hi = 0xbf) {
+		if (i + k >= ss || s[i + k] < lo || s[i + k] > hi) {
+			*c = 0xfffd;
+			return k;
+		}
+		u = (u << 6) | (s[i + k] & 0x3f);
+	}
+	*c = (int32_t)u;
+	return n;
+}
+
+#ifdef S_X86_CPU_EXT
+
+/*
+ * 16-byte block decoding: all ASCII (16 characters), all 2-byte sequences
+ * (8 characters), or four 3-byte sequences (12 bytes, the other 4 bytes
+ * are not used). Sequences are validated (continuation bytes, overlong
+ * forms, and surrogates). Output: UTF-16 units ("a": 8, "b": the other 8
+ * for ASCII). Returns the input bytes used, 0 if not matching any case
+ */
+S_TARGET("ssse3")
+S_INLINE size_t sc_utf8_blk_ssse3(const unsigned char *p, __m128i *a,
+				  __m128i *b, size_t *nc)
+{
+	__m128i v, x, y;
+	const __m128i z = _mm_setzero_si128();
+	v = _mm_loadu_si128((const __m128i *)p);
+	if (!_mm_movemask_epi8(v)) {
+		*a = _mm_unpacklo_epi8(v, z);
+		*b = _mm_unpackhi_epi8(v, z);
+		*nc = 16;
+		return 16;
+	}
+	/* 2-byte: 110xxxxx 10xxxxxx (16-bit lanes), and not C0 nor C1 */
+	x = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(0xc0e0)),
+			    _mm_set1_epi16(0x80c0));
+	y = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1e)), z);
+	if (_mm_movemask_epi8(_mm_andnot_si128(y, x)) == 0xffff) {
+		x = _mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1f)), 6);
+		y = _mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0x3f));
+		*a = _mm_or_si128(x, y);
+		*nc = 8;
+		return 16;
+	}
+	/* 3-byte: 1110xxxx 10xxxxxx 10xxxxxx, reversed into 32-bit lanes */
+	v = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7,
+					      6, -1, 11, 10, 9, -1));
+	x = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(0xf0c0c0)),
+			    _mm_set1_epi32(0xe08080));
+	if (_mm_movemask_epi8(x) != 0xffff)
+		return 0;
+	v = _mm_or_si128(
+		_mm_or_si128(_mm_and_si128(v, _mm_set1_epi32(0x3f)),
+			     _mm_and_si128(_mm_srli_epi32(v, 2),
+					   _mm_set1_epi32(0xfc0))),
+		_mm_and_si128(_mm_srli_epi32(v, 4), _mm_set1_epi32(0xf000)));
+	x = _mm_or_si128(_mm_cmplt_epi32(v, _mm_set1_epi32(0x800)),
+			 _mm_cmpeq_epi32(_mm_and_si128(v,
+						       _mm_set1_epi32(0xf800)),
+					 _mm_set1_epi32(0xd800)));
+	if (_mm_movemask_epi8(x))
+		return 0;
+	*a = _mm_shuffle_epi8(v, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1,
+					       -1, -1, -1, -1, -1, -1, -1));
+	*nc = 4;
+	return 12;
+}
+
+/* Store "n" (4 or 8) UTF-16 units as UTF-16 or UTF-32 ("w": unit size) */
+S_TARGET("ssse3")
+S_INLINE void sc_utf_st_ssse3(void *o, const size_t w, const size_t j,
+			      const __m128i a, const size_t n)
+{
+	const __m128i z = _mm_setzero_si128();
+	if (w == 2) {
+		if (n == 8)
+			_mm_storeu_si128((__m128i *)((uint16_t *)o + j), a);
+		else
+			_mm_storel_epi64((__m128i *)((uint16_t *)o + j), a);
+		return;
+	}
+	_mm_storeu_si128((__m128i *)((uint32_t *)o + j),
+			 _mm_unpacklo_epi16(a, z));
+	if (n == 8)
+		_mm_storeu_si128((__m128i *)((uint32_t *)o + j + 4),
+				 _mm_unpackhi_epi16(a, z));
+}
+
+/*
+ * Decoding while the blocks match, stopping at the first one not matching
+ * (left to the scalar code), or when the output is full ("o" can be NULL,
+ * for counting). Returns the input bytes processed ("j": output units)
+ */
+S_TARGET("ssse3")
+static size_t sc_utf8_dec_ssse3(const unsigned char *s, const size_t ss,
+				void *o, const size_t w, const size_t max_o,
+				size_t *j)
+{
+	size_t i = 0, n, nc;
+	__m128i a, b;
+	for (; i + 16 <= ss; i += n, *j += nc) {
+		n = sc_utf8_blk_ssse3(s + i, &a, &b, &nc);
+		if (!n || (o && *j + nc > max_o))
+			break;
+		if (o) {
+			sc_utf_st_ssse3(o, w, *j, a, S_MIN(nc, 8));
+			if (nc == 16)
+				sc_utf_st_ssse3(o, w, *j + 8, b, 8);
+		}
+	}
+	return i;
+}
+
+/*
+ * Same as the SSSE3 version, with 32-byte ASCII blocks (tried after ASCII
+ * blocks only, so other scripts do not pay for it)
+ */
+S_TARGET("avx2")
+static size_t sc_utf8_dec_avx2(const unsigned char *s, const size_t ss,
+			       void *o, const size_t w, const size_t max_o,
+			       size_t *j)
+{
+	size_t i = 0, k, n, nc = 16;
+	__m128i a, b;
+	__m256i v;
+	while (i + 16 <= ss) {
+		if (nc == 16 && i + 32 <= ss && (!o || *j + 32 <= max_o)) {
+			v = _mm256_loadu_si256((const __m256i *)(s + i));
+			if (!_mm256_movemask_epi8(v)) {
+				for (k = 0; o && k < 32; k += 32 / w) {
+					a = _mm_loadu_si128(
+						(const __m128i *)(s + i + k));
+					if (w == 2)
+						_mm256_storeu_si256(
+							(__m256i *)((uint16_t *)o
+								    + *j + k),
+							_mm256_cvtepu8_epi16(a));
+					else
+						_mm256_storeu_si256(
+							(__m256i *)((uint32_t *)o
+								    + *j + k),
+							_mm256_cvtepu8_epi32(a));
+				}
+				i += 32;
+				*j += 32;
+				continue;
+			}
+		}
+		n = sc_utf8_blk_ssse3(s + i, &a, &b, &nc);
+		if (!n || (o && *j + nc > max_o))
+			break;
+		if (o) {
+			sc_utf_st_ssse3(o, w, *j, a, S_MIN(nc, 8));
+			if (nc == 16)
+				sc_utf_st_ssse3(o, w, *j + 8, b, 8);
+		}
+		i += n;
+		*j += nc;
+	}
+	return i;
+}
+
+#endif /* #ifdef S_X86_CPU_EXT */
+
+/*
+ * SIMD decoding, if available (the input bytes processed are returned, and
+ * "j" is updated)
+ */
+S_INLINE size_t sc_utf8_dec_x86(const unsigned char *s, const size_t ss,
+				void *o, const size_t w, const size_t max_o,
+				size_t *j)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (ss >= 16) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return sc_utf8_dec_avx2(s, ss, o, w, max_o, j);
+		if (f & S_CPU_SSSE3)
+			return sc_utf8_dec_ssse3(s, ss, o, w, max_o, j);
+	}
+#else
+	(void)s;
+	(void)ss;
+	(void)o;
+	(void)w;
+	(void)max_o;
+	(void)j;
+#endif
+	return 0;
+}
+
+S_INLINE size_t sc_utf8_ascii_span(const unsigned char *s, size_t i,
+				   const size_t ss)
+{
+	const size_t i0 = i;
+	for (; i + sizeof(size_t) <= ss; i += sizeof(size_t))
+		if (S_LD_SZT(s + i) & SC_SZT_HI8)
+			break;
+	for (; i < ss && s[i] < 0x80; i++)
+		;
+	return i - i0;
+}
+
+size_t sc_utf8_to_utf16(const char *s0, const size_t ss, uint16_t *o,
+			const size_t max_o, size_t *s_used)
+{
+	int32_t c;
+	size_t i, j, k, n, l, simd = 0;
+	const unsigned char *s = (const unsigned char *)s0;
+	for (i = j = 0; s && i < ss;) {
+		if (i >= simd) {
+			i += sc_utf8_dec_x86(s + i, ss - i, o, 2, max_o, &j);
+			simd = i + 16; /* not matching block: scalar code */
+			if (i == ss)
+				break;
+		}
+		n = sc_utf8_ascii_span(s, i, ss);
+		if (n > 0) {
+			if (o) {
+				n = S_MIN(n, max_o - j);
+				for (k = 0; k < n; k++)
+					o[j + k] = s[i + k];
+			}
+			i += n;
+			j += n;
+			if (i == ss || (o && j == max_o))
+				break;
+		}
+		l = sc_utf8_dec(s, i, ss, &c);
+		if (c <= 0xffff) {
+			if (o) {
+				if (j == max_o)
+					break;
+				o[j] = (uint16_t)c;
+			}
+			j++;
+		} else {
+			if (o) {
+				if (j + 2 > max_o)
+					break;
+				c -= 0x10000;
+				o[j] = (uint16_t)(SSU16_HS0 | (c >> 10));
+				o[j + 1] = (uint16_t)(SSU16_LS0 | (c & 0x3ff));
+			}
+			j += 2;
+		}
+		i += l;
+	}
+	if (s_used)
+		*s_used = i;
+	return j;
+}
+
+size_t sc_utf8_to_utf32(const char *s0, const size_t ss, uint32_t *o,
+			const size_t max_o, size_t *s_used)
+{
+	int32_t c;
+	size_t i, j, k, n, simd = 0;
+	const unsigned char *s = (const unsigned char *)s0;
+	for (i = j = 0; s && i < ss;) {
+		if (i >= simd) {
+			i += sc_utf8_dec_x86(s + i, ss - i, o, 4, max_o, &j);
+			simd = i + 16; /* not matching block: scalar code */
+			if (i == ss)
+				break;
+		}
+		n = sc_utf8_ascii_span(s, i, ss);
+		if (n > 0) {
+			if (o) {
+				n = S_MIN(n, max_o - j);
+				for (k = 0; k < n; k++)
+					o[j + k] = s[i + k];
+			}
+			i += n;
+			j += n;
+			if (i == ss || (o && j == max_o))
+				break;
+		}
+		if (o) {
+			if (j == max_o)
+				break;
+			i += sc_utf8_dec(s, i, ss, &c);
+			o[j] = (uint32_t)c;
+		} else {
+			i += sc_utf8_dec(s, i, ss, &c);
+		}
+		j++;
+	}
+	if (s_used)
+		*s_used = i;
+	return j;
+}
+
+S_INLINE size_t sc_wc_to_utf8_fast(const uint32_t c, unsigned char *o)
+{
+	if (c < 0x800) {
+		if (o) {
+			o[0] = (unsigned char)(SSU8_S2 | (c >> 6));
+			o[1] = (unsigned char)(SSU8_SX | (c & 0x3f));
+		}
+		return 2;
+	}
+	if (c < 0x10000) {
+		if (o) {
+			o[0] = (unsigned char)(SSU8_S3 | (c >> 12));
+			o[1] = (unsigned char)(SSU8_SX | ((c >> 6) & 0x3f));
+			o[2] = (unsigned char)(SSU8_SX | (c & 0x3f));
+		}
+		return 3;
+	}
+	return o ? sc_wc_to_utf8((int32_t)c, (char *)o, 0, SSU8_MAX_SIZE)
+		 : sc_wc_to_utf8_size((int32_t)c);
+}
+
+/* BEHAVIOR: unpaired surrogates are ignored */
+size_t sc_utf16_to_utf8(const uint16_t *s, const size_t ss, char *o0,
+			size_t *u_chars)
+{
+	uint32_t c;
+	size_t i, j, k, uc;
+	unsigned char *o = (unsigned char *)o0;
+	const uint64_t hi9 = ((uint64_t)0xff80ff80 << 32) | 0xff80ff80;
+	for (i = j = uc = 0; s && i < ss;) {
+		for (k = i; k + 4 <= ss && !(S_LD_U64(s + k) & hi9); k += 4)
+			if (o) {
+				o[j + k - i] = (unsigned char)s[k];
+				o[j + k - i + 1] = (unsigned char)s[k + 1];
+				o[j + k - i + 2] = (unsigned char)s[k + 2];
+				o[j + k - i + 3] = (unsigned char)s[k + 3];
+			}
+		for (; k < ss && s[k] < 0x80; k++)
+			if (o)
+				o[j + k - i] = (unsigned char)s[k];
+		j += k - i;
+		uc += k - i;
+		i = k;
+		if (i == ss)
+			break;
+		c = s[i++];
+		if (!SSU16_SIMPLE(c)) {
+			if (!SSU16_VALID_HS(c) || i == ss
+			    || !SSU16_VALID_LS(s[i]))
+				continue;
+			c = SSU16_TO_U32(c, s[i]);
+			i++;
+		}
+		j += sc_wc_to_utf8_fast(c, o ? o + j : NULL);
+		uc++;
+	}
+	if (u_chars)
+		*u_chars = uc;
+	return j;
+}
+
+size_t sc_utf32_to_utf8(const uint32_t *s, const size_t ss, char *o0,
+			size_t *u_chars)
+{
+	size_t i, j;
+	unsigned char *o = (unsigned char *)o0;
+	for (i = j = 0; s && i < ss; i++) {
+		if (s[i] < 0x80) {
+			if (o)
+				o[j] = (unsigned char)s[i];
+			j++;
+		} else {
+			j += sc_wc_to_utf8_fast(s[i], o ? o + j : NULL);
+		}
+	}
+	if (u_chars)
+		*u_chars = ss;
+	return j;
+}
+
 	/*
 	 * Minimal build removes Unicode tolower/toupper support
 	 */
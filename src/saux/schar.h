@@ -18,6 +18,11 @@ extern "C" {
  * Features:
  *
  * - Unicode <-> UTF-8 character conversion.
+ * - UTF-8 <-> UTF-16/UTF-32 string conversion (ASCII processed one machine
+ *   word per loop). On x86, UTF-8 decoding uses SSSE3/AVX2 (selected at
+ *   run time) for blocks of ASCII, 2-byte, or 3-byte sequences (5-7x
+ *   faster than the scalar code for Cyrillic or CJK text). Broken UTF-8
+ *   (including overlong forms and surrogates) is decoded as U+FFFD.
  * - Compute Unicode required size for UTF-8 representation.
  * - Count Unicode characters into UTF-8 stream.
  * - Lowercase/uppercase conversions.
@@ -69,7 +74,8 @@ enum SSUTF16 {
 	(((unsigned short)(c)) < SSU16_HS0 || ((unsigned short)(c)) > SSU16_LSN)
 #define SSU16_VALID_HS(c) (((c)&SSU16_SM) == SSU16_HS0)
 #define SSU16_VALID_LS(c) (((c)&SSU16_SM) == SSU16_LS0)
-#define SSU16_TO_U32(hs, ls) ((((hs)&SSU16_SMI) << 10) | ((ls)&SSU16_SMI))
+#define SSU16_TO_U32(hs, ls)                                                   \
+	(((((hs)&SSU16_SMI) << 10) | ((ls)&SSU16_SMI)) + 0x10000)
 
 size_t sc_utf8_char_size(const char *s, const size_t off, const size_t max_off,
 			 size_t *enc_errors);
@@ -91,6 +97,14 @@ int32_t sc_tolower(const int32_t c);
 int32_t sc_toupper(const int32_t c);
 int32_t sc_tolower_tr(const int32_t c);
 int32_t sc_toupper_tr(const int32_t c);
+size_t sc_utf8_to_utf16(const char *s, const size_t ss, uint16_t *o,
+			const size_t max_o, size_t *s_used);
+size_t sc_utf8_to_utf32(const char *s, const size_t ss, uint32_t *o,
+			const size_t max_o, size_t *s_used);
+size_t sc_utf16_to_utf8(const uint16_t *s, const size_t ss, char *o,
+			size_t *u_chars);
+size_t sc_utf32_to_utf8(const uint32_t *s, const size_t ss, char *o,
+			size_t *u_chars);
 size_t sc_parallel_toX(const char *s, size_t off, const size_t max, char *o,
 		       int32_t (*ssc_toX)(const int32_t));
 
@@ -8,6 +8,12 @@
  */
 
 #include "scommon.h"
+#ifdef S_PTHREAD
+#include <pthread.h>
+#endif
+#ifdef S_X86_CPU_EXT
+#include <cpuid.h>
+#endif
 
 #define D8_LE_MASK S_NBITMASK(8 - D8_LE_SHIFT)
 #define D16_LE_MASK S_NBITMASK(16 - D16_LE_SHIFT)
@@ -266,3 +272,101 @@ void s_memset16(void *o, const void *s, size_t n2)
 	if (n2 % 2)
 		memcpy((uint8_t *)o + n4 * 4, s, 2);
 }
+
+/*
+ * x86 CPU features
+ */
+
+#ifdef S_X86_CPU_EXT
+
+/*
+ * XCR0 register (OS support for saving AVX registers: bits 1 and 2)
+ */
+static unsigned s_xcr0(void)
+{
+	unsigned lo, hi;
+	__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return lo;
+}
+
+/*
+ * CPU features, cached (concurrent first calls store the same value)
+ */
+unsigned s_cpu(void)
+{
+	static volatile unsigned f = 0;
+	unsigned a, b, c, d, r = 0;
+	if (!f) {
+		if (__get_cpuid(1, &a, &b, &c, &d)) {
+			r = c & (S_CPU_PCLMUL | S_CPU_SSSE3 | S_CPU_SSE42);
+			if (d & (1 << 26))
+				r |= S_CPU_SSE2;
+			if ((c & S_CPU_OSXSAVE) && (s_xcr0() & 6) == 6
+			    && __get_cpuid_max(0, NULL) >= 7) {
+				__cpuid_count(7, 0, a, b, c, d);
+				if (b & (1 << 5))
+					r |= S_CPU_AVX2;
+			}
+		}
+		f = r | S_CPU_DONE;
+	}
+	return f;
+}
+
+#endif /* #ifdef S_X86_CPU_EXT */
+
+/*
+ * Parallel execution
+ */
+
+#ifdef S_PTHREAD
+struct SParJob {
+	pthread_t th;
+	srt_bool started, ok;
+	srt_par_f f;
+	void *ctx;
+	size_t i;
+};
+
+static void *s_par_run(void *job0)
+{
+	struct SParJob *job = (struct SParJob *)job0;
+	job->ok = job->f(job->ctx, job->i);
+	return NULL;
+}
+#endif
+
+srt_bool s_parallel(const size_t n, srt_par_f f, void *ctx)
+{
+	size_t i;
+	srt_bool ok = S_TRUE;
+#ifdef S_PTHREAD
+	struct SParJob *jobs = n > 1 ? (struct SParJob *)s_malloc(
+					       sizeof(struct SParJob) * n)
+				     : NULL;
+	if (jobs) {
+		for (i = 1; i < n; i++) {
+			jobs[i].f = f;
+			jobs[i].ctx = ctx;
+			jobs[i].i = i;
+			jobs[i].ok = S_FALSE;
+			jobs[i].started = !pthread_create(&jobs[i].th, NULL,
+							  s_par_run, jobs + i);
+		}
+		/* BEHAVIOR: if a thread can not be created, run it here */
+		ok = f(ctx, 0);
+		for (i = 1; i < n; i++) {
+			if (jobs[i].started)
+				pthread_join(jobs[i].th, NULL);
+			else
+				jobs[i].ok = f(ctx, i);
+			ok &= jobs[i].ok;
+		}
+		s_free(jobs);
+		return ok;
+	}
+#endif
+	for (i = 0; i < n; i++)
+		ok &= f(ctx, i);
+	return ok;
+}
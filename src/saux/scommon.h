@@ -255,7 +255,49 @@ union s_u64 {
 #define S_TRUE 1
 #define S_FALSE 0
 #define S_CRC32_INIT 0
+#define S_CRC32C_INIT 0
 #define S_ADLER32_INIT 1
+#define S_FNV1A64_INIT (((uint64_t)0xcbf29ce4 << 32) | 0x84222325)
+
+/*
+ * Framed LZ flags (ss_enc_lzf(), senc_lzf())
+ */
+
+#define S_LZF_CRC32 1 /* CRC-32 of every block (checked when decoding) */
+#define S_LZF_HIGH 2  /* high compression (senc_lzh() for every block) */
+#define S_LZF_ENTROPY 4 /* entropy-coded blocks (senc_lze()) */
+#define S_LZF_INDEX 8	/* block index (random access: sdec_lzf_range()) */
+#define S_LZF_LEVEL(l) ((l) << 8) /* compression level (senc_lz_level()) */
+
+/*
+ * LZ compression levels (ss_enc_lz_level(), senc_lz_level())
+ */
+
+#define S_LZ_LEVEL_MAX 9
+
+/*
+ * Streaming codec types (ss_codec_alloc(), scodec_alloc())
+ */
+
+enum eSCodec {
+	SC_ENC_B64,
+	SC_DEC_B64,
+	SC_ENC_B64URL,
+	SC_DEC_B64URL,
+	SC_ENC_HEX,
+	SC_ENC_HEX_UPPER,
+	SC_DEC_HEX,
+	SC_ENC_ESC_XML,
+	SC_DEC_ESC_XML,
+	SC_ENC_ESC_JSON,
+	SC_DEC_ESC_JSON,
+	SC_ENC_ESC_URL,
+	SC_DEC_ESC_URL,
+	SC_ENC_LZ,
+	SC_DEC_LZ,
+	SC_ENC_LZF,
+	SC_DEC_LZF
+};
 
 /*
  * Variable argument helpers
@@ -486,6 +528,36 @@ void s_st_pk_u64(uint8_t **buf, const uint64_t v);
 uint64_t s_ld_pk_u64(const uint8_t **buf, const size_t bs);
 size_t s_pk_u64_size(const uint8_t *buf);
 
+/*
+ * Parallel execution: run f(ctx, 0) ... f(ctx, n - 1), each call in its own
+ * thread if built with S_PTHREAD (make PTHREAD=1), or sequentially if not.
+ * Returns S_TRUE if all calls returned S_TRUE.
+ */
+typedef srt_bool (*srt_par_f)(void *ctx, size_t i);
+srt_bool s_parallel(const size_t n, srt_par_f f, void *ctx);
+
+/*
+ * x86 CPU extensions (SSE2, PCLMULQDQ, SSSE3, SSE4.2, AVX2): functions are
+ * built for them using the target attribute (S_TARGET()), so no compiler
+ * flags are required, and selected at run time (s_cpu() flags, from CPUID).
+ * Disabled with S_DISABLE_CPU_EXT, and for S_MINIMAL builds
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(S_DISABLE_CPU_EXT) \
+	&& !defined(S_MINIMAL)                                                 \
+	&& (defined(__clang__) || __GNUC__ > 4                                 \
+	    || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define S_X86_CPU_EXT
+#define S_TARGET(t) __attribute__((target(t)))
+#define S_CPU_DONE 1		/* CPUID.1:ECX bit 0 (SSE3, not used) */
+#define S_CPU_PCLMUL (1 << 1)	/* CPUID.1:ECX bit 1 */
+#define S_CPU_SSE2 (1 << 2)	/* CPUID.1:EDX bit 26 (ECX 2 not used) */
+#define S_CPU_SSSE3 (1 << 9)	/* CPUID.1:ECX bit 9 */
+#define S_CPU_SSE42 (1 << 20)	/* CPUID.1:ECX bit 20 */
+#define S_CPU_OSXSAVE (1 << 27) /* CPUID.1:ECX bit 27 */
+#define S_CPU_AVX2 (1U << 31)	/* CPUID.7:EBX bit 5 (ECX 31 not used) */
+unsigned s_cpu(void);
+#endif
+
 /*
  * Debug and alloc counter (used by the test)
  */
@@ -555,6 +627,33 @@ S_INLINE unsigned slog2(uint64_t i)
 	return i > 0xffffffff ? slog2_64(i) : slog2_32((uint32_t)i);
 }
 
+/*
+ * Integer hash (bijective mixers, every input bit affects every output
+ * bit), e.g. for hash tables with integer keys (int32_t/int64_t keys can
+ * be cast to uint32_t/uint64_t). For seeded hashing, XOR the seed to the
+ * key: s_hash_u64(k ^ seed)
+ */
+
+S_INLINE uint32_t s_hash_u32(uint32_t x)
+{
+	/* "lowbias32" (C. Wellons, hash-prospector) */
+	x ^= x >> 16;
+	x *= 0x21f0aaad;
+	x ^= x >> 15;
+	x *= 0x735a2d97;
+	return x ^ (x >> 15);
+}
+
+S_INLINE uint64_t s_hash_u64(uint64_t x)
+{
+	/* SplitMix64 finalizer ("Mix13", D. Stafford) */
+	x ^= x >> 30;
+	x *= ((uint64_t)0xbf58476d << 32) | 0x1ce4e5b9;
+	x ^= x >> 27;
+	x *= ((uint64_t)0x94d049bb << 32) | 0x133111eb;
+	return x ^ (x >> 31);
+}
+
 S_INLINE void s_move_elems(void *t, const size_t t_off, const void *s,
 			   const size_t s_off, const size_t n,
 			   const size_t e_size)
@@ -596,7 +695,7 @@ void s_memset16(void *o, const void *s, size_t n);
 	S_INLINE T FN(T v)                                                     \
 	{                                                                      \
 		size_t i;                                                      \
-		for (i = 1; i < sizeof(T) * 8 / 2; i <<= 1)                    \
+		for (i = 1; i < sizeof(T) * 8; i <<= 1)                        \
 			v |= (v >> i);                                         \
 		return v & ~(v >> 1);                                          \
 	}
@@ -60,10 +60,6 @@ extern "C" {
 	{                                                                      \
 		return stpfix##_size((const srt_data *)c);                     \
 	}                                                                      \
-	S_INLINE void pfix##_set_size(t *c, const size_t s)                    \
-	{                                                                      \
-		stpfix##_set_size((srt_data *)c, s);                           \
-	}                                                                      \
 	S_INLINE size_t pfix##_max_size(const t *c)                            \
 	{                                                                      \
 		return stpfix##_max_size((const srt_data *)c);                 \
@@ -100,6 +96,10 @@ extern "C" {
 	}
 
 #define SD_BUILDFUNCS_ST2(pfix, t, stpfix)                                     \
+	S_INLINE void pfix##_set_size(t *c, const size_t s)                    \
+	{                                                                      \
+		stpfix##_set_size((srt_data *)c, s);                           \
+	}                                                                      \
 	S_INLINE char *pfix##_get_buffer(t *c)                                 \
 	{                                                                      \
 		return stpfix##_get_buffer((srt_data *)c);                     \
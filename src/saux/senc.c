@@ -8,8 +8,15 @@
  */
 
 #include "senc.h"
+#include "schar.h"
 #include "shash.h"
+#ifndef S_MINIMAL
+#include "sb64tbl.h"
+#endif
 #include <stdlib.h>
+#ifdef S_X86_CPU_EXT
+#include <immintrin.h>
+#endif
 
 #define SDEBUG_LZ 0
 #if !defined(SDEBUG_LZ_STATS) && SDEBUG_LZ
@@ -51,15 +58,32 @@ static const uint8_t b64e[64] = {
 	'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
 	'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
 	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
+static const uint8_t b64ue[64] = {
+	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+	'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+	'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+	'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '_'};
+#define NV 0x80 /* not valid */
 static const uint8_t b64d[128] = {
-	0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  62, 0,  0,  0,  63,
-	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0,  0,  0,  0,  0,  0,
-	0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14,
-	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0,  0,  0,  0,  0,
-	0,  26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
-	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0,  0,  0,  0,  0};
+	NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV,
+	NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV,
+	NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, 62, NV, NV, NV, 63,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, NV, NV, NV, NV, NV, NV,
+	NV, 0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, NV, NV, NV, NV, NV,
+	NV, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, NV, NV, NV, NV, NV};
+static const uint8_t b64ud[128] = {
+	NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV,
+	NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV,
+	NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, NV, 62, NV, NV,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, NV, NV, NV, NV, NV, NV,
+	NV, 0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, NV, NV, NV, NV, 63,
+	NV, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, NV, NV, NV, NV, NV};
+#undef NV
 static const uint8_t n2h_l[16] = {48, 49, 50, 51, 52, 53,  54,  55,
 				  56, 57, 97, 98, 99, 100, 101, 102};
 static const uint8_t n2h_u[16] = {48, 49, 50, 51, 52, 53, 54, 55,
@@ -69,6 +93,25 @@ static const uint8_t h2n[64] = {
 	0, 10, 11, 12, 13, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0,  0,  0,  0,  0,  0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 10, 11, 12, 13, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+#ifndef S_MINIMAL
+/* Byte to 2 hex digits (first one in the low byte) */
+#define HEXC(n, a) ((n) < 10 ? '0' + (n) : (a)-10 + (n))
+#define HEXP(i, a) (HEXC((i) >> 4, a) | HEXC((i)&15, a) << 8)
+#define HEXP4(i, a) HEXP(i, a), HEXP(i + 1, a), HEXP(i + 2, a), HEXP(i + 3, a)
+#define HEXP16(i, a)                                                           \
+	HEXP4(i, a), HEXP4(i + 4, a), HEXP4(i + 8, a), HEXP4(i + 12, a)
+#define HEXP64(i, a)                                                           \
+	HEXP16(i, a), HEXP16(i + 16, a), HEXP16(i + 32, a), HEXP16(i + 48, a)
+#define HEXP256(a) HEXP64(0, a), HEXP64(64, a), HEXP64(128, a), HEXP64(192, a)
+static const uint16_t n2hp_l[256] = {HEXP256('a')};
+static const uint16_t n2hp_u[256] = {HEXP256('A')};
+#undef HEXC
+#undef HEXP
+#undef HEXP4
+#undef HEXP16
+#undef HEXP64
+#undef HEXP256
+#endif
 
 /*
  * Macros
@@ -82,6 +125,15 @@ static const uint8_t h2n[64] = {
 #define DB64C2(b, c) ((uint8_t)(b << 4 | c >> 2))
 #define DB64C3(c, d) ((uint8_t)(c << 6 | d))
 
+/* 64-bit word with one byte lane per character (SWAR) */
+#define SWAR_ONES (((uint64_t)0x01010101 << 32) | 0x01010101)
+#define SWAR_REP8(c) ((uint64_t)(c)*SWAR_ONES)
+#define SWAR_REP16(c) ((((uint64_t)(c) << 16 | (c)) << 32) | (c) << 16 | (c))
+/* 0x80 on the lanes >= t (lanes and t < 128), 0 on the others */
+#define SWAR_GE(v, t) (((v) + SWAR_REP8(128 - (t))) & SWAR_REP8(0x80))
+/* Sum of the lanes (the result must be < 256) */
+#define SWAR_SUM(v) (((v)*SWAR_ONES) >> 56)
+
 /*
  * Internal functions
  */
@@ -91,10 +143,104 @@ S_INLINE uint8_t hex2nibble(const int h)
 	return h2n[(h - 48) & 0x3f];
 }
 
+/* 0x80 on the lanes equal to c, 0 on the others (any lane value) */
+S_INLINE uint64_t swar_eq(const uint64_t v, const unsigned c)
+{
+	const uint64_t x = v ^ SWAR_REP8(c);
+	return ~(((x & SWAR_REP8(0x7f)) + SWAR_REP8(0x7f)) | x)
+	       & SWAR_REP8(0x80);
+}
+
+/* Hex digit value, or 0x80 if not valid */
+S_INLINE unsigned hex2nibble_chk(const unsigned h)
+{
+	const unsigned l = h | 0x20;
+	return h - '0' < 10 ? h - '0' : l - 'a' < 6 ? l - 'a' + 10 : 0x80;
+}
+
+#ifdef S_X86_CPU_EXT
+
+#define SHEX_DIGITS(upper)                                                     \
+	(upper ? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8',    \
+			       '9', 'A', 'B', 'C', 'D', 'E', 'F')              \
+	       : _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8',    \
+			       '9', 'a', 'b', 'c', 'd', 'e', 'f'))
+
+/*
+ * Nibble split, digits from a 16-entry table (pshufb), and interleaving.
+ * Backwards, as the scalar code, for aliasing. Returns the input bytes not
+ * processed ("i": input size, "o": output end)
+ */
+S_TARGET("ssse3")
+static size_t senc_hex_ssse3(const uint8_t *s, size_t i, uint8_t *o,
+			     const srt_bool upper)
+{
+	__m128i v, h, l;
+	const __m128i t = SHEX_DIGITS(upper), m = _mm_set1_epi8(0x0f);
+	for (; i >= 16; i -= 16, o -= 32) {
+		v = _mm_loadu_si128((const __m128i *)(s + i - 16));
+		h = _mm_shuffle_epi8(t, _mm_and_si128(_mm_srli_epi16(v, 4), m));
+		l = _mm_shuffle_epi8(t, _mm_and_si128(v, m));
+		_mm_storeu_si128((__m128i *)(o - 32), _mm_unpacklo_epi8(h, l));
+		_mm_storeu_si128((__m128i *)(o - 16), _mm_unpackhi_epi8(h, l));
+	}
+	return i;
+}
+
+S_TARGET("avx2")
+static size_t senc_hex_avx2(const uint8_t *s, size_t i, uint8_t *o,
+			    const srt_bool upper)
+{
+	__m256i v, h, l, a, b;
+	const __m256i t = _mm256_broadcastsi128_si256(SHEX_DIGITS(upper)),
+		      m = _mm256_set1_epi8(0x0f);
+	for (; i >= 32; i -= 32, o -= 64) {
+		v = _mm256_loadu_si256((const __m256i *)(s + i - 32));
+		h = _mm256_shuffle_epi8(
+			t, _mm256_and_si256(_mm256_srli_epi16(v, 4), m));
+		l = _mm256_shuffle_epi8(t, _mm256_and_si256(v, m));
+		/* Interleaving is per 128-bit lane */
+		a = _mm256_unpacklo_epi8(h, l);
+		b = _mm256_unpackhi_epi8(h, l);
+		_mm256_storeu_si256((__m256i *)(o - 64),
+				    _mm256_permute2x128_si256(a, b, 0x20));
+		_mm256_storeu_si256((__m256i *)(o - 32),
+				    _mm256_permute2x128_si256(a, b, 0x31));
+	}
+	return senc_hex_ssse3(s, i, o, upper);
+}
+
+#endif /* #ifdef S_X86_CPU_EXT */
+
+/* SIMD encoding, if available. Returns the input bytes not processed */
+S_INLINE size_t senc_hex_x86(const uint8_t *s, const size_t i, uint8_t *o,
+			     const srt_bool upper)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (i >= 16) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return senc_hex_avx2(s, i, o, upper);
+		if (f & S_CPU_SSSE3)
+			return senc_hex_ssse3(s, i, o, upper);
+	}
+#else
+	(void)s;
+	(void)o;
+	(void)upper;
+#endif
+	return i;
+}
+
 static size_t senc_hex_aux(const uint8_t *s, const size_t ss, uint8_t *o,
-			   const uint8_t *t)
+			   const srt_bool upper)
 {
 	size_t out_size, i, j;
+	const uint8_t *t = upper ? n2h_u : n2h_l;
+#ifndef S_MINIMAL
+	const uint16_t *tp = upper ? n2hp_u : n2hp_l;
+#endif
 	RETURN_IF(!o, ss * 2);
 	RETURN_IF(!s, 0);
 	out_size = ss * 2;
@@ -111,6 +257,16 @@ static size_t senc_hex_aux(const uint8_t *s, const size_t ss, uint8_t *o,
 		i--;
 		j -= 2;
 	}
+	i = senc_hex_x86(s, i, o + j, upper);
+	j = i * 2;
+#ifndef S_MINIMAL
+	/* 4 bytes per loop: output is twice the input, so aliasing is safe */
+	for (; i >= 4; i -= 4, j -= 8)
+		S_ST_LE_U64(o + j - 8,
+			    tp[s[i - 4]] | (uint64_t)tp[s[i - 3]] << 16
+				    | (uint64_t)tp[s[i - 2]] << 32
+				    | (uint64_t)tp[s[i - 1]] << 48);
+#endif
 	for (; i > 0; i -= 2, j -= 4) {
 		ENCHEX_LOOP(j, i);
 		ENCHEX_LOOP(j - 2, i - 1);
@@ -121,249 +277,990 @@ static size_t senc_hex_aux(const uint8_t *s, const size_t ss, uint8_t *o,
 
 /*
  * Base64 encoding/decoding
+ *
+ * Except for S_MINIMAL builds, 6 bytes are encoded per loop using a table
+ * of 4096 character pairs (the URL alphabet is patched from the standard
+ * one), and 4 characters are decoded per loop using tables with the values
+ * already in their output bit positions (so all four are validated at once
+ * and stored as one 32-bit word). The small tables are used for the tails,
+ * the invalid input, and for S_MINIMAL. On x86, the bulk is processed with
+ * SSSE3 or AVX2 (pshufb), 12/24 bytes or 16/32 characters per loop.
  */
 
-size_t senc_b64(const uint8_t *s, const size_t ss, uint8_t *o)
+#ifndef S_MINIMAL
+/*
+ * Standard to URL alphabet: '+' and '/' are the only characters below '0',
+ * becoming '-' (+2) and '_' (+48), told apart by the bit 2 ('/' has it)
+ */
+S_INLINE uint64_t b64_std2url(const uint64_t v)
+{
+	uint64_t m = (~SWAR_GE(v, '0') & SWAR_REP8(0x80)) >> 7;
+	return v + m * 2 + ((v >> 2) & m) * ('_' - '/' - 2);
+}
+#endif
+
+#ifdef S_X86_CPU_EXT
+
+/*
+ * 16 characters from 12 bytes (input in the bytes 4 to 15 of "v"):
+ * 6-bit indexes, moved into bytes, and then the alphabet offset, from the
+ * index range (0-25: 'A', 26-51: 'a', 52-61: '0', 62, 63)
+ */
+S_TARGET("ssse3")
+S_INLINE __m128i senc_b64_blk_ssse3(__m128i v, const __m128i off)
+{
+	__m128i a, b;
+	v = _mm_shuffle_epi8(v, _mm_setr_epi8(5, 4, 6, 5, 8, 7, 9, 8, 11, 10,
+					      12, 11, 14, 13, 15, 14));
+	a = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00)),
+			    _mm_set1_epi32(0x04000040));
+	b = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003f03f0)),
+			    _mm_set1_epi32(0x01000010));
+	v = _mm_or_si128(a, b);
+	a = _mm_subs_epu8(v, _mm_set1_epi8(51));
+	b = _mm_cmpgt_epi8(_mm_set1_epi8(26), v);
+	a = _mm_or_si128(a, _mm_and_si128(b, _mm_set1_epi8(13)));
+	return _mm_add_epi8(v, _mm_shuffle_epi8(off, a));
+}
+
+#define SB64_OFF(url)                                                          \
+	_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,        \
+		      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,        \
+		      '0' - 52, (url ? '-' : '+') - 62,                        \
+		      (url ? '_' : '/') - 63, 'A', 0, 0)
+
+/*
+ * Backwards, as the scalar code, for aliasing. Returns the input bytes not
+ * processed ("i": input size, multiple of 3, "o": output end)
+ */
+S_TARGET("ssse3")
+static size_t senc_b64_ssse3(const uint8_t *s, size_t i, uint8_t *o,
+			     const srt_bool url)
+{
+	const __m128i off = SB64_OFF(url);
+	for (; i >= 16; i -= 12, o -= 16)
+		_mm_storeu_si128(
+			(__m128i *)(o - 16),
+			senc_b64_blk_ssse3(
+				_mm_loadu_si128((const __m128i *)(s + i - 16)),
+				off));
+	return i;
+}
+
+S_TARGET("avx2")
+static size_t senc_b64_avx2(const uint8_t *s, size_t i, uint8_t *o,
+			    const srt_bool url)
+{
+	__m256i v, a, b;
+	const __m256i off = _mm256_broadcastsi128_si256(SB64_OFF(url)),
+		      sh = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7,
+					    10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5,
+					    4, 7, 6, 8, 7, 10, 9, 11, 10);
+	for (; i >= 32; i -= 24, o -= 32) {
+		/* Bytes 8 to 19 to the low lane, 20 to 31 to the high one */
+		v = _mm256_loadu_si256((const __m256i *)(s + i - 32));
+		v = _mm256_permutevar8x32_epi32(
+			v, _mm256_setr_epi32(2, 3, 4, 5, 5, 6, 7, 7));
+		v = _mm256_shuffle_epi8(v, sh);
+		a = _mm256_mulhi_epu16(
+			_mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00)),
+			_mm256_set1_epi32(0x04000040));
+		b = _mm256_mullo_epi16(
+			_mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0)),
+			_mm256_set1_epi32(0x01000010));
+		v = _mm256_or_si256(a, b);
+		a = _mm256_subs_epu8(v, _mm256_set1_epi8(51));
+		b = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), v);
+		a = _mm256_or_si256(a,
+				    _mm256_and_si256(b, _mm256_set1_epi8(13)));
+		v = _mm256_add_epi8(v, _mm256_shuffle_epi8(off, a));
+		_mm256_storeu_si256((__m256i *)(o - 32), v);
+	}
+	return senc_b64_ssse3(s, i, o, url);
+}
+
+/*
+ * Character validation: bit set for the high nibble (2 to 7, the rest
+ * being always invalid), and the high nibbles not valid for every low
+ * nibble. The value is the character plus an offset from the high nibble
+ * (index 10 or 13 for the character 63: '/' or '_')
+ */
+#define SB64_HI                                                                \
+	_mm_setr_epi8(0x40, 0x40, 1, 2, 4, 8, 0x10, 0x20, 0x40, 0x40, 0x40,    \
+		      0x40, 0x40, 0x40, 0x40, 0x40)
+#define SB64_LO(url)                                                           \
+	(url ? _mm_setr_epi8(0x55, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,   \
+			     0x41, 0x41, 0x43, 0x6b, 0x6b, 0x6a, 0x6b, 0x63)   \
+	     : _mm_setr_epi8(0x55, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,   \
+			     0x41, 0x41, 0x43, 0x6a, 0x6b, 0x6b, 0x6b, 0x6a))
+#define SB64_ROLL(url)                                                         \
+	_mm_setr_epi8(0, 0, url ? 62 - '-' : 62 - '+', 52 - '0', -'A', -'A',   \
+		      26 - 'a', 26 - 'a', 0, 0, 63 - '/', 0, 0, 63 - '_', 0, 0)
+
+/*
+ * 16 characters to 12 bytes (in the bytes 0 to 11, the rest being zero),
+ * "c63": the character for the value 63. Returns 0 on invalid characters
+ */
+S_TARGET("ssse3")
+S_INLINE int sdec_b64_blk_ssse3(__m128i v, const __m128i lo,
+				const __m128i roll, const __m128i c63,
+				__m128i *out)
+{
+	__m128i h, x;
+	const __m128i m = _mm_set1_epi8(0x0f);
+	h = _mm_and_si128(_mm_srli_epi32(v, 4), m);
+	x = _mm_and_si128(_mm_shuffle_epi8(SB64_HI, h),
+			  _mm_shuffle_epi8(lo, _mm_and_si128(v, m)));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi8(x, _mm_setzero_si128())))
+		return 0;
+	h = _mm_or_si128(h, _mm_and_si128(_mm_cmpeq_epi8(v, c63),
+					  _mm_set1_epi8(8)));
+	v = _mm_add_epi8(v, _mm_shuffle_epi8(roll, h));
+	v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+	v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+	*out = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+						 13, 12, -1, -1, -1, -1));
+	return 1;
+}
+
+/*
+ * Decoding while the blocks are valid, stopping at the first one not
+ * valid (left to the scalar code). At least 24 characters are kept after
+ * the last block, so the extra output bytes written are rewritten later.
+ * Returns the characters processed
+ */
+S_TARGET("ssse3")
+static size_t sdec_b64_ssse3(const uint8_t *s, const size_t ss, uint8_t *o,
+			     const srt_bool url)
+{
+	size_t i = 0;
+	__m128i v, r;
+	const __m128i lo = SB64_LO(url), roll = SB64_ROLL(url),
+		      c63 = _mm_set1_epi8(url ? '_' : '/');
+	for (; i + 16 + 24 <= ss; i += 16, o += 12) {
+		v = _mm_loadu_si128((const __m128i *)(s + i));
+		if (!sdec_b64_blk_ssse3(v, lo, roll, c63, &r))
+			break;
+		_mm_storeu_si128((__m128i *)o, r);
+	}
+	return i;
+}
+
+S_TARGET("avx2")
+static size_t sdec_b64_avx2(const uint8_t *s, const size_t ss, uint8_t *o,
+			    const srt_bool url)
+{
+	size_t i = 0;
+	__m256i v, h, x;
+	const __m256i m = _mm256_set1_epi8(0x0f),
+		      hi = _mm256_broadcastsi128_si256(SB64_HI),
+		      lo = _mm256_broadcastsi128_si256(SB64_LO(url)),
+		      roll = _mm256_broadcastsi128_si256(SB64_ROLL(url)),
+		      c63 = _mm256_set1_epi8(url ? '_' : '/');
+	for (; i + 32 + 24 <= ss; i += 32, o += 24) {
+		v = _mm256_loadu_si256((const __m256i *)(s + i));
+		h = _mm256_and_si256(_mm256_srli_epi32(v, 4), m);
+		x = _mm256_and_si256(
+			_mm256_shuffle_epi8(hi, h),
+			_mm256_shuffle_epi8(lo, _mm256_and_si256(v, m)));
+		if (_mm256_movemask_epi8(
+			    _mm256_cmpgt_epi8(x, _mm256_setzero_si256())))
+			break;
+		h = _mm256_or_si256(
+			h, _mm256_and_si256(_mm256_cmpeq_epi8(v, c63),
+					    _mm256_set1_epi8(8)));
+		v = _mm256_add_epi8(v, _mm256_shuffle_epi8(roll, h));
+		v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+		v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+		v = _mm256_shuffle_epi8(
+			v, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13,
+					    12, -1, -1, -1, -1, 2, 1, 0, 6, 5,
+					    4, 10, 9, 8, 14, 13, 12, -1, -1,
+					    -1, -1));
+		/* 12 bytes per lane, joined */
+		_mm256_storeu_si256(
+			(__m256i *)o,
+			_mm256_permutevar8x32_epi32(
+				v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7)));
+	}
+	return i + sdec_b64_ssse3(s + i, ss - i, o, url);
+}
+
+#endif /* #ifdef S_X86_CPU_EXT */
+
+/*
+ * SIMD encoding (backwards, from the end of the whole 3-byte groups), if
+ * available. Returns the input bytes not processed
+ */
+S_INLINE size_t senc_b64_x86(const uint8_t *s, const size_t i, uint8_t *o,
+			     const srt_bool url)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (i >= 16) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return senc_b64_avx2(s, i, o, url);
+		if (f & S_CPU_SSSE3)
+			return senc_b64_ssse3(s, i, o, url);
+	}
+#else
+	(void)s;
+	(void)o;
+	(void)url;
+#endif
+	return i;
+}
+
+/* SIMD decoding, if available. Returns the characters processed */
+S_INLINE size_t sdec_b64_x86(const uint8_t *s, const size_t ss, uint8_t *o,
+			     const srt_bool url)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (ss >= 16 + 24) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return sdec_b64_avx2(s, ss, o, url);
+		if (f & S_CPU_SSSE3)
+			return sdec_b64_ssse3(s, ss, o, url);
+	}
+#else
+	(void)s;
+	(void)ss;
+	(void)o;
+	(void)url;
+#endif
+	return 0;
+}
+
+static size_t senc_b64_aux(const uint8_t *s, const size_t ss, uint8_t *o,
+			   const srt_bool url)
 {
 	unsigned si0, si1, si2;
 	size_t ssod4, ssd3, tail, i, j, out_size;
-	RETURN_IF(!o, (ss / 3 + (ss % 3 ? 1 : 0)) * 4);
-	RETURN_IF(!s, 0);
-	ssod4 = (ss / 3) * 4;
+	const uint8_t *t = url ? b64ue : b64e;
+#ifndef S_MINIMAL
+	uint64_t x, y;
+#endif
 	ssd3 = ss - (ss % 3);
 	tail = ss - ssd3;
+	ssod4 = (ss / 3) * 4;
+	/* BEHAVIOR: base64url output is not padded */
+	out_size = ssod4 + (!tail ? 0 : url ? tail + 1 : 4);
+	RETURN_IF(!o, out_size);
+	RETURN_IF(!s, 0);
 	i = ssd3;
-	j = ssod4 + (tail ? 4 : 0);
-	out_size = j;
-	switch (tail) {
-	case 2:
-		si0 = s[ssd3];
-		si1 = s[ssd3 + 1];
-		o[j - 4] = b64e[EB64C1(si0)];
-		o[j - 3] = b64e[EB64C2(si0, si1)];
-		o[j - 2] = b64e[EB64C3(si1, 0)];
-		o[j - 1] = '=';
-		j -= 4;
-		break;
-	case 1:
+	j = out_size;
+	if (tail) {
 		si0 = s[ssd3];
-		o[j - 4] = b64e[EB64C1(si0)];
-		o[j - 3] = b64e[EB64C2(si0, 0)];
-		o[j - 2] = '=';
-		o[j - 1] = '=';
-		j -= 4;
+		si1 = tail == 2 ? s[ssd3 + 1] : 0;
+		if (!url) {
+			o[--j] = '=';
+			if (tail == 1)
+				o[--j] = '=';
+		}
+		if (tail == 2)
+			o[--j] = t[EB64C3(si1, 0)];
+		o[--j] = t[EB64C2(si0, si1)];
+		o[--j] = t[EB64C1(si0)];
 	}
+	i = senc_b64_x86(s, i, o + j, url);
+	j = (i / 3) * 4;
+#ifndef S_MINIMAL
+	/*
+	 * Backwards, as the scalar loop: being the output bigger than the
+	 * input, the written area never overlaps the pending input (aliasing)
+	 */
+	for (; i >= 6; i -= 6, j -= 8) {
+		x = (uint64_t)s[i - 6] << 40 | (uint64_t)s[i - 5] << 32
+		    | (uint64_t)s[i - 4] << 24 | (uint64_t)s[i - 3] << 16
+		    | (uint64_t)s[i - 2] << 8 | s[i - 1];
+		y = sb64_e12[x >> 36]
+		    | (uint64_t)sb64_e12[(x >> 24) & 0xfff] << 16
+		    | (uint64_t)sb64_e12[(x >> 12) & 0xfff] << 32
+		    | (uint64_t)sb64_e12[x & 0xfff] << 48;
+		S_ST_LE_U64(o + j - 8, url ? b64_std2url(y) : y);
+	}
+#endif
 	for (; i > 0; i -= 3, j -= 4) {
 		si0 = s[i - 3];
 		si1 = s[i - 2];
 		si2 = s[i - 1];
-		o[j - 4] = b64e[EB64C1(si0)];
-		o[j - 3] = b64e[EB64C2(si0, si1)];
-		o[j - 2] = b64e[EB64C3(si1, si2)];
-		o[j - 1] = b64e[EB64C4(si2)];
+		o[j - 4] = t[EB64C1(si0)];
+		o[j - 3] = t[EB64C2(si0, si1)];
+		o[j - 2] = t[EB64C3(si1, si2)];
+		o[j - 1] = t[EB64C4(si2)];
 	}
 	return out_size;
 }
 
-size_t sdec_b64(const uint8_t *s, const size_t ss, uint8_t *o)
+/* Bytes >= 128 are not valid */
+#define B64D(t, c) ((t)[(c)&0x7f] | ((c)&0x80))
+
+/*
+ * BEHAVIOR: in non-strict mode, characters not in the alphabet are decoded
+ * as zero, padding is optional, and a trailing single character is ignored.
+ * In strict mode, any of those, misplaced padding, or non-zero unused bits
+ * in the last character, make the decoding fail (0 output bytes).
+ * Standard base64 requires padding in strict mode, base64url does not.
+ * Non-final parts of a stream (whole quanta) are decoded with "part" set,
+ * so padding is not expected there.
+ */
+static size_t sdec_b64_aux(const uint8_t *s, const size_t ss, uint8_t *o,
+			   const srt_bool url, const srt_bool strict,
+			   const srt_bool part)
 {
-	size_t i, j, ssd4, tail;
-	RETURN_IF(!o, (ss / 4) * 3);
-	RETURN_IF(!s, 0);
-	i = 0;
-	j = 0;
-	ssd4 = ss - (ss % 4);
-	tail = s[ss - 2] == '=' || s[ss - 1] == '=' ? 4 : 0;
-	for (; i < ssd4 - tail; i += 4, j += 3) {
-		const int a = b64d[s[i]], b = b64d[s[i + 1]],
-			  c = b64d[s[i + 2]], d = b64d[s[i + 3]];
+	unsigned a, b, c, d;
+	size_t n, i, j, k, full, tail, simd = 0;
+	const uint8_t *t = url ? b64ud : b64d;
+#ifndef S_MINIMAL
+	uint32_t x;
+	const uint32_t rej = SB64_NV | (url ? SB64_STD : SB64_URL);
+#endif
+	RETURN_IF(!o, (ss / 4) * 3 + (ss % 4 ? ss % 4 - 1 : 0));
+	RETURN_IF(!s || !ss, 0);
+	n = ss;
+	if (!part && s[n - 1] == '=') {
+		n--;
+		if (n > 0 && s[n - 1] == '=')
+			n--;
+	}
+	tail = n % 4;
+	full = n - tail;
+	if (strict && (n < ss ? ss % 4 != 0 : !url && tail != 0))
+		return 0;
+	for (i = j = 0; i < full; i += 4, j += 3) {
+		if (i >= simd) {
+			k = sdec_b64_x86(s + i, full - i, o + j, url);
+			i += k;
+			j += (k / 4) * 3;
+			simd = i + 16; /* not valid block: scalar code */
+		}
+#ifndef S_MINIMAL
+		x = sb64_d0[s[i]] | sb64_d1[s[i + 1]] | sb64_d2[s[i + 2]]
+		    | sb64_d3[s[i + 3]];
+		if (!(x & rej)) {
+			/* 4-byte store: the extra one is rewritten later */
+			if (i + 4 < full) {
+				S_ST_LE_U32(o + j, x);
+			} else {
+				o[j] = (uint8_t)x;
+				o[j + 1] = (uint8_t)(x >> 8);
+				o[j + 2] = (uint8_t)(x >> 16);
+			}
+			continue;
+		}
+#endif
+		a = B64D(t, s[i]);
+		b = B64D(t, s[i + 1]);
+		c = B64D(t, s[i + 2]);
+		d = B64D(t, s[i + 3]);
+		if ((a | b | c | d) & 0x80) {
+			RETURN_IF(strict, 0);
+			a &= 0x3f;
+			b &= 0x3f;
+			c &= 0x3f;
+			d &= 0x3f;
+		}
 		o[j] = DB64C1(a, b);
 		o[j + 1] = DB64C2(b, c);
 		o[j + 2] = DB64C3(c, d);
 	}
-	if (tail) {
-		const int a = b64d[s[i] & 0x7f], b = b64d[s[i + 1] & 0x7f];
+	if (tail >= 2) {
+		a = B64D(t, s[i]);
+		b = B64D(t, s[i + 1]);
+		c = tail == 3 ? B64D(t, s[i + 2]) : 0;
+		if ((a | b | c) & 0x80) {
+			RETURN_IF(strict, 0);
+			a &= 0x3f;
+			b &= 0x3f;
+			c &= 0x3f;
+		}
+		RETURN_IF(strict && (tail == 2 ? b & 0xf : c & 3), 0);
 		o[j++] = DB64C1(a, b);
-		if (s[i + 2] != '=') {
-			const int c = b64d[s[i + 2] & 0x7f];
+		if (tail == 3)
 			o[j++] = DB64C2(b, c);
-		}
+	} else {
+		RETURN_IF(strict && tail == 1, 0);
 	}
 	return j;
 }
 
+size_t senc_b64(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return senc_b64_aux(s, ss, o, S_FALSE);
+}
+
+size_t sdec_b64(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return sdec_b64_aux(s, ss, o, S_FALSE, S_FALSE, S_FALSE);
+}
+
+size_t sdec_b64_strict(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return sdec_b64_aux(s, ss, o, S_FALSE, S_TRUE, S_FALSE);
+}
+
+size_t senc_b64url(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return senc_b64_aux(s, ss, o, S_TRUE);
+}
+
+size_t sdec_b64url(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return sdec_b64_aux(s, ss, o, S_TRUE, S_FALSE, S_FALSE);
+}
+
+size_t sdec_b64url_strict(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return sdec_b64_aux(s, ss, o, S_TRUE, S_TRUE, S_FALSE);
+}
+
 /*
  * Hexadecimal encoding/decoding
  */
 
 size_t senc_hex(const uint8_t *s, const size_t ss, uint8_t *o)
 {
-	return senc_hex_aux(s, ss, o, n2h_l);
+	return senc_hex_aux(s, ss, o, S_FALSE);
 }
 
 size_t senc_HEX(const uint8_t *s, const size_t ss, uint8_t *o)
 {
-	return senc_hex_aux(s, ss, o, n2h_u);
+	return senc_hex_aux(s, ss, o, S_TRUE);
+}
+
+/*
+ * Decoding of 8 hex digits into 4 bytes, or 0x100000000 if not valid
+ * (lowercase conversion, per-lane range checks, and nibble packing)
+ */
+S_INLINE uint64_t sdec_hex_swar(const uint64_t c)
+{
+	uint64_t l = c | SWAR_REP8(0x20),
+		 dg = SWAR_GE(c, '0') & ~SWAR_GE(c, '9' + 1),
+		 al = SWAR_GE(l, 'a') & ~SWAR_GE(l, 'f' + 1), v;
+	if (((dg | al) & ~c & SWAR_REP8(0x80)) != SWAR_REP8(0x80))
+		return (uint64_t)1 << 32;
+	v = l - SWAR_REP8('0') - (al >> 7) * ('a' - '0' - 10);
+	v = ((v & SWAR_REP16(0x0f)) << 4) | ((v >> 8) & SWAR_REP16(0x0f));
+	v = (v | v >> 8) & (((uint64_t)0xffff << 32) | 0xffff);
+	return (v | v >> 16) & 0xffffffff;
+}
+
+#ifdef S_X86_CPU_EXT
+
+/*
+ * 16 hex digits into 8 bytes (low half, the rest being zero), validating
+ * them (unsigned range checks: '0'-'9', and 'a'-'f' after lowercase
+ * conversion). Returns 0 if not valid
+ */
+S_TARGET("ssse3")
+S_INLINE int sdec_hex_blk_ssse3(const __m128i c, __m128i *out)
+{
+	__m128i d, a, dg, al;
+	d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+	a = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)),
+			 _mm_set1_epi8('a'));
+	dg = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+	al = _mm_cmpeq_epi8(_mm_min_epu8(a, _mm_set1_epi8(5)), a);
+	if (_mm_movemask_epi8(_mm_or_si128(dg, al)) != 0xffff)
+		return 0;
+	a = _mm_add_epi8(a, _mm_set1_epi8(10));
+	d = _mm_or_si128(_mm_and_si128(dg, d), _mm_andnot_si128(dg, a));
+	/* Digit pairs: first one x 16 + second one */
+	d = _mm_maddubs_epi16(d, _mm_set1_epi16(0x0110));
+	*out = _mm_packus_epi16(d, _mm_setzero_si128());
+	return 1;
+}
+
+/*
+ * Decoding while the blocks are valid, stopping at the first one not
+ * valid (left to the scalar code, for the error). Returns the digits
+ * processed
+ */
+S_TARGET("ssse3")
+static size_t sdec_hex_ssse3(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	size_t i = 0;
+	__m128i v;
+	for (; i + 16 <= ss; i += 16, o += 8) {
+		v = _mm_loadu_si128((const __m128i *)(s + i));
+		if (!sdec_hex_blk_ssse3(v, &v))
+			break;
+		_mm_storel_epi64((__m128i *)o, v);
+	}
+	return i;
+}
+
+S_TARGET("avx2")
+static size_t sdec_hex_avx2(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	size_t i = 0;
+	__m256i c, d, a, dg, al;
+	for (; i + 32 <= ss; i += 32, o += 16) {
+		c = _mm256_loadu_si256((const __m256i *)(s + i));
+		d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+		a = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)),
+				    _mm256_set1_epi8('a'));
+		dg = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)),
+				       d);
+		al = _mm256_cmpeq_epi8(_mm256_min_epu8(a, _mm256_set1_epi8(5)),
+				       a);
+		if (_mm256_movemask_epi8(_mm256_or_si256(dg, al)) != -1)
+			break;
+		d = _mm256_blendv_epi8(_mm256_add_epi8(a, _mm256_set1_epi8(10)),
+				       d, dg);
+		d = _mm256_maddubs_epi16(d, _mm256_set1_epi16(0x0110));
+		/* 8 bytes per lane, joined */
+		d = _mm256_permute4x64_epi64(_mm256_packus_epi16(d, d), 0x08);
+		_mm_storeu_si128((__m128i *)o, _mm256_castsi256_si128(d));
+	}
+	return i + sdec_hex_ssse3(s + i, ss - i, o);
+}
+
+#endif /* #ifdef S_X86_CPU_EXT */
+
+/* SIMD decoding, if available. Returns the digits processed */
+S_INLINE size_t sdec_hex_x86(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (ss >= 16) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return sdec_hex_avx2(s, ss, o);
+		if (f & S_CPU_SSSE3)
+			return sdec_hex_ssse3(s, ss, o);
+	}
+#else
+	(void)s;
+	(void)ss;
+	(void)o;
+#endif
+	return 0;
 }
 
+/*
+ * BEHAVIOR: if the input has a non-hex character no output is generated
+ * (0 bytes). An odd trailing character is ignored.
+ */
 size_t sdec_hex(const uint8_t *s, const size_t ss, uint8_t *o)
 {
-	size_t ssd2, ssd4, i, j;
+	size_t ssd2, i, j;
+	uint64_t w;
+	unsigned a, b;
 	RETURN_IF(!o, ss / 2);
 	ssd2 = ss - (ss % 2);
-	ssd4 = ss - (ss % 4);
 	ASSERT_RETURN_IF(!ssd2, 0);
-	i = 0;
-	j = 0;
-#define SDEC_HEX_L(n, m)                                                       \
-	o[j + n] = (uint8_t)(hex2nibble(s[i + m]) << 4)                        \
-		   | hex2nibble(s[i + m + 1]);
-	for (; i < ssd4; i += 4, j += 2) {
-		SDEC_HEX_L(0, 0);
-		SDEC_HEX_L(1, 2);
-	}
-	for (; i < ssd2; i += 2, j += 1)
-		SDEC_HEX_L(0, 0);
-#undef SDEC_HEX_L
+	/* Output is half the input: aliasing is safe going forward */
+	i = sdec_hex_x86(s, ssd2, o);
+	for (j = i / 2; i + 8 <= ssd2; i += 8, j += 4) {
+		w = sdec_hex_swar(S_LD_LE_U64(s + i));
+		RETURN_IF(w >> 32, 0);
+		S_ST_LE_U32(o + j, (uint32_t)w);
+	}
+	for (; i < ssd2; i += 2, j++) {
+		a = hex2nibble_chk(s[i]);
+		b = hex2nibble_chk(s[i + 1]);
+		RETURN_IF((a | b) & 0x80, 0);
+		o[j] = (uint8_t)(a << 4 | b);
+	}
 	return j;
 }
 
-S_INLINE size_t senc_esc_xml_req_size(const uint8_t *s, const size_t ss)
+/*
+ * JSON, XML, URL and quote escaping/unescaping
+ *
+ * The input is scanned one 64-bit word per loop (SWAR), testing all bytes
+ * at once, so clean words (no bytes requiring escaping) are counted and
+ * copied as a whole, and only the other ones are processed byte by byte.
+ * Escaping goes backwards (aliasing safe, as the output is not smaller than
+ * the input), and stops as soon as the remaining input is known to be
+ * clean, as it is already in place when escaping in-place. Unescaping goes
+ * forward, skipping the words not having the escape character. On x86,
+ * clean runs are scanned, counted, and copied 16/32 bytes per loop (SSE2
+ * or AVX2, selected at run time), the SWAR code being used for the rest.
+ */
+
+enum eSEsc { SESC_XML, SESC_JSON, SESC_URL, SESC_BYTE };
+
+#ifdef S_X86_CPU_EXT
+
+/*
+ * Extra output bytes per input byte when escaping (0: not escaped). Signed
+ * compares: bytes >= 128 are out of the ASCII ranges
+ */
+S_TARGET("sse2")
+S_INLINE __m128i esc_w_sse2(const __m128i v, const enum eSEsc k,
+			    const uint8_t tgt)
 {
-	size_t i = 0, sso = ss;
-	for (; i < ss; i++)
-		switch (s[i]) {
-		case '"':
-		case '\'':
-			sso += 5;
-			continue;
-		case '&':
-			sso += 4;
-			continue;
-		case '<':
-		case '>':
-			sso += 3;
-			continue;
-		default:
-			continue;
-		}
-	return sso;
+	__m128i a, b, c;
+#define ESC_EQ(x) _mm_cmpeq_epi8(v, _mm_set1_epi8(x))
+#define ESC_IN(x, lo, hi)                                                      \
+	_mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8((lo)-1)),              \
+		      _mm_cmplt_epi8(x, _mm_set1_epi8((hi) + 1)))
+	switch (k) {
+	case SESC_XML:
+		a = _mm_or_si128(ESC_EQ('"'), ESC_EQ('\''));
+		b = _mm_or_si128(ESC_EQ('<'), ESC_EQ('>'));
+		return _mm_or_si128(
+			_mm_or_si128(_mm_and_si128(a, _mm_set1_epi8(5)),
+				     _mm_and_si128(ESC_EQ('&'),
+						   _mm_set1_epi8(4))),
+			_mm_and_si128(b, _mm_set1_epi8(3)));
+	case SESC_JSON:
+		a = _mm_andnot_si128(ESC_EQ('\v'), ESC_IN(v, '\b', '\r'));
+		b = _mm_or_si128(ESC_EQ('"'), ESC_EQ('\\'));
+		return _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi8(1));
+	case SESC_URL:
+		c = _mm_or_si128(v, _mm_set1_epi8(0x20));
+		a = _mm_or_si128(ESC_IN(v, '0', '9'), ESC_IN(c, 'a', 'z'));
+		b = _mm_or_si128(_mm_or_si128(ESC_EQ('-'), ESC_EQ('_')),
+				 _mm_or_si128(ESC_EQ('.'), ESC_EQ('~')));
+		return _mm_andnot_si128(_mm_or_si128(a, b), _mm_set1_epi8(2));
+	default: /* SESC_BYTE */
+		return _mm_and_si128(ESC_EQ((char)tgt), _mm_set1_epi8(1));
+	}
+#undef ESC_EQ
+#undef ESC_IN
 }
 
-size_t senc_esc_xml(const uint8_t *s, const size_t ss, uint8_t *o,
-		    const size_t known_sso)
+S_TARGET("avx2")
+S_INLINE __m256i esc_w_avx2(const __m256i v, const enum eSEsc k,
+			    const uint8_t tgt)
 {
-	size_t sso, i, j;
-	RETURN_IF(!s, 0);
-	sso = known_sso ? known_sso : senc_esc_xml_req_size(s, ss);
-	RETURN_IF(!o, sso);
-	RETURN_IF(!ss, 0);
-	i = ss - 1;
-	j = sso;
-	for (; i != (size_t)-1; i--) {
-		switch (s[i]) {
-		case '"':
-			j -= 6;
-			memcpy(o + j, "&quot;", 6);
-			continue;
-		case '&':
-			j -= 5;
-			memcpy(o + j, "&amp;", 5);
-			continue;
-		case '\'':
-			j -= 6;
-			memcpy(o + j, "&apos;", 6);
-			continue;
-		case '<':
-			j -= 4;
-			memcpy(o + j, "&lt;", 4);
-			continue;
-		case '>':
-			j -= 4;
-			memcpy(o + j, "&gt;", 4);
-			continue;
-		default:
-			o[--j] = s[i];
-			continue;
-		}
+	__m256i a, b, c;
+#define ESC_EQ(x) _mm256_cmpeq_epi8(v, _mm256_set1_epi8(x))
+#define ESC_IN(x, lo, hi)                                                      \
+	_mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8((lo)-1)),     \
+			 _mm256_cmpgt_epi8(_mm256_set1_epi8((hi) + 1), x))
+	switch (k) {
+	case SESC_XML:
+		a = _mm256_or_si256(ESC_EQ('"'), ESC_EQ('\''));
+		b = _mm256_or_si256(ESC_EQ('<'), ESC_EQ('>'));
+		return _mm256_or_si256(
+			_mm256_or_si256(_mm256_and_si256(a, _mm256_set1_epi8(5)),
+					_mm256_and_si256(ESC_EQ('&'),
+							 _mm256_set1_epi8(4))),
+			_mm256_and_si256(b, _mm256_set1_epi8(3)));
+	case SESC_JSON:
+		a = _mm256_andnot_si256(ESC_EQ('\v'), ESC_IN(v, '\b', '\r'));
+		b = _mm256_or_si256(ESC_EQ('"'), ESC_EQ('\\'));
+		return _mm256_and_si256(_mm256_or_si256(a, b),
+					_mm256_set1_epi8(1));
+	case SESC_URL:
+		c = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+		a = _mm256_or_si256(ESC_IN(v, '0', '9'), ESC_IN(c, 'a', 'z'));
+		b = _mm256_or_si256(_mm256_or_si256(ESC_EQ('-'), ESC_EQ('_')),
+				    _mm256_or_si256(ESC_EQ('.'), ESC_EQ('~')));
+		return _mm256_andnot_si256(_mm256_or_si256(a, b),
+					   _mm256_set1_epi8(2));
+	default: /* SESC_BYTE */
+		return _mm256_and_si256(ESC_EQ((char)tgt), _mm256_set1_epi8(1));
 	}
-	return sso;
+#undef ESC_EQ
+#undef ESC_IN
 }
 
-size_t sdec_esc_xml(const uint8_t *s, const size_t ss, uint8_t *o)
+/* Sum of the two 64-bit lanes */
+S_TARGET("sse2")
+S_INLINE size_t esc_sum_sse2(__m128i v)
 {
-	size_t i, j;
-	RETURN_IF(!o, ss);
-	RETURN_IF(!s || !ss, 0);
-	for (i = j = 0; i < ss; j++) {
-		if (s[i] == '&') {
-			switch (s[i + 1]) {
-			case 'q':
-				if (i + 5 <= ss && s[i + 2] == 'u'
-				    && s[i + 3] == 'o' && s[i + 4] == 't'
-				    && s[i + 5] == ';') {
-					o[j] = '"';
-					i += 6;
-					continue;
-				}
-				break;
-			case 'a':
-				if (i + 4 <= ss && s[i + 2] == 'm'
-				    && s[i + 3] == 'p' && s[i + 4] == ';') {
-					o[j] = '&';
-					i += 5;
-					continue;
-				}
-				if (i + 5 <= ss && s[i + 2] == 'p'
-				    && s[i + 3] == 'o' && s[i + 4] == 's'
-				    && s[i + 5] == ';') {
-					o[j] = '\'';
-					i += 6;
-					continue;
-				}
-				break;
-			case 'l':
-				if (i + 3 <= ss && s[i + 2] == 't'
-				    && s[i + 3] == ';') {
-					o[j] = '<';
-					i += 4;
-					continue;
-				}
-				break;
-			case 'g':
-				if (i + 3 <= ss && s[i + 2] == 't'
-				    && s[i + 3] == ';') {
-					o[j] = '>';
-					i += 4;
-					continue;
-				}
-				break;
-#if 0 /* BEHAVIOR: not implemented (on purpose) */
-			case '#':
-				break;
+	v = _mm_add_epi64(v, _mm_unpackhi_epi64(v, v));
+#if SIZE_MAX > 0xffffffff
+	return (size_t)_mm_cvtsi128_si64(v);
+#else
+	return (size_t)_mm_cvtsi128_si32(v);
 #endif
-			default:
-				break;
-			}
-		}
-		o[j] = s[i++];
+}
+
+/* Extra output bytes (escaping), "i" being the input bytes processed */
+S_TARGET("sse2")
+static size_t esc_req_sse2(const uint8_t *s, const size_t ss,
+			   const enum eSEsc k, const uint8_t tgt, size_t *i)
+{
+	__m128i acc = _mm_setzero_si128(), v;
+	for (; *i + 16 <= ss; *i += 16) {
+		v = esc_w_sse2(_mm_loadu_si128((const __m128i *)(s + *i)), k,
+			       tgt);
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(v, _mm_setzero_si128()));
 	}
-	return j;
+	return esc_sum_sse2(acc);
 }
 
-S_INLINE size_t senc_esc_json_req_size(const uint8_t *s, const size_t ss)
+S_TARGET("avx2")
+static size_t esc_req_avx2(const uint8_t *s, const size_t ss,
+			   const enum eSEsc k, const uint8_t tgt, size_t *i)
 {
-	size_t i = 0, sso = ss;
-	for (; i < ss; i++)
+	const __m256i z = _mm256_setzero_si256();
+	__m256i acc = z, v;
+	for (; *i + 32 <= ss; *i += 32) {
+		v = esc_w_avx2(_mm256_loadu_si256((const __m256i *)(s + *i)), k,
+			       tgt);
+		acc = _mm256_add_epi64(acc, _mm256_sad_epu8(v, z));
+	}
+	return esc_sum_sse2(_mm_add_epi64(_mm256_castsi256_si128(acc),
+					  _mm256_extracti128_si256(acc, 1)))
+	       + esc_req_sse2(s, ss, k, tgt, i);
+}
+
+/*
+ * Backwards escaping of the clean blocks before "i", stopping at the first
+ * one requiring escaping ("j": output position). Returns the bytes copied
+ */
+S_TARGET("sse2")
+static size_t esc_enc_sse2(const uint8_t *s, size_t i, uint8_t *o, size_t j,
+			   const enum eSEsc k, const uint8_t tgt)
+{
+	const size_t i0 = i;
+	__m128i v;
+	for (; i >= 16; i -= 16, j -= 16) {
+		v = _mm_loadu_si128((const __m128i *)(s + i - 16));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(esc_w_sse2(v, k, tgt),
+						     _mm_setzero_si128()))
+		    != 0xffff)
+			break;
+		_mm_storeu_si128((__m128i *)(o + j - 16), v);
+	}
+	return i0 - i;
+}
+
+S_TARGET("avx2")
+static size_t esc_enc_avx2(const uint8_t *s, size_t i, uint8_t *o, size_t j,
+			   const enum eSEsc k, const uint8_t tgt)
+{
+	const size_t i0 = i;
+	__m256i v, w;
+	for (; i >= 32; i -= 32, j -= 32) {
+		v = _mm256_loadu_si256((const __m256i *)(s + i - 32));
+		w = esc_w_avx2(v, k, tgt);
+		if (!_mm256_testz_si256(w, w))
+			break;
+		_mm256_storeu_si256((__m256i *)(o + j - 32), v);
+	}
+	return i0 - i + esc_enc_sse2(s, i, o, j, k, tgt);
+}
+
+/*
+ * Forward copy of the blocks not having the escape character "c". Returns
+ * the bytes copied
+ */
+S_TARGET("sse2")
+static size_t esc_dec_sse2(const uint8_t *s, const size_t ss, uint8_t *o,
+			   const uint8_t c)
+{
+	size_t i = 0;
+	__m128i v;
+	const __m128i e = _mm_set1_epi8((char)c);
+	for (; i + 16 <= ss; i += 16) {
+		v = _mm_loadu_si128((const __m128i *)(s + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, e)))
+			break;
+		_mm_storeu_si128((__m128i *)(o + i), v);
+	}
+	return i;
+}
+
+S_TARGET("avx2")
+static size_t esc_dec_avx2(const uint8_t *s, const size_t ss, uint8_t *o,
+			   const uint8_t c)
+{
+	size_t i = 0;
+	__m256i v;
+	const __m256i e = _mm256_set1_epi8((char)c);
+	for (; i + 32 <= ss; i += 32) {
+		v = _mm256_loadu_si256((const __m256i *)(s + i));
+		if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, e)))
+			break;
+		_mm256_storeu_si256((__m256i *)(o + i), v);
+	}
+	return i + esc_dec_sse2(s + i, ss - i, o + i, c);
+}
+
+#endif /* #ifdef S_X86_CPU_EXT */
+
+/*
+ * SIMD dispatch (the SWAR code is used if not available): extra escaping
+ * size (updating "i", the input bytes processed), backwards clean block
+ * escaping, and forward clean block unescaping (returning the bytes copied)
+ */
+S_INLINE size_t esc_req_x86(const uint8_t *s, const size_t ss,
+			    const enum eSEsc k, const uint8_t tgt, size_t *i)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (ss >= 16) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return esc_req_avx2(s, ss, k, tgt, i);
+		if (f & S_CPU_SSE2)
+			return esc_req_sse2(s, ss, k, tgt, i);
+	}
+#else
+	(void)s;
+	(void)ss;
+	(void)k;
+	(void)tgt;
+	(void)i;
+#endif
+	return 0;
+}
+
+S_INLINE size_t esc_enc_x86(const uint8_t *s, const size_t i, uint8_t *o,
+			    const size_t j, const enum eSEsc k,
+			    const uint8_t tgt)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (i >= 16) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return esc_enc_avx2(s, i, o, j, k, tgt);
+		if (f & S_CPU_SSE2)
+			return esc_enc_sse2(s, i, o, j, k, tgt);
+	}
+#else
+	(void)s;
+	(void)i;
+	(void)o;
+	(void)j;
+	(void)k;
+	(void)tgt;
+#endif
+	return 0;
+}
+
+S_INLINE size_t esc_dec_x86(const uint8_t *s, const size_t ss, uint8_t *o,
+			    const uint8_t c)
+{
+#ifdef S_X86_CPU_EXT
+	unsigned f;
+	if (ss >= 16) {
+		f = s_cpu();
+		if (f & S_CPU_AVX2)
+			return esc_dec_avx2(s, ss, o, c);
+		if (f & S_CPU_SSE2)
+			return esc_dec_sse2(s, ss, o, c);
+	}
+#else
+	(void)s;
+	(void)ss;
+	(void)o;
+	(void)c;
+#endif
+	return 0;
+}
+
+/*
+ * Backwards escaping loop, being MASK_F the per-word escape mask, and ESC_F
+ * the escaping of one byte requiring it (returning the new output position).
+ * The word lanes are in little endian order (first byte in the low lane),
+ * and the tail (< 8 bytes) goes in the high lanes of a zero-padded word.
+ * SIMD blocks (KIND, TGT) are tried again once the input ("i") is below
+ * the block that stopped them ("k").
+ */
+#define ESC_ENC_LOOP(MASK_F, ESC_F, KIND, TGT)                                 \
+	for (i = k = ss, j = sso; i > 0 && j > i;) {                           \
+		if (i <= k) {                                                  \
+			n = esc_enc_x86(s, i, o, j, KIND, TGT);                \
+			i -= n;                                                \
+			j -= n;                                                \
+			k = i >= 16 ? i - 16 : 0;                              \
+			if (n)                                                 \
+				continue;                                      \
+		}                                                              \
+		if (i >= 8) {                                                  \
+			w = S_LD_LE_U64(s + i - 8);                            \
+			n = 8;                                                 \
+		} else {                                                       \
+			memset(t, 0, 8);                                       \
+			memcpy(t + 8 - i, s, i);                               \
+			w = S_LD_LE_U64(t);                                    \
+			n = i;                                                 \
+		}                                                              \
+		m = MASK_F(w);                                                 \
+		if (!m && n == 8) {                                            \
+			i -= 8;                                                \
+			j -= 8;                                                \
+			S_ST_LE_U64(o + j, w);                                 \
+			continue;                                              \
+		}                                                              \
+		for (; n > 0; n--, m <<= 8, w <<= 8) {                         \
+			i--;                                                   \
+			if (m >> 63)                                           \
+				j = ESC_F(o, j, (uint8_t)(w >> 56));           \
+			else                                                   \
+				o[--j] = (uint8_t)(w >> 56);                   \
+		}                                                              \
+	}                                                                      \
+	if (i && o != s)                                                       \
+		memmove(o, s, i);
+
+/*
+ * Forward unescaping loop, being c the escape character, and UNESC_F the
+ * unescaping of one output byte (returning the new input position). After
+ * an escape character, bytes are processed one by one until having 16
+ * bytes without escapes (so dense escaping does not pay the word checks).
+ * If "used" is not NULL (streaming), it stops at escape characters not
+ * followed by "hold - 1" bytes (escape sequences that could be cut).
+ */
+#define ESC_DEC_LOOP(c, hold, UNESC_F)                                         \
+	for (i = j = 0, e = ss; i < e;) {                                      \
+		k = esc_dec_x86(s + i, e - i, o + j, c);                       \
+		i += k;                                                        \
+		j += k;                                                        \
+		for (; i + 8 <= e; i += 8, j += 8) {                           \
+			w = S_LD_U64(s + i);                                   \
+			if (swar_eq(w, c))                                     \
+				break;                                         \
+			S_ST_U64(o + j, w);                                    \
+		}                                                              \
+		for (k = i + 16; i < k && i < e; j++) {                        \
+			if (s[i] == c) {                                       \
+				if (used && e - i < hold) {                    \
+					e = i;                                 \
+					break;                                 \
+				}                                              \
+				k = i + 16;                                    \
+			}                                                      \
+			i = UNESC_F(s, ss, i, o + j);                          \
+		}                                                              \
+	}                                                                      \
+	if (used)                                                              \
+		*used = i;
+
+S_INLINE uint64_t esc_xml_mask(const uint64_t v)
+{
+	return swar_eq(v, '"') | swar_eq(v, '&') | swar_eq(v, '\'')
+	       | swar_eq(v, '<') | swar_eq(v, '>');
+}
+
+S_INLINE size_t senc_esc_xml_req_size(const uint8_t *s, const size_t ss)
+{
+	size_t i = 0, sso = ss + esc_req_x86(s, ss, SESC_XML, 0, &i);
+	uint64_t w, m5, m4, m3;
+	for (; i + 8 <= ss; i += 8) {
+		w = S_LD_U64(s + i);
+		m5 = swar_eq(w, '"') | swar_eq(w, '\'');
+		m4 = swar_eq(w, '&');
+		m3 = swar_eq(w, '<') | swar_eq(w, '>');
+		if (m5 | m4 | m3)
+			sso += SWAR_SUM((m5 >> 7) * 5 + (m4 >> 7) * 4
+					+ (m3 >> 7) * 3);
+	}
+	for (; i < ss; i++)
 		switch (s[i]) {
-		case '\b':
-		case '\t':
-		case '\n':
-		case '\f':
-		case '\r':
 		case '"':
-		case '\\':
-			sso++;
+		case '\'':
+			sso += 5;
+			continue;
+		case '&':
+			sso += 4;
+			continue;
+		case '<':
+		case '>':
+			sso += 3;
 			continue;
 		default:
 			continue;
@@ -371,104 +1268,252 @@ S_INLINE size_t senc_esc_json_req_size(const uint8_t *s, const size_t ss)
 	return sso;
 }
 
-/* BEHAVIOR: slash ('/') is not escaped (intentional) */
-size_t senc_esc_json(const uint8_t *s, const size_t ss, uint8_t *o,
-		     const size_t known_sso)
+S_INLINE size_t esc_xml_chr(uint8_t *o, size_t j, const uint8_t c)
 {
-	size_t i, j, sso;
+	switch (c) {
+	case '"':
+		j -= 6;
+		memcpy(o + j, "&quot;", 6);
+		return j;
+	case '&':
+		j -= 5;
+		memcpy(o + j, "&amp;", 5);
+		return j;
+	case '\'':
+		j -= 6;
+		memcpy(o + j, "&apos;", 6);
+		return j;
+	case '<':
+		j -= 4;
+		memcpy(o + j, "&lt;", 4);
+		return j;
+	default: /* '>' */
+		j -= 4;
+		memcpy(o + j, "&gt;", 4);
+		return j;
+	}
+}
+
+size_t senc_esc_xml(const uint8_t *s, const size_t ss, uint8_t *o,
+		    const size_t known_sso)
+{
+	size_t sso, i, j, k, n;
+	uint64_t w, m;
+	uint8_t t[8];
 	RETURN_IF(!s, 0);
-	sso = known_sso ? known_sso : senc_esc_json_req_size(s, ss);
+	sso = known_sso ? known_sso : senc_esc_xml_req_size(s, ss);
 	RETURN_IF(!o, sso);
 	RETURN_IF(!ss, 0);
-	i = ss - 1;
-	j = sso;
-	for (; i != (size_t)-1; i--) {
+	ESC_ENC_LOOP(esc_xml_mask, esc_xml_chr, SESC_XML, 0);
+	return sso;
+}
+
+S_INLINE size_t unesc_xml_chr(const uint8_t *s, const size_t ss, size_t i,
+				uint8_t *o)
+{
+	const size_t r = ss - i;
+	if (s[i] == '&' && r >= 4) {
+		switch (s[i + 1]) {
+		case 'q':
+			if (r >= 6 && !memcmp(s + i + 2, "uot;", 4)) {
+				*o = '"';
+				return i + 6;
+			}
+			break;
+		case 'a':
+			if (r >= 5 && !memcmp(s + i + 2, "mp;", 3)) {
+				*o = '&';
+				return i + 5;
+			}
+			if (r >= 6 && !memcmp(s + i + 2, "pos;", 4)) {
+				*o = '\'';
+				return i + 6;
+			}
+			break;
+		case 'l':
+			if (!memcmp(s + i + 2, "t;", 2)) {
+				*o = '<';
+				return i + 4;
+			}
+			break;
+		case 'g':
+			if (!memcmp(s + i + 2, "t;", 2)) {
+				*o = '>';
+				return i + 4;
+			}
+			break;
+#if 0 /* BEHAVIOR: not implemented (on purpose) */
+		case '#':
+			break;
+#endif
+		default:
+			break;
+		}
+	}
+	*o = s[i];
+	return i + 1;
+}
+
+static size_t sdec_esc_xml_aux(const uint8_t *s, const size_t ss,
+			       uint8_t *o, size_t *used)
+{
+	size_t i, j, k, e;
+	uint64_t w;
+	ESC_DEC_LOOP('&', 6, unesc_xml_chr);
+	return j;
+}
+
+size_t sdec_esc_xml(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	RETURN_IF(!o, ss);
+	RETURN_IF(!s || !ss, 0);
+	return sdec_esc_xml_aux(s, ss, o, NULL);
+}
+
+/* '\b', '\t', '\n', '\f', '\r' ('\v' is not escaped), '"' and '\\' */
+S_INLINE uint64_t esc_json_mask(const uint64_t v)
+{
+	const uint64_t l = v & SWAR_REP8(0x7f),
+		       ctl = SWAR_GE(l, '\b') & ~SWAR_GE(l, '\r' + 1) & ~v
+			     & ~swar_eq(v, '\v');
+	return ctl | swar_eq(v, '"') | swar_eq(v, '\\');
+}
+
+S_INLINE size_t senc_esc_json_req_size(const uint8_t *s, const size_t ss)
+{
+	size_t i = 0, sso = ss + esc_req_x86(s, ss, SESC_JSON, 0, &i);
+	uint64_t m;
+	for (; i + 8 <= ss; i += 8)
+		if ((m = esc_json_mask(S_LD_U64(s + i))) != 0)
+			sso += SWAR_SUM(m >> 7);
+	for (; i < ss; i++)
 		switch (s[i]) {
 		case '\b':
-			j -= 2;
-			memcpy(o + j, "\\b", 2);
-			continue;
 		case '\t':
-			j -= 2;
-			memcpy(o + j, "\\t", 2);
-			continue;
 		case '\n':
-			j -= 2;
-			memcpy(o + j, "\\n", 2);
-			continue;
 		case '\f':
-			j -= 2;
-			memcpy(o + j, "\\f", 2);
-			continue;
 		case '\r':
-			j -= 2;
-			memcpy(o + j, "\\r", 2);
-			continue;
 		case '"':
-			j -= 2;
-			memcpy(o + j, "\\\"", 2);
-			continue;
 		case '\\':
-			j -= 2;
-			memcpy(o + j, "\\\\", 2);
+			sso++;
 			continue;
 		default:
-			o[--j] = s[i];
 			continue;
 		}
+	return sso;
+}
+
+S_INLINE size_t esc_json_chr(uint8_t *o, size_t j, const uint8_t c)
+{
+	switch (c) {
+	case '\b':
+		o[--j] = 'b';
+		break;
+	case '\t':
+		o[--j] = 't';
+		break;
+	case '\n':
+		o[--j] = 'n';
+		break;
+	case '\f':
+		o[--j] = 'f';
+		break;
+	case '\r':
+		o[--j] = 'r';
+		break;
+	default: /* '"', '\\' */
+		o[--j] = c;
+		break;
 	}
+	o[--j] = '\\';
+	return j;
+}
+
+/* BEHAVIOR: slash ('/') is not escaped (intentional) */
+size_t senc_esc_json(const uint8_t *s, const size_t ss, uint8_t *o,
+		     const size_t known_sso)
+{
+	size_t i, j, k, n, sso;
+	uint64_t w, m;
+	uint8_t t[8];
+	RETURN_IF(!s, 0);
+	sso = known_sso ? known_sso : senc_esc_json_req_size(s, ss);
+	RETURN_IF(!o, sso);
+	RETURN_IF(!ss, 0);
+	ESC_ENC_LOOP(esc_json_mask, esc_json_chr, SESC_JSON, 0);
 	return sso;
 }
 
-size_t sdec_esc_json(const uint8_t *s, const size_t ss, uint8_t *o)
+S_INLINE size_t unesc_json_chr(const uint8_t *s, const size_t ss, size_t i,
+				 uint8_t *o)
 {
-	size_t i, j;
-	RETURN_IF(!o, ss);
-	RETURN_IF(!s || !ss, 0);
-	for (i = j = 0; i < ss; j++) {
-		if (s[i] == '\\' && i + 1 <= ss) {
-			switch (s[i + 1]) {
-			case 'b':
-				o[j] = 8;
-				i += 2;
-				continue;
-			case 't':
-				o[j] = 9;
-				i += 2;
-				continue;
-			case 'n':
-				o[j] = 10;
-				i += 2;
-				continue;
-			case 'f':
-				o[j] = 12;
-				i += 2;
-				continue;
-			case 'r':
-				o[j] = 13;
-				i += 2;
-				continue;
-			case '"':
-			case '\\':
-			case '/':
-				o[j] = s[i + 1];
-				i += 2;
-				continue;
+	if (s[i] == '\\' && i + 1 < ss) {
+		switch (s[i + 1]) {
+		case 'b':
+			*o = 8;
+			return i + 2;
+		case 't':
+			*o = 9;
+			return i + 2;
+		case 'n':
+			*o = 10;
+			return i + 2;
+		case 'f':
+			*o = 12;
+			return i + 2;
+		case 'r':
+			*o = 13;
+			return i + 2;
+		case '"':
+		case '\\':
+		case '/':
+			*o = s[i + 1];
+			return i + 2;
 #if 0 /* BEHAVIOR: not implemented (on purpose) */
-			case 'u': break;
+		case 'u': break;
 #endif
-			default:
-				break;
-			}
+		default:
+			break;
 		}
-		o[j] = s[i++];
 	}
+	*o = s[i];
+	return i + 1;
+}
+
+static size_t sdec_esc_json_aux(const uint8_t *s, const size_t ss,
+				uint8_t *o, size_t *used)
+{
+	size_t i, j, k, e;
+	uint64_t w;
+	ESC_DEC_LOOP('\\', 2, unesc_json_chr);
 	return j;
 }
 
+size_t sdec_esc_json(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	RETURN_IF(!o, ss);
+	RETURN_IF(!s || !ss, 0);
+	return sdec_esc_json_aux(s, ss, o, NULL);
+}
+
+/* Not unreserved bytes (RFC 3986: ALPHA, DIGIT, '-', '.', '_', '~') */
+S_INLINE uint64_t esc_url_mask(const uint64_t v)
+{
+	const uint64_t l = v & SWAR_REP8(0x7f), lc = l | SWAR_REP8(0x20),
+		       dg = SWAR_GE(l, '0') & ~SWAR_GE(l, '9' + 1),
+		       al = SWAR_GE(lc, 'a') & ~SWAR_GE(lc, 'z' + 1),
+		       ok = dg | al | swar_eq(v, '-') | swar_eq(v, '_')
+			    | swar_eq(v, '.') | swar_eq(v, '~');
+	return (~ok | v) & SWAR_REP8(0x80);
+}
+
 S_INLINE size_t senc_esc_url_req_size(const uint8_t *s, const size_t ss)
 {
-	size_t i = 0, sso = ss;
+	size_t i = 0, sso = ss + esc_req_x86(s, ss, SESC_URL, 0, &i);
+	uint64_t m;
+	for (; i + 8 <= ss; i += 8)
+		if ((m = esc_url_mask(S_LD_U64(s + i))) != 0)
+			sso += 2 * SWAR_SUM(m >> 7);
 	for (; i < ss; i++) {
 		if ((s[i] >= 'A' && s[i] <= 'Z') || (s[i] >= 'a' && s[i] <= 'z')
 		    || (s[i] >= '0' && s[i] <= '9'))
@@ -487,104 +1532,118 @@ S_INLINE size_t senc_esc_url_req_size(const uint8_t *s, const size_t ss)
 	return sso;
 }
 
+S_INLINE size_t esc_url_chr(uint8_t *o, size_t j, const uint8_t c)
+{
+	j -= 3;
+	o[j + 2] = n2h_u[c & 0x0f];
+	o[j + 1] = n2h_u[c >> 4];
+	o[j] = '%';
+	return j;
+}
+
 size_t senc_esc_url(const uint8_t *s, const size_t ss, uint8_t *o,
 		    const size_t known_sso)
 {
-	size_t i, j, sso;
+	size_t i, j, k, n, sso;
+	uint64_t w, m;
+	uint8_t t[8];
 	RETURN_IF(!s, 0);
 	sso = known_sso ? known_sso : senc_esc_url_req_size(s, ss);
 	RETURN_IF(!o, sso);
 	RETURN_IF(!ss, 0);
-	i = ss - 1;
-	j = sso;
-	for (; i != (size_t)-1; i--) {
-		if ((s[i] >= 'A' && s[i] <= 'Z') || (s[i] >= 'a' && s[i] <= 'z')
-		    || (s[i] >= '0' && s[i] <= '9')) {
-			o[--j] = s[i];
-			continue;
-		}
-		switch (s[i]) {
-		case '-':
-		case '_':
-		case '.':
-		case '~':
-			o[--j] = s[i];
-			continue;
-		default:
-			j -= 3;
-			o[j + 2] = n2h_u[s[i] & 0x0f];
-			o[j + 1] = n2h_u[s[i] >> 4];
-			o[j] = '%';
-			continue;
-		}
-	}
+	ESC_ENC_LOOP(esc_url_mask, esc_url_chr, SESC_URL, 0);
 	return sso;
 }
 
+S_INLINE size_t unesc_url_chr(const uint8_t *s, const size_t ss, size_t i,
+				uint8_t *o)
+{
+	if (s[i] == '%' && i + 3 <= ss) {
+		*o = (uint8_t)(hex2nibble(s[i + 1]) << 4) | hex2nibble(s[i + 2]);
+		return i + 3;
+	}
+	*o = s[i];
+	return i + 1;
+}
+
+static size_t sdec_esc_url_aux(const uint8_t *s, const size_t ss,
+			       uint8_t *o, size_t *used)
+{
+	size_t i, j, k, e;
+	uint64_t w;
+	ESC_DEC_LOOP('%', 3, unesc_url_chr);
+	return j;
+}
+
 size_t sdec_esc_url(const uint8_t *s, const size_t ss, uint8_t *o)
 {
-	size_t i, j;
 	RETURN_IF(!o, ss);
 	RETURN_IF(!s || !ss, 0);
-	for (i = j = 0; i < ss; j++) {
-		if (s[i] == '%' && i + 3 <= ss) {
-			o[j] = (uint8_t)(hex2nibble(s[i + 1]) << 4)
-			       | hex2nibble(s[i + 2]);
-			i += 3;
-			continue;
-		}
-		o[j] = s[i++];
-	}
-	return j;
+	return sdec_esc_url_aux(s, ss, o, NULL);
 }
 
 S_INLINE size_t senc_esc_byte_req_size(const uint8_t *s, uint8_t tgt,
 				       const size_t ss)
 {
-	size_t i = 0, sso = ss;
+	size_t i = 0, sso = ss + esc_req_x86(s, ss, SESC_BYTE, tgt, &i);
+	uint64_t m;
+	for (; i + 8 <= ss; i += 8)
+		if ((m = swar_eq(S_LD_U64(s + i), tgt)) != 0)
+			sso += SWAR_SUM(m >> 7);
 	for (; i < ss; i++)
 		if (s[i] == tgt)
 			sso++;
 	return sso;
 }
 
+S_INLINE size_t esc_byte_chr(uint8_t *o, size_t j, const uint8_t c)
+{
+	o[--j] = c;
+	o[--j] = c;
+	return j;
+}
+
 static size_t senc_esc_byte(const uint8_t *s, const size_t ss, uint8_t tgt,
 			    uint8_t *o, const size_t known_sso)
 {
-	size_t i, j, sso;
+	size_t i, j, k, n, sso;
+	uint64_t w, m;
+	uint8_t t[8];
 	RETURN_IF(!s, 0);
 	sso = known_sso ? known_sso : senc_esc_byte_req_size(s, tgt, ss);
 	RETURN_IF(!o, sso);
 	RETURN_IF(!ss, 0);
-	i = ss - 1;
-	j = sso;
-	for (; i != (size_t)-1; i--) {
-		if (s[i] == tgt)
-			o[--j] = s[i];
-		o[--j] = s[i];
-	}
+#define ESC_BYTE_MASK(v) swar_eq(v, tgt)
+	ESC_ENC_LOOP(ESC_BYTE_MASK, esc_byte_chr, SESC_BYTE, tgt);
+#undef ESC_BYTE_MASK
 	return sso;
 }
 
+S_INLINE size_t unesc_byte_chr(const uint8_t *s, const size_t ss, size_t i,
+				 uint8_t *o, const uint8_t tgt)
+{
+	if (s[i] == tgt && i + 1 < ss && s[i + 1] == tgt)
+		i++;
+	*o = s[i];
+	return i + 1;
+}
+
 static size_t sdec_esc_byte(const uint8_t *s, const size_t ss, uint8_t tgt,
 			    uint8_t *o)
 {
-	size_t i, j, ssm1;
+	size_t i, j, k, e, *used = NULL;
+	uint64_t w;
 	RETURN_IF(!o, ss);
 	RETURN_IF(!s || !ss, 0);
-	i = 0;
-	j = 0;
-	ssm1 = ss - 1;
-	for (; i < ssm1; j++) {
-		if (s[i] == tgt && s[i + 1] == tgt)
-			i++;
-		o[j] = s[i++];
-	}
-	if (i < ss)
-		o[j++] = s[i];
+#define UNESC_BYTE_CHR(s, ss, i, o) unesc_byte_chr(s, ss, i, o, tgt)
+	ESC_DEC_LOOP(tgt, 2, UNESC_BYTE_CHR);
+#undef UNESC_BYTE_CHR
 	return j;
 }
 
+#undef ESC_ENC_LOOP
+#undef ESC_DEC_LOOP
+
 size_t senc_esc_dquote(const uint8_t *s, const size_t ss, uint8_t *o,
 		       const size_t known_sso)
 {
@@ -607,6 +1666,53 @@ size_t sdec_esc_squote(const uint8_t *s, const size_t ss, uint8_t *o)
 	return sdec_esc_byte(s, ss, '\'', o);
 }
 
+/*
+ * UTF-16LE (the UTF-8 <-> UTF-16 conversion is done in small chunks, so
+ * the byte order is handled without requiring additional memory)
+ */
+
+#define U16_CHUNK 256
+
+size_t senc_utf16le(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	uint16_t u[U16_CHUNK];
+	size_t i, j, k, n, used;
+	RETURN_IF(!s || !ss, 0);
+	if (!o)
+		return 2 * sc_utf8_to_utf16((const char *)s, ss, NULL, 0, NULL);
+	for (i = j = 0; i < ss; i += used) {
+		n = sc_utf8_to_utf16((const char *)s + i, ss - i, u, U16_CHUNK,
+				     &used);
+		for (k = 0; k < n; k++, j += 2) {
+			o[j] = (uint8_t)u[k];
+			o[j + 1] = (uint8_t)(u[k] >> 8);
+		}
+	}
+	return j;
+}
+
+/*
+ * BEHAVIOR: unpaired surrogates are ignored, and also the last byte, if the
+ * input size is odd
+ */
+size_t sdec_utf16le(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	uint16_t u[U16_CHUNK];
+	size_t i, j, k, n, nu;
+	nu = ss / 2;
+	RETURN_IF(!s || !nu, 0);
+	for (i = j = 0; i < nu; i += n) {
+		n = S_MIN(nu - i, U16_CHUNK);
+		for (k = 0; k < n; k++)
+			u[k] = (uint16_t)(s[2 * (i + k)]
+					  | (s[2 * (i + k) + 1] << 8));
+		if (i + n < nu && SSU16_VALID_HS(u[n - 1]))
+			n--; /* keep the surrogate pair in the same chunk */
+		j += sc_utf16_to_utf8(u, n, o ? (char *)o + j : NULL, NULL);
+	}
+	return j;
+}
+
 #if SDEBUG_LZ_STATS
 size_t lz_st_lit[9] = {0}, lz_st_lit_bytes = 0;
 size_t lz_st_ref[9] = {0}, lz_st_ref_bytes = 0;
@@ -972,19 +2078,35 @@ S_INLINE uint32_t senc_lz_hash(uint32_t a, size_t hash_size)
 	       & S_NBITMASK(hash_size);
 }
 
-static size_t senc_lz_aux(const uint8_t *s, const size_t ss, uint8_t *o0,
-			  const size_t hash_max_bits)
+/*
+ * Max out bytes = (input size) * 1.125 + 32
+ * (0 in case of edge case size_t overflow)
+ */
+#define SENC_LZ_MAX_OUT(ss) s_size_t_add(ss, (ss / 8) + 32, 0)
+
+/*
+ * Hash size is kept proportional to the input buffer size, in order to
+ * ensure the hash initialization time don't hurt the case of small inputs.
+ */
+S_INLINE size_t senc_lz_hash_size(const size_t ss, const size_t hash_max_bits)
+{
+	size_t hash_size0 = slog2((uint64_t)ss);
+	if (hash_size0 >= 2)
+		hash_size0 -= 2;
+	return S_RANGE(hash_size0, 3, hash_max_bits);
+}
+
+/*
+ * Compression loop. Hash table entries are positions plus "base": entries
+ * below the base are from previous calls (reusable context, see
+ * senc_lz_ctx()), being equivalent to the position 0 of a cleared table
+ */
+S_INLINE size_t senc_lz_run(const uint8_t *s, const size_t ss, uint8_t *o0,
+			    size_t *refs, const size_t hash_size,
+			    const size_t base)
 {
 	uint8_t *o;
-	size_t *refs, *refsx;
-	size_t i, len, dist, w32, plit, h, last, sm4, hash_size0, hash_size,
-		hash_elems;
-	/*
-	 * Max out bytes = (input size) * 1.125 + 32
-	 * (0 in case of edge case size_t overflow)
-	 */
-	RETURN_IF(!o0 && ss > 0, s_size_t_add(ss, (ss / 8) + 32, 0));
-	RETURN_IF(!s || !o0 || !ss, 0);
+	size_t i, len, dist, w32, plit, h, last, sm4;
 	/*
 	 * Header: unpacked length (compressed u64)
 	 */
@@ -997,28 +2119,6 @@ static size_t senc_lz_aux(const uint8_t *s, const size_t ss, uint8_t *o0,
 		senc_lz_store_lit(&o, s, ss);
 		return (size_t)(o - o0);
 	}
-	/*
-	 * Hash size is kept proportional to the input buffer size, in order to
-	 * ensure the hash initialization time don't hurt the case of small
-	 * inputs.
-	 */
-	hash_size0 = slog2((uint64_t)ss);
-	if (hash_size0 >= 2)
-		hash_size0 -= 2;
-	hash_size = S_RANGE(hash_size0, 3, hash_max_bits);
-	hash_elems = (size_t)1 << hash_size;
-	/*
-	 * Hash table allocation and initialization
-	 */
-	refsx = hash_size > LZ_MAX_HASH_BITS_STACK
-			? (size_t *)s_malloc(sizeof(size_t) * hash_elems)
-			: NULL;
-	refs = refsx ? refsx : (size_t *)s_alloca(sizeof(size_t) * hash_elems);
-	RETURN_IF(!refs, 0);
-	memset(refs, 0, hash_elems * sizeof(refs[0]));
-	/*
-	 * Compression loop
-	 */
 	plit = 0;
 	sm4 = ss - 4;
 	for (i = 4; i <= sm4;) {
@@ -1027,8 +2127,9 @@ static size_t senc_lz_aux(const uint8_t *s, const size_t ss, uint8_t *o0,
 		 */
 		w32 = S_LD_U32(s + i);
 		h = senc_lz_hash((uint32_t)w32, hash_size);
-		last = refs[h];
-		refs[h] = i;
+		last = refs[h] - base;
+		refs[h] = base + i;
+		last &= (size_t)0 - (last < i);
 		if (w32 != S_LD_U32(s + last)) { /* Not found? */
 			i++;
 			continue;
@@ -1053,9 +2154,79 @@ static size_t senc_lz_aux(const uint8_t *s, const size_t ss, uint8_t *o0,
 	}
 	if (ss - plit > 0)
 		senc_lz_store_lit(&o, s + plit, ss - plit);
+	return (size_t)(o - o0);
+}
+
+static size_t senc_lz_aux(const uint8_t *s, const size_t ss, uint8_t *o0,
+			  const size_t hash_max_bits)
+{
+	size_t *refs, *refsx, hash_size, hash_elems, r;
+	RETURN_IF(!o0 && ss > 0, SENC_LZ_MAX_OUT(ss));
+	RETURN_IF(!s || !o0 || !ss, 0);
+	hash_size = senc_lz_hash_size(ss, hash_max_bits);
+	hash_elems = (size_t)1 << hash_size;
+	/*
+	 * Hash table allocation and initialization
+	 */
+	refsx = hash_size > LZ_MAX_HASH_BITS_STACK
+			? (size_t *)s_malloc(sizeof(size_t) * hash_elems)
+			: NULL;
+	refs = refsx ? refsx : (size_t *)s_alloca(sizeof(size_t) * hash_elems);
+	RETURN_IF(!refs, 0);
+	memset(refs, 0, hash_elems * sizeof(refs[0]));
+	r = senc_lz_run(s, ss, o0, refs, hash_size, 0);
 	if (refsx)
 		s_free(refsx);
-	return (size_t)(o - o0);
+	return r;
+}
+
+/*
+ * Reusable LZ compression context: the hash table is allocated once, and
+ * not cleared between calls (the base is moved after the previous input
+ * positions, so old entries are ignored). It is cleared only when the base
+ * would overflow (e.g. after 4 GiB of input for 32-bit size_t)
+ */
+
+struct SLZCtx {
+	size_t base, hash_bits;
+	size_t *refs;
+};
+
+struct SLZCtx *senc_lz_ctx_alloc(const size_t hash_bits)
+{
+	struct SLZCtx *c;
+	size_t hb = hash_bits ? S_RANGE(hash_bits, 3, LZ_MAX_HASH_BITS)
+			      : LZ_MAX_HASH_BITS_STACK,
+	       tsize = sizeof(size_t) << hb;
+	c = (struct SLZCtx *)s_malloc(sizeof(struct SLZCtx) + tsize);
+	RETURN_IF(!c, NULL);
+	c->base = 0;
+	c->hash_bits = hb;
+	c->refs = (size_t *)(c + 1);
+	memset(c->refs, 0, tsize);
+	return c;
+}
+
+size_t senc_lz_ctx(struct SLZCtx *c, const uint8_t *s, const size_t ss,
+		   uint8_t *o0)
+{
+	size_t hash_size, r;
+	RETURN_IF(!c, senc_lz(s, ss, o0));
+	RETURN_IF(!o0 && ss > 0, SENC_LZ_MAX_OUT(ss));
+	RETURN_IF(!s || !o0 || !ss, 0);
+	hash_size = c->hash_bits;
+	if (c->base > SIZE_MAX - ss) {
+		memset(c->refs, 0, sizeof(size_t) << c->hash_bits);
+		c->base = 0;
+	}
+	r = senc_lz_run(s, ss, o0, c->refs, hash_size, c->base);
+	c->base += ss;
+	return r;
+}
+
+void senc_lz_ctx_free(struct SLZCtx *c)
+{
+	s_free(c);
 }
 
 size_t senc_lz(const uint8_t *s, const size_t ss, uint8_t *o0)
@@ -1068,6 +2239,195 @@ size_t senc_lzh(const uint8_t *s, const size_t ss, uint8_t *o0)
 	return senc_lz_aux(s, ss, o0, LZ_MAX_HASH_BITS);
 }
 
+/*
+ * LZ compression levels (2 to S_LZ_LEVEL_MAX): hash chains, i.e. all
+ * previous positions within the window having the same hash are linked,
+ * and up to "depth" of them are checked, keeping the one saving more bytes
+ * (match length minus the reference size). Lazy matching: before storing a
+ * reference, up to "lazy" following positions are checked, and if one of
+ * them has a better match, the current byte goes as literal. Output is
+ * the same format as senc_lz() (so decoding speed is not affected).
+ */
+
+#ifdef S_LZ_ALLOW_HEAP_USAGE
+
+#define LZ_HC_NONE 0xffffffff
+
+/* Chain depth, lazy steps, hash and window bits, and "good enough" length */
+struct SLZLevel {
+	size_t depth, lazy, hbits, wbits, nice;
+};
+
+static const struct SLZLevel lz_levels[S_LZ_LEVEL_MAX - 1] = {
+	{4, 0, 15, 16, 32},	{8, 1, 16, 17, 32},	{16, 1, 16, 18, 64},
+	{32, 1, 17, 19, 128},	{64, 2, 18, 20, 256},	{128, 2, 19, 21, 512},
+	{256, 2, 20, 22, 1024}, {512, 2, 20, 22, 4096}};
+
+/* Positions are 32-bit (half the memory/cache usage) */
+struct SLZHC {
+	const uint8_t *s;
+	uint32_t *head, *chain;
+	size_t ss, hbits, wmask, ins;
+	const struct SLZLevel *lv;
+};
+
+/* Reference size (same logic as senc_lz_store_ref()), 0 if not valid */
+S_INLINE size_t senc_lz_ref_size(const size_t dist0, const size_t len0)
+{
+	size_t d = dist0 - 1, l = len0 - 4;
+	if (d < LZOPR_D16S_RANGE && l < LZOPR_L16S_RANGE)
+		return 2;
+	if (d < LZOPR_D16S2_RANGE && l < LZOPR_L16S2_RANGE)
+		return 2;
+	if (d < LZOPR_D16_RANGE && l < LZOPR_L16_RANGE)
+		return 2;
+	if (d < LZOPR_D24S_RANGE && l < LZOPR_L24S_RANGE)
+		return 3;
+	if (d < LZOPR_D24S2_RANGE && l < LZOPR_L24S2_RANGE)
+		return 3;
+	if (d < LZOPR_D24S3_RANGE && l < LZOPR_L24S3_RANGE)
+		return 3;
+	if (d < LZOPR_D24_RANGE) {
+		if (l < LZOPR_L24_RANGE)
+			return 3;
+	} else if (len0 <= 4 || (d >= LZOPR_D32_RANGE && len0 <= 5)) {
+		return 0;
+	}
+	if (d < LZOPR_D32_RANGE && l < LZOPR_L32_RANGE)
+		return 4;
+	if (d < LZOPR_D40_RANGE && l < LZOPR_L40_RANGE)
+		return 5;
+	return len0 <= 8 ? 0 : 8 * (l / LZOPR_L64_RANGE + 1);
+}
+
+/* Bytes saved by a reference (0 if none) */
+S_INLINE size_t senc_lz_gain(const size_t dist, const size_t len)
+{
+	size_t rs = senc_lz_ref_size(dist, len);
+	return rs && len > rs ? len - rs : 0;
+}
+
+S_INLINE void senc_lz_hc_ins(struct SLZHC *c, const size_t i)
+{
+	const size_t top = S_MIN(i, c->ss - 4 + 1);
+	size_t h;
+	for (; c->ins < top; c->ins++) {
+		h = senc_lz_hash(S_LD_U32(c->s + c->ins), c->hbits);
+		c->chain[c->ins & c->wmask] = c->head[h];
+		c->head[h] = (uint32_t)c->ins;
+	}
+}
+
+/*
+ * Best match for position i (0 if none), inserting positions up to i.
+ * Once a match of at least 1/4 of the "good enough" length is found, only
+ * half of the remaining candidates are checked.
+ */
+static size_t senc_lz_hc_find(struct SLZHC *c, const size_t i,
+			      size_t depth, size_t *dist, size_t *gain)
+{
+	const uint8_t *s = c->s;
+	const uint32_t w32 = S_LD_U32(s + i);
+	size_t p, len, g, best_len = 3, max_len = c->ss - i;
+	*gain = 0;
+	senc_lz_hc_ins(c, i);
+	p = c->head[senc_lz_hash(w32, c->hbits)];
+	senc_lz_hc_ins(c, i + 1);
+	for (; p != LZ_HC_NONE && i - p <= c->wmask && depth > 0;
+	     p = c->chain[p & c->wmask], depth--) {
+		if (s[p + best_len] != s[i + best_len] || S_LD_U32(s + p) != w32)
+			continue;
+		len = 4 + senc_lz_match(s + i + 4, s + p + 4, max_len - 4);
+		g = senc_lz_gain(i - p, len);
+		if (g > *gain) {
+			*gain = g;
+			*dist = i - p;
+			if (len >= c->lv->nice / 4 && best_len < c->lv->nice / 4)
+				depth /= 2;
+			best_len = len;
+			if (len >= c->lv->nice || len == max_len)
+				break;
+		}
+	}
+	return *gain ? best_len : 0;
+}
+
+static size_t senc_lz_hc(const uint8_t *s, const size_t ss, uint8_t *o0,
+			 const struct SLZLevel *lv)
+{
+	uint8_t *o;
+	struct SLZHC c;
+	size_t i, k, len, dist, gain, len2, dist2, gain2, plit, sm4, wbits;
+	/* Same max out bytes as senc_lz_aux() */
+	RETURN_IF(!o0 && ss > 0, s_size_t_add(ss, (ss / 8) + 32, 0));
+	RETURN_IF(!s || !o0 || !ss, 0);
+	RETURN_IF(ss < 8, senc_lz_aux(s, ss, o0, LZ_MAX_HASH_BITS_STACK));
+	c.s = s;
+	c.ss = ss;
+	c.lv = lv;
+	c.ins = 0;
+	c.hbits = S_RANGE(slog2((uint64_t)ss), 8, lv->hbits);
+	wbits = S_RANGE(slog2((uint64_t)ss) + 1, 8, lv->wbits);
+	c.wmask = S_NBITMASK(wbits);
+	/* BEHAVIOR: > 4GB input or not enough memory: fallback to level 1 */
+	c.head = (uint64_t)ss < LZ_HC_NONE
+			 ? (uint32_t *)s_malloc(sizeof(uint32_t)
+						* (((size_t)1 << c.hbits)
+						   + c.wmask + 1))
+			 : NULL;
+	RETURN_IF(!c.head, senc_lz_aux(s, ss, o0, LZ_MAX_HASH_BITS));
+	c.chain = c.head + ((size_t)1 << c.hbits);
+	memset(c.head, 0xff, sizeof(uint32_t) << c.hbits);
+	o = o0;
+	s_st_pk_u64(&o, ss);
+	plit = 0;
+	sm4 = ss - 4;
+	for (i = 0; i <= sm4;) {
+		len = senc_lz_hc_find(&c, i, lv->depth, &dist, &gain);
+		if (!len) {
+			i++;
+			continue;
+		}
+		/* Lazy matching (half depth) */
+		for (k = 0; k < lv->lazy && len < lv->nice && i + 1 <= sm4;
+		     k++) {
+			len2 = senc_lz_hc_find(&c, i + 1, lv->depth / 2, &dist2,
+					       &gain2);
+			if (gain2 <= gain)
+				break;
+			i++;
+			len = len2;
+			dist = dist2;
+			gain = gain2;
+		}
+		if (!senc_lz_store_ref(&o, s + plit, i - plit, dist, &len)) {
+			i++;
+			continue;
+		}
+		i += len;
+		plit = i;
+	}
+	if (ss - plit > 0)
+		senc_lz_store_lit(&o, s + plit, ss - plit);
+	s_free(c.head);
+	return (size_t)(o - o0);
+}
+
+#endif
+
+size_t senc_lz_level(const uint8_t *s, const size_t ss, uint8_t *o0,
+		     const int level)
+{
+	RETURN_IF(level <= 0, senc_lz(s, ss, o0));
+#ifdef S_LZ_ALLOW_HEAP_USAGE
+	if (level >= 2)
+		return senc_lz_hc(s, ss, o0,
+				  lz_levels + S_MIN(level, S_LZ_LEVEL_MAX) - 2);
+#endif
+	/* BEHAVIOR: level 1, or any level if heap usage is not allowed */
+	return senc_lzh(s, ss, o0);
+}
+
 S_INLINE void s_reccpy1(uint8_t *o, const size_t dist, size_t n)
 {
 	size_t j = 0;
@@ -1077,7 +2437,7 @@ S_INLINE void s_reccpy1(uint8_t *o, const size_t dist, size_t n)
 
 S_INLINE void s_reccpy(uint8_t *o, const size_t dist, size_t n)
 {
-	size_t i, n2, chunk;
+	size_t i, chunk;
 	const uint8_t *s = o - dist;
 	if (dist > n) {
 		/* non-overlapped */
@@ -1113,24 +2473,44 @@ S_INLINE void s_reccpy(uint8_t *o, const size_t dist, size_t n)
 		s_memset64(o, s, (n / 8) + 1);
 		return;
 	}
-	/* overlapped copy: generic */
+	/*
+	 * overlapped copy: generic (the last chunk is clamped, as it could
+	 * write up to dist - 1 bytes after the end, more than the output
+	 * slack)
+	 */
 	memcpy(o, s, dist);
 	chunk = dist * 2;
-	i = dist;
-	if (i + chunk < n) {
-		n2 = n - dist;
-		for (; i < n2; i += chunk)
-			memcpy(o + i, s, chunk);
+	for (i = dist; i < n; i += chunk)
+		memcpy(o + i, s, S_MIN(chunk, n - i));
+}
+
+/*
+ * Reference reaching the dictionary (dist > o - o0): the first bytes come
+ * from the dictionary end, and the rest, if any, from the output start
+ */
+S_INLINE void sdec_lz_dict_ref(uint8_t *o, const uint8_t *o0,
+			       const uint8_t *d_top, const size_t dist,
+			       size_t len)
+{
+	const uint8_t *r = d_top - (dist - (size_t)(o - o0));
+	size_t nd = (size_t)(d_top - r);
+	if (len <= nd) {
+		memcpy(o, r, len);
+		return;
 	}
-	if (i < n)
-		memcpy(o + i, s, n - i);
+	memcpy(o, r, nd);
+	s_reccpy(o + nd, dist, len - nd);
 }
 
-S_INLINE void sdec_lz_load_ref(uint8_t **o, size_t dist, size_t len)
+S_INLINE void sdec_lz_load_ref(uint8_t **o, const uint8_t *o0,
+			       const uint8_t *d_top, size_t dist, size_t len)
 {
 	dist++;
 	len += 4;
-	s_reccpy(*o, dist, len);
+	if (S_UNLIKELY(dist > (size_t)(*o - o0)))
+		sdec_lz_dict_ref(*o, o0, d_top, dist, len);
+	else
+		s_reccpy(*o, dist, len);
 	(*o) += len;
 }
 
@@ -1142,28 +2522,177 @@ S_INLINE void sdec_lz_load_lit(const uint8_t **s, uint8_t **o, size_t cnt)
 	(*o) += cnt;
 }
 
-/* BEHAVIOR: safety for avoiding decompression buffer overflow */
-#define SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, sz)                   \
-	if (S_UNLIKELY(o + sz > o_top)) {                                      \
+/* Bounds-checked s_ld_pk_u64() */
+static srt_bool lzf_ld_pk(const uint8_t **s, const uint8_t *s_top,
+			  uint64_t *v)
+{
+	uint8_t b[16];
+	const uint8_t *p = b;
+	size_t hs, n = (size_t)(s_top - *s);
+	RETURN_IF(!n, S_FALSE);
+	memset(b, 0, sizeof(b));
+	memcpy(b, *s, S_MIN(n, S_PK_U64_MAX_BYTES));
+	hs = s_pk_u64_size(b);
+	RETURN_IF(!hs || hs > n, S_FALSE);
+	*v = s_ld_pk_u64(&p, hs);
+	*s += hs;
+	return S_TRUE;
+}
+
+/*
+ * BEHAVIOR: safety for avoiding decompression buffer overflow, and out of
+ * bounds reads on not valid input (references before the output start, or
+ * literals after the input end)
+ */
+#define SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, sz, cond)             \
+	if (S_UNLIKELY((sz) > (size_t)(o_top - o) || (cond))) {                \
 		s = s_top;                                                     \
 		continue;                                                      \
 	}
+#define SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds)               \
+	SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len + 4,              \
+				     dist >= (size_t)(o - o0) + ds)
+#define SDEC_LZ_LIT_CHECK(s, s_top, o, o_top, cnt)                             \
+	SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, cnt + 1,              \
+				     s > s_top || cnt >= (size_t)(s_top - s))
 
-size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
+/*
+ * Fast decoding path: opcode table, indexed by the opcode low 4 bits
+ * (LZOP_MASK4). Every opcode is decoded from one 64-bit load, as
+ * (w << shl) >> shr, giving the distance in the low dbits bits, and the
+ * length (or the literal count) in the rest.
+ */
+
+struct SLZOp {
+	uint8_t size, shl, shr, dbits, lit;
+};
+
+#define LZOPR_T(b, hdr, d) {b / 8, 64 - b, 64 - b + hdr, d, 0}
+#define LZOPL_T(b, hdr) {b / 8, 64 - b, 64 - b + hdr, 0, 1}
+#define LZOPR_T16 LZOPR_T(16, LZOPR_HDR_16_BITS, LZOPR_D16_BITS)
+
+static const struct SLZOp lz_ops[16] = {
+	LZOPR_T16,							 /* 0 */
+	LZOPR_T(24, LZOPR_HDR_24_BITS, LZOPR_D24_BITS),			 /* 1 */
+	LZOPR_T(32, LZOPR_HDR_32_BITS, LZOPR_D32_BITS),			 /* 2 */
+	LZOPR_T(40, LZOPR_HDR_40_BITS, LZOPR_D40_BITS),			 /* 3 */
+	LZOPR_T16,							 /* 4 */
+	LZOPR_T(24, LZOPR_HDR_24S3_BITS, LZOPR_D24S3_BITS),		 /* 5 */
+	LZOPR_T(24, LZOPR_HDR_24S_BITS, LZOPR_D24S_BITS),		 /* 6 */
+	LZOPR_T(64, LZOPR_HDR_64_BITS, LZOPR_D64_BITS),			 /* 7 */
+	LZOPR_T16,							 /* 8 */
+	LZOPR_T(16, LZOPR_HDR_16S_BITS, LZOPR_D16S_BITS),		 /* 9 */
+	LZOPR_T(24, LZOPR_HDR_24S2_BITS, LZOPR_D24S2_BITS),		 /* a */
+	LZOPL_T(8, LZOPL_HDR_8_BITS),					 /* b */
+	LZOPR_T16,							 /* c */
+	LZOPR_T(16, LZOPR_HDR_16S2_BITS, LZOPR_D16S2_BITS),		 /* d */
+	LZOPL_T(16, LZOPL_HDR_16_BITS),					 /* e */
+	LZOPL_T(32, LZOPL_HDR_32_BITS)					 /* f */
+};
+
+/*
+ * Fast path input and output margins: opcode (up to 8 bytes) plus one
+ * 16-byte wild literal copy, and 32 bytes of output
+ */
+#define SDEC_LZ_FAST_IN 24
+#define SDEC_LZ_FAST_OUT 32
+
+/*
+ * Reference copy using 16-byte overlapping ("wild") copies, writing up to
+ * 15 bytes after the end (covered by the output slack). Distances from 8
+ * to 15 use 8-byte copies, and shorter ones the run-length expansion
+ */
+S_INLINE void sdec_lz_wild_ref(uint8_t *o, const size_t dist, const size_t len)
 {
-	uint8_t *o;
-	uint64_t mix64;
-	const uint8_t *s, *s_top, *o_top;
+	const uint8_t *o_end = o + len;
+	if (S_LIKELY(dist >= 16)) {
+		do {
+			memcpy(o, o - dist, 16);
+			o += 16;
+		} while (o < o_end);
+	} else if (dist >= 8) {
+		do {
+			memcpy(o, o - dist, 8);
+			o += 8;
+		} while (o < o_end);
+	} else {
+		s_reccpy(o, dist, len);
+	}
+}
+
+/*
+ * Decoding, with optional dictionary ("d", "ds" bytes): references with
+ * distance beyond the output start go into the dictionary end
+ */
+static size_t sdec_lz_aux(const uint8_t *s0, const size_t ss, uint8_t *o0,
+			  const uint8_t *d, const size_t ds)
+{
+	uint8_t *o, tail[16];
+	uint64_t v, mix64, dist64;
+	const struct SLZOp *t;
+	const uint8_t *s, *s_top, *o_top, *d_top = d ? d + ds : NULL;
 	size_t cnt, dist, len, mix, op, expected_ss;
-	RETURN_IF(!s0 || ss < 4, 0); /* too small input (min hdr + opcode) */
+	srt_bool in_tail = S_FALSE;
+	RETURN_IF(!s0 || ss < 3, 0); /* too small input (hdr + opcode + byte) */
 	s = s0;
-	expected_ss = (size_t)s_ld_pk_u64(&s, ss);
+	RETURN_IF(!lzf_ld_pk(&s, s0 + ss, &v) || v > S_NPOS - 16, 0);
+	expected_ss = (size_t)v;
 	RETURN_IF(ss <= (size_t)(s - s0), 0); /* invalid: incomplete header */
 	RETURN_IF(!o0, expected_ss + 16);     /* max out size */
 	s_top = s0 + ss;
 	o = o0;
 	o_top = o + expected_ss;
+	/*
+	 * Fast path: no per-opcode branches, and wild copies, while far from
+	 * the input and output ends. Any opcode not fitting in the remaining
+	 * input/output is left to the checked loop below (same result)
+	 */
+	while (s_top - s >= SDEC_LZ_FAST_IN && o_top - o >= SDEC_LZ_FAST_OUT) {
+		mix64 = S_LD_LE_U64(s);
+		t = lz_ops + (mix64 & LZOP_MASK4);
+		mix64 = (mix64 << t->shl) >> t->shr;
+		len = (size_t)(mix64 >> t->dbits);
+		if (t->lit) {
+			cnt = len + 1;
+			if (S_UNLIKELY(cnt > (size_t)(o_top - o)
+				       || cnt > (size_t)(s_top - s) - t->size))
+				break;
+			s += t->size;
+			memcpy(o, s, 16);
+			if (cnt > 16)
+				memcpy(o + 16, s + 16, cnt - 16);
+			s += cnt;
+			o += cnt;
+			continue;
+		}
+		dist64 = mix64 & S_NBITMASK64(t->dbits);
+		if (S_UNLIKELY(len + 4 > (size_t)(o_top - o)))
+			break;
+		if (S_UNLIKELY(dist64 >= (uint64_t)(o - o0))) {
+			if (dist64 >= (uint64_t)(o - o0) + ds)
+				break;
+			s += t->size;
+			sdec_lz_dict_ref(o, o0, d_top, (size_t)dist64 + 1,
+					 len + 4);
+			o += len + 4;
+			continue;
+		}
+		s += t->size;
+		sdec_lz_wild_ref(o, (size_t)dist64 + 1, len + 4);
+		o += len + 4;
+	}
 	while (s < s_top) {
+		/*
+		 * Opcodes take up to 8 bytes: the last bytes are decoded from
+		 * a padded copy, so there are no reads after the input end
+		 */
+		if (S_UNLIKELY(s_top - s < 8 && !in_tail)) {
+			memset(tail, 0, sizeof(tail));
+			memcpy(tail, s, (size_t)(s_top - s));
+			s_top = tail + (s_top - s);
+			s = tail;
+			in_tail = S_TRUE;
+		}
 		if ((*s & LZOP_MASK2) == LZOPR_16_ID) {
 			mix = S_LD_LE_U16(s) >> LZOPR_HDR_16_BITS;
 			dist = mix & S_NBITMASK(LZOPR_D16_BITS);
@@ -1173,8 +2702,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R2:%06i.%08i\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		}
 		op = *s & LZOP_MASK4;
@@ -1188,8 +2717,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R2:%06i.%08i [S2]\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPR_16S_ID:
 			mix = S_LD_LE_U16(s) >> LZOPR_HDR_16S_BITS;
@@ -1200,8 +2729,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R2:%06i.%08i [S1]\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPR_24S3_ID:
 			mix = (*s | (S_LD_LE_U16(s + 1) << 8))
@@ -1213,8 +2742,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R3:%06i.%08i [S2]\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPR_24S2_ID:
 			mix = (*s | (S_LD_LE_U16(s + 1) << 8))
@@ -1226,8 +2755,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R3:%06i.%08i [S3]\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPR_24S_ID:
 			mix = (*s | (S_LD_LE_U16(s + 1) << 8))
@@ -1239,8 +2768,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R3:%06i.%08i [S1]\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPR_24_ID:
 			mix = (*s | (S_LD_LE_U16(s + 1) << 8))
@@ -1252,8 +2781,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R3:%06i.%08i\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPR_32_ID:
 			mix = S_LD_LE_U32(s) >> LZOPR_HDR_32_BITS;
@@ -1264,8 +2793,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R4:%06i.%08i\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPL_8_ID:
 			cnt = *s >> LZOPL_HDR_8_BITS;
@@ -1273,7 +2802,7 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 #if SDEBUG_LZ
 			fprintf(stderr, "L8:%06i\n", 1 + (int)cnt);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, cnt);
+			SDEC_LZ_LIT_CHECK(s, s_top, o, o_top, cnt);
 			sdec_lz_load_lit(&s, &o, cnt);
 			continue;
 		}
@@ -1288,8 +2817,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R5:%06i.%08i\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPR_64_ID:
 			mix64 = S_LD_LE_U64(s) >> LZOPR_HDR_64_BITS;
@@ -1300,8 +2829,8 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 			fprintf(stderr, "R8:%06i.%08i\n", 4 + (int)len,
 				1 + (int)dist);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, len);
-			sdec_lz_load_ref(&o, dist, len);
+			SDEC_LZ_REF_CHECK(s, s_top, o, o0, o_top, dist, len, ds);
+			sdec_lz_load_ref(&o, o0, d_top, dist, len);
 			continue;
 		case LZOPL_16_ID:
 			cnt = S_LD_LE_U16(s) >> LZOPL_HDR_16_BITS;
@@ -1309,7 +2838,7 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 #if SDEBUG_LZ
 			fprintf(stderr, "L16:%06i\n", 1 + (int)cnt);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, cnt);
+			SDEC_LZ_LIT_CHECK(s, s_top, o, o_top, cnt);
 			sdec_lz_load_lit(&s, &o, cnt);
 			continue;
 		case LZOPL_32_ID:
@@ -1318,7 +2847,7 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 #if SDEBUG_LZ
 			fprintf(stderr, "L32:%06i\n", 1 + (int)cnt);
 #endif
-			SDEC_LZ_ILOOP_OVERFLOW_CHECK(s, s_top, o, o_top, cnt);
+			SDEC_LZ_LIT_CHECK(s, s_top, o, o_top, cnt);
 			sdec_lz_load_lit(&s, &o, cnt);
 			continue;
 		default:
@@ -1332,3 +2861,1781 @@ size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
 	}
 	return o - o0;
 }
+
+size_t sdec_lz(const uint8_t *s0, const size_t ss, uint8_t *o0)
+{
+	return sdec_lz_aux(s0, ss, o0, NULL, 0);
+}
+
+/*
+ * Dictionary LZ
+ *
+ * Format: dictionary ID (32-bit little endian), followed by the LZ data,
+ * with references reaching the dictionary end (i.e. as if the input were
+ * the dictionary continuation).
+ *
+ * The dictionary hash table is computed once, and it is read-only when
+ * encoding (so one dictionary can be used by several threads at once):
+ * every input position is looked up in its own table (proportional to the
+ * input size, as senc_lz()), and in the dictionary table.
+ */
+
+#define LZD_HDR_SIZE 4
+#define LZD_MAX_HASH_BITS 16
+
+struct SLZDict {
+	uint32_t id;
+	size_t ds, hbits;
+	uint8_t *d;
+	uint32_t *refs; /* dictionary positions + 1 (0: empty) */
+};
+
+struct SLZDict *senc_lz_dict_alloc(const uint8_t *d, const size_t ds)
+{
+	size_t i, hb, alloc_size;
+	struct SLZDict *c;
+	RETURN_IF(!d || ds < 4 || ds > UINT32_MAX - 1, NULL);
+	hb = S_RANGE(slog2((uint64_t)ds) + 1, 8, LZD_MAX_HASH_BITS);
+	alloc_size = s_size_t_add(sizeof(struct SLZDict) + (sizeof(uint32_t)
+							    << hb),
+				  ds, 0);
+	RETURN_IF(!alloc_size, NULL);
+	c = (struct SLZDict *)s_malloc(alloc_size);
+	RETURN_IF(!c, NULL);
+	c->id = sh_crc32(S_CRC32_INIT, d, ds);
+	c->ds = ds;
+	c->hbits = hb;
+	c->refs = (uint32_t *)(c + 1);
+	c->d = (uint8_t *)(c->refs + ((size_t)1 << hb));
+	memcpy(c->d, d, ds);
+	memset(c->refs, 0, sizeof(uint32_t) << hb);
+	/* Later positions overwrite earlier ones (closer: shorter refs) */
+	for (i = 0; i + 4 <= ds; i++)
+		c->refs[senc_lz_hash(S_LD_U32(c->d + i), hb)] = (uint32_t)i + 1;
+	return c;
+}
+
+uint32_t senc_lz_dict_id(const struct SLZDict *c)
+{
+	return c ? c->id : 0;
+}
+
+void senc_lz_dict_free(struct SLZDict *c)
+{
+	s_free(c);
+}
+
+/*
+ * Dictionary training: the samples are split in segments (LZD_SEG bytes),
+ * scored by the number of samples containing their 8-byte strings (k-mers,
+ * counted once per sample, ignoring the ones found in too few samples).
+ * Segments are taken by their score, not counting the k-mers covered by
+ * the already taken ones (lazy greedy selection: scores are updated when
+ * reaching the heap top), and the best ones are placed at the dictionary
+ * end (shorter references).
+ */
+
+#define LZD_K 8
+#define LZD_SEG 64
+#define LZD_TBITS 18
+#define LZD_MIN_DIV 256
+
+struct SLZDSeg {
+	size_t off, size, score;
+};
+
+S_INLINE srt_bool lzd_seg_gt(const struct SLZDSeg *x, const struct SLZDSeg *y)
+{
+	return x->score != y->score ? x->score > y->score : x->off < y->off;
+}
+
+/* Max-heap (by score), sift down from "i" */
+static void lzd_heap_down(struct SLZDSeg *h, const size_t n, size_t i)
+{
+	size_t c;
+	struct SLZDSeg t;
+	for (; (c = 2 * i + 1) < n; i = c) {
+		if (c + 1 < n && lzd_seg_gt(&h[c + 1], &h[c]))
+			c++;
+		if (!lzd_seg_gt(&h[c], &h[i]))
+			break;
+		t = h[i];
+		h[i] = h[c];
+		h[c] = t;
+	}
+}
+
+S_INLINE size_t lzd_kmer(const uint8_t *s)
+{
+	return (size_t)((S_LD_LE_U64(s)
+			 * (((uint64_t)0x9e3779b9 << 32) | 0x7f4a7c15))
+			>> (64 - LZD_TBITS));
+}
+
+/*
+ * Segment score: k-mers found in more than "min" samples (and clear their
+ * counts, if "cover" is set)
+ */
+static size_t lzd_score(uint32_t *cnt, const uint8_t *s, const size_t ss,
+			const size_t min, const srt_bool cover)
+{
+	size_t i, h, score = 0;
+	for (i = 0; i + LZD_K <= ss; i++) {
+		h = lzd_kmer(s + i);
+		if (cnt[h] > min)
+			score += cnt[h] - min;
+		if (cover)
+			cnt[h] = 0;
+	}
+	return score;
+}
+
+size_t senc_lz_dict_train(const uint8_t *s, const size_t *sizes,
+			  const size_t n, uint8_t *o, const size_t max_size)
+{
+	uint32_t *cnt, *last;
+	struct SLZDSeg *seg, t;
+	size_t i, j, k, h, off, total, nseg, ns, nsel, out_size, score,
+		min = 1 + n / LZD_MIN_DIV;
+	RETURN_IF(!s || !sizes || !n || !max_size, 0);
+	for (j = total = nseg = 0; j < n; j++) {
+		total += sizes[j];
+		nseg += sizes[j] / LZD_SEG + 1;
+	}
+	RETURN_IF(!o, S_MIN(total, max_size));
+	cnt = (uint32_t *)s_calloc((size_t)2 << LZD_TBITS, sizeof(uint32_t));
+	seg = (struct SLZDSeg *)s_malloc(nseg * sizeof(struct SLZDSeg));
+	if (!cnt || !seg) {
+		s_free(cnt);
+		s_free(seg);
+		return 0;
+	}
+	last = cnt + ((size_t)1 << LZD_TBITS);
+	/* Number of samples containing every k-mer */
+	for (j = off = 0; j < n; off += sizes[j++])
+		for (i = 0; i + LZD_K <= sizes[j]; i++) {
+			h = lzd_kmer(s + off + i);
+			if (last[h] != (uint32_t)j + 1) {
+				last[h] = (uint32_t)j + 1;
+				cnt[h]++;
+			}
+		}
+	/* Segments with some score */
+	for (j = off = ns = 0; j < n; off += sizes[j++])
+		for (i = 0; i < sizes[j]; i += LZD_SEG) {
+			seg[ns].off = off + i;
+			seg[ns].size = S_MIN(LZD_SEG, sizes[j] - i);
+			seg[ns].score = lzd_score(cnt, s + seg[ns].off,
+						  seg[ns].size, min, S_FALSE);
+			if (seg[ns].score)
+				ns++;
+		}
+	/*
+	 * Selection: the heap is at the array start, and the selected
+	 * segments at the end (from the array end backwards, so the last
+	 * selected is the first one in the dictionary)
+	 */
+	for (k = ns / 2; k-- > 0;)
+		lzd_heap_down(seg, ns, k);
+	nsel = out_size = 0;
+	while (ns > 0 && out_size < max_size) {
+		score = lzd_score(cnt, s + seg[0].off, seg[0].size, min,
+				  S_FALSE);
+		if (score < seg[0].score) { /* Partially covered: update */
+			seg[0].score = score;
+			if (!score)
+				seg[0] = seg[--ns];
+			lzd_heap_down(seg, ns, 0);
+			continue;
+		}
+		lzd_score(cnt, s + seg[0].off, seg[0].size, min, S_TRUE);
+		t = seg[0];
+		t.size = S_MIN(t.size, max_size - out_size);
+		out_size += t.size;
+		seg[0] = seg[--ns];
+		lzd_heap_down(seg, ns, 0);
+		seg[nseg - ++nsel] = t;
+	}
+	for (k = nseg - nsel; k < nseg; o += seg[k++].size)
+		memcpy(o, s + seg[k].off, seg[k].size);
+	s_free(cnt);
+	s_free(seg);
+	return out_size;
+}
+
+/* Dictionary match (continuing into the input if reaching its end) */
+S_INLINE size_t senc_lz_dict_match(const uint8_t *d, const size_t ds,
+				   const size_t q, const uint8_t *s,
+				   const size_t ss, const size_t i)
+{
+	size_t len =
+		senc_lz_match(s + i + 4, d + q + 4, S_MIN(ss - i, ds - q) - 4)
+		+ 4;
+	if (q + len == ds)
+		len += senc_lz_match(s + i + len, s, ss - i - len);
+	return len;
+}
+
+/*
+ * LZ encoding with references reaching the dictionary ("d", "ds" bytes,
+ * "drefs": hash table of dictionary positions + 1, 2^dbits elements).
+ * Dictionary candidates: the hash table one, and the one at the same
+ * distance as the previous dictionary reference (same alignment, e.g.
+ * after a small edit). Dictionary matches are extended backwards over the
+ * pending literals
+ */
+static size_t senc_lz_dref(const uint8_t *d, const size_t ds,
+			   const uint32_t *drefs, const size_t dbits,
+			   const uint8_t *s, const size_t ss, uint8_t *o0)
+{
+	uint8_t *o;
+	size_t *refs, i, h, len, dlen, dist, rdist, w32, plit, last, q, nb,
+		hash_size, hash_elems;
+	hash_size = senc_lz_hash_size(ss, LZ_MAX_HASH_BITS_STACK);
+	hash_elems = (size_t)1 << hash_size;
+	refs = (size_t *)s_alloca(sizeof(size_t) * hash_elems);
+	RETURN_IF(!refs, 0);
+	memset(refs, 0, hash_elems * sizeof(refs[0]));
+	o = o0;
+	s_st_pk_u64(&o, ss);
+	plit = rdist = 0;
+	for (i = 0; i + 4 <= ss;) {
+		w32 = S_LD_U32(s + i);
+		/* Input match (table entries: position + 1) */
+		h = senc_lz_hash((uint32_t)w32, hash_size);
+		last = refs[h];
+		refs[h] = i + 1;
+		len = dist = 0;
+		if (last-- && w32 == S_LD_U32(s + last)) {
+			len = senc_lz_match(s + i + 4, s + last + 4, ss - i - 4)
+			      + 4;
+			dist = i - last;
+		}
+		/* Dictionary match, if longer */
+		if (len < 16) {
+			q = drefs[senc_lz_hash((uint32_t)w32, dbits)];
+			if (q-- && w32 == S_LD_U32(d + q)) {
+				dlen = senc_lz_dict_match(d, ds, q, s, ss, i);
+				if (dlen > len) {
+					len = dlen;
+					dist = i + ds - q;
+				}
+			}
+			q = i + ds - rdist;
+			if (rdist >= i + 4 && rdist != dist
+			    && w32 == S_LD_U32(d + q)) {
+				dlen = senc_lz_dict_match(d, ds, q, s, ss, i);
+				if (dlen > len) {
+					len = dlen;
+					dist = rdist;
+				}
+			}
+		}
+		nb = 0;
+		if (dist > i) {
+			q = i + ds - dist;
+			while (nb < i - plit && nb < q
+			       && s[i - nb - 1] == d[q - nb - 1])
+				nb++;
+			len += nb;
+		}
+		if (!len || !senc_lz_store_ref(&o, s + plit, i - nb - plit,
+					       dist, &len)) {
+			i++;
+			continue;
+		}
+		if (dist > i)
+			rdist = dist;
+		i = i - nb + len;
+		plit = i;
+	}
+	if (ss - plit > 0)
+		senc_lz_store_lit(&o, s + plit, ss - plit);
+	return (size_t)(o - o0);
+}
+
+size_t senc_lz_dict(const struct SLZDict *c, const uint8_t *s,
+		    const size_t ss, uint8_t *o0)
+{
+	RETURN_IF(!o0 && ss > 0, s_size_t_add(SENC_LZ_MAX_OUT(ss),
+					      LZD_HDR_SIZE, 0));
+	size_t n;
+	RETURN_IF(!c || !s || !o0 || !ss, 0);
+	S_ST_LE_U32(o0, c->id);
+	n = senc_lz_dref(c->d, c->ds, c->refs, c->hbits, s, ss,
+			 o0 + LZD_HDR_SIZE);
+	return n ? LZD_HDR_SIZE + n : 0;
+}
+
+size_t sdec_lz_dict(const struct SLZDict *c, const uint8_t *s,
+		    const size_t ss, uint8_t *o)
+{
+	RETURN_IF(!c || !s || ss <= LZD_HDR_SIZE, 0);
+	/* BEHAVIOR: other dictionary, no output */
+	RETURN_IF(S_LD_LE_U32(s) != c->id, 0);
+	return sdec_lz_aux(s + LZD_HDR_SIZE, ss - LZD_HDR_SIZE, o, c->d, c->ds);
+}
+
+/*
+ * Delta (binary diff)
+ *
+ * Format: base ID (CRC-32 of the base, 32-bit little endian), followed by
+ * the LZ data, being dictionary LZ with the base as dictionary: references
+ * are the copy instructions (from the base, or from the already decoded
+ * target), and literals the insert instructions. Unchanged regions become
+ * long references, usually with the same distance as the previous one
+ * (tried on every position, besides the hash table candidate).
+ *
+ * The base hash table is built on every call (proportional to the base
+ * size, up to 2^LZ_DELTA_MAX_HASH_BITS elements, 32-bit positions), so the
+ * base can be up to 4 GiB. When the base is bigger than the table, one of
+ * every "step" positions is inserted, so the whole base is reachable (the
+ * bytes before the first inserted position of a match are covered by the
+ * backward match extension).
+ */
+
+#define LZ_DELTA_MAX_HASH_BITS S_MIN(22, LZ_MAX_HASH_BITS)
+
+size_t senc_delta(const uint8_t *b, const size_t bs, const uint8_t *s,
+		  const size_t ss, uint8_t *o0)
+{
+	size_t i, hb, n, step;
+	uint32_t *refs, *refsx;
+	RETURN_IF(!o0 && ss > 0, s_size_t_add(SENC_LZ_MAX_OUT(ss),
+					      LZD_HDR_SIZE, 0));
+	RETURN_IF(!s || !o0 || !ss || (!b && bs), 0);
+	RETURN_IF(bs > UINT32_MAX - 1, 0);
+	hb = S_RANGE(slog2((uint64_t)bs) + 1, 8, LZ_DELTA_MAX_HASH_BITS);
+	refsx = hb > LZ_MAX_HASH_BITS_STACK
+			? (uint32_t *)s_malloc(sizeof(uint32_t) << hb)
+			: NULL;
+	refs = refsx ? refsx : (uint32_t *)s_alloca(sizeof(uint32_t) << hb);
+	RETURN_IF(!refs, 0);
+	memset(refs, 0, sizeof(uint32_t) << hb);
+	step = S_MAX(bs >> hb, 1);
+	for (i = 0; i + 4 <= bs; i += step)
+		refs[senc_lz_hash(S_LD_U32(b + i), hb)] = (uint32_t)i + 1;
+	S_ST_LE_U32(o0, sh_crc32(S_CRC32_INIT, b, bs));
+	n = senc_lz_dref(b, bs, refs, hb, s, ss, o0 + LZD_HDR_SIZE);
+	if (refsx)
+		s_free(refsx);
+	return n ? LZD_HDR_SIZE + n : 0;
+}
+
+size_t sdec_delta(const uint8_t *b, const size_t bs, const uint8_t *s,
+		  const size_t ss, uint8_t *o)
+{
+	RETURN_IF(!s || ss <= LZD_HDR_SIZE || (!b && bs), 0);
+	/* BEHAVIOR: other base, no output (not checked for the size query) */
+	RETURN_IF(o && S_LD_LE_U32(s) != sh_crc32(S_CRC32_INIT, b, bs), 0);
+	return sdec_lz_aux(s + LZD_HDR_SIZE, ss - LZD_HDR_SIZE, o, b, bs);
+}
+
+/*
+ * Framed LZ
+ *
+ * Frame: "sLZF", flags byte, block size and input size (s_st_pk_u64()),
+ * followed by the blocks. Block: data size * 2, plus 1 if stored
+ * uncompressed (s_st_pk_u64()), CRC-32 of the uncompressed block (32-bit
+ * little endian, only if S_LZF_CRC32 flag is set), and the data (senc_lz()
+ * output, senc_lze() output if S_LZF_ENTROPY flag is set, or the block
+ * itself). Blocks are independent, so compression and decompression can be
+ * done in parallel (s_parallel()). If S_LZF_INDEX flag is set, the blocks
+ * are followed by the block index: the offset of every block (64-bit
+ * little endian), from the first block start. As the uncompressed block
+ * offsets are multiples of the block size, any block is located in O(1)
+ * (random access, see sdec_lzf_range()).
+ *
+ * Compression: every block is compressed into its own slot (worst case
+ * size, so no extra memory is required), and then the slots are packed in
+ * order, from the first to the last one, using the same output buffer.
+ *
+ * Decompression: every thread decodes a range of consecutive blocks, in
+ * place. As sdec_lz() and sdec_lze() may write up to 16 bytes after the
+ * block end, the last block of the range is decoded into a temporary
+ * buffer when it is not the last block of the frame.
+ */
+
+#define LZF_MAGIC "sLZF"
+#define LZF_MAGIC_SIZE 4
+#define LZF_HDR_MAX (LZF_MAGIC_SIZE + 1 + 2 * S_PK_U64_MAX_BYTES)
+#define LZF_BHDR_MAX (S_PK_U64_MAX_BYTES + 4)
+#define LZF_FLAGS_STORED (S_LZF_CRC32 | S_LZF_ENTROPY | S_LZF_INDEX)
+#define LZF_IDX_ENTRY 8
+
+struct SLZF {
+	const uint8_t *s, *s_top; /* input (decoding: first block) */
+	const uint8_t *idx;	  /* decoding: block index (NULL if none) */
+	uint8_t *o;		  /* output (encoding: first slot) */
+	size_t ss;		  /* uncompressed size */
+	size_t bs, nb, slot, nt;  /* block size, blocks, slot size, threads */
+	int flags;
+};
+
+S_INLINE size_t lzf_bsize(const struct SLZF *c, const size_t i)
+{
+	return S_MIN(c->bs, c->ss - i * c->bs);
+}
+
+static srt_bool lzf_enc_job(void *c0, size_t t)
+{
+	const struct SLZF *c = (const struct SLZF *)c0;
+	const int level = c->flags >> 8 ? c->flags >> 8
+					: (c->flags & S_LZF_HIGH) ? 1 : 0;
+	size_t i, n, bsz;
+	uint8_t *slot;
+	const uint8_t *b;
+	for (i = t; i < c->nb; i += c->nt) {
+		b = c->s + i * c->bs;
+		bsz = lzf_bsize(c, i);
+		slot = c->o + i * c->slot;
+		n = (c->flags & S_LZF_ENTROPY)
+			    ? senc_lze(b, bsz, slot + LZF_BHDR_MAX, level)
+			    : senc_lz_level(b, bsz, slot + LZF_BHDR_MAX, level);
+		/* Slot header: compressed size and CRC-32 (native format) */
+		S_ST_U64(slot, (uint64_t)n);
+		S_ST_LE_U32(slot + 8, (c->flags & S_LZF_CRC32)
+					      ? sh_crc32(S_CRC32_INIT, b, bsz)
+					      : 0);
+	}
+	return S_TRUE;
+}
+
+size_t senc_lzf(const uint8_t *s, const size_t ss, uint8_t *o,
+		const size_t block_size, const int flags, const size_t nthreads)
+{
+	struct SLZF c;
+	uint8_t *w, *slot, *b0;
+	const uint8_t *p;
+	size_t i, n, bsz;
+	uint32_t crc;
+	srt_bool raw;
+	c.bs = block_size ? block_size : SC_LZ_BLOCK_SIZE;
+	c.nb = ss / c.bs + (ss % c.bs ? 1 : 0);
+	c.slot = s_size_t_add(LZF_BHDR_MAX,
+			      S_MAX(senc_lz(s, S_MIN(c.bs, ss), NULL),
+				    senc_lze(s, S_MIN(c.bs, ss), NULL, 0)),
+			      0);
+	RETURN_IF(c.nb
+			  && (!c.slot
+			      || c.nb > (S_NPOS - LZF_HDR_MAX)
+						/ (c.slot + LZF_IDX_ENTRY)),
+		  0);
+	RETURN_IF(!o, LZF_HDR_MAX + c.nb * (c.slot + LZF_IDX_ENTRY)); /* max */
+	RETURN_IF(!s && ss > 0, 0);
+	w = o;
+	memcpy(w, LZF_MAGIC, LZF_MAGIC_SIZE);
+	w += LZF_MAGIC_SIZE;
+	*w++ = (uint8_t)(flags & LZF_FLAGS_STORED);
+	s_st_pk_u64(&w, c.bs);
+	s_st_pk_u64(&w, ss);
+	RETURN_IF(!c.nb, (size_t)(w - o));
+	b0 = w;
+	c.s = s;
+	c.ss = ss;
+	c.o = o + LZF_HDR_MAX;
+	c.flags = flags;
+	c.nt = S_RANGE(nthreads, 1, c.nb);
+	s_parallel(c.nt, lzf_enc_job, &c);
+	/*
+	 * Pack the blocks. The write position is never after the slot
+	 * start, so a block never overwrites the following slots.
+	 */
+	for (i = 0; i < c.nb; i++) {
+		slot = c.o + i * c.slot;
+		n = (size_t)S_LD_U64(slot);
+		crc = S_LD_LE_U32(slot + 8);
+		bsz = lzf_bsize(&c, i);
+		/* BEHAVIOR: not compressible blocks are stored as is */
+		raw = !n || n >= bsz;
+		s_st_pk_u64(&w, raw ? (uint64_t)bsz * 2 + 1 : (uint64_t)n * 2);
+		if (flags & S_LZF_CRC32) {
+			S_ST_LE_U32(w, crc);
+			w += 4;
+		}
+		if (raw) {
+			memcpy(w, s + i * c.bs, bsz);
+			w += bsz;
+		} else {
+			memmove(w, slot + LZF_BHDR_MAX, n);
+			w += n;
+		}
+	}
+	/* Block index (the block headers are parsed again) */
+	if (flags & S_LZF_INDEX) {
+		for (i = 0, p = b0; i < c.nb; i++, w += LZF_IDX_ENTRY) {
+			S_ST_LE_U64(w, (uint64_t)(p - b0));
+			n = (size_t)s_ld_pk_u64(&p, S_PK_U64_MAX_BYTES);
+			p += (n >> 1) + ((flags & S_LZF_CRC32) ? 4 : 0);
+		}
+	}
+	return (size_t)(w - o);
+}
+
+/* Block header: returns the data start, or NULL if not valid */
+static const uint8_t *lzf_blk(const struct SLZF *c, const uint8_t *s,
+			      const size_t i, size_t *n, srt_bool *raw,
+			      uint32_t *crc)
+{
+	uint64_t v;
+	RETURN_IF(!lzf_ld_pk(&s, c->s_top, &v), NULL);
+	*raw = (srt_bool)(v & 1);
+	v >>= 1;
+	*crc = 0;
+	if (c->flags & S_LZF_CRC32) {
+		RETURN_IF(c->s_top - s < 4, NULL);
+		*crc = S_LD_LE_U32(s);
+		s += 4;
+	}
+	RETURN_IF(v > (uint64_t)(c->s_top - s), NULL);
+	*n = (size_t)v;
+	RETURN_IF(*raw && *n != lzf_bsize(c, i), NULL);
+	return s;
+}
+
+/* Frame header check */
+static srt_bool lzf_dec_hdr(struct SLZF *c, const uint8_t *s, const size_t ss)
+{
+	uint64_t bs, us;
+	RETURN_IF(!s || ss < LZF_MAGIC_SIZE + 1
+			  || memcmp(s, LZF_MAGIC, LZF_MAGIC_SIZE),
+		  S_FALSE);
+	c->flags = s[LZF_MAGIC_SIZE];
+	RETURN_IF(c->flags & ~LZF_FLAGS_STORED, S_FALSE);
+	c->s = s + LZF_MAGIC_SIZE + 1;
+	c->s_top = s + ss;
+	RETURN_IF(!lzf_ld_pk(&c->s, c->s_top, &bs)
+			  || !lzf_ld_pk(&c->s, c->s_top, &us) || !bs
+			  || bs > S_NPOS - 16 || us > S_NPOS - 16,
+		  S_FALSE);
+	c->bs = (size_t)bs;
+	c->ss = (size_t)us;
+	c->nb = c->ss / c->bs + (c->ss % c->bs ? 1 : 0);
+	c->idx = NULL;
+	if (c->flags & S_LZF_INDEX) {
+		RETURN_IF(c->nb > (size_t)(c->s_top - c->s) / LZF_IDX_ENTRY,
+			  S_FALSE);
+		c->s_top -= c->nb * LZF_IDX_ENTRY;
+		c->idx = c->s_top;
+	}
+	/* At least one byte per block header */
+	return c->nb <= (size_t)(c->s_top - c->s) ? S_TRUE : S_FALSE;
+}
+
+/* Frame header, block headers, and block index check */
+static srt_bool lzf_dec_init(struct SLZF *c, const uint8_t *s,
+			     const size_t ss)
+{
+	size_t i, n;
+	uint32_t crc;
+	srt_bool raw;
+	const uint8_t *p;
+	RETURN_IF(!lzf_dec_hdr(c, s, ss), S_FALSE);
+	for (i = 0, p = c->s; i < c->nb; i++, p += n) {
+		RETURN_IF(c->idx
+				  && S_LD_LE_U64(c->idx + i * LZF_IDX_ENTRY)
+					     != (uint64_t)(p - c->s),
+			  S_FALSE);
+		p = lzf_blk(c, p, i, &n, &raw, &crc);
+		RETURN_IF(!p, S_FALSE);
+	}
+	return p == c->s_top ? S_TRUE : S_FALSE;
+}
+
+/*
+ * Block "i" data start, or NULL if not valid. O(1) if the frame has block
+ * index, O(i) otherwise (block headers are parsed from the first one)
+ */
+static const uint8_t *lzf_blk_find(const struct SLZF *c, const size_t i,
+				   size_t *n, srt_bool *raw, uint32_t *crc)
+{
+	size_t j;
+	uint64_t off;
+	const uint8_t *p = c->s;
+	if (c->idx) {
+		off = S_LD_LE_U64(c->idx + i * LZF_IDX_ENTRY);
+		RETURN_IF(off >= (uint64_t)(c->s_top - c->s), NULL);
+		return lzf_blk(c, c->s + off, i, n, raw, crc);
+	}
+	for (j = 0; j < i; j++, p += *n) {
+		p = lzf_blk(c, p, j, n, raw, crc);
+		RETURN_IF(!p, NULL);
+	}
+	return lzf_blk(c, p, i, n, raw, crc);
+}
+
+/*
+ * Block decoding, with CRC-32 check. Output buffer requires 16 extra bytes
+ * if not raw (sdec_lz() and sdec_lze() writes after the block end)
+ */
+static srt_bool lzf_dec_blk(const struct SLZF *c, const uint8_t *p,
+			    const size_t n, const srt_bool raw,
+			    const uint32_t crc, uint8_t *o, const size_t bsz)
+{
+	srt_bool ok;
+	if (raw) {
+		memcpy(o, p, n);
+		ok = S_TRUE;
+	} else {
+		ok = (c->flags & S_LZF_ENTROPY)
+			     ? sdec_lze(p, n, NULL) == bsz + 16
+				       && sdec_lze(p, n, o) == bsz
+			     : sdec_lz(p, n, NULL) == bsz + 16
+				       && sdec_lz(p, n, o) == bsz;
+	}
+	return ok && (!(c->flags & S_LZF_CRC32)
+		      || sh_crc32(S_CRC32_INIT, o, bsz) == crc)
+		       ? S_TRUE
+		       : S_FALSE;
+}
+
+static srt_bool lzf_dec_job(void *c0, size_t t)
+{
+	const struct SLZF *c = (const struct SLZF *)c0;
+	size_t i, i0, i1, n = 0, bsz;
+	uint8_t *o, *tmp = NULL;
+	const uint8_t *p = NULL;
+	uint32_t crc;
+	srt_bool raw, ok = S_TRUE;
+	i0 = t * (c->nb / c->nt) + S_MIN(t, c->nb % c->nt);
+	i1 = i0 + c->nb / c->nt + (t < c->nb % c->nt ? 1 : 0);
+	for (i = i0; i < i1 && ok; i++) {
+		p = i == i0 ? lzf_blk_find(c, i, &n, &raw, &crc)
+			    : lzf_blk(c, p + n, i, &n, &raw, &crc);
+		bsz = lzf_bsize(c, i);
+		o = c->o + i * c->bs;
+		if (!raw && i + 1 == i1 && i1 < c->nb) {
+			/* sdec_lz()/sdec_lze() max out size for the block */
+			tmp = (uint8_t *)s_malloc(bsz + 16);
+			if (!tmp)
+				break;
+			ok = lzf_dec_blk(c, p, n, raw, crc, tmp, bsz);
+			memcpy(o, tmp, bsz);
+			s_free(tmp);
+		} else {
+			ok = lzf_dec_blk(c, p, n, raw, crc, o, bsz);
+		}
+	}
+	return ok && i == i1 ? S_TRUE : S_FALSE;
+}
+
+/*
+ * Frame size (frame header, blocks, and block index), or 0 if not valid.
+ * O(1) for a whole frame with block index, O(blocks) otherwise (block
+ * headers are parsed, in order to find the frame end)
+ */
+static size_t lzf_frame_size(const uint8_t *s, const size_t ss)
+{
+	struct SLZF c;
+	size_t i, n;
+	uint32_t crc;
+	srt_bool raw;
+	const uint8_t *p;
+	RETURN_IF(!lzf_dec_hdr(&c, s, ss), 0);
+	if (c.idx && c.nb) {
+		p = lzf_blk_find(&c, c.nb - 1, &n, &raw, &crc);
+		RETURN_IF(p && p + n == c.s_top, ss);
+	}
+	c.s_top = s + ss; /* the frame could be followed by other frames */
+	for (i = 0, p = c.s; i < c.nb; i++, p += n) {
+		p = lzf_blk(&c, p, i, &n, &raw, &crc);
+		RETURN_IF(!p, 0);
+	}
+	n = c.idx ? c.nb * LZF_IDX_ENTRY : 0;
+	return n <= (size_t)(c.s_top - p) ? (size_t)(p - s) + n : 0;
+}
+
+/*
+ * BEHAVIOR: concatenated frames (e.g. SC_ENC_LZF stream) are decoded one
+ * after the other
+ */
+size_t sdec_lzf(const uint8_t *s, const size_t ss, uint8_t *o,
+		const size_t nthreads)
+{
+	struct SLZF c;
+	size_t i, fs, j = 0;
+	RETURN_IF(!s || !ss, 0);
+	for (i = 0; i < ss; i += fs) {
+		fs = lzf_frame_size(s + i, ss - i);
+		RETURN_IF(!fs || !lzf_dec_init(&c, s + i, fs), 0);
+		if (o && c.nb) {
+			c.o = o + j;
+			c.nt = S_RANGE(nthreads, 1, c.nb);
+			RETURN_IF(!s_parallel(c.nt, lzf_dec_job, &c), 0);
+		}
+		j = s_size_t_add(j, c.ss, S_NPOS);
+	}
+	return o ? j : s_size_t_add(j, 16, S_NPOS); /* max out size */
+}
+
+/* Range from a single frame */
+static size_t lzf_dec_range(const uint8_t *s, const size_t ss, uint8_t *o,
+			    const size_t off, const size_t len)
+{
+	struct SLZF c;
+	uint8_t *tmp = NULL;
+	const uint8_t *p = NULL;
+	size_t i, i1, n = 0, bsz, boff, cnt, done, rlen;
+	uint32_t crc;
+	srt_bool raw, ok = S_TRUE;
+	RETURN_IF(!lzf_dec_hdr(&c, s, ss) || off >= c.ss || !len, 0);
+	rlen = S_MIN(len, c.ss - off);
+	RETURN_IF(!o, rlen); /* max out size */
+	i1 = (off + rlen - 1) / c.bs;
+	for (i = off / c.bs, done = 0; i <= i1 && ok; i++, done += cnt) {
+		p = !done ? lzf_blk_find(&c, i, &n, &raw, &crc)
+			  : lzf_blk(&c, p + n, i, &n, &raw, &crc);
+		if (!p)
+			break;
+		bsz = lzf_bsize(&c, i);
+		boff = !done ? off - i * c.bs : 0;
+		cnt = S_MIN(bsz - boff, rlen - done);
+		/* Whole block, and room for the decoder extra bytes */
+		if (!boff && cnt == bsz && (raw || rlen - done >= bsz + 16)) {
+			ok = lzf_dec_blk(&c, p, n, raw, crc, o + done, bsz);
+			continue;
+		}
+		if (!tmp) /* sdec_lz()/sdec_lze() max out size for any block */
+			tmp = (uint8_t *)s_malloc(c.bs + 16);
+		ok = tmp && lzf_dec_blk(&c, p, n, raw, crc, tmp, bsz);
+		if (ok)
+			memcpy(o + done, tmp + boff, cnt);
+	}
+	s_free(tmp);
+	return ok && i > i1 ? rlen : 0;
+}
+
+size_t sdec_lzf_range(const uint8_t *s, const size_t ss, uint8_t *o,
+		      const size_t off, const size_t len)
+{
+	struct SLZF c;
+	size_t i, fs, n, done = 0, foff = off;
+	RETURN_IF(!s || !len, 0);
+	/* Frames before the range are skipped, without decoding them */
+	for (i = 0; i < ss && done < len; i += fs) {
+		fs = lzf_frame_size(s + i, ss - i);
+		RETURN_IF(!fs || !lzf_dec_hdr(&c, s + i, fs), 0);
+		if (foff >= c.ss) {
+			foff -= c.ss;
+			continue;
+		}
+		n = lzf_dec_range(s + i, fs, o ? o + done : NULL, foff,
+				  len - done);
+		RETURN_IF(!n, 0);
+		done += n;
+		foff = 0;
+	}
+	return done;
+}
+/*
+ * Frame walker (streaming decoding): frame and block headers are parsed
+ * as they come, skipping the block data and the block index, so the frame
+ * end is found without having the whole frame in memory
+ */
+
+enum eLZFW { LZFW_FHDR, LZFW_BHDR, LZFW_DATA, LZFW_IDX, LZFW_END };
+
+struct SLZFW {
+	enum eLZFW st;
+	int flags;
+	size_t hn;		/* header bytes */
+	uint8_t h[LZF_HDR_MAX]; /* frame or block header */
+	size_t us, nb, i;	/* uncompressed size, blocks, current block */
+	size_t skip;		/* block data or block index bytes left */
+};
+
+/* After the frame header or a block: next block header, index, or end */
+static void lzfw_next(struct SLZFW *w)
+{
+	w->hn = 0;
+	if (w->i < w->nb) {
+		w->st = LZFW_BHDR;
+		return;
+	}
+	w->skip = (w->flags & S_LZF_INDEX) ? w->nb * LZF_IDX_ENTRY : 0;
+	w->st = w->skip ? LZFW_IDX : LZFW_END;
+}
+
+/*
+ * Returns the consumed bytes (stopping at the frame end, LZFW_END state),
+ * or S_NPOS if not valid
+ */
+static size_t lzfw_walk(struct SLZFW *w, const uint8_t *s, const size_t ss)
+{
+	size_t i = 0, n;
+	uint64_t bs, us;
+	const uint8_t *p;
+	while (i < ss && w->st != LZFW_END) {
+		if (w->st == LZFW_DATA || w->st == LZFW_IDX) {
+			n = S_MIN(w->skip, ss - i);
+			i += n;
+			w->skip -= n;
+			if (!w->skip) {
+				if (w->st == LZFW_IDX)
+					w->st = LZFW_END;
+				else
+					lzfw_next(w);
+			}
+			continue;
+		}
+		w->h[w->hn++] = s[i++];
+		p = w->h;
+		if (w->st == LZFW_BHDR) {
+			if (!lzf_ld_pk(&p, w->h + w->hn, &bs)) {
+				RETURN_IF(w->hn == S_PK_U64_MAX_BYTES, S_NPOS);
+				continue;
+			}
+			RETURN_IF((bs >> 1) > S_NPOS - 4, S_NPOS);
+			w->skip = (size_t)(bs >> 1)
+				  + ((w->flags & S_LZF_CRC32) ? 4 : 0);
+			w->i++;
+			w->st = LZFW_DATA;
+			continue;
+		}
+		/* Frame header: magic, flags, block size, and input size */
+		if (w->hn <= LZF_MAGIC_SIZE) {
+			RETURN_IF(w->h[w->hn - 1] != LZF_MAGIC[w->hn - 1],
+				  S_NPOS);
+			continue;
+		}
+		w->flags = w->h[LZF_MAGIC_SIZE];
+		RETURN_IF(w->flags & ~LZF_FLAGS_STORED, S_NPOS);
+		p += LZF_MAGIC_SIZE + 1;
+		if (!lzf_ld_pk(&p, w->h + w->hn, &bs)
+		    || !lzf_ld_pk(&p, w->h + w->hn, &us)) {
+			RETURN_IF(w->hn == LZF_HDR_MAX, S_NPOS);
+			continue;
+		}
+		RETURN_IF(!bs || bs > S_NPOS - 16 || us > S_NPOS - 16, S_NPOS);
+		w->us = (size_t)us;
+		w->nb = w->us / (size_t)bs + (w->us % (size_t)bs ? 1 : 0);
+		RETURN_IF(w->nb > S_NPOS / LZF_IDX_ENTRY, S_NPOS);
+		w->i = 0;
+		lzfw_next(w);
+	}
+	return i;
+}
+
+
+/*
+ * Entropy-coded LZ (LZE)
+ *
+ * Format: input size (s_st_pk_u64()), followed by blocks of up to
+ * LZE_BLOCK_SIZE input bytes, each one being its data size * 4 plus the
+ * block mode (s_st_pk_u64()), and the data: the block itself (LZE_RAW),
+ * senc_lz() output (LZE_LZ), or entropy-coded sequences (LZE_HUF):
+ *
+ * - Number of sequences (s_st_pk_u64()).
+ * - Huffman code lengths for literals, literal run lengths, match lengths
+ *   and distances: number of symbols (s_st_pk_u64()), and 4 bits per
+ *   symbol (low nibble first).
+ * - Bit stream (LSB first): every sequence is a literal run length, the
+ *   literals, a match length and a distance. Literals after the last
+ *   sequence take the rest of the block.
+ *
+ * Lengths and distances are coded as a symbol and extra bits: values
+ * below 16 are symbols, and bigger ones use two symbols per power of two
+ * (log2 and the next bit), followed by the remaining low bits.
+ *
+ * Encoding: every block is compressed with senc_lz_level(), and the LZ
+ * opcodes are parsed twice (symbol counting and bit stream writing), so
+ * the entropy stage works with any compression level. The smallest of the
+ * three block modes is used (so the output is never much bigger than the
+ * senc_lz_level() one).
+ *
+ * Decoding: canonical Huffman codes of up to LZE_MAX_BITS bits, decoded
+ * with one table lookup per symbol (the table is indexed by the next
+ * LZE_MAX_BITS bits of the stream).
+ */
+
+#define LZE_BLOCK_SIZE (1 << 20)
+#define LZE_MAX_BITS 11
+#define LZE_TSIZE (1 << LZE_MAX_BITS)
+#define LZE_NLIT 256
+#define LZE_NSYM 50 /* length/distance symbols (values up to 2^20) */
+#define LZE_NTBL 4
+#define LZE_RAW 0
+#define LZE_LZ 1
+#define LZE_HUF 2
+#define LZE_MAX_OUT(ss)                                                        \
+	s_size_t_add(ss, (ss / LZE_BLOCK_SIZE + 2) * S_PK_U64_MAX_BYTES, 0)
+
+struct SLZEHuf {
+	size_t n; /* symbols (last used + 1) */
+	uint32_t freq[LZE_NLIT];
+	uint16_t code[LZE_NLIT]; /* bit-reversed (LSB first) */
+	uint8_t len[LZE_NLIT];
+};
+
+/* LZ sequence: literals and reference (len 0: no reference, block end) */
+struct SLZESeq {
+	const uint8_t *p, *p_top, *lit;
+	size_t nlit, len, dist;
+};
+
+struct SLZEBw {
+	uint8_t *o;
+	uint64_t acc;
+	size_t n;
+};
+
+struct SLZEBr {
+	const uint8_t *p, *p_top;
+	uint64_t acc;
+	size_t n, over; /* bits in "acc", zero bits added after the end */
+};
+
+static size_t lze_pk_size(const uint64_t v)
+{
+	uint8_t b[S_PK_U64_MAX_BYTES], *p = b;
+	s_st_pk_u64(&p, v);
+	return (size_t)(p - b);
+}
+
+/* Value to symbol, and number of extra bits */
+S_INLINE size_t lze_sym(const size_t v, size_t *nx)
+{
+	size_t b;
+	if (v < 16) {
+		*nx = 0;
+		return v;
+	}
+	b = slog2((uint64_t)v);
+	*nx = b - 1;
+	return 16 + (b - 4) * 2 + ((v >> (b - 1)) & 1);
+}
+
+/*
+ * Next LZ sequence. Literal runs take one opcode (pending literals are
+ * stored at once, and blocks are smaller than LZOPL_32_RANGE)
+ */
+static void lze_seq(struct SLZESeq *q)
+{
+	uint64_t v;
+	const struct SLZOp *t;
+	q->nlit = q->len = 0;
+	while (q->p < q->p_top) {
+		v = S_LD_LE_U64(q->p);
+		t = lz_ops + (v & LZOP_MASK4);
+		v = (v << t->shl) >> t->shr;
+		q->p += t->size;
+		if (t->lit) {
+			q->lit = q->p;
+			q->nlit = (size_t)v + 1;
+			q->p += q->nlit;
+			continue;
+		}
+		q->len = (size_t)(v >> t->dbits) + 4;
+		q->dist = (size_t)(v & S_NBITMASK64(t->dbits)) + 1;
+		return;
+	}
+}
+
+/*
+ * Code lengths from the frequencies (Huffman tree built with two queues,
+ * sorted leaves and internal nodes). If longer than LZE_MAX_BITS, the
+ * frequencies are halved, and the tree is built again.
+ */
+static void lze_huf_lens(struct SLZEHuf *h)
+{
+	uint32_t f[LZE_NLIT], w[2 * LZE_NLIT];
+	uint16_t sym[LZE_NLIT], parent[2 * LZE_NLIT];
+	uint8_t depth[2 * LZE_NLIT];
+	size_t i, j, k, a, b, n, maxl;
+	for (i = n = h->n = 0; i < LZE_NLIT; i++) {
+		f[i] = h->freq[i];
+		h->len[i] = 0;
+		if (f[i]) {
+			sym[n++] = (uint16_t)i;
+			h->n = i + 1;
+		}
+	}
+	if (n < 2) {
+		if (n)
+			h->len[sym[0]] = 1;
+		return;
+	}
+	for (;;) {
+		for (i = 1; i < n; i++) /* by frequency, then symbol */
+			for (j = i; j > 0 && f[sym[j - 1]] > f[sym[j]]; j--) {
+				a = sym[j];
+				sym[j] = sym[j - 1];
+				sym[j - 1] = (uint16_t)a;
+			}
+		for (i = 0; i < n; i++)
+			w[i] = f[sym[i]];
+		for (i = 0, j = k = n; k < 2 * n - 1; k++) {
+			a = i < n && (j >= k || w[i] <= w[j]) ? i++ : j++;
+			b = i < n && (j >= k || w[i] <= w[j]) ? i++ : j++;
+			w[k] = w[a] + w[b];
+			parent[a] = parent[b] = (uint16_t)k;
+		}
+		depth[2 * n - 2] = 0;
+		for (k = 2 * n - 2, maxl = 0; k-- > 0;) {
+			depth[k] = (uint8_t)(depth[parent[k]] + 1);
+			if (k < n && depth[k] > maxl)
+				maxl = depth[k];
+		}
+		if (maxl <= LZE_MAX_BITS)
+			break;
+		for (i = 0; i < n; i++)
+			f[sym[i]] = (f[sym[i]] >> 1) | 1;
+	}
+	for (i = 0; i < n; i++)
+		h->len[sym[i]] = depth[i];
+}
+
+/* Canonical codes (bit-reversed) from the code lengths */
+static void lze_huf_codes(const uint8_t *len, const size_t n, uint16_t *code)
+{
+	size_t i, j, c, cnt[LZE_MAX_BITS + 1], next[LZE_MAX_BITS + 1];
+	memset(cnt, 0, sizeof(cnt));
+	for (i = 0; i < n; i++)
+		cnt[len[i]]++;
+	for (cnt[0] = 0, next[0] = 0, i = 1; i <= LZE_MAX_BITS; i++)
+		next[i] = (next[i - 1] + cnt[i - 1]) << 1;
+	for (i = 0; i < n; i++) {
+		if (!len[i])
+			continue;
+		c = next[len[i]]++;
+		for (j = 0, code[i] = 0; j < len[i]; j++, c >>= 1)
+			code[i] = (uint16_t)((code[i] << 1) | (c & 1));
+	}
+}
+
+/*
+ * Decoding table: symbol * 16 + code length, for every LZE_MAX_BITS-bit
+ * value. Only complete codes are valid (or one symbol, with 1-bit code),
+ * so every table entry is a symbol.
+ */
+static srt_bool lze_huf_table(const uint8_t *len, const size_t n, uint16_t *t)
+{
+	uint16_t code[LZE_NLIT];
+	size_t i, r, kraft = 0, nsym = 0;
+	for (i = 0; i < n; i++)
+		if (len[i]) {
+			RETURN_IF(len[i] > LZE_MAX_BITS, S_FALSE);
+			kraft += (size_t)1 << (LZE_MAX_BITS - len[i]);
+			nsym++;
+		}
+	RETURN_IF(kraft != LZE_TSIZE && (nsym != 1 || kraft != LZE_TSIZE / 2),
+		  S_FALSE);
+	lze_huf_codes(len, n, code);
+	for (i = 0; i < n; i++)
+		if (len[i])
+			for (r = nsym == 1 ? 0 : code[i]; r < LZE_TSIZE;
+			     r += nsym == 1 ? 1 : (size_t)1 << len[i])
+				t[r] = (uint16_t)((i << 4) | len[i]);
+	return S_TRUE;
+}
+
+/* Up to 32 bits */
+S_INLINE void lze_put(struct SLZEBw *w, const uint64_t v, const size_t nbits)
+{
+	w->acc |= v << w->n;
+	w->n += nbits;
+	if (w->n >= 32) {
+		S_ST_LE_U32(w->o, (uint32_t)w->acc);
+		w->o += 4;
+		w->acc >>= 32;
+		w->n -= 32;
+	}
+}
+
+S_INLINE void lze_put_sym(struct SLZEBw *w, const struct SLZEHuf *h,
+			  const size_t v)
+{
+	size_t nx, sym = lze_sym(v, &nx);
+	lze_put(w,
+		h->code[sym] | ((uint64_t)(v & S_NBITMASK(nx)) << h->len[sym]),
+		h->len[sym] + nx);
+}
+
+/* At least 56 bits in the buffer after the call */
+S_INLINE void lze_refill(struct SLZEBr *r)
+{
+	if (S_LIKELY(r->p_top - r->p >= 8)) {
+		r->acc |= S_LD_LE_U64(r->p) << r->n;
+		r->p += (63 - r->n) >> 3;
+		r->n |= 56;
+		return;
+	}
+	for (; r->n <= 56; r->n += 8)
+		if (r->p < r->p_top)
+			r->acc |= (uint64_t)*r->p++ << r->n;
+		else
+			r->over += 8;
+}
+
+S_INLINE size_t lze_huf_dec(struct SLZEBr *r, const uint16_t *t)
+{
+	const size_t e = t[r->acc & (LZE_TSIZE - 1)];
+	r->acc >>= e & 15;
+	r->n -= e & 15;
+	return e >> 4;
+}
+
+S_INLINE size_t lze_val(struct SLZEBr *r, const uint16_t *t)
+{
+	size_t v, nx, sym;
+	lze_refill(r);
+	sym = lze_huf_dec(r, t);
+	RETURN_IF(sym < 16, sym);
+	nx = (sym - 16) / 2 + 3;
+	v = (((size_t)2 | ((sym - 16) & 1)) << nx)
+	    | (size_t)(r->acc & S_NBITMASK(nx));
+	r->acc >>= nx;
+	r->n -= nx;
+	return v;
+}
+
+S_INLINE void lze_lits(struct SLZEBr *r, const uint16_t *t, uint8_t *o,
+		       size_t n)
+{
+	for (; n >= 4; n -= 4, o += 4) {
+		lze_refill(r);
+		o[0] = (uint8_t)lze_huf_dec(r, t);
+		o[1] = (uint8_t)lze_huf_dec(r, t);
+		o[2] = (uint8_t)lze_huf_dec(r, t);
+		o[3] = (uint8_t)lze_huf_dec(r, t);
+	}
+	lze_refill(r);
+	for (; n > 0; n--)
+		*o++ = (uint8_t)lze_huf_dec(r, t);
+}
+
+/* Block encoding ("lz": buffer for the senc_lz_level() output) */
+static size_t lze_enc_blk(const uint8_t *s, const size_t ss, uint8_t *o0,
+			  uint8_t *lz, const int level)
+{
+	struct SLZEHuf h[LZE_NTBL];
+	struct SLZESeq q;
+	struct SLZEBw w;
+	uint8_t *o = o0;
+	size_t i, k, nx, nlz, hs, nseq = 0, bits = 0, hsize, mode, n;
+	nlz = senc_lz_level(s, ss, lz, level);
+	memset(lz + nlz, 0, 8); /* 64-bit opcode loads */
+	hs = s_pk_u64_size(lz);
+	for (k = 0; k < LZE_NTBL; k++)
+		memset(h[k].freq, 0, sizeof(h[k].freq));
+	q.p = lz + hs;
+	q.p_top = lz + nlz;
+	for (;;) {
+		lze_seq(&q);
+		for (i = 0; i < q.nlit; i++)
+			h[0].freq[q.lit[i]]++;
+		if (!q.len)
+			break;
+		h[1].freq[lze_sym(q.nlit, &nx)]++;
+		bits += nx;
+		h[2].freq[lze_sym(q.len - 4, &nx)]++;
+		bits += nx;
+		h[3].freq[lze_sym(q.dist - 1, &nx)]++;
+		bits += nx;
+		nseq++;
+	}
+	hsize = lze_pk_size(nseq);
+	for (k = 0; k < LZE_NTBL; k++) {
+		lze_huf_lens(&h[k]);
+		for (i = 0; i < h[k].n; i++)
+			bits += (size_t)h[k].freq[i] * h[k].len[i];
+		hsize += lze_pk_size(h[k].n) + (h[k].n + 1) / 2;
+	}
+	hsize += (bits + 7) / 8;
+	mode = hsize < nlz && hsize < ss ? LZE_HUF : nlz < ss ? LZE_LZ : LZE_RAW;
+	n = mode == LZE_HUF ? hsize : mode == LZE_LZ ? nlz : ss;
+	s_st_pk_u64(&o, (uint64_t)n * 4 + mode);
+	if (mode != LZE_HUF) {
+		memcpy(o, mode == LZE_LZ ? lz : s, n);
+		return (size_t)(o - o0) + n;
+	}
+	s_st_pk_u64(&o, nseq);
+	for (k = 0; k < LZE_NTBL; k++) {
+		s_st_pk_u64(&o, h[k].n);
+		for (i = 0; i < h[k].n; i += 2)
+			*o++ = (uint8_t)(h[k].len[i]
+					 | (i + 1 < h[k].n ? h[k].len[i + 1] << 4
+							   : 0));
+		lze_huf_codes(h[k].len, h[k].n, h[k].code);
+	}
+	w.o = o;
+	w.acc = 0;
+	w.n = 0;
+	q.p = lz + hs;
+	for (;;) {
+		lze_seq(&q);
+		if (q.len)
+			lze_put_sym(&w, &h[1], q.nlit);
+		for (i = 0; i < q.nlit; i++)
+			lze_put(&w, h[0].code[q.lit[i]], h[0].len[q.lit[i]]);
+		if (!q.len)
+			break;
+		lze_put_sym(&w, &h[2], q.len - 4);
+		lze_put_sym(&w, &h[3], q.dist - 1);
+	}
+	for (; w.n > 0; w.n = w.n > 8 ? w.n - 8 : 0, w.acc >>= 8)
+		*w.o++ = (uint8_t)w.acc;
+	return (size_t)(w.o - o0);
+}
+
+size_t senc_lze(const uint8_t *s, const size_t ss, uint8_t *o0,
+		const int level)
+{
+	uint8_t *o, *lz;
+	size_t i, bsz;
+	RETURN_IF(!o0 && ss > 0, LZE_MAX_OUT(ss));
+	RETURN_IF(!s || !o0 || !ss, 0);
+	lz = (uint8_t *)s_malloc(
+		s_size_t_add(senc_lz(s, S_MIN(ss, LZE_BLOCK_SIZE), NULL), 8, 0));
+	RETURN_IF(!lz, 0);
+	o = o0;
+	s_st_pk_u64(&o, ss);
+	for (i = 0; i < ss; i += bsz) {
+		bsz = S_MIN(LZE_BLOCK_SIZE, ss - i);
+		o += lze_enc_blk(s + i, bsz, o, lz, level);
+	}
+	s_free(lz);
+	return (size_t)(o - o0);
+}
+
+/*
+ * Entropy-coded block decoding. References can not reach previous blocks
+ * (blocks are compressed independently)
+ */
+static srt_bool lze_dec_huf(const uint8_t *s, const uint8_t *s_top,
+			    uint8_t *o0, const size_t bsz)
+{
+	uint16_t t[LZE_NTBL][LZE_TSIZE];
+	uint8_t len[LZE_NLIT];
+	struct SLZEBr r;
+	uint64_t v;
+	uint8_t *o = o0, *o_top = o0 + bsz;
+	size_t i, k, n, nseq, nlit, dist;
+	RETURN_IF(!lzf_ld_pk(&s, s_top, &v) || v > bsz / 4, S_FALSE);
+	nseq = (size_t)v;
+	for (k = 0; k < LZE_NTBL; k++) {
+		RETURN_IF(!lzf_ld_pk(&s, s_top, &v)
+				  || v > (k ? LZE_NSYM : LZE_NLIT),
+			  S_FALSE);
+		n = (size_t)v;
+		RETURN_IF((n + 1) / 2 > (size_t)(s_top - s), S_FALSE);
+		for (i = 0; i < n; i++)
+			len[i] = (uint8_t)((s[i / 2] >> (4 * (i & 1))) & 15);
+		s += (n + 1) / 2;
+		/* BEHAVIOR: empty table: every symbol is 0 (no bits) */
+		if (!n)
+			memset(t[k], 0, sizeof(t[k]));
+		else if (!lze_huf_table(len, n, t[k]))
+			return S_FALSE;
+	}
+	r.p = s;
+	r.p_top = s_top;
+	r.acc = 0;
+	r.n = r.over = 0;
+	for (k = 0; k < nseq; k++) {
+		nlit = lze_val(&r, t[1]);
+		RETURN_IF(nlit > (size_t)(o_top - o), S_FALSE);
+		lze_lits(&r, t[0], o, nlit);
+		o += nlit;
+		n = lze_val(&r, t[2]) + 4;
+		dist = lze_val(&r, t[3]) + 1;
+		RETURN_IF(n > (size_t)(o_top - o) || dist > (size_t)(o - o0),
+			  S_FALSE);
+		s_reccpy(o, dist, n); /* up to 16 bytes after o + n */
+		o += n;
+	}
+	lze_lits(&r, t[0], o, (size_t)(o_top - o));
+	/* Valid if no padding bits were used, and no full bytes are left */
+	return r.over <= r.n && r.n - r.over < 8 && r.p == r.p_top ? S_TRUE
+								    : S_FALSE;
+}
+
+size_t sdec_lze(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	uint64_t v;
+	size_t i, n, bsz, total;
+	const uint8_t *s_top = s + ss;
+	srt_bool ok;
+	RETURN_IF(!s || !ss || !lzf_ld_pk(&s, s_top, &v) || v > S_NPOS - 16,
+		  0);
+	total = (size_t)v;
+	RETURN_IF(!o, total + 16); /* max out size */
+	for (i = 0; i < total; i += bsz, s += n) {
+		bsz = S_MIN(LZE_BLOCK_SIZE, total - i);
+		RETURN_IF(!lzf_ld_pk(&s, s_top, &v)
+				  || (v >> 2) > (uint64_t)(s_top - s),
+			  0);
+		n = (size_t)(v >> 2);
+		switch (v & 3) {
+		case LZE_RAW:
+			ok = n == bsz;
+			if (ok)
+				memcpy(o + i, s, n);
+			break;
+		case LZE_LZ:
+			ok = sdec_lz(s, n, NULL) == bsz + 16
+			     && sdec_lz(s, n, o + i) == bsz;
+			break;
+		case LZE_HUF:
+			ok = lze_dec_huf(s, s + n, o + i, bsz);
+			break;
+		default:
+			ok = S_FALSE;
+		}
+		RETURN_IF(!ok, 0);
+	}
+	return s == s_top ? total : 0;
+}
+
+/*
+ * Streaming codecs
+ *
+ * Input is processed as it comes, keeping only what can not be processed
+ * yet: incomplete base64/hex quanta, escape sequences that could be cut at
+ * the chunk end (SC_PEND_MAX bytes at most), and for LZ, one block (input
+ * block when encoding, compressed block when decoding). LZ streams are a
+ * sequence of blocks, each one being the senc_lz() output for up to
+ * SC_LZ_BLOCK_SIZE input bytes, prefixed by its size (s_st_pk_u64()).
+ * Framed LZ streams are a sequence of senc_lzf() frames, each one for up
+ * to block size x threads input bytes (one block per thread), keeping one
+ * frame (input when encoding, compressed frame when decoding).
+ */
+
+#define SC_PEND_MAX 16
+
+struct SCodec {
+	enum eSCodec type;
+	srt_bool error;
+	size_t pn;		/* pending input bytes */
+	uint8_t p[SC_PEND_MAX]; /* pending input (block header, for LZ) */
+	uint8_t *b;		/* LZ block buffer */
+	size_t bs, bmax;	/* LZ block buffer size: used, allocated */
+	size_t need;		/* LZ decoding: block size (0: header) */
+	uint8_t lh[S_PK_U64_MAX_BYTES]; /* LZ decoding: block first bytes */
+	size_t lzf_bs, lzf_nt;	/* framed LZ: block size, threads */
+	int lzf_flags;		/* framed LZ: senc_lzf() flags */
+	struct SLZFW w;		/* framed LZ decoding: frame walker */
+};
+
+static size_t sdec_b64_part(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return sdec_b64_aux(s, ss, o, S_FALSE, S_FALSE, S_TRUE);
+}
+
+static size_t sdec_b64url_part(const uint8_t *s, const size_t ss, uint8_t *o)
+{
+	return sdec_b64_aux(s, ss, o, S_TRUE, S_FALSE, S_TRUE);
+}
+
+/*
+ * Codecs working with fixed size quanta: the input (pending bytes followed
+ * by the new ones) is processed in multiples of "q" bytes, keeping at
+ * least "hold" bytes (e.g. base64 padding, only handled at the end)
+ */
+static size_t sc_quanta(struct SCodec *c, const uint8_t *s, const size_t ss,
+			uint8_t *o, const size_t q, const size_t hold,
+			srt_enc_f f)
+{
+	uint8_t t[2 * SC_PEND_MAX];
+	const size_t pn = c->pn, total = pn + ss,
+		     l = total > hold ? ((total - hold) / q) * q : 0;
+	size_t a, j = 0, r;
+	RETURN_IF(!o, l ? f(c->p, l, NULL) : 0);
+	/* Pending bytes, completed with the first input bytes */
+	a = S_MIN((pn + q - 1) / q * q, l);
+	if (a) {
+		memcpy(t, c->p, S_MIN(pn, a));
+		if (a > pn)
+			memcpy(t + pn, s, a - pn);
+		j = f(t, a, o);
+		if (j != f(t, a, NULL))
+			c->error = S_TRUE;
+	}
+	/* Input bytes, in place */
+	if (l > a && !c->error) {
+		r = f(s + a - pn, l - a, o + j);
+		if (r != f(s, l - a, NULL))
+			c->error = S_TRUE;
+		j += r;
+	}
+	if (l >= pn) {
+		memcpy(c->p, s + l - pn, total - l);
+	} else {
+		memmove(c->p, c->p + l, pn - l);
+		memcpy(c->p + pn - l, s, ss);
+	}
+	c->pn = total - l;
+	return j;
+}
+
+/*
+ * Unescaping: pending bytes (a possibly cut escape sequence) go first,
+ * together with a few input bytes, so the escape sequence is completed
+ */
+static size_t sc_unesc(struct SCodec *c, const uint8_t *s, const size_t ss,
+		       uint8_t *o,
+		       size_t (*f)(const uint8_t *, const size_t, uint8_t *,
+				   size_t *))
+{
+	uint8_t t[2 * SC_PEND_MAX];
+	size_t n, j = 0, u = 0, pn = c->pn;
+	RETURN_IF(!o, pn + ss);
+	if (pn) {
+		n = S_MIN(ss, 8);
+		memcpy(t, c->p, pn);
+		memcpy(t + pn, s, n);
+		j = f(t, pn + n, o, &u);
+		if (u < pn) { /* still cut (too few input bytes) */
+			memmove(c->p, t + u, pn + n - u);
+			c->pn = pn + n - u;
+			return j;
+		}
+		u -= pn;
+	}
+	j += f(s + u, ss - u, o + j, &n);
+	u += n;
+	memcpy(c->p, s + u, ss - u);
+	c->pn = ss - u;
+	return j;
+}
+
+typedef size_t (*srt_sc_blk_f)(const struct SCodec *c, const uint8_t *s,
+			       const size_t ss, uint8_t *o);
+
+/* LZ block: size header, and the senc_lz() output */
+static size_t sc_lz_block(const struct SCodec *c, const uint8_t *s,
+			  const size_t ss, uint8_t *o)
+{
+	uint8_t *h = o;
+	size_t n;
+	(void)c;
+	RETURN_IF(!o, S_PK_U64_MAX_BYTES + senc_lz(s, ss, NULL));
+	n = senc_lz(s, ss, o + S_PK_U64_MAX_BYTES);
+	s_st_pk_u64(&h, n);
+	memmove(h, o + S_PK_U64_MAX_BYTES, n);
+	return (size_t)(h - o) + n;
+}
+
+static srt_bool sc_lz_buf(struct SCodec *c, const size_t size)
+{
+	uint8_t *b;
+	if (c->bmax < size) {
+		b = (uint8_t *)s_realloc(c->b, size);
+		RETURN_IF(!b, S_FALSE);
+		c->b = b;
+		c->bmax = size;
+	}
+	return S_TRUE;
+}
+
+/* Framed LZ: one frame, one block per thread */
+static size_t sc_lzf_frame(const struct SCodec *c, const uint8_t *s,
+			   const size_t ss, uint8_t *o)
+{
+	return senc_lzf(s, ss, o, c->lzf_bs, c->lzf_flags, c->lzf_nt);
+}
+
+/* Block encoding (LZ: blocks, framed LZ: frames) of "bsz" input bytes */
+static size_t sc_blk_enc(struct SCodec *c, const uint8_t *s, size_t ss,
+			 uint8_t *o, const size_t bsz, srt_sc_blk_f f)
+{
+	size_t n, j = 0;
+	RETURN_IF(!o, ((c->bs + ss) / bsz) * f(c, s, bsz, NULL));
+	while (ss > 0) {
+		if (!c->bs && ss >= bsz) { /* whole block */
+			j += f(c, s, bsz, o + j);
+			s += bsz;
+			ss -= bsz;
+			continue;
+		}
+		if (!sc_lz_buf(c, bsz)) {
+			c->error = S_TRUE;
+			break;
+		}
+		n = S_MIN(bsz - c->bs, ss);
+		memcpy(c->b + c->bs, s, n);
+		c->bs += n;
+		s += n;
+		ss -= n;
+		if (c->bs == bsz) {
+			j += f(c, c->b, c->bs, o + j);
+			c->bs = 0;
+		}
+	}
+	return j;
+}
+
+/*
+ * LZ decoding: the output size is computed walking the same state machine
+ * without copying nor decoding (the block first bytes, having the decoded
+ * size, are kept apart for that purpose)
+ */
+static size_t sc_lz_dec(struct SCodec *c, const uint8_t *s, const size_t ss,
+			uint8_t *o)
+{
+	const uint8_t *blk, *h;
+	uint8_t p[S_PK_U64_MAX_BYTES], lh[S_PK_U64_MAX_BYTES];
+	size_t i = 0, j = 0, n, hl, dsz, pn = c->pn, bs = c->bs,
+	       need = c->need;
+	memcpy(p, c->p, S_PK_U64_MAX_BYTES);
+	memcpy(lh, c->lh, S_PK_U64_MAX_BYTES);
+	while (i < ss) {
+		if (!need) { /* block header */
+			p[pn++] = s[i++];
+			if (pn < s_pk_u64_size(p))
+				continue;
+			h = p;
+			need = (size_t)s_ld_pk_u64(&h, pn);
+			pn = 0;
+			if (need < 3) { /* sdec_lz() minimum input size */
+				c->error = S_TRUE;
+				return 0;
+			}
+			continue;
+		}
+		n = S_MIN(need - bs, ss - i);
+		if (bs < S_PK_U64_MAX_BYTES)
+			memcpy(lh + bs, s + i,
+			       S_MIN(n, S_PK_U64_MAX_BYTES - bs));
+		blk = s + i;
+		if (o && n < need) { /* not having the whole block in place */
+			if (!sc_lz_buf(c, need)) {
+				c->error = S_TRUE;
+				return 0;
+			}
+			memcpy(c->b + bs, s + i, n);
+			blk = c->b;
+		}
+		bs += n;
+		i += n;
+		if (bs < need)
+			continue;
+		h = lh;
+		hl = S_MIN(need, S_PK_U64_MAX_BYTES);
+		dsz = (size_t)s_ld_pk_u64(&h, hl);
+		if (!o) {
+			j = s_size_t_add(j, dsz, S_NPOS);
+		} else if (sdec_lz(blk, need, o + j) != dsz) {
+			c->error = S_TRUE;
+			return 0;
+		} else {
+			j += dsz;
+		}
+		bs = need = 0;
+	}
+	if (!o) /* sdec_lz() may write up to 16 bytes after the end */
+		return j ? s_size_t_add(j, 16, S_NPOS) : 0;
+	memcpy(c->p, p, S_PK_U64_MAX_BYTES);
+	memcpy(c->lh, lh, S_PK_U64_MAX_BYTES);
+	c->pn = pn;
+	c->bs = bs;
+	c->need = need;
+	return j;
+}
+
+/*
+ * Framed LZ decoding: every frame is decoded once complete, in place if
+ * it is whole in the input chunk, or buffered otherwise. The output size
+ * is computed walking the frames without copying nor decoding. BEHAVIOR:
+ * a stream cut at a frame end is valid (frames are independent)
+ */
+static size_t sc_lzf_dec(struct SCodec *c, const uint8_t *s, const size_t ss,
+			 uint8_t *o)
+{
+	struct SLZFW w = c->w;
+	const uint8_t *f;
+	size_t i = 0, j = 0, n, fs;
+	while (i < ss) {
+		n = lzfw_walk(&w, s + i, ss - i);
+		if (n == S_NPOS) {
+			c->error = S_TRUE;
+			return 0;
+		}
+		f = s + i;
+		fs = n;
+		i += n;
+		if (o && (c->bs || w.st != LZFW_END)) { /* frame not in place */
+			if (c->bs + n > c->bmax
+			    && !sc_lz_buf(c, s_size_t_add(c->bs, S_MAX(c->bs, n),
+							  S_NPOS))) {
+				c->error = S_TRUE;
+				return 0;
+			}
+			memcpy(c->b + c->bs, f, n);
+			c->bs += n;
+			f = c->b;
+			fs = c->bs;
+		}
+		if (w.st != LZFW_END)
+			continue;
+		if (!o) {
+			j = s_size_t_add(j, w.us, S_NPOS);
+		} else if (sdec_lzf(f, fs, o + j, c->lzf_nt) != w.us) {
+			c->error = S_TRUE;
+			return 0;
+		} else {
+			j += w.us;
+			c->bs = 0;
+		}
+		memset(&w, 0, sizeof(w));
+	}
+	if (!o) /* sdec_lzf() may write up to 16 bytes after the end */
+		return j ? s_size_t_add(j, 16, S_NPOS) : 0;
+	c->w = w;
+	return j;
+}
+
+/* Escaping output size upper bound (not scanning the input) */
+S_INLINE size_t sc_max_out(const size_t ss, const size_t expansion)
+{
+	return ss <= S_NPOS / expansion ? ss * expansion : S_NPOS;
+}
+
+struct SCodec *scodec_alloc(const enum eSCodec type)
+{
+	struct SCodec *c;
+	RETURN_IF((unsigned)type > SC_DEC_LZF, NULL);
+	c = (struct SCodec *)s_malloc(sizeof(struct SCodec));
+	RETURN_IF(!c, NULL);
+	memset(c, 0, sizeof(struct SCodec));
+	c->type = type;
+	c->lzf_bs = SC_LZ_BLOCK_SIZE;
+	c->lzf_nt = 1;
+	return c;
+}
+
+struct SCodec *scodec_alloc_lzf(const enum eSCodec type,
+				const size_t block_size, const int flags,
+				const size_t nthreads)
+{
+	struct SCodec *c;
+	RETURN_IF(type != SC_ENC_LZF && type != SC_DEC_LZF, NULL);
+	c = scodec_alloc(type);
+	RETURN_IF(!c, NULL);
+	if (block_size)
+		c->lzf_bs = block_size;
+	/* BEHAVIOR: threads are limited so the frame input size fits */
+	c->lzf_nt = S_RANGE(nthreads, 1, S_NPOS / c->lzf_bs);
+	c->lzf_flags = flags;
+	return c;
+}
+
+size_t scodec_update(struct SCodec *c, const uint8_t *s, const size_t ss,
+		     uint8_t *o)
+{
+	RETURN_IF(!c || c->error || !s || !ss, 0);
+	switch (c->type) {
+	case SC_ENC_B64:
+		return sc_quanta(c, s, ss, o, 3, 0, senc_b64);
+	case SC_DEC_B64:
+		return sc_quanta(c, s, ss, o, 4, 2, sdec_b64_part);
+	case SC_ENC_B64URL:
+		return sc_quanta(c, s, ss, o, 3, 0, senc_b64url);
+	case SC_DEC_B64URL:
+		return sc_quanta(c, s, ss, o, 4, 2, sdec_b64url_part);
+	case SC_ENC_HEX:
+		return senc_hex(s, ss, o);
+	case SC_ENC_HEX_UPPER:
+		return senc_HEX(s, ss, o);
+	case SC_DEC_HEX:
+		return sc_quanta(c, s, ss, o, 2, 0, sdec_hex);
+	case SC_ENC_ESC_XML: /* worst case: '"' -> "&quot;" */
+		return o ? senc_esc_xml(s, ss, o, 0) : sc_max_out(ss, 6);
+	case SC_DEC_ESC_XML:
+		return sc_unesc(c, s, ss, o, sdec_esc_xml_aux);
+	case SC_ENC_ESC_JSON: /* worst case: '\n' -> "\\n" */
+		return o ? senc_esc_json(s, ss, o, 0) : sc_max_out(ss, 2);
+	case SC_DEC_ESC_JSON:
+		return sc_unesc(c, s, ss, o, sdec_esc_json_aux);
+	case SC_ENC_ESC_URL: /* worst case: ' ' -> "%20" */
+		return o ? senc_esc_url(s, ss, o, 0) : sc_max_out(ss, 3);
+	case SC_DEC_ESC_URL:
+		return sc_unesc(c, s, ss, o, sdec_esc_url_aux);
+	case SC_ENC_LZ:
+		return sc_blk_enc(c, s, ss, o, SC_LZ_BLOCK_SIZE, sc_lz_block);
+	case SC_DEC_LZ:
+		return sc_lz_dec(c, s, ss, o);
+	case SC_ENC_LZF:
+		return sc_blk_enc(c, s, ss, o, c->lzf_bs * c->lzf_nt,
+				  sc_lzf_frame);
+	case SC_DEC_LZF:
+		return sc_lzf_dec(c, s, ss, o);
+	}
+	return 0;
+}
+
+/*
+ * BEHAVIOR: the codec is reset (except for the error flag), so it can be
+ * used again for a new stream. With NULL output, only the required output
+ * size is returned.
+ */
+size_t scodec_final(struct SCodec *c, uint8_t *o)
+{
+	size_t r = 0;
+	RETURN_IF(!c, 0);
+	if (!c->error)
+		switch (c->type) {
+		case SC_ENC_B64:
+			r = senc_b64(c->p, c->pn, o);
+			break;
+		case SC_DEC_B64:
+			r = sdec_b64(c->p, c->pn, o);
+			break;
+		case SC_ENC_B64URL:
+			r = senc_b64url(c->p, c->pn, o);
+			break;
+		case SC_DEC_B64URL:
+			r = sdec_b64url(c->p, c->pn, o);
+			break;
+		case SC_DEC_ESC_XML:
+			r = sdec_esc_xml(c->p, c->pn, o);
+			break;
+		case SC_DEC_ESC_JSON:
+			r = sdec_esc_json(c->p, c->pn, o);
+			break;
+		case SC_DEC_ESC_URL:
+			r = sdec_esc_url(c->p, c->pn, o);
+			break;
+		case SC_ENC_LZ:
+			r = c->bs ? sc_lz_block(c, c->b, c->bs, o) : 0;
+			break;
+		case SC_DEC_LZ:
+			if (o && (c->pn || c->need)) /* truncated stream */
+				c->error = S_TRUE;
+			break;
+		case SC_ENC_LZF:
+			r = c->bs ? sc_lzf_frame(c, c->b, c->bs, o) : 0;
+			break;
+		case SC_DEC_LZF:
+			if (o && (c->w.st != LZFW_FHDR || c->w.hn)) /* cut */
+				c->error = S_TRUE;
+			break;
+		default:
+			/* hex (BEHAVIOR: odd trailing digit is ignored) */
+			break;
+		}
+	RETURN_IF(!o, r);
+	c->pn = c->bs = c->need = 0;
+	memset(&c->w, 0, sizeof(c->w));
+	return r;
+}
+
+srt_bool scodec_error(const struct SCodec *c)
+{
+	return !c || c->error ? S_TRUE : S_FALSE;
+}
+
+void scodec_set_error(struct SCodec *c)
+{
+	if (c)
+		c->error = S_TRUE;
+}
+
+void scodec_free(struct SCodec *c)
+{
+	if (c) {
+		if (c->b)
+			s_free(c->b);
+		s_free(c);
+	}
+}
@@ -16,37 +16,153 @@ extern "C" {
  *
  * - Aliasing safe (input and output buffer can be the same).
  * - RFC 3548/4648 base 16 (hexadecimal) and 64 encoding/decoding.
- * - Fast (~1 GB/s on i5-3330 @3GHz -using one core- and gcc 4.8.2 -O2)
+ * - RFC 4648 base64url (URL and filename safe alphabet, without padding
+ *   when encoding, and with optional padding when decoding).
+ * - Strict base64 decoding mode: fails on characters not in the alphabet,
+ *   wrong padding or size, and not canonical encoding (non-zero unused
+ *   bits), returning 0 bytes.
+ * - Hex decoding validates the input: on non-hex characters, no output
+ *   is generated (0 bytes).
+ * - Fast (~1 GB/s on i5-3330 @3GHz -using one core- and gcc 4.8.2 -O2).
+ *   Base64 encodes 6 bytes per loop and decodes (and validates) 4
+ *   characters per loop using wide lookup tables. Hex encodes 4 bytes per
+ *   loop (byte to digit pair table) and decodes 8 digits per loop (SWAR:
+ *   64-bit word arithmetic). On x86, SSSE3 or AVX2 are used when
+ *   available (run-time detection), 3-4x faster: base64 processes 12/24
+ *   bytes per loop (16/32 characters, validated as a block, the invalid
+ *   blocks going to the table code), and hex 16/32 bytes per loop (nibble
+ *   to digit pshufb table, and vector range checks for decoding).
  *
- * Features (JSON and XML escape/unescape):
+ * Features (JSON, XML, URL and quote escape/unescape):
  *
  * - Aliasing safe.
  * - JSON escape subset of RFC 4627
  * - XML escape subset of XML 1.0 W3C 26 Nov 2008 (4.6 Predefined Entities)
- * - Fast decoding (~1 GB/s on i5-3330 @3GHz -using one core-)
- * - "Fast" decoding (200-400 MB/s on "; there is room for optimization)
+ * - URL escape (RFC 3986 percent-encoding, except for unreserved bytes)
+ * - Fast: the input is scanned 8 bytes per loop (SWAR), so runs of bytes
+ *   not requiring escaping are counted and copied one word at a time (2-4x
+ *   faster than byte by byte for mostly clean input). On x86, SSE2 or
+ *   AVX2 are used for the clean runs (16/32 bytes per loop, another 3-5x),
+ *   the SWAR code handling the rest. Dense escaping (e.g. most URL
+ *   escaping) runs at about the byte by byte speed.
+ *
+ * Features (UTF-16LE encoding/decoding):
+ *
+ * - UTF-8 <-> UTF-16LE, processing ASCII one machine word per loop.
+ * - Not aliasing safe (output could be bigger than the input).
  *
  * Features (custom LZ77 implementation):
  *
  * - Encoding time complexity: O(n)
  * - Decoding time complexity: O(n)
+ * - Fast decoding: while far from the input and output ends (>= 24 bytes of
+ *   input and >= 32 bytes of output), opcodes are decoded using one 64-bit
+ *   load and a 16-entry table, and data is copied using 16-byte overlapping
+ *   copies (short distance references are expanded as patterns). Near the
+ *   ends, a loop with checks on every opcode is used. The output buffer
+ *   requires 16 bytes of extra space (sdec_lz(s, ss, NULL) includes it).
+ * - Reusable compression context (senc_lz_ctx): the hash table is allocated
+ *   and cleared once, instead of on every call (entries from previous calls
+ *   are ignored using a position offset), for compressing many small
+ *   inputs. The whole table is used for every input, so output may differ
+ *   from senc_lz() (same format).
+ * - Compression levels (senc_lz_level): 0 (senc_lz), 1 (senc_lzh), and
+ *   2 to S_LZ_LEVEL_MAX, using hash chains (match search depth, hash table
+ *   and window size increasing with the level) and lazy matching (a match
+ *   is deferred if the next position gives a better one). Same format, so
+ *   decoding is not affected (same speed). Levels >= 2 use up to ~24 MiB
+ *   of heap memory (level 9), falling back to level 1 when heap usage is
+ *   not allowed (S_LZ_ALLOW_HEAP_USAGE not defined, e.g. S_MINIMAL) or on
+ *   allocation failure.
+ * - Dictionary (senc_lz_dict/sdec_lz_dict): references can reach a
+ *   dictionary (up to 4 GiB), as if the input were its continuation, for
+ *   small records that don't compress by themselves. The output has the
+ *   dictionary ID (CRC-32 of the dictionary), so decoding with another
+ *   dictionary gives no output. The dictionary hash table is computed once
+ *   (read-only afterwards, so it can be shared by threads). Dictionaries
+ *   can be built from samples (senc_lz_dict_train), choosing the segments
+ *   containing the 8-byte strings present in more samples.
+ * - Delta (senc_delta/sdec_delta): binary diff, as dictionary LZ using the
+ *   base (old version) as dictionary, so the output is a sequence of copy
+ *   (from the base or the target) and insert instructions. The base ID
+ *   (CRC-32) is stored, so applying the delta to another base gives no
+ *   output. Decoding speed is the same as sdec_lz().
+ *
+ * Features (entropy-coded LZ: senc_lze/sdec_lze):
+ *
+ * - LZ parsing with any compression level (senc_lz_level), followed by
+ *   block-wise (1 MiB) canonical Huffman coding of literals, literal run
+ *   lengths, match lengths and distances (log2 buckets plus extra bits).
+ * - ~15-20% smaller than the LZ output with the same level (e.g. for
+ *   source code and executables).
+ *   Decoding uses one table lookup per symbol (codes of up to 11 bits),
+ *   being slower than sdec_lz (no byte-aligned opcodes).
+ * - Blocks not benefiting from the entropy coding are stored as LZ or as
+ *   is (a few bytes of overhead per block).
+ * - Framed LZ can use it for every block (S_LZF_ENTROPY flag).
+ * - No heap usage for decoding (16 KiB of stack for the decoding tables),
+ *   and one LZ block buffer for encoding.
+ *
+ * Features (framed LZ: senc_lzf/sdec_lzf):
+ *
+ * - Input split in independent blocks of configurable size (default: 1 MiB),
+ *   so blocks are compressed and decompressed in parallel, using up to
+ *   the given number of threads (requires building with S_PTHREAD, e.g.
+ *   "make PTHREAD=1"; otherwise, it runs in the calling thread). Output is
+ *   the same, regardless of the number of threads.
+ * - Per-block sizes, and optional per-block CRC-32 (S_LZF_CRC32 flag).
+ * - Not compressible blocks are stored as is (worst case overhead: a few
+ *   bytes per block).
+ * - Optional block index (S_LZF_INDEX flag: 8 bytes per block, after the
+ *   blocks), for random access (sdec_lzf_range): the blocks covering the
+ *   requested range are located in O(1) and only those are decoded (and
+ *   checked). Without index, block headers are walked (no decoding).
+ * - Concatenated frames (e.g. SC_ENC_LZF streams) are decoded as one.
+ * - Strict decoding: on any format or CRC error, no output is generated
+ *   (0 bytes).
+ * - Not aliasing safe.
+ *
+ * Features (streaming codecs: scodec_*):
+ *
+ * - Input in chunks of any size: scodec_update() for every chunk, and
+ *   scodec_final() at the end. For both, an output size upper bound is
+ *   returned when passing NULL as output buffer, without scanning the
+ *   input (worst-case expansion), except for LZ decoding (block headers
+ *   are walked, for the decoded sizes).
+ * - Bounded state: up to 16 bytes of pending input, except for LZ, using
+ *   one block of memory (SC_LZ_BLOCK_SIZE bytes for encoding, and the
+ *   compressed block size for decoding), and framed LZ, using one frame
+ *   (block size x threads input bytes for encoding, and the compressed
+ *   frame for decoding).
+ * - Same output as the one-shot functions for b64, hex, and escaping.
+ *   LZ streams are a sequence of blocks prefixed by their size, each one
+ *   compressed independently. Framed LZ streams (scodec_alloc_lzf()) are
+ *   a sequence of senc_lzf() frames, one every block size x threads input
+ *   bytes, so every frame is compressed and decompressed in parallel.
+ * - Errors (invalid hex digits, LZ format errors, or out of memory) stop
+ *   the processing, being reported by scodec_error().
  *
  * Observations:
- * - Tables take 288 bytes (could be reduced to 248 bytes -tweaking access
- * to b64d[]-, but it would require to increase the number of operations in
- * order to shift -and secure- access to that area, being code increase more
- * than those 40 bytes).
+ * - Tables take 480 bytes (base64 standard and URL alphabets: 2 x 192
+ * bytes, hex: 96 bytes), plus 12 KiB for the base64 wide lookup tables
+ * (sb64tbl.h) and 1 KiB for the hex digit pair tables (not used when
+ * building with S_MINIMAL).
  */
 
 #include "scommon.h"
 
 #define SDEBUG_LZ_STATS 0
+#define SC_LZ_BLOCK_SIZE (1024 * 1024)
 
 typedef size_t (*srt_enc_f)(const uint8_t *s, const size_t ss, uint8_t *o);
 typedef size_t (*srt_enc_f2)(const uint8_t *s, const size_t ss, uint8_t *o, const size_t known_sso);
 
 size_t senc_b64(const uint8_t *s, const size_t ss, uint8_t *o);
 size_t sdec_b64(const uint8_t *s, const size_t ss, uint8_t *o);
+size_t sdec_b64_strict(const uint8_t *s, const size_t ss, uint8_t *o);
+size_t senc_b64url(const uint8_t *s, const size_t ss, uint8_t *o);
+size_t sdec_b64url(const uint8_t *s, const size_t ss, uint8_t *o);
+size_t sdec_b64url_strict(const uint8_t *s, const size_t ss, uint8_t *o);
 size_t senc_hex(const uint8_t *s, const size_t ss, uint8_t *o);
 size_t senc_HEX(const uint8_t *s, const size_t ss, uint8_t *o);
 size_t sdec_hex(const uint8_t *s, const size_t ss, uint8_t *o);
@@ -60,10 +176,60 @@ size_t senc_esc_dquote(const uint8_t *s, const size_t ss, uint8_t *o, const size
 size_t sdec_esc_dquote(const uint8_t *s, const size_t ss, uint8_t *o);
 size_t senc_esc_squote(const uint8_t *s, const size_t ss, uint8_t *o, const size_t known_sso);
 size_t sdec_esc_squote(const uint8_t *s, const size_t ss, uint8_t *o);
+size_t senc_utf16le(const uint8_t *s, const size_t ss, uint8_t *o);
+size_t sdec_utf16le(const uint8_t *s, const size_t ss, uint8_t *o);
 size_t senc_lz(const uint8_t *s, const size_t ss, uint8_t *o);
 size_t senc_lzh(const uint8_t *s, const size_t ss, uint8_t *o);
+size_t senc_lz_level(const uint8_t *s, const size_t ss, uint8_t *o,
+		     const int level);
 size_t sdec_lz(const uint8_t *s, const size_t ss, uint8_t *o);
 
+struct SLZCtx;
+
+struct SLZCtx *senc_lz_ctx_alloc(const size_t hash_bits);
+size_t senc_lz_ctx(struct SLZCtx *c, const uint8_t *s, const size_t ss,
+		   uint8_t *o);
+void senc_lz_ctx_free(struct SLZCtx *c);
+
+struct SLZDict;
+
+struct SLZDict *senc_lz_dict_alloc(const uint8_t *d, const size_t ds);
+uint32_t senc_lz_dict_id(const struct SLZDict *c);
+void senc_lz_dict_free(struct SLZDict *c);
+size_t senc_lz_dict_train(const uint8_t *s, const size_t *sizes,
+			  const size_t n, uint8_t *o, const size_t max_size);
+size_t senc_lz_dict(const struct SLZDict *c, const uint8_t *s,
+		    const size_t ss, uint8_t *o);
+size_t sdec_lz_dict(const struct SLZDict *c, const uint8_t *s,
+		    const size_t ss, uint8_t *o);
+size_t senc_delta(const uint8_t *b, const size_t bs, const uint8_t *s,
+		  const size_t ss, uint8_t *o);
+size_t sdec_delta(const uint8_t *b, const size_t bs, const uint8_t *s,
+		  const size_t ss, uint8_t *o);
+
+size_t senc_lzf(const uint8_t *s, const size_t ss, uint8_t *o,
+		const size_t block_size, const int flags, const size_t nthreads);
+size_t sdec_lzf(const uint8_t *s, const size_t ss, uint8_t *o,
+		const size_t nthreads);
+size_t sdec_lzf_range(const uint8_t *s, const size_t ss, uint8_t *o,
+		      const size_t off, const size_t len);
+size_t senc_lze(const uint8_t *s, const size_t ss, uint8_t *o,
+		const int level);
+size_t sdec_lze(const uint8_t *s, const size_t ss, uint8_t *o);
+
+struct SCodec;
+
+struct SCodec *scodec_alloc(const enum eSCodec type);
+struct SCodec *scodec_alloc_lzf(const enum eSCodec type,
+				const size_t block_size, const int flags,
+				const size_t nthreads);
+size_t scodec_update(struct SCodec *c, const uint8_t *s, const size_t ss,
+		     uint8_t *o);
+size_t scodec_final(struct SCodec *c, uint8_t *o);
+srt_bool scodec_error(const struct SCodec *c);
+void scodec_set_error(struct SCodec *c);
+void scodec_free(struct SCodec *c);
+
 #define senc_b16 senc_HEX
 #define sdec_b16 sdec_hex
 
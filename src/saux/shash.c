@@ -14,6 +14,14 @@
  */
 
 #define S_CRC32_POLY 0xedb88320
+#define S_CRC32C_POLY 0x82f63b78 /* Castagnoli */
+
+/*
+ * CRC-32C lane sizes for the SSE4.2 implementation (three lanes computed
+ * at once, combined using the "zeros" tables, see scrc32.h)
+ */
+#define SH_CRC32C_LONG 8192
+#define SH_CRC32C_SHORT 256
 
 /*
  * CRC-32 implementations
@@ -26,10 +34,9 @@
 /*
  * Compact implementation, without hash tables (one bit per loop)
  */
-uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size)
+static uint32_t sh_crc32_bits(uint32_t crc, const uint8_t *p, size_t buf_size,
+			      const uint32_t poly)
 {
-	RETURN_IF(!buf, S_CRC32_INIT);
-	const uint8_t *p = (const uint8_t *)buf;
 	size_t i, j;
 	crc = ~crc;
 	for (i = 0; i < buf_size; i++) {
@@ -38,14 +45,37 @@ uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size)
 			int b0 = crc & 1;
 			crc >>= 1;
 			if (b0)
-				crc ^= S_CRC32_POLY;
+				crc ^= poly;
 		}
 	}
 	return ~crc;
 }
 
+uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size)
+{
+	RETURN_IF(!buf, S_CRC32_INIT);
+	return sh_crc32_bits(crc, (const uint8_t *)buf, buf_size,
+			     S_CRC32_POLY);
+}
+
+uint32_t sh_crc32c(uint32_t crc, const void *buf, size_t buf_size)
+{
+	RETURN_IF(!buf, S_CRC32C_INIT);
+	return sh_crc32_bits(crc, (const uint8_t *)buf, buf_size,
+			     S_CRC32C_POLY);
+}
+
 #else
 
+/*
+ * x86 CPU extensions (see S_X86_CPU_EXT in scommon.h)
+ */
+#ifdef S_X86_CPU_EXT
+#define SH_X86_CPU_EXT
+#define SCRC32C_ZEROS
+#include <immintrin.h>
+#endif
+
 #include "scrc32.h"
 
 #define S_U32_BYTE0(a) ((a)&0xff)
@@ -70,18 +100,15 @@ uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size)
 
 /*
  * 1, 4, 8, 12, and 16 bytes per loop using 1024 to 16384 bytes table
+ * (CRC register in and out, i.e. without the initial/final inversion)
  */
-uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size)
+S_INLINE uint32_t sh_crc32_slc(const uint32_t (*t)[256], uint32_t crc,
+			       const uint8_t *p, size_t buf_size)
 {
 #if S_CRC32_SLC >= 4
 	size_t bsX;
 #endif
-	size_t i;
-	const uint8_t *p;
-	RETURN_IF(!buf, S_CRC32_INIT);
-	i = 0;
-	p = (const uint8_t *)buf;
-	crc = ~crc;
+	size_t i = 0;
 #if (S_CRC32_SLC == 4 || S_CRC32_SLC == 8 || S_CRC32_SLC == 12                 \
      || S_CRC32_SLC == 16)
 	bsX = (buf_size / S_CRC32_SLC) * S_CRC32_SLC;
@@ -100,49 +127,353 @@ uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size)
 			 d = S_LD_LE_U32(p + i + 12)
 #endif
 			;
-		crc = crc32_tab[0][S_U32_BYTE3(SC32A)]
-		      ^ crc32_tab[1][S_U32_BYTE2(SC32A)]
-		      ^ crc32_tab[2][S_U32_BYTE1(SC32A)]
-		      ^ crc32_tab[3][S_U32_BYTE0(SC32A)]
+		crc = t[0][S_U32_BYTE3(SC32A)] ^ t[1][S_U32_BYTE2(SC32A)]
+		      ^ t[2][S_U32_BYTE1(SC32A)] ^ t[3][S_U32_BYTE0(SC32A)]
 #if S_CRC32_SLC >= 8
-		      ^ crc32_tab[4][S_U32_BYTE3(SC32B)]
-		      ^ crc32_tab[5][S_U32_BYTE2(SC32B)]
-		      ^ crc32_tab[6][S_U32_BYTE1(SC32B)]
-		      ^ crc32_tab[7][S_U32_BYTE0(SC32B)]
+		      ^ t[4][S_U32_BYTE3(SC32B)] ^ t[5][S_U32_BYTE2(SC32B)]
+		      ^ t[6][S_U32_BYTE1(SC32B)] ^ t[7][S_U32_BYTE0(SC32B)]
 #endif
 #if S_CRC32_SLC >= 12
-		      ^ crc32_tab[8][S_U32_BYTE3(SC32C)]
-		      ^ crc32_tab[9][S_U32_BYTE2(SC32C)]
-		      ^ crc32_tab[10][S_U32_BYTE1(SC32C)]
-		      ^ crc32_tab[11][S_U32_BYTE0(SC32C)]
+		      ^ t[8][S_U32_BYTE3(SC32C)] ^ t[9][S_U32_BYTE2(SC32C)]
+		      ^ t[10][S_U32_BYTE1(SC32C)] ^ t[11][S_U32_BYTE0(SC32C)]
 #endif
 #if S_CRC32_SLC == 16
-		      ^ crc32_tab[12][S_U32_BYTE3(SC32D)]
-		      ^ crc32_tab[13][S_U32_BYTE2(SC32D)]
-		      ^ crc32_tab[14][S_U32_BYTE1(SC32D)]
-		      ^ crc32_tab[15][S_U32_BYTE0(SC32D)]
+		      ^ t[12][S_U32_BYTE3(SC32D)] ^ t[13][S_U32_BYTE2(SC32D)]
+		      ^ t[14][S_U32_BYTE1(SC32D)] ^ t[15][S_U32_BYTE0(SC32D)]
 #endif
 			;
 	}
 #endif
 	for (; i < buf_size; i++)
-		crc = crc32_tab[0][(crc ^ p[i]) & 0xff] ^ (crc >> 8);
-	return ~crc;
+		crc = t[0][(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+	return crc;
+}
+
+#ifdef SH_X86_CPU_EXT
+
+#define SH_CLMUL_MIN 64
+
+#define SH_M128_U64X2(lo_hi, lo_lo, hi_hi, hi_lo)                             \
+	_mm_set_epi32((int)(hi_hi), (int)(hi_lo), (int)(lo_hi), (int)(lo_lo))
+
+/*
+ * CRC-32 using carry-less multiplication (PCLMULQDQ): four 128-bit
+ * accumulators are folded 64 bytes per loop, then folded into one, and
+ * reduced to 32 bits (Barrett reduction). Constants are powers of x modulo
+ * the polynomial (bit-reflected), from Intel's "Fast CRC Computation for
+ * Generic Polynomials Using PCLMULQDQ Instruction" paper. CRC register in
+ * and out; "n" must be a multiple of 16, and at least 64
+ */
+S_TARGET("sse2,pclmul")
+static uint32_t sh_crc32_clmul(uint32_t crc, const uint8_t *p, size_t n)
+{
+	__m128i k, x1, x2, x3, x4, y1, y2, y3, y4;
+	const __m128i m32 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_loadu_si128((const __m128i *)p);
+	x2 = _mm_loadu_si128((const __m128i *)(p + 16));
+	x3 = _mm_loadu_si128((const __m128i *)(p + 32));
+	x4 = _mm_loadu_si128((const __m128i *)(p + 48));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+	k = SH_M128_U64X2(0x01, 0x54442bd4, 0x01, 0xc6e41596);
+	for (p += 64, n -= 64; n >= 64; p += 64, n -= 64) {
+		y1 = _mm_clmulepi64_si128(x1, k, 0x00);
+		y2 = _mm_clmulepi64_si128(x2, k, 0x00);
+		y3 = _mm_clmulepi64_si128(x3, k, 0x00);
+		y4 = _mm_clmulepi64_si128(x4, k, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, k, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, y1),
+				   _mm_loadu_si128((const __m128i *)p));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, y2),
+				   _mm_loadu_si128((const __m128i *)(p + 16)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, y3),
+				   _mm_loadu_si128((const __m128i *)(p + 32)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, y4),
+				   _mm_loadu_si128((const __m128i *)(p + 48)));
+	}
+	/* Fold 512 into 128 bits, and then 16 bytes per loop */
+	k = SH_M128_U64X2(0x01, 0x751997d0, 0x00, 0xccaa009e);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x11),
+					 _mm_clmulepi64_si128(x1, k, 0x00)),
+			   x2);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x11),
+					 _mm_clmulepi64_si128(x1, k, 0x00)),
+			   x3);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x11),
+					 _mm_clmulepi64_si128(x1, k, 0x00)),
+			   x4);
+	for (; n >= 16; p += 16, n -= 16)
+		x1 = _mm_xor_si128(
+			_mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x11),
+				      _mm_clmulepi64_si128(x1, k, 0x00)),
+			_mm_loadu_si128((const __m128i *)p));
+	/* Fold 128 into 64 bits */
+	x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	k = SH_M128_U64X2(0x01, 0x63cd6124, 0x00, 0x00);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, m32);
+	x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x00), x2);
+	/* Barrett reduction to 32 bits */
+	k = SH_M128_U64X2(0x01, 0xdb710641, 0x01, 0xf7011641);
+	x2 = _mm_and_si128(x1, m32);
+	x2 = _mm_clmulepi64_si128(x2, k, 0x10);
+	x2 = _mm_and_si128(x2, m32);
+	x2 = _mm_clmulepi64_si128(x2, k, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	return (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+
+/*
+ * CRC register after "n" zero bytes (n: lane size of the table)
+ */
+S_INLINE uint32_t sh_crc32c_shift(const uint32_t (*z)[256], const uint32_t c)
+{
+	return z[0][c & 0xff] ^ z[1][(c >> 8) & 0xff] ^ z[2][(c >> 16) & 0xff]
+	       ^ z[3][c >> 24];
+}
+
+#ifdef __x86_64__
+#define SH_CRC32C_W 8
+#define SH_CRC32C_HW(c, p) ((uint32_t)_mm_crc32_u64(c, S_LD_U64(p)))
+#else
+#define SH_CRC32C_W 4
+#define SH_CRC32C_HW(c, p) _mm_crc32_u32(c, S_LD_U32(p))
+#endif
+
+/*
+ * CRC-32C using the SSE4.2 crc32 instruction: three independent lanes per
+ * loop (instruction latency: 3 cycles, throughput: 1 per cycle), so it
+ * runs at the instruction throughput, and the lane CRCs are combined by
+ * shifting the previous ones (zeros tables). CRC register in and out
+ */
+S_TARGET("sse4.2")
+static uint32_t sh_crc32c_sse42(uint32_t crc, const uint8_t *p, size_t n)
+{
+	size_t i, lane;
+	uint32_t c1, c2;
+	const uint32_t(*z)[256];
+	for (lane = SH_CRC32C_LONG; lane >= SH_CRC32C_SHORT;
+	     lane = lane == SH_CRC32C_LONG ? SH_CRC32C_SHORT : 0) {
+		z = lane == SH_CRC32C_LONG ? crc32c_long : crc32c_short;
+		for (; n >= 3 * lane; p += 3 * lane, n -= 3 * lane) {
+			c1 = c2 = 0;
+			for (i = 0; i < lane; i += SH_CRC32C_W) {
+				crc = SH_CRC32C_HW(crc, p + i);
+				c1 = SH_CRC32C_HW(c1, p + lane + i);
+				c2 = SH_CRC32C_HW(c2, p + 2 * lane + i);
+			}
+			crc = sh_crc32c_shift(z, crc) ^ c1;
+			crc = sh_crc32c_shift(z, crc) ^ c2;
+		}
+	}
+	for (; n >= SH_CRC32C_W; p += SH_CRC32C_W, n -= SH_CRC32C_W)
+		crc = SH_CRC32C_HW(crc, p);
+	for (; n > 0; p++, n--)
+		crc = _mm_crc32_u8(crc, *p);
+	return crc;
+}
+
+#endif /* #ifdef SH_X86_CPU_EXT */
+
+uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size)
+{
+	const uint8_t *p;
+#ifdef SH_X86_CPU_EXT
+	size_t n;
+#endif
+	RETURN_IF(!buf, S_CRC32_INIT);
+	p = (const uint8_t *)buf;
+	crc = ~crc;
+#ifdef SH_X86_CPU_EXT
+	if (buf_size >= SH_CLMUL_MIN && (s_cpu() & S_CPU_PCLMUL)) {
+		n = buf_size & ~(size_t)15;
+		crc = sh_crc32_clmul(crc, p, n);
+		p += n;
+		buf_size -= n;
+	}
+#endif
+	return ~sh_crc32_slc(crc32_tab, crc, p, buf_size);
+}
+
+uint32_t sh_crc32c(uint32_t crc, const void *buf, size_t buf_size)
+{
+	RETURN_IF(!buf, S_CRC32C_INIT);
+#ifdef SH_X86_CPU_EXT
+	if (s_cpu() & S_CPU_SSE42)
+		return ~sh_crc32c_sse42(~crc, (const uint8_t *)buf, buf_size);
+#endif
+	return ~sh_crc32_slc(crc32c_tab, ~crc, (const uint8_t *)buf, buf_size);
 }
 
 #endif /* #ifdef S_MINIMAL */
 
+/*
+ * CRC combination: CRC(A + B) = CRC(A) * x^(8 * len(B)) + CRC(B), modulo
+ * the polynomial (as in zlib's crc32_combine()). Polynomials are
+ * bit-reflected (x^0 is the most significant bit), and x^(8 * n) is
+ * computed by squaring (O(log n))
+ */
+static uint32_t sh_crc_mulmod(uint32_t a, uint32_t b, const uint32_t poly)
+{
+	uint32_t p = 0;
+	for (; a; a <<= 1) {
+		if (a & 0x80000000)
+			p ^= b;
+		b = (b >> 1) ^ (b & 1 ? poly : 0);
+	}
+	return p;
+}
+
+static uint32_t sh_crc_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b,
+			       const uint32_t poly)
+{
+	uint32_t x = (uint32_t)1 << (31 - 8), /* x^8 */
+		xn = (uint32_t)1 << 31;	      /* x^0 */
+	for (; len_b; len_b >>= 1) {
+		if (len_b & 1)
+			xn = sh_crc_mulmod(x, xn, poly);
+		x = sh_crc_mulmod(x, x, poly);
+	}
+	return sh_crc_mulmod(xn, crc_a, poly) ^ crc_b;
+}
+
+uint32_t sh_crc32_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b)
+{
+	return sh_crc_combine(crc_a, crc_b, len_b, S_CRC32_POLY);
+}
+
+uint32_t sh_crc32c_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b)
+{
+	return sh_crc_combine(crc_a, crc_b, len_b, S_CRC32C_POLY);
+}
+
 #define ADLER32_BASE 65521 /* Largest prime below 2^16 */
 #define ADLER32_NMAX 5552
 
+#ifdef SH_X86_CPU_EXT
+
+/*
+ * Adler32 using SIMD: for every block of 32 (SSSE3) or 64 (AVX2) bytes,
+ * s1 gets the sum of the bytes (PSADBW), and s2 the sum of the bytes
+ * weighted by its distance to the block end (PMADDUBSW + PMADDWD), plus
+ * the block size multiplied by s1 at the start of the block (accumulated
+ * in "ps"). Both are reduced modulo ADLER32_BASE every ADLER32_NMAX bytes,
+ * as in the scalar version. "n" must be a multiple of the block size
+ */
+S_TARGET("ssse3")
+static uint32_t sh_adler32_ssse3(uint32_t adler, const uint8_t *p, size_t n)
+{
+	size_t blocks = n / 32, k;
+	uint32_t s1 = adler & 0xffff, s2 = (adler >> 16) & 0xffff;
+	__m128i ps, v1, v2, x1, x2;
+	const __m128i z = _mm_setzero_si128(), ones = _mm_set1_epi16(1),
+		      t1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24,
+					 23, 22, 21, 20, 19, 18, 17),
+		      t2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+					 6, 5, 4, 3, 2, 1);
+	for (; blocks > 0; blocks -= k) {
+		k = S_MIN(blocks, ADLER32_NMAX / 32);
+		ps = _mm_cvtsi32_si128((int)(s1 * k));
+		v1 = z;
+		v2 = _mm_cvtsi32_si128((int)s2);
+		for (n = k; n > 0; n--, p += 32) {
+			x1 = _mm_loadu_si128((const __m128i *)p);
+			x2 = _mm_loadu_si128((const __m128i *)(p + 16));
+			ps = _mm_add_epi32(ps, v1);
+			v1 = _mm_add_epi32(v1, _mm_sad_epu8(x1, z));
+			v1 = _mm_add_epi32(v1, _mm_sad_epu8(x2, z));
+			x1 = _mm_madd_epi16(_mm_maddubs_epi16(x1, t1), ones);
+			x2 = _mm_madd_epi16(_mm_maddubs_epi16(x2, t2), ones);
+			v2 = _mm_add_epi32(v2, _mm_add_epi32(x1, x2));
+		}
+		v2 = _mm_add_epi32(v2, _mm_slli_epi32(ps, 5));
+		v1 = _mm_add_epi32(v1, _mm_shuffle_epi32(v1, 0x4e));
+		v2 = _mm_add_epi32(v2, _mm_shuffle_epi32(v2, 0x4e));
+		v2 = _mm_add_epi32(v2, _mm_shuffle_epi32(v2, 0xb1));
+		s1 = (s1 + (uint32_t)_mm_cvtsi128_si32(v1)) % ADLER32_BASE;
+		s2 = (uint32_t)_mm_cvtsi128_si32(v2) % ADLER32_BASE;
+	}
+	return (s2 << 16) | s1;
+}
+
+S_TARGET("avx2")
+static uint32_t sh_adler32_avx2(uint32_t adler, const uint8_t *p, size_t n)
+{
+	size_t blocks = n / 64, k;
+	uint32_t s1 = adler & 0xffff, s2 = (adler >> 16) & 0xffff;
+	__m128i w1, w2;
+	__m256i ps, v1, v2, x1, x2;
+	const __m256i z = _mm256_setzero_si256(),
+		      ones = _mm256_set1_epi16(1),
+		      t1 = _mm256_setr_epi8(64, 63, 62, 61, 60, 59, 58, 57, 56,
+					    55, 54, 53, 52, 51, 50, 49, 48, 47,
+					    46, 45, 44, 43, 42, 41, 40, 39, 38,
+					    37, 36, 35, 34, 33),
+		      t2 = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24,
+					    23, 22, 21, 20, 19, 18, 17, 16, 15,
+					    14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+					    4, 3, 2, 1);
+	for (; blocks > 0; blocks -= k) {
+		k = S_MIN(blocks, ADLER32_NMAX / 64);
+		ps = _mm256_setr_epi32((int)(s1 * k), 0, 0, 0, 0, 0, 0, 0);
+		v1 = z;
+		v2 = _mm256_setr_epi32((int)s2, 0, 0, 0, 0, 0, 0, 0);
+		for (n = k; n > 0; n--, p += 64) {
+			x1 = _mm256_loadu_si256((const __m256i *)p);
+			x2 = _mm256_loadu_si256((const __m256i *)(p + 32));
+			ps = _mm256_add_epi32(ps, v1);
+			v1 = _mm256_add_epi32(v1, _mm256_sad_epu8(x1, z));
+			v1 = _mm256_add_epi32(v1, _mm256_sad_epu8(x2, z));
+			x1 = _mm256_madd_epi16(_mm256_maddubs_epi16(x1, t1),
+					       ones);
+			x2 = _mm256_madd_epi16(_mm256_maddubs_epi16(x2, t2),
+					       ones);
+			v2 = _mm256_add_epi32(v2, _mm256_add_epi32(x1, x2));
+		}
+		v2 = _mm256_add_epi32(v2, _mm256_slli_epi32(ps, 6));
+		w1 = _mm_add_epi32(_mm256_castsi256_si128(v1),
+				   _mm256_extracti128_si256(v1, 1));
+		w2 = _mm_add_epi32(_mm256_castsi256_si128(v2),
+				   _mm256_extracti128_si256(v2, 1));
+		w1 = _mm_add_epi32(w1, _mm_shuffle_epi32(w1, 0x4e));
+		w2 = _mm_add_epi32(w2, _mm_shuffle_epi32(w2, 0x4e));
+		w2 = _mm_add_epi32(w2, _mm_shuffle_epi32(w2, 0xb1));
+		s1 = (s1 + (uint32_t)_mm_cvtsi128_si32(w1)) % ADLER32_BASE;
+		s2 = (uint32_t)_mm_cvtsi128_si32(w2) % ADLER32_BASE;
+	}
+	return (s2 << 16) | s1;
+}
+
+#endif /* #ifdef SH_X86_CPU_EXT */
+
 uint32_t sh_adler32(uint32_t adler, const void *buf0, size_t buf_size)
 {
 	uint32_t s1, s2;
 	size_t remaining, k;
 	const unsigned char *buf;
+#ifdef SH_X86_CPU_EXT
+	unsigned f;
+#endif
 	RETURN_IF(!buf0, S_ADLER32_INIT);
 	remaining = buf_size;
 	buf = (const unsigned char *)buf0;
+#ifdef SH_X86_CPU_EXT
+	if (remaining >= 64) {
+		f = s_cpu();
+		k = remaining & ~(size_t)(f & S_CPU_AVX2 ? 63 : 31);
+		if (f & S_CPU_AVX2)
+			adler = sh_adler32_avx2(adler, buf, k);
+		else if (f & S_CPU_SSSE3)
+			adler = sh_adler32_ssse3(adler, buf, k);
+		else
+			k = 0;
+		buf += k;
+		remaining -= k;
+	}
+#endif
 	s1 = (adler & 0xffff);
 	s2 = (adler >> 16) & 0xffff;
 	for (; remaining > 0; s1 %= ADLER32_BASE, s2 %= ADLER32_BASE) {
@@ -188,54 +519,578 @@ uint32_t sh_adler32(uint32_t adler, const void *buf0, size_t buf_size)
 	return (s2 << 16) | s1;
 }
 
+/*
+ * Adler32 combination (as in zlib's adler32_combine()): the sum of bytes
+ * of A is added to every running sum of B (len(B) times)
+ */
+uint32_t sh_adler32_combine(uint32_t adler_a, uint32_t adler_b,
+			    uint64_t len_b)
+{
+	uint32_t rem = (uint32_t)(len_b % ADLER32_BASE),
+		 s1 = adler_a & 0xffff, s2 = rem * s1 % ADLER32_BASE;
+	s1 += (adler_b & 0xffff) + ADLER32_BASE - 1;
+	s2 += ((adler_a >> 16) & 0xffff) + ((adler_b >> 16) & 0xffff)
+	      + ADLER32_BASE - rem;
+	if (s1 >= ADLER32_BASE)
+		s1 -= ADLER32_BASE;
+	if (s1 >= ADLER32_BASE)
+		s1 -= ADLER32_BASE;
+	if (s2 >= (ADLER32_BASE << 1))
+		s2 -= (ADLER32_BASE << 1);
+	if (s2 >= ADLER32_BASE)
+		s2 -= ADLER32_BASE;
+	return s1 | (s2 << 16);
+}
+
+/*
+ * Parallel checksum: the buffer is split in up to "nthreads" chunks (of at
+ * least SH_PAR_MIN bytes), computed in parallel (s_parallel()), and the
+ * partial results are combined in order. The first chunk uses the given
+ * accumulator, and the others the initial value
+ */
+
+#define SH_PAR_MIN (1024 * 1024)
+#define SH_PAR_MAX 64
+
+typedef uint32_t (*sh_sum32_f)(uint32_t, const void *, size_t);
+typedef uint32_t (*sh_comb32_f)(uint32_t, uint32_t, uint64_t);
+
+struct SHPar {
+	sh_sum32_f f;
+	uint32_t acc, init;
+	const uint8_t *p;
+	size_t ss, chunk;
+	uint32_t r[SH_PAR_MAX];
+};
+
+static srt_bool sh_par_job(void *c0, size_t i)
+{
+	struct SHPar *c = (struct SHPar *)c0;
+	size_t off = i * c->chunk;
+	c->r[i] = c->f(i ? c->init : c->acc, c->p + off,
+		       S_MIN(c->chunk, c->ss - off));
+	return S_TRUE;
+}
+
+static uint32_t sh_par(sh_sum32_f f, sh_comb32_f comb, const uint32_t init,
+		       uint32_t acc, const void *buf, size_t buf_size,
+		       size_t nthreads)
+{
+	size_t i, nt;
+	struct SHPar c;
+	RETURN_IF(!buf, init);
+	nt = S_MIN(S_MIN(nthreads, buf_size / SH_PAR_MIN), SH_PAR_MAX);
+	RETURN_IF(nt <= 1, f(acc, buf, buf_size));
+	c.f = f;
+	c.acc = acc;
+	c.init = init;
+	c.p = (const uint8_t *)buf;
+	c.ss = buf_size;
+	c.chunk = (buf_size + nt - 1) / nt;
+	nt = (buf_size + c.chunk - 1) / c.chunk;
+	s_parallel(nt, sh_par_job, &c);
+	for (acc = c.r[0], i = 1; i < nt; i++)
+		acc = comb(acc, c.r[i], S_MIN(c.chunk, buf_size - i * c.chunk));
+	return acc;
+}
+
+uint32_t sh_crc32_parallel(uint32_t crc, const void *buf, size_t buf_size,
+			   size_t nthreads)
+{
+	return sh_par(sh_crc32, sh_crc32_combine, S_CRC32_INIT, crc, buf,
+		      buf_size, nthreads);
+}
+
+uint32_t sh_crc32c_parallel(uint32_t crc, const void *buf,
+			    size_t buf_size, size_t nthreads)
+{
+	return sh_par(sh_crc32c, sh_crc32c_combine, S_CRC32C_INIT, crc, buf,
+		      buf_size, nthreads);
+}
+
+uint32_t sh_adler32_parallel(uint32_t adler, const void *buf,
+			     size_t buf_size, size_t nthreads)
+{
+	return sh_par(sh_adler32, sh_adler32_combine, S_ADLER32_INIT, adler,
+		      buf, buf_size, nthreads);
+}
+
+#define FNV1A64_PRIME (((uint64_t)1 << 40) | 0x1b3)
+
+uint64_t sh_fnv1a64(uint64_t h, const void *buf0, size_t buf_size)
+{
+	size_t i;
+	const unsigned char *buf;
+	RETURN_IF(!buf0, S_FNV1A64_INIT);
+	buf = (const unsigned char *)buf0;
+	for (i = 0; i < buf_size; i++)
+		h = (h ^ buf[i]) * FNV1A64_PRIME;
+	return h;
+}
+
+/*
+ * 64-bit hash: wyhash algorithm (final version 4, by Wang Yi, public
+ * domain). Input is processed 48 bytes per loop, in three independent
+ * lanes, mixed with 64x64 -> 128-bit multiplications (XOR of both halves)
+ */
+
+#define SH_U64(hi, lo) (((uint64_t)(hi) << 32) | (lo))
+#define SH_WYP0 SH_U64(0x2d358dcc, 0xaa6c78a5)
+#define SH_WYP1 SH_U64(0x8bb84b93, 0x962eacc9)
+#define SH_WYP2 SH_U64(0x4b33a62e, 0xd433d4a3)
+#define SH_WYP3 SH_U64(0x4d5a2da5, 0x1de1aa47)
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 sh_u128;
+
+S_INLINE void sh_mum(uint64_t *a, uint64_t *b)
+{
+	sh_u128 r = (sh_u128)*a * *b;
+	*a = (uint64_t)r;
+	*b = (uint64_t)(r >> 64);
+}
+#else
+S_INLINE void sh_mum(uint64_t *a, uint64_t *b)
+{
+	uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a,
+		 lb = (uint32_t)*b, rh = ha * hb, rm0 = ha * lb, rm1 = hb * la,
+		 rl = la * lb, t = rl + (rm0 << 32), c = t < rl, lo;
+	lo = t + (rm1 << 32);
+	c += lo < t;
+	*a = lo;
+	*b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+}
+#endif
+
+S_INLINE uint64_t sh_mix(uint64_t a, uint64_t b)
+{
+	sh_mum(&a, &b);
+	return a ^ b;
+}
+
+S_INLINE uint64_t sh_hash64_aux(uint64_t seed, const void *buf,
+				 size_t buf_size, const uint64_t *k)
+{
+	size_t i = buf_size;
+	uint64_t a, b, s1, s2;
+	const uint8_t *p = (const uint8_t *)buf;
+	RETURN_IF(!buf, 0);
+	seed ^= sh_mix(seed ^ k[0], k[1]);
+	if (i <= 16) {
+		if (i >= 4) {
+			a = ((uint64_t)S_LD_LE_U32(p) << 32)
+			    | S_LD_LE_U32(p + ((i >> 3) << 2));
+			b = ((uint64_t)S_LD_LE_U32(p + i - 4) << 32)
+			    | S_LD_LE_U32(p + i - 4 - ((i >> 3) << 2));
+		} else if (i > 0) {
+			a = ((uint64_t)p[0] << 16) | ((uint64_t)p[i >> 1] << 8)
+			    | p[i - 1];
+			b = 0;
+		} else {
+			a = b = 0;
+		}
+	} else {
+		if (i > 48) {
+			s1 = s2 = seed;
+			do {
+				seed = sh_mix(S_LD_LE_U64(p) ^ k[1],
+					      S_LD_LE_U64(p + 8) ^ seed);
+				s1 = sh_mix(S_LD_LE_U64(p + 16) ^ k[2],
+					    S_LD_LE_U64(p + 24) ^ s1);
+				s2 = sh_mix(S_LD_LE_U64(p + 32) ^ k[3],
+					    S_LD_LE_U64(p + 40) ^ s2);
+				p += 48;
+				i -= 48;
+			} while (i > 48);
+			seed ^= s1 ^ s2;
+		}
+		for (; i > 16; i -= 16, p += 16)
+			seed = sh_mix(S_LD_LE_U64(p) ^ k[1],
+				      S_LD_LE_U64(p + 8) ^ seed);
+		a = S_LD_LE_U64(p + i - 16);
+		b = S_LD_LE_U64(p + i - 8);
+	}
+	a ^= k[1];
+	b ^= seed;
+	sh_mum(&a, &b);
+	return sh_mix(a ^ k[0] ^ (uint64_t)buf_size, b ^ k[1]);
+}
+
+uint64_t sh_hash64(uint64_t seed, const void *buf, size_t buf_size)
+{
+	static const uint64_t k[4] = {SH_WYP0, SH_WYP1, SH_WYP2, SH_WYP3};
+	return sh_hash64_aux(seed, buf, buf_size, k);
+}
+
+/*
+ * Keyed variant: the secrets are derived from the key, so an attacker not
+ * knowing it can not cancel the multiplications (e.g. with input words
+ * equal to a public secret, which would discard the seed)
+ */
+uint64_t sh_hash64_keyed(uint64_t key, const void *buf, size_t buf_size)
+{
+	uint64_t k[4];
+	k[0] = s_hash_u64(key ^ SH_WYP0) | 1;
+	k[1] = s_hash_u64(key ^ SH_WYP1) | 1;
+	k[2] = s_hash_u64(key ^ SH_WYP2) | 1;
+	k[3] = s_hash_u64(key ^ SH_WYP3) | 1;
+	return sh_hash64_aux(key, buf, buf_size, k);
+}
+
+/*
+ * Rolling hashes. The Gear table entries are the SplitMix64 finalizer of
+ * 1 to 256 (see s_hash_u64()); the Buzhash table uses their 32 high bits
+ */
+
+static const uint64_t sh_gear_tab[256] = {
+	SH_U64(0x5692161d, 0x100b05e5), SH_U64(0xdbd23897, 0x3a2b148a),
+	SH_U64(0x1e535eed, 0xe31428f0), SH_U64(0xb7a4712c, 0x74562914),
+	SH_U64(0xb6bf613d, 0xbebb45dc), SH_U64(0xd1770797, 0x7078336c),
+	SH_U64(0x12ae3023, 0x7b17df14), SH_U64(0xd56b1fbb, 0x9ceba9e8),
+	SH_U64(0x826c6abf, 0x7fdd5ad7), SH_U64(0x075c8519, 0xa9320579),
+	SH_U64(0x3462d848, 0xf53abb6d), SH_U64(0x37be58e8, 0xd7213bbc),
+	SH_U64(0xdcfa9555, 0xb5f881d1), SH_U64(0x255c6046, 0xf62fbe29),
+	SH_U64(0x03927549, 0x34ea1539), SH_U64(0xd9844bce, 0xcca4a8bd),
+	SH_U64(0x302b8631, 0x721c51be), SH_U64(0xffcb5c99, 0xf6aa8871),
+	SH_U64(0xe34a1ed0, 0x9841f857), SH_U64(0x0eb90a33, 0x52640af2),
+	SH_U64(0xd633b184, 0x6faf2b49), SH_U64(0xfd95fa4d, 0xb404dd7b),
+	SH_U64(0x378a5760, 0xbe593ca5), SH_U64(0xd59eef30, 0xdb86cab8),
+	SH_U64(0xd7a982c1, 0x06d3fe38), SH_U64(0xe8a33702, 0xfa0a06db),
+	SH_U64(0x32469675, 0x332a0efc), SH_U64(0xdf890a49, 0x33721ba2),
+	SH_U64(0x4f7abb76, 0x27b74f52), SH_U64(0x0724ea92, 0x69d42a72),
+	SH_U64(0x540f172e, 0x046ef165), SH_U64(0xadfb1ebb, 0x497fad45),
+	SH_U64(0xb4941eef, 0x820868c7), SH_U64(0xc67949c3, 0xa864283c),
+	SH_U64(0x43e7cefc, 0x06c022be), SH_U64(0xff96b931, 0xed5510e2),
+	SH_U64(0x499ef488, 0xef760e18), SH_U64(0x5b64875d, 0x6615936e),
+	SH_U64(0x271c93c1, 0x47c4cd83), SH_U64(0xb74fd707, 0xf0b39325),
+	SH_U64(0x66d1ecf1, 0xbbb89d25), SH_U64(0xa759ea27, 0xd4727622),
+	SH_U64(0x4f0a61d9, 0xc798d8ca), SH_U64(0xfb2bf499, 0x6809baf7),
+	SH_U64(0xbdbfb556, 0x329aee83), SH_U64(0x6f14aec1, 0x7cb2794b),
+	SH_U64(0x5a9ff51b, 0xa33adc1c), SH_U64(0xa630657c, 0xb8c7f164),
+	SH_U64(0x622570c6, 0xc262c8df), SH_U64(0x4930c821, 0xc1606730),
+	SH_U64(0xcb9ebfbd, 0xfe40f3f9), SH_U64(0x6616b7c1, 0xa5e48c27),
+	SH_U64(0x632fd669, 0xa7ab1bd4), SH_U64(0xf95d76a4, 0x30c5bb5c),
+	SH_U64(0x9abd6df5, 0x738c0a9b), SH_U64(0x58efd731, 0xa91fb004),
+	SH_U64(0x6231eab2, 0x525ba011), SH_U64(0x99e7fe09, 0xb67a7978),
+	SH_U64(0x8bd89997, 0x6cb6021e), SH_U64(0x0e49d524, 0xd3a854e5),
+	SH_U64(0x926465ef, 0x67d04f3f), SH_U64(0x3cee7818, 0x15ce206b),
+	SH_U64(0xe1baa47d, 0x01408015), SH_U64(0x8aa449ce, 0x2d0ca1d3),
+	SH_U64(0x6b18769d, 0x9c324eab), SH_U64(0xcf4a7b3c, 0x48d45c4f),
+	SH_U64(0xa46b0224, 0x5b9f3af4), SH_U64(0x21c2dd3f, 0x1fdb3325),
+	SH_U64(0x41956a36, 0xdbc51080), SH_U64(0x87cf9df8, 0x0d80457c),
+	SH_U64(0x4bee6186, 0x85b05729), SH_U64(0x654fafc0, 0xee6f9a84),
+	SH_U64(0xa7941fa8, 0x506d86f0), SH_U64(0xc1ebf56d, 0x881f3523),
+	SH_U64(0xcfca9d28, 0x80b2128d), SH_U64(0xb6c90eba, 0xcc2b26dd),
+	SH_U64(0x2cfa56b4, 0xa2af9298), SH_U64(0xe309713c, 0xe13e0797),
+	SH_U64(0xcff04462, 0x43756e89), SH_U64(0x087d70ad, 0x2ca29b0a),
+	SH_U64(0x8b37e5e0, 0xa757936c), SH_U64(0x33c61742, 0x8bbaa70b),
+	SH_U64(0x45f79258, 0xe41b3ae0), SH_U64(0xe3841e09, 0x8fbc6ad9),
+	SH_U64(0x8505be27, 0xdef25da7), SH_U64(0x9e14c3b3, 0x8f31b195),
+	SH_U64(0xcf15a836, 0xb33fd539), SH_U64(0x2505f58c, 0x05e6526f),
+	SH_U64(0x1d3169fb, 0xb198c267), SH_U64(0xaa2d7708, 0xf2a6f456),
+	SH_U64(0x968a5ba2, 0x3473faff), SH_U64(0xde295d82, 0xf964f296),
+	SH_U64(0xfebd6a4f, 0xbd0a7802), SH_U64(0x4a1033f1, 0xab1b19dd),
+	SH_U64(0xd1f31274, 0xab1cea5a), SH_U64(0xb283085a, 0x8c486789),
+	SH_U64(0xaeff7d4b, 0x5b72ec99), SH_U64(0xf2f8ede6, 0xfa70bf5f),
+	SH_U64(0x79ce5dc9, 0x7509c089), SH_U64(0x2731d9fd, 0xf756b334),
+	SH_U64(0xa7d485d7, 0x47130317), SH_U64(0x973d7f79, 0xfc81e7f3),
+	SH_U64(0x51b6e610, 0xeb969d89), SH_U64(0xfadb7bdc, 0x13722e8e),
+	SH_U64(0x168b5740, 0xba2991ff), SH_U64(0x2c81ea32, 0x9aeaba69),
+	SH_U64(0x8607c732, 0x1697c49d), SH_U64(0xf2baed4a, 0x618b76b9),
+	SH_U64(0x30af74b3, 0x2e05f342), SH_U64(0xca4b25a2, 0x3588ff96),
+	SH_U64(0x581d666d, 0xc9c63f77), SH_U64(0x1801ebc2, 0x0183eb48),
+	SH_U64(0xe2d92833, 0x383b377e), SH_U64(0xf311e1c1, 0xd9823f53),
+	SH_U64(0x786dd0ab, 0x972d849a), SH_U64(0x33cffc11, 0x6cf4f2f0),
+	SH_U64(0xef08a61a, 0x384aadee), SH_U64(0x17b1332c, 0xd96c043d),
+	SH_U64(0xdad9841b, 0xd5324d12), SH_U64(0x17863164, 0x9ea56d8a),
+	SH_U64(0x8bc94640, 0x9c88cb8f), SH_U64(0x8aeb093d, 0x93e71bbf),
+	SH_U64(0xd94fa4a9, 0x067dc0c4), SH_U64(0x0ead39eb, 0xf60cc176),
+	SH_U64(0x2d2898ce, 0x1f8cef8e), SH_U64(0x584592b4, 0x271786aa),
+	SH_U64(0xa09d66d4, 0x686ad125), SH_U64(0xaf26563f, 0x2ec4c8e6),
+	SH_U64(0x89607b27, 0xda843f55), SH_U64(0xd1237454, 0x0570b1a6),
+	SH_U64(0xe2e78900, 0x52504d85), SH_U64(0x9e94f67a, 0x91a8b89f),
+	SH_U64(0x629be6c3, 0xeec6e119), SH_U64(0xdda64e04, 0x828f136d),
+	SH_U64(0x02dff2f7, 0x9f398377), SH_U64(0x3e784199, 0xb71ea792),
+	SH_U64(0x72025a4f, 0xb5a542db), SH_U64(0x1d08970c, 0x8bcea7c1),
+	SH_U64(0x5cb85fd2, 0x65949fd2), SH_U64(0xa46f85ac, 0x5faf045d),
+	SH_U64(0xc1726a66, 0x40a7c667), SH_U64(0x97dcc30d, 0x0b60ae52),
+	SH_U64(0x2427cee8, 0xd2e4a800), SH_U64(0x30c19ce0, 0x2862b3c8),
+	SH_U64(0xd8013ba0, 0x973c70b4), SH_U64(0x4a1ac66d, 0xc58909f5),
+	SH_U64(0xfb7c0c28, 0x4af128d0), SH_U64(0x83d7ead9, 0x103e6a46),
+	SH_U64(0x0d732b41, 0x73198b1f), SH_U64(0x3465840d, 0x39b46bb3),
+	SH_U64(0xb3cc71e5, 0xddf6ebc3), SH_U64(0x076fe017, 0x4dadb77a),
+	SH_U64(0x4b73dab7, 0xcd5c5cdd), SH_U64(0xc016eac8, 0x769baa71),
+	SH_U64(0x94644999, 0x900a2d35), SH_U64(0x5ae32c35, 0xd44c85af),
+	SH_U64(0x9197ec39, 0x95324e47), SH_U64(0x9fe088c6, 0x86eadd13),
+	SH_U64(0x27912c9a, 0x98904626), SH_U64(0x0bed6875, 0x9c38d660),
+	SH_U64(0x7b91969a, 0x323c7ba1), SH_U64(0x451dd81e, 0xff9a7375),
+	SH_U64(0xab53246b, 0xc8010cd8), SH_U64(0x678c2e85, 0x17754e17),
+	SH_U64(0x205a52ed, 0x34b11640), SH_U64(0x20bf6e6b, 0xb267925c),
+	SH_U64(0xcc81c265, 0x26b6b495), SH_U64(0x60e5feb0, 0x50a350f3),
+	SH_U64(0xceb199aa, 0x91d38677), SH_U64(0x702db9ad, 0x49a9308f),
+	SH_U64(0xb2729643, 0xea40709b), SH_U64(0xd0f9d121, 0xd892dd8b),
+	SH_U64(0xd4d5ee87, 0xd81b4dcb), SH_U64(0x9e2b506f, 0x667faa72),
+	SH_U64(0x0422ead6, 0xd14dfd08), SH_U64(0x78b9f773, 0x427f6a3e),
+	SH_U64(0x1d6ca414, 0xab31ddfb), SH_U64(0xd4409696, 0xbf750e0e),
+	SH_U64(0x647560a2, 0xfec4c6bb), SH_U64(0x545aee13, 0xe54de8ac),
+	SH_U64(0xbe7ea806, 0xe6d0cd2f), SH_U64(0xc1e50100, 0xc635af5f),
+	SH_U64(0x9b2adb56, 0x88049bf6), SH_U64(0x2274f866, 0xce8563ed),
+	SH_U64(0xd5de2878, 0x8450e19d), SH_U64(0x2c28e0f7, 0xcc43aac8),
+	SH_U64(0x68e4f6e4, 0x042c1729), SH_U64(0x28f0b19d, 0xc0496d52),
+	SH_U64(0xa267f1c5, 0x990f7dbc), SH_U64(0xa3e624eb, 0x5639d4b4),
+	SH_U64(0xcd4a68e0, 0x106a93f1), SH_U64(0x93b41d13, 0xc2a63a42),
+	SH_U64(0xdd1d0296, 0x3964404f), SH_U64(0xc42137f5, 0x855a43f2),
+	SH_U64(0x6b51ed48, 0x87fb3d49), SH_U64(0x7ac22589, 0xa7b7901f),
+	SH_U64(0x9aca53c7, 0xf3705033), SH_U64(0xee8f42af, 0xfd428d43),
+	SH_U64(0xa1922ec8, 0x27532a19), SH_U64(0xb485f15a, 0x1b61e328),
+	SH_U64(0x6846c159, 0x1a677e0f), SH_U64(0xe4795566, 0xec5789af),
+	SH_U64(0xb74d6c45, 0x30017552), SH_U64(0x2e7afef1, 0xf903cfe7),
+	SH_U64(0x7614ffe5, 0x3b7cdd80), SH_U64(0x3d4b8ec0, 0xeb61bed3),
+	SH_U64(0x0ca962b0, 0x5ff7b794), SH_U64(0xf0a97ed7, 0x01e839f8),
+	SH_U64(0xc029831c, 0x403e3572), SH_U64(0x2d16ae81, 0x745323fe),
+	SH_U64(0x718a7051, 0x0ebe1268), SH_U64(0xedd41e21, 0x40abd242),
+	SH_U64(0xfe501eb5, 0xbaddad2c), SH_U64(0x7231cbc6, 0xd153027a),
+	SH_U64(0x8db52593, 0x89ff9c58), SH_U64(0x7f539d37, 0xf75a6232),
+	SH_U64(0x39823bbb, 0x07ba34dc), SH_U64(0xf62f3320, 0x5db92070),
+	SH_U64(0x85cf722e, 0x93215478), SH_U64(0x94964b46, 0x6b11ff2c),
+	SH_U64(0x4c98f8c6, 0xe83dfd15), SH_U64(0xdee8d937, 0xbafb4b29),
+	SH_U64(0x92702b50, 0x9d55a315), SH_U64(0x2af65e9f, 0x23dd36bd),
+	SH_U64(0x55c4f42a, 0x3adaf452), SH_U64(0xc5b25064, 0x70766efd),
+	SH_U64(0x394836aa, 0xb36daa5d), SH_U64(0x7af40d3b, 0x679d11e6),
+	SH_U64(0x1c2b3848, 0x95884773), SH_U64(0x8ab963f7, 0xda9e8c75),
+	SH_U64(0x2144464c, 0xb91cbc36), SH_U64(0x62927f3d, 0xef23d9f5),
+	SH_U64(0xae62443f, 0x0d2c70a4), SH_U64(0x72e195f2, 0x3a2bfe78),
+	SH_U64(0x2d029f0d, 0x52b5847b), SH_U64(0x2f626659, 0xb2d8087b),
+	SH_U64(0x803b84a1, 0x79f46aa6), SH_U64(0xb0a58f4e, 0xb57882a8),
+	SH_U64(0xbef579e2, 0xe575809f), SH_U64(0xc8ea2568, 0xf2865454),
+	SH_U64(0x5abb7d3a, 0x4ba9bc50), SH_U64(0x17928c83, 0x3911971e),
+	SH_U64(0x78173c47, 0x26eb56fd), SH_U64(0xaaa65c35, 0x4adf9d1f),
+	SH_U64(0x5d85cbc2, 0x5a4525f6), SH_U64(0x4c7d0bf1, 0xf13f04c8),
+	SH_U64(0x8c681489, 0x4790deb1), SH_U64(0x184cfaf2, 0xd94782c8),
+	SH_U64(0x0e59f24c, 0x06962a5e), SH_U64(0x5a51319c, 0x3f19df1d),
+	SH_U64(0xb5fdd0eb, 0x4bd50397), SH_U64(0xb08b2568, 0x4e2f0d54),
+	SH_U64(0xc7dbab0c, 0xea6e88d6), SH_U64(0x6fe8da05, 0xba00ff03),
+	SH_U64(0x33914dae, 0x20f87536), SH_U64(0xf82a6f1d, 0x1144170d)
+};
+
+#define SH_BUZ(c) ((uint32_t)(sh_gear_tab[c] >> 32))
+#define SH_ROTL32(h, n) (((h) << (n)) | ((h) >> ((32 - (n)) & 31)))
+
+uint32_t sh_buzhash(const void *buf, size_t w)
+{
+	size_t i;
+	uint32_t h = 0;
+	const uint8_t *p = (const uint8_t *)buf;
+	RETURN_IF(!buf, 0);
+	for (i = 0; i < w; i++)
+		h = SH_ROTL32(h, 1) ^ SH_BUZ(p[i]);
+	return h;
+}
+
+uint32_t sh_buzhash_roll(uint32_t h, uint8_t c_out, uint8_t c_in, size_t w)
+{
+	uint32_t out = SH_BUZ(c_out);
+	return SH_ROTL32(h, 1) ^ SH_ROTL32(out, w % 32) ^ SH_BUZ(c_in);
+}
+
+uint64_t sh_gear(uint64_t h, const void *buf, size_t buf_size)
+{
+	size_t i;
+	const uint8_t *p = (const uint8_t *)buf;
+	RETURN_IF(!buf, h);
+	for (i = 0; i < buf_size; i++)
+		h = (h << 1) + sh_gear_tab[p[i]];
+	return h;
+}
+
+/*
+ * Content-defined chunking (FastCDC algorithm, with normalization level
+ * 2): the Gear hash starts at the minimum chunk size, and a boundary is
+ * found when the hash bits selected by the mask are zero. The mask has
+ * two more bits than log2(avg) below the average size, and two less
+ * above, so chunk sizes are concentrated around the average. High hash
+ * bits are used, as these depend on the last 63 bytes (low bits depend
+ * only on the last few). Two bytes are processed per loop, checking the
+ * first one with the mask shifted (the most significant bit is not part
+ * of the mask, so the result is the same as with one byte per loop)
+ */
+
+#define SH_CDC_MASK(bits) ((~(uint64_t)0 << (64 - (bits))) >> 1)
+
+size_t sh_cdc(const void *buf, size_t buf_size, size_t min, size_t avg,
+	      size_t max, srt_bool last)
+{
+	size_t i, n, mid;
+	unsigned bits;
+	uint64_t h = 0, ms, ml;
+	const uint8_t *p = (const uint8_t *)buf;
+	RETURN_IF(!buf || !buf_size, 0);
+	max = S_MAX(S_MAX(max, min), 1);
+	n = S_MIN(buf_size, max);
+	if (n <= min)
+		return n == max || last ? n : 0;
+	bits = S_RANGE(slog2(avg), 6, 48);
+	ms = SH_CDC_MASK(bits + 2);
+	ml = SH_CDC_MASK(bits - 2);
+	mid = S_MAX(min, S_MIN(n, avg));
+	for (i = min; i + 1 < mid; i += 2) {
+		h = (h << 2) + (sh_gear_tab[p[i]] << 1);
+		if (!(h & (ms << 1)))
+			return i + 1;
+		h += sh_gear_tab[p[i + 1]];
+		if (!(h & ms))
+			return i + 2;
+	}
+	for (; i < mid; i++) {
+		h = (h << 1) + sh_gear_tab[p[i]];
+		if (!(h & ms))
+			return i + 1;
+	}
+	for (; i + 1 < n; i += 2) {
+		h = (h << 2) + (sh_gear_tab[p[i]] << 1);
+		if (!(h & (ml << 1)))
+			return i + 1;
+		h += sh_gear_tab[p[i + 1]];
+		if (!(h & ml))
+			return i + 2;
+	}
+	for (; i < n; i++) {
+		h = (h << 1) + sh_gear_tab[p[i]];
+		if (!(h & ml))
+			return i + 1;
+	}
+	/*
+	 * BEHAVIOR:
+	 * If the buffer is smaller than the maximum chunk size and no
+	 * boundary was found, more data is required (unless it is the last
+	 * block of the stream), so 0 is returned
+	 */
+	return n == max || last ? n : 0;
+}
+
 #else
 
 /*
  * gcc shash.c -DS_BUILD_CRC32_TABLES -o a ; ./a >scrc32.h
  */
-int main(int argc, const char **argv)
+
+static void crc_tables(uint32_t t[16][256], const uint32_t poly)
 {
 	/*
-	 * Generation of scrc32.h content
-	 *
 	 * Learned from:
 	 * https://web.archive.org/web/20121011093914/http://www.intel.com
 	 *	          /technology/comms/perfnet/download/CRC_generators.pdf
 	 * http://create.stephan-brumme.com/crc32/
 	 */
 	size_t i, j;
-	uint32_t c32t[16][256];
 	for (i = 0; i < 256; i++) {
 		uint32_t crc = i;
 		for (j = 0; j < 8; j++) {
 			int b0 = crc & 1;
 			crc >>= 1;
 			if (b0)
-				crc ^= S_CRC32_POLY;
+				crc ^= poly;
 		}
-		c32t[0][i] = crc;
+		t[0][i] = crc;
 	}
-	for (j = 1; j < 16; j++) {
-		for (i = 0; i < 256; i++) {
-#define C32L(s)                                                                \
-	c32t[s][i] = (c32t[s - 1][i] >> 8) ^ c32t[0][c32t[s - 1][i] & 0xff];
-			C32L(1);
-			C32L(2);
-			C32L(3);
-			C32L(4);
-			C32L(5);
-			C32L(6);
-			C32L(7);
-			C32L(8);
-			C32L(9);
-			C32L(10);
-			C32L(11);
-			C32L(12);
-			C32L(13);
-			C32L(14);
-			C32L(15);
+	for (j = 1; j < 16; j++)
+		for (i = 0; i < 256; i++)
+			t[j][i] = (t[j - 1][i] >> 8) ^ t[0][t[j - 1][i] & 0xff];
+}
+
+/*
+ * "Zeros" tables: CRC register after n zero bytes, for every byte of the
+ * register (the operation is linear, so it is the XOR of the 4 lookups)
+ */
+static void crc_zeros(uint32_t z[4][256], const uint32_t t0[256],
+		      const size_t n)
+{
+	size_t i, j, k;
+	uint32_t bits[32], crc;
+	for (i = 0; i < 32; i++) {
+		crc = (uint32_t)1 << i;
+		for (j = 0; j < n; j++)
+			crc = t0[crc & 0xff] ^ (crc >> 8);
+		bits[i] = crc;
+	}
+	for (k = 0; k < 4; k++)
+		for (i = 0; i < 256; i++)
+			for (z[k][i] = 0, j = 0; j < 8; j++)
+				if (i & (1 << j))
+					z[k][i] ^= bits[k * 8 + j];
+}
+
+static void print_row(const uint32_t r[256])
+{
+	const size_t rows = 6;
+	size_t j;
+	printf("\t{\n\t");
+	for (j = 0; j < 256; j++) {
+		printf("0x%08x", (unsigned)r[j]);
+		if (j < 255) {
+			if ((j % rows) == (rows - 1))
+				printf(",\n\t");
+			else
+				printf(", ");
 		}
 	}
+	printf("\n\t}");
+}
+
+static void print_slc(const char *name, uint32_t t[16][256])
+{
+	size_t i;
+	printf("static const uint32_t %s[S_CRC32_SLC][256] = {\n", name);
+	for (i = 0; i < 16; i++) {
+		print_row(t[i]);
+		switch (i) {
+		case 0:
+			printf("\n#if S_CRC32_SLC >= 4\n\t,");
+			break;
+		case 3:
+			printf("\n#endif /*#if S_CRC32_SLC >= 4*/");
+			printf("\n#if S_CRC32_SLC >= 8\n\t,");
+			break;
+		case 7:
+			printf("\n#endif /*#if S_CRC32_SLC >= 8*/");
+			printf("\n#if S_CRC32_SLC >= 12\n\t,");
+			break;
+		case 11:
+			printf("\n#endif /*#if S_CRC32_SLC >= 12*/");
+			printf("\n#if S_CRC32_SLC >= 16\n\t,");
+			break;
+		case 15:
+			printf("\n#endif /*#if S_CRC32_SLC >= 16*/\n");
+			break;
+		default:
+			printf(",");
+		}
+		printf("\n");
+	}
+	printf("};\n\n");
+}
+
+static void print_zeros(const char *name, uint32_t z[4][256])
+{
+	size_t i;
+	printf("static const uint32_t %s[4][256] = {\n", name);
+	for (i = 0; i < 4; i++) {
+		print_row(z[i]);
+		printf(i < 3 ? ",\n" : "\n");
+	}
+	printf("};\n\n");
+}
+
+int main(int argc, const char **argv)
+{
+	/*
+	 * Generation of scrc32.h content
+	 */
+	static uint32_t c32t[16][256], c32ct[16][256], zl[4][256], zs[4][256];
+	crc_tables(c32t, S_CRC32_POLY);
+	crc_tables(c32ct, S_CRC32C_POLY);
+	crc_zeros(zl, c32ct[0], SH_CRC32C_LONG);
+	crc_zeros(zs, c32ct[0], SH_CRC32C_SHORT);
 	/*
 	 * Flush table to the output
 	 */
@@ -263,49 +1118,26 @@ int main(int argc, const char **argv)
 	       "#define S_CRC32_SLC 1\n"
 	       "#endif\n"
 	       "#endif\n\n"
-	       "#if S_CRC32_SLC > 0\n\n"
-	       "static const uint32_t crc32_tab[S_CRC32_SLC][256] = {\n",
+	       "#if S_CRC32_SLC > 0\n\n",
 	       S_CRC32_POLY);
-	int rows = 6;
-	for (i = 0; i < 16; i++) {
-		printf("\t{\n\t");
-		for (j = 0; j < 256; j++) {
-			printf("0x%08x", (unsigned)c32t[i][j]);
-			if (j < 255) {
-				if ((j % rows) == (rows - 1))
-					printf(",\n\t");
-				else
-					printf(", ");
-			}
-		}
-		printf("\n\t}");
-		switch (i) {
-		case 0:
-			printf("\n#if S_CRC32_SLC >= 4\n\t,");
-			break;
-		case 3:
-			printf("\n#endif /*#if S_CRC32_SLC >= 4*/");
-			printf("\n#if S_CRC32_SLC >= 8\n\t,");
-			break;
-		case 7:
-			printf("\n#endif /*#if S_CRC32_SLC >= 8*/");
-			printf("\n#if S_CRC32_SLC >= 12\n\t,");
-			break;
-		case 11:
-			printf("\n#endif /*#if S_CRC32_SLC >= 12*/");
-			printf("\n#if S_CRC32_SLC >= 16\n\t,");
-			break;
-		case 15:
-			printf("\n#endif /*#if S_CRC32_SLC >= 16*/\n");
-			break;
-		default:
-			printf(",");
-		}
-		printf("\n");
-	}
-	printf("};\n\n"
+	print_slc("crc32_tab", c32t);
+	printf("/*\n"
+	       " * CRC-32C (polynomial 0x%08x)\n"
+	       " */\n\n",
+	       S_CRC32C_POLY);
+	print_slc("crc32c_tab", c32ct);
+	printf("#ifdef SCRC32C_ZEROS\n\n"
+	       "/*\n"
+	       " * CRC-32C register after %u and %u zero bytes (lane sizes of\n"
+	       " * the SSE4.2 implementation)\n"
+	       " */\n\n",
+	       (unsigned)SH_CRC32C_LONG, (unsigned)SH_CRC32C_SHORT);
+	print_zeros("crc32c_long", zl);
+	print_zeros("crc32c_short", zs);
+	printf("#endif /*#ifdef SCRC32C_ZEROS*/\n\n"
 	       "#endif /*#if S_CRC32_SLC > 0*/\n\n"
 	       "#endif /* #ifdef SCRC32_H */\n\n");
+	return 0;
 }
 
 #endif /* #ifndef S_BUILD_CRC32_TABLES */
@@ -21,14 +21,78 @@ extern "C" {
  *     + 8192 byte hash table: 8 bytes/loop (2000MB/s on i5@3GHz)
  *     + 12288 byte hash table: 12 bytes/loop (2500MB/s on i5@3GHz)
  *     + 16384 byte hash table: 16 bytes/loop (2700MB/s on i5@3GHz)
+ * - CRC-32C (Castagnoli polynomial, e.g. for iSCSI, ext4, and storage
+ *   formats), with the same table modes (separate tables).
+ * - x86 CPU-specific CRC-32 and CRC-32C (not in compact mode, and only
+ *   with gcc >= 4.9 or clang, disabled with S_DISABLE_CPU_EXT), selected
+ *   at run time if the CPU supports it:
+ *     + CRC-32: carry-less multiplication (PCLMULQDQ), folding 64 bytes
+ *       per loop, for 64 bytes or more (16GB/s vs 2.3GB/s of the 12 byte
+ *       per loop mode, on Xeon@2GHz, for 4 KiB or more in cache)
+ *     + CRC-32C: SSE4.2 crc32 instruction, three lanes at once (10-12GB/s
+ *       on Xeon@2GHz). The lane combination uses 8 KiB of "zeros" tables
+ * - Adler32 checksum. On x86 (same conditions as CRC-32 above) it uses
+ *   AVX2 or SSSE3 (vectorized weighted sums, reduced modulo 65521 every
+ *   5552 bytes), selected at run time, for 64 bytes or more (23GB/s with
+ *   AVX2 and 9.8GB/s with SSSE3 vs 2GB/s, on Xeon@2GHz, 16 KiB in cache)
+ * - CRC-32, CRC-32C, and Adler32 combination (checksum of A + B from the
+ *   checksums of A and B, and the size of B: O(log n) for CRC, O(1) for
+ *   Adler32), and parallel computation (the buffer is split in chunks of
+ *   at least 1 MiB, one per thread, combining the results; requires
+ *   building with S_PTHREAD, otherwise it runs in the calling thread).
+ * - FNV-1a 64-bit hash (used for the srt_string cached hash)
+ * - 64-bit hash for hash tables, bloom filters, and partitioning (wyhash
+ *   algorithm: 48 bytes per loop, 12GB/s on Xeon@2GHz for 4 KiB in
+ *   cache, and few cycles for short keys). The seeded variant is not
+ *   protected against hash flooding (the secret constants are public, and
+ *   some inputs cancel the seed): the keyed variant derives every secret
+ *   from the key, so a secret random key prevents hash flooding attacks
+ * - Rolling hashes: Buzhash (any window size, O(1) update by removing the
+ *   first byte and adding the next one) and Gear (implicit 64 byte window)
+ * - Content-defined chunking (FastCDC, using the Gear hash): boundaries
+ *   depend only on the content around them, so inserting or removing data
+ *   changes only the chunks around the edit (data deduplication)
  */
 
 #include "scommon.h"
 
 /* #notAPI: |CRC-32 (0xedb88320 polynomial)|CRC accumulator (for offset 0 must be 0);buffer;buffer size (in bytes)|32-bit hash|O(n)|1;2| */
 uint32_t sh_crc32(uint32_t crc, const void *buf, size_t buf_size);
+/* #notAPI: |CRC-32C (0x82f63b78 polynomial, Castagnoli)|CRC accumulator (for offset 0 must be 0);buffer;buffer size (in bytes)|32-bit hash|O(n)|1;2| */
+uint32_t sh_crc32c(uint32_t crc, const void *buf, size_t buf_size);
 /* #notAPI: |Adler32 checksum|Adler32 accumulator (for offset 0 must be 1);buffer;buffer size (in bytes)|32-bit hash|O(n)|1;2| */
 uint32_t sh_adler32(uint32_t adler, const void *buf, size_t buf_size);
+/* #notAPI: |CRC-32 of A + B, from CRC-32 of A and B|CRC-32 of A;CRC-32 of B;size of B (in bytes)|32-bit hash|O(log n)|1;2| */
+uint32_t sh_crc32_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b);
+/* #notAPI: |CRC-32C of A + B, from CRC-32C of A and B|CRC-32C of A;CRC-32C of B;size of B (in bytes)|32-bit hash|O(log n)|1;2| */
+uint32_t sh_crc32c_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b);
+/* #notAPI: |Adler32 of A + B, from Adler32 of A and B|Adler32 of A;Adler32 of B;size of B (in bytes)|32-bit hash|O(1)|1;2| */
+uint32_t sh_adler32_combine(uint32_t adler_a, uint32_t adler_b,
+			    uint64_t len_b);
+/* #notAPI: |CRC-32, using up to nthreads threads|CRC accumulator (for offset 0 must be 0);buffer;buffer size (in bytes);maximum number of threads|32-bit hash|O(n)|1;2| */
+uint32_t sh_crc32_parallel(uint32_t crc, const void *buf, size_t buf_size,
+			   size_t nthreads);
+/* #notAPI: |CRC-32C, using up to nthreads threads|CRC accumulator (for offset 0 must be 0);buffer;buffer size (in bytes);maximum number of threads|32-bit hash|O(n)|1;2| */
+uint32_t sh_crc32c_parallel(uint32_t crc, const void *buf,
+			    size_t buf_size, size_t nthreads);
+/* #notAPI: |Adler32, using up to nthreads threads|Adler32 accumulator (for offset 0 must be 1);buffer;buffer size (in bytes);maximum number of threads|32-bit hash|O(n)|1;2| */
+uint32_t sh_adler32_parallel(uint32_t adler, const void *buf,
+			     size_t buf_size, size_t nthreads);
+/* #notAPI: |FNV-1a 64-bit hash|hash accumulator (for offset 0 must be S_FNV1A64_INIT);buffer;buffer size (in bytes)|64-bit hash|O(n)|1;2| */
+uint64_t sh_fnv1a64(uint64_t h, const void *buf, size_t buf_size);
+/* #notAPI: |64-bit hash (wyhash), no hash flooding protection (see sh_hash64_keyed())|seed (e.g. 0);buffer;buffer size (in bytes)|64-bit hash|O(n)|1;2| */
+uint64_t sh_hash64(uint64_t seed, const void *buf, size_t buf_size);
+/* #notAPI: |64-bit keyed hash (wyhash, with the secrets derived from the key)|key (a secret random value against hash flooding);buffer;buffer size (in bytes)|64-bit hash|O(n)|1;2| */
+uint64_t sh_hash64_keyed(uint64_t key, const void *buf, size_t buf_size);
+/* #notAPI: |Buzhash rolling hash (cyclic polynomial) of a window|buffer;window size (in bytes)|32-bit hash|O(n)|1;2| */
+uint32_t sh_buzhash(const void *buf, size_t w);
+/* #notAPI: |Buzhash rolling: remove the first byte of the window, add a byte at the end|Buzhash of the window;first byte of the window;byte after the window;window size (in bytes)|32-bit hash|O(1)|1;2| */
+uint32_t sh_buzhash_roll(uint32_t h, uint8_t c_out, uint8_t c_in, size_t w);
+/* #notAPI: |Gear rolling hash (the last 64 bytes determine the high bits)|hash accumulator (for offset 0 must be 0);buffer;buffer size (in bytes)|64-bit hash|O(n)|1;2| */
+uint64_t sh_gear(uint64_t h, const void *buf, size_t buf_size);
+/* #notAPI: |Content-defined chunking: next chunk size (FastCDC)|buffer (at the chunk start);buffer size (in bytes);minimum chunk size;average chunk size (rounded down to a power of 2);maximum chunk size;last block of the stream flag|chunk size (0: no data, or more data required if not the last block)|O(n)|1;2| */
+size_t sh_cdc(const void *buf, size_t buf_size, size_t min, size_t avg,
+	      size_t max, srt_bool last);
 
 #ifdef __cplusplus
 } /* extern "C" { */
@@ -0,0 +1,382 @@
+/*
+ * snorm.c
+ *
+ * Unicode normalization and case folding.
+ *
+ * Copyright (c) 2015-2018 F. Aragon. All rights reserved.
+ * Released under the BSD 3-Clause License (see the doc/LICENSE)
+ */
+
+#include "snorm.h"
+#include "schar.h"
+#include "snormtbl.h"
+
+/*
+ * Character properties (see utl/mk_snorm_tables.py)
+ */
+
+#define SN_CCC_MASK 0xff
+#define SN_NFC_QC_MAYBE (1 << 8)
+#define SN_NFC_QC_NO (1 << 9)
+#define SN_NFKC_QC_MAYBE (1 << 10)
+#define SN_NFKC_QC_NO (1 << 11)
+#define SN_NFD_QC_NO (1 << 12)
+#define SN_NFKD_QC_NO (1 << 13)
+#define SN_HAS_FOLD (1 << 14)
+
+#define SN_MAP_CP(k) ((int32_t)((k)&0xffffff))
+#define SN_MAP_LEN(k) ((size_t)((k) >> 24))
+
+/*
+ * Hangul syllables (algorithmic composition/decomposition)
+ */
+
+#define SN_H_S0 0xac00
+#define SN_H_L0 0x1100
+#define SN_H_V0 0x1161
+#define SN_H_T0 0x11a7
+#define SN_H_LN 19
+#define SN_H_VN 21
+#define SN_H_TN 28
+#define SN_H_NN (SN_H_VN * SN_H_TN)
+#define SN_H_SN (SN_H_LN * SN_H_NN)
+
+#define SN_BUF_SIZE 32
+
+/* Replicate byte into a machine word */
+#define SN_REP(b) ((~(size_t)0 / 0xff) * (b))
+
+struct SNormState {
+	int32_t cp[SN_BUF_SIZE];
+	unsigned char cc[SN_BUF_SIZE];
+	size_t n;
+	char *o;
+	size_t oi;
+	enum SNormForm f;
+};
+
+S_INLINE unsigned sn_prop(const int32_t c)
+{
+	size_t i0, i1;
+	const int32_t m1 = (1 << SN_PROP_SHIFT1) - 1,
+		      m2 = (1 << SN_PROP_SHIFT2) - 1;
+	if (c < 0x80 || c >= SN_PROP_LIMIT)
+		return 0;
+	i0 = sn_prop_s0[c >> (SN_PROP_SHIFT1 + SN_PROP_SHIFT2)];
+	i1 = sn_prop_s1[(i0 << SN_PROP_SHIFT1) | ((c >> SN_PROP_SHIFT2) & m1)];
+	return sn_prop_s2[(i1 << SN_PROP_SHIFT2) | (c & m2)];
+}
+
+static const uint16_t *sn_map(const uint32_t *k, const uint16_t *off,
+			      const size_t nk, const int32_t c, size_t *len)
+{
+	size_t i = 0, j = nk, m;
+	while (i < j) {
+		m = i + (j - i) / 2;
+		if (SN_MAP_CP(k[m]) < c)
+			i = m + 1;
+		else
+			j = m;
+	}
+	if (i < nk && SN_MAP_CP(k[i]) == c) {
+		*len = SN_MAP_LEN(k[i]);
+		return sn_pool + off[i];
+	}
+	return NULL;
+}
+
+static int32_t sn_compose_pair(const int32_t a, const int32_t b)
+{
+	size_t i = 0, j, m;
+	const size_t np = sizeof(sn_comp_v) / sizeof(sn_comp_v[0]);
+	if (a >= SN_H_L0 && a < SN_H_L0 + SN_H_LN && b >= SN_H_V0
+	    && b < SN_H_V0 + SN_H_VN)
+		return SN_H_S0
+		       + ((a - SN_H_L0) * SN_H_VN + (b - SN_H_V0)) * SN_H_TN;
+	if (a >= SN_H_S0 && a < SN_H_S0 + SN_H_SN
+	    && (a - SN_H_S0) % SN_H_TN == 0 && b > SN_H_T0
+	    && b < SN_H_T0 + SN_H_TN)
+		return a + (b - SN_H_T0);
+	j = np;
+	while (i < j) {
+		m = i + (j - i) / 2;
+		if ((int32_t)sn_comp_k1[m] < a
+		    || ((int32_t)sn_comp_k1[m] == a
+			&& (int32_t)sn_comp_k2[m] < b))
+			i = m + 1;
+		else
+			j = m;
+	}
+	return i < np && (int32_t)sn_comp_k1[i] == a
+			       && (int32_t)sn_comp_k2[i] == b
+		       ? (int32_t)sn_comp_v[i]
+		       : 0;
+}
+
+/*
+ * UTF-8 decoding, rejecting overlong encodings and invalid continuation bytes
+ * (so invalid input is always copied as is)
+ */
+static size_t sn_utf8_to_wc(const char *s, const size_t off, const size_t ss,
+			    int *c, srt_bool *invalid)
+{
+	size_t i, cs;
+	int32_t enc_errors = 0;
+	cs = sc_utf8_to_wc(s, off, ss, c, &enc_errors);
+	*invalid = enc_errors || cs != sc_wc_to_utf8_size(*c);
+	for (i = 1; !*invalid && i < cs; i++)
+		if ((s[off + i] & 0xc0) != 0x80)
+			*invalid = S_TRUE;
+	return *invalid ? 1 : cs;
+}
+
+static void sn_out(struct SNormState *st, const int32_t c)
+{
+	size_t cs = sc_wc_to_utf8_size(c);
+	if (st->o)
+		sc_wc_to_utf8(c, st->o, st->oi, st->oi + cs);
+	st->oi += cs;
+}
+
+static void sn_out_raw(struct SNormState *st, const char *s, const size_t ss)
+{
+	if (st->o)
+		memcpy(st->o + st->oi, s, ss);
+	st->oi += ss;
+}
+
+/*
+ * Canonical composition of the buffered characters
+ */
+static void sn_compose(struct SNormState *st)
+{
+	size_t i, n, starter = 0;
+	int32_t c;
+	unsigned cc, last_cc = st->cc[0] ? 256 : 0;
+	for (i = n = 1; i < st->n; i++) {
+		c = st->cp[i];
+		cc = st->cc[i];
+		if (last_cc < cc || last_cc == 0) {
+			c = sn_compose_pair(st->cp[starter], c);
+			if (c) {
+				st->cp[starter] = c;
+				continue;
+			}
+			c = st->cp[i];
+		}
+		if (cc == 0)
+			starter = n;
+		last_cc = cc;
+		st->cp[n] = c;
+		st->cc[n] = (unsigned char)cc;
+		n++;
+	}
+	st->n = n;
+}
+
+static void sn_flush(struct SNormState *st)
+{
+	size_t i;
+	if (st->n > 0) {
+		if (st->f == SN_NFC || st->f == SN_NFKC)
+			sn_compose(st);
+		for (i = 0; i < st->n; i++)
+			sn_out(st, st->cp[i]);
+		st->n = 0;
+	}
+}
+
+/*
+ * Add decomposed character, keeping canonical ordering
+ */
+static void sn_add(struct SNormState *st, const int32_t c, const unsigned p)
+{
+	size_t i;
+	const unsigned cc = p & SN_CCC_MASK,
+		       maybe = st->f == SN_NFC ? SN_NFC_QC_MAYBE
+					       : st->f == SN_NFKC
+							 ? SN_NFKC_QC_MAYBE
+							 : 0;
+	if ((cc == 0 && (p & maybe) == 0) || st->n == SN_BUF_SIZE)
+		sn_flush(st);
+	for (i = st->n; cc && i > 0 && st->cc[i - 1] > cc; i--) {
+		st->cp[i] = st->cp[i - 1];
+		st->cc[i] = st->cc[i - 1];
+	}
+	st->cp[i] = c;
+	st->cc[i] = (unsigned char)cc;
+	st->n++;
+}
+
+static void sn_decompose(struct SNormState *st, const int32_t c)
+{
+	size_t i, len = 0;
+	int32_t d, si;
+	const uint16_t *m = NULL;
+	const unsigned p = sn_prop(c);
+	const srt_bool compat = st->f == SN_NFKC || st->f == SN_NFKD;
+	if ((p & (compat ? SN_NFKD_QC_NO : SN_NFD_QC_NO)) == 0) {
+		sn_add(st, c, p);
+		return;
+	}
+	if (c >= SN_H_S0 && c < SN_H_S0 + SN_H_SN) {
+		si = c - SN_H_S0;
+		sn_add(st, SN_H_L0 + si / SN_H_NN, 0);
+		sn_add(st, SN_H_V0 + (si % SN_H_NN) / SN_H_TN,
+		       sn_prop(SN_H_V0));
+		if (si % SN_H_TN)
+			sn_add(st, SN_H_T0 + si % SN_H_TN,
+			       sn_prop(SN_H_T0 + 1));
+		return;
+	}
+	if (compat)
+		m = sn_map(sn_compat_k, sn_compat_off,
+			   sizeof(sn_compat_off) / sizeof(sn_compat_off[0]), c,
+			   &len);
+	if (!m)
+		m = sn_map(sn_canon_k, sn_canon_off,
+			   sizeof(sn_canon_off) / sizeof(sn_canon_off[0]), c,
+			   &len);
+	if (!m) { /* BEHAVIOR: not reachable with consistent tables */
+		sn_add(st, c, p);
+		return;
+	}
+	for (i = 0; i < len; i++) {
+		d = m[i];
+		if (SSU16_VALID_HS(d) && i + 1 < len)
+			d = SSU16_TO_U32(d, m[++i]);
+		sn_add(st, d, sn_prop(d));
+	}
+}
+
+static void sn_fold(struct SNormState *st, const int32_t c)
+{
+	size_t i, len = 0;
+	int32_t d;
+	const uint16_t *m;
+	if ((sn_prop(c) & SN_HAS_FOLD) == 0) {
+		sn_out(st, c);
+		return;
+	}
+	m = sn_map(sn_fold_k, sn_fold_off,
+		   sizeof(sn_fold_off) / sizeof(sn_fold_off[0]), c, &len);
+	for (i = 0; m && i < len; i++) {
+		d = m[i];
+		if (SSU16_VALID_HS(d) && i + 1 < len)
+			d = SSU16_TO_U32(d, m[++i]);
+		sn_out(st, d);
+	}
+}
+
+/*
+ * Skip bytes below the given threshold (and ASCII uppercase if requested),
+ * processing one machine word per loop. The returned offset is always at a
+ * UTF-8 character start.
+ */
+static size_t sn_skip(const char *s, size_t i, const size_t ss,
+		      const unsigned thr, const srt_bool upper)
+{
+	size_t w, i0 = i;
+	const size_t hi = SN_REP(0x80), lo = SN_REP(0x7f),
+		     kt = SN_REP(0x100 - thr), ka = SN_REP(0x80 - 'A'),
+		     kz = SN_REP(0x80 - 'Z' - 1);
+	for (; i + sizeof(size_t) <= ss; i += sizeof(size_t)) {
+		w = S_LD_SZT(s + i);
+		if ((w & ((w & lo) + kt) & hi) != 0)
+			break;
+		if (upper && (w & hi) != 0)
+			break;
+		if (upper && ((w + ka) & ~(w + kz) & hi) != 0)
+			break;
+	}
+	for (; i > i0 && i < ss && (s[i] & 0xc0) == 0x80; i--)
+		;
+	return i;
+}
+
+enum SNormQC sn_utf8_quick_check(const char *s, const size_t ss,
+				 const enum SNormForm f)
+{
+	size_t i, j, cs;
+	int c;
+	srt_bool invalid;
+	unsigned p, cc, last_cc = 0;
+	enum SNormQC r = SN_QC_YES;
+	const unsigned thr = f == SN_NFC ? SN_QC_THR_NFC
+				: f == SN_NFD ? SN_QC_THR_NFD
+				: f == SN_NFKC ? SN_QC_THR_NFKC
+				: f == SN_NFKD ? SN_QC_THR_NFKD
+				: SN_QC_THR_CASEFOLD,
+		       no = f == SN_NFC ? SN_NFC_QC_NO
+			  : f == SN_NFD ? SN_NFD_QC_NO
+			  : f == SN_NFKC ? SN_NFKC_QC_NO
+			  : f == SN_NFKD ? SN_NFKD_QC_NO : SN_HAS_FOLD,
+		       maybe = f == SN_NFC ? SN_NFC_QC_MAYBE
+			     : f == SN_NFKC ? SN_NFKC_QC_MAYBE : 0;
+	RETURN_IF(!s, SN_QC_YES);
+	for (i = 0; i < ss; i += cs) {
+		j = sn_skip(s, i, ss, thr, f == SN_CASEFOLD);
+		if (j != i) {
+			i = j;
+			last_cc = 0;
+			if (i >= ss)
+				break;
+		}
+		if ((unsigned char)s[i] < 0x80) {
+			if (f == SN_CASEFOLD && s[i] >= 'A' && s[i] <= 'Z')
+				return SN_QC_NO;
+			cs = 1;
+			last_cc = 0;
+			continue;
+		}
+		cs = sn_utf8_to_wc(s, i, ss, &c, &invalid);
+		if (invalid) { /* BEHAVIOR: invalid bytes are kept as is */
+			last_cc = 0;
+			continue;
+		}
+		p = sn_prop(c);
+		RETURN_IF(p & no, SN_QC_NO);
+		cc = p & SN_CCC_MASK;
+		if (f != SN_CASEFOLD && cc && last_cc > cc)
+			return SN_QC_NO;
+		if (p & maybe)
+			r = SN_QC_MAYBE;
+		last_cc = cc;
+	}
+	return r;
+}
+
+/*
+ * If 'o' is NULL, the required output size is returned (i.e. the function
+ * must be called twice, like with senc.c functions). Aliasing is not
+ * supported.
+ */
+size_t sn_utf8_normalize(const char *s, const size_t ss, char *o,
+			 const enum SNormForm f)
+{
+	size_t i, cs;
+	int c;
+	srt_bool invalid;
+	struct SNormState st;
+	RETURN_IF(!s || !ss, 0);
+	st.n = st.oi = 0;
+	st.o = o;
+	st.f = f;
+	for (i = 0; i < ss; i += cs) {
+		cs = sn_utf8_to_wc(s, i, ss, &c, &invalid);
+		if (invalid) { /* BEHAVIOR: copy invalid bytes as is */
+			sn_flush(&st);
+			sn_out_raw(&st, s + i, cs);
+			continue;
+		}
+		if (f == SN_CASEFOLD) {
+			if (c >= 'A' && c <= 'Z')
+				c += 'a' - 'A';
+			sn_fold(&st, c);
+		} else {
+			sn_decompose(&st, c);
+		}
+	}
+	sn_flush(&st);
+	return st.oi;
+}
@@ -0,0 +1,50 @@
+#ifndef SNORM_H
+#define SNORM_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * snorm.h
+ *
+ * Unicode normalization and case folding.
+ *
+ * Copyright (c) 2015-2018 F. Aragon. All rights reserved.
+ * Released under the BSD 3-Clause License (see the doc/LICENSE)
+ *
+ * Designed to be used by libraries or wrapped by some abstraction (e.g.
+ * srt_string/libsrt), not as general-purpose direct usage.
+ *
+ * Features:
+ *
+ * - NFC, NFD, NFKC, and NFKD normalization forms (UAX #15).
+ * - Full case folding (CaseFolding.txt, status C + F).
+ * - Quick check, for avoiding the normalization when the input is already
+ *   normalized (ASCII and other "safe" characters are skipped processing
+ *   one machine word per loop).
+ * - Not relies on C library nor OS Unicode support ("locale").
+ * - Compact tables, generated from the Unicode Character Database (see
+ *   utl/mk_snorm_tables.py).
+ *
+ * Observations:
+ * - Invalid UTF-8 sequences are copied as is.
+ * - Combining character sequences longer than 32 code points (i.e. not
+ *   "stream-safe" text, see UAX #15) are processed in 32 code point chunks,
+ *   so canonical ordering is not guaranteed for those cases.
+ */
+
+#include "scommon.h"
+
+enum SNormForm { SN_NFC, SN_NFD, SN_NFKC, SN_NFKD, SN_CASEFOLD };
+
+enum SNormQC { SN_QC_YES, SN_QC_MAYBE, SN_QC_NO };
+
+enum SNormQC sn_utf8_quick_check(const char *s, const size_t ss,
+				 const enum SNormForm f);
+size_t sn_utf8_normalize(const char *s, const size_t ss, char *o,
+			 const enum SNormForm f);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+#endif /* SNORM_H */
@@ -0,0 +1,3824 @@
+/*
+ * snormtbl.h
+ *
+ * Unicode 14.0.0 normalization and case folding tables
+ * (python3 utl/mk_snorm_tables.py >src/saux/snormtbl.h)
+ *
+ * Copyright (c) 2015-2018 F. Aragon. All rights reserved.
+ * Released under the BSD 3-Clause License (see the doc/LICENSE)
+ */
+
+#ifndef SNORMTBL_H
+#define SNORMTBL_H
+
+/* clang-format off */
+
+#define SN_PROP_LIMIT 0x2fa40
+#define SN_PROP_SHIFT1 4
+#define SN_PROP_SHIFT2 2
+
+#define SN_QC_THR_NFC 0xcc
+#define SN_QC_THR_NFD 0xc3
+#define SN_QC_THR_NFKC 0xc2
+#define SN_QC_THR_NFKD 0xc2
+#define SN_QC_THR_CASEFOLD 0xc2
+
+static const uint8_t sn_prop_s0[3049] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+	14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 26,
+	27, 28, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+	40, 41, 36, 42, 43, 44, 40, 45, 40, 46, 47, 44, 0, 48,
+	49, 50, 51, 52, 53, 54, 55, 56, 57, 0, 58, 59, 0, 60,
+	61, 62, 0, 0, 0, 0, 0, 63, 0, 64, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 66, 0, 0,
+	67, 0, 68, 0, 0, 0, 69, 70, 71, 72, 73, 74, 75, 76,
+	77, 0, 78, 79, 80, 81, 82, 83, 84, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+	103, 0, 0, 0, 0, 104, 105, 106, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	107, 108, 0, 109, 0, 0, 0, 0, 110, 111, 112, 113, 0, 114,
+	0, 115, 0, 0, 116, 117, 118, 118, 118, 119, 120, 121, 122, 123,
+	124, 118, 125, 0, 126, 127, 118, 118, 118, 118, 118, 118, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 128, 129, 130, 131, 132, 133, 134,
+	135, 0, 0, 136, 137, 138, 139, 140, 0, 0, 141, 142, 0, 143,
+	144, 145, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+	146, 146, 146, 146, 146, 146, 146, 146, 147, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 148, 148, 148, 148, 149, 150, 148, 151, 152, 153, 154, 155,
+	118, 118, 118, 118, 156, 157, 158, 159, 160, 161, 118, 162, 163, 118,
+	164, 165, 0, 0, 0, 0, 0, 0, 0, 166, 0, 0, 0, 167,
+	0, 168, 0, 0, 169, 0, 170, 171, 0, 172, 173, 0, 0, 0,
+	0, 0, 0, 0, 174, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	175, 0, 0, 176, 0, 0, 0, 0, 0, 0, 177, 0, 178, 0,
+	0, 0, 0, 0, 179, 0, 0, 180, 181, 0, 0, 182, 183, 0,
+	184, 139, 0, 185, 186, 0, 0, 187, 188, 189, 0, 0, 0, 190,
+	191, 192, 0, 0, 193, 194, 195, 0, 196, 0, 197, 0, 0, 0,
+	198, 0, 199, 0, 200, 201, 0, 202, 203, 204, 205, 0, 0, 0,
+	0, 0, 195, 0, 0, 0, 0, 206, 207, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 209, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 0, 0, 0, 0,
+	0, 211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 213,
+	214, 215, 0, 216, 0, 0, 0, 0, 0, 0, 118, 217, 218, 219,
+	220, 221, 118, 118, 118, 118, 222, 118, 118, 118, 118, 223, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 224, 0, 0, 0, 209, 0, 0, 0, 0, 0, 225, 226,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 228, 229, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 231, 232, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	233, 234, 235, 0, 236, 237, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 148, 148, 148, 148, 148, 148, 148, 148, 239,
+};
+
+static const uint16_t sn_prop_s1[3840] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 2, 2, 2, 2, 2, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+	5, 6, 7, 8, 9, 9, 10, 11, 10, 10, 12, 13, 12, 14,
+	15, 16, 15, 15, 17, 18, 17, 16, 19, 19, 19, 19, 20, 19,
+	19, 19, 19, 21, 19, 19, 22, 19, 23, 24, 25, 26, 27, 19,
+	21, 19, 19, 19, 19, 21, 19, 19, 19, 19, 28, 24, 29, 30,
+	1, 31, 32, 30, 33, 32, 21, 30, 34, 35, 36, 37, 33, 33,
+	0, 38, 39, 40, 26, 26, 26, 41, 19, 20, 19, 19, 42, 43,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 44, 20, 19, 19,
+	19, 0, 31, 29, 37, 3, 44, 44, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 45, 45, 4, 0, 0, 0, 0, 0, 0, 0,
+	45, 46, 45, 4, 0, 0, 0, 0, 0, 0, 47, 48, 47, 49,
+	50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+	64, 65, 66, 67, 68, 69, 70, 71, 71, 71, 44, 72, 73, 74,
+	0, 75, 13, 76, 77, 2, 2, 2, 32, 2, 78, 15, 79, 0,
+	0, 0, 80, 0, 81, 82, 83, 84, 44, 44, 44, 44, 44, 44,
+	85, 86, 87, 1, 11, 88, 2, 89, 2, 2, 90, 2, 2, 2,
+	2, 2, 0, 0, 91, 0, 0, 0, 0, 0, 16, 92, 0, 18,
+	44, 44, 44, 44, 44, 20, 44, 44, 93, 71, 80, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 94, 37, 37, 34,
+	19, 20, 20, 19, 20, 19, 20, 19, 19, 21, 21, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 1, 2, 2, 2,
+	2, 2, 2, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 95, 0, 0, 96, 97, 98, 71, 99, 53, 97, 100,
+	101, 102, 103, 104, 105, 106, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 107, 0,
+	81, 18, 0, 0, 0, 0, 0, 0, 0, 0, 108, 109, 110, 111,
+	71, 112, 0, 0, 0, 0, 113, 114, 4, 0, 115, 0, 0, 0,
+	92, 116, 71, 117, 66, 117, 118, 119, 0, 0, 0, 0, 0, 0,
+	0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 121, 112, 122, 123,
+	97, 123, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 71,
+	97, 0, 0, 126, 0, 0, 0, 0, 0, 116, 127, 71, 71, 128,
+	128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	131, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 66,
+	53, 71, 71, 71, 132, 97, 121, 131, 133, 97, 134, 71, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 91, 0, 91, 135, 0, 136,
+	0, 0, 0, 137, 138, 139, 140, 140, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 141, 0, 0, 92, 142, 0, 143, 0, 144, 0, 0,
+	0, 0, 0, 0, 0, 145, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 146, 147, 0, 148, 0, 0, 0, 137, 0, 0,
+	149, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 148, 0, 0,
+	0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 150, 142, 0, 151, 0, 152, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 153, 0, 0, 81, 142, 0, 143, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 135, 137, 0, 154, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 155, 92, 156, 137, 0, 157,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158, 159, 0, 0,
+	160, 143, 0, 0, 161, 162, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0,
+	163, 0, 0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6, 0, 165, 0, 0, 0, 166, 0, 0, 0, 0, 46,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+	167, 0, 0, 0, 0, 0, 0, 168, 169, 0, 146, 0, 0, 170,
+	147, 146, 0, 171, 0, 0, 170, 0, 172, 173, 174, 175, 176, 177,
+	0, 0, 146, 0, 0, 170, 147, 146, 0, 171, 0, 0, 170, 0,
+	0, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 0, 153,
+	0, 179, 180, 0, 0, 0, 0, 126, 0, 0, 0, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 32, 0, 34, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+	0, 0, 181, 182, 182, 182, 182, 183, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 182, 182, 182, 182, 182, 182, 184, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2, 185, 0, 0, 0, 0, 0, 186, 0, 0, 0, 0,
+	0, 0, 0, 187, 0, 0, 0, 0, 0, 0, 188, 0, 0, 189,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 0,
+	0, 0, 0, 125, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 187, 0, 0, 0, 0, 128,
+	71, 193, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	71, 131, 67, 194, 112, 61, 97, 195, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 161, 115, 115, 161, 0, 0, 0,
+	0, 0, 0, 0, 0, 196, 92, 91, 16, 187, 0, 0, 0, 0,
+	0, 0, 0, 0, 125, 61, 71, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 198, 0, 0, 197, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179,
+	0, 0, 2, 2, 33, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 1, 0, 0, 0, 0, 195, 199, 64, 53, 200, 59,
+	201, 126, 0, 139, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9, 45, 45, 9, 45, 45, 45, 45, 202, 45, 45,
+	45, 45, 45, 45, 9, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+	0, 0, 6, 45, 45, 45, 45, 45, 45, 45, 45, 45, 97, 71,
+	97, 203, 204, 71, 71, 71, 71, 71, 71, 71, 71, 205, 206, 207,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 208, 209, 80, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 21, 44, 15, 15, 10, 10, 15, 210, 10, 211,
+	15, 15, 10, 10, 15, 15, 10, 10, 15, 210, 10, 211, 19, 19,
+	212, 212, 15, 15, 10, 10, 213, 213, 213, 214, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 215, 76, 216, 217, 218, 76,
+	219, 220, 221, 222, 216, 223, 221, 208, 216, 224, 222, 76, 219, 225,
+	226, 45, 9, 0, 227, 6, 0, 0, 0, 9, 0, 6, 6, 228,
+	0, 5, 0, 6, 46, 0, 0, 6, 0, 6, 0, 0, 0, 0,
+	46, 45, 45, 45, 45, 45, 45, 9, 45, 45, 45, 4, 0, 0,
+	4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 229, 71, 230, 139,
+	189, 231, 232, 53, 139, 0, 0, 0, 45, 114, 114, 45, 45, 233,
+	114, 46, 9, 234, 235, 202, 236, 45, 202, 45, 4, 114, 46, 0,
+	45, 45, 45, 45, 237, 237, 237, 237, 45, 45, 45, 45, 238, 0,
+	227, 0, 0, 0, 81, 0, 0, 0, 0, 161, 0, 0, 0, 0,
+	0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 135, 91, 135, 0, 0, 0, 0, 0, 115, 0, 202,
+	4, 0, 0, 0, 91, 150, 91, 0, 0, 0, 0, 0, 115, 0,
+	0, 17, 210, 210, 210, 0, 210, 210, 210, 0, 0, 0, 0, 0,
+	0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 15, 0, 81, 210, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 240,
+	237, 237, 237, 237, 237, 237, 45, 45, 45, 45, 45, 45, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 171, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 30, 241, 37, 1, 44, 34, 0, 242,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 238, 243,
+	244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6, 0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0,
+	71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0,
+	0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 245, 246,
+	0, 73, 9, 0, 0, 0, 0, 115, 115, 115, 115, 115, 115, 247,
+	91, 0, 16, 156, 248, 210, 0, 0, 0, 0, 0, 135, 249, 250,
+	0, 0, 0, 115, 115, 115, 115, 115, 115, 247, 91, 0, 16, 156,
+	248, 210, 0, 0, 0, 0, 0, 150, 18, 251, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 114, 45, 45, 45, 45, 45,
+	45, 9, 7, 45, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+	45, 45, 45, 45, 45, 45, 45, 9, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 9, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	44, 93, 0, 71, 71, 129, 44, 44, 44, 44, 44, 44, 44, 252,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 80, 44, 44, 44, 80, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 4, 0, 37, 29,
+	44, 44, 238, 34, 44, 80, 44, 44, 44, 44, 30, 3, 2, 44,
+	44, 44, 44, 2, 34, 0, 33, 80, 33, 0, 0, 0, 0, 0,
+	7, 253, 46, 0, 0, 188, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 187, 0, 0, 0, 0, 0, 187, 0, 0, 0, 0, 0, 0,
+	71, 71, 71, 71, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 254, 167, 0, 0, 0, 0, 0, 0, 0, 0,
+	158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 0, 0, 0,
+	187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 256, 139, 116, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+	0, 0, 227, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 137, 0, 0, 0, 0, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0,
+	0, 0, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+	140, 140, 140, 140, 140, 140, 140, 152, 257, 149, 140, 258, 257, 239,
+	259, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+	140, 140, 140, 152, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+	152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 237, 260, 0, 0,
+	95, 237, 0, 261, 45, 45, 262, 140, 140, 258, 140, 257, 144, 263,
+	140, 264, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 46, 0,
+	0, 0, 0, 0, 0, 0, 6, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 46, 0, 0, 0, 0, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 7, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 45, 4, 0, 0,
+	0, 0, 45, 45, 46, 0, 71, 66, 53, 64, 45, 45, 45, 45,
+	45, 265, 45, 45, 9, 45, 45, 45, 45, 9, 45, 0, 9, 228,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 4, 114, 45, 45, 45, 45, 45, 45, 45, 266, 237,
+	237, 237, 237, 237, 267, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 9, 7, 45, 7, 45, 7, 45,
+	7, 4, 45, 9, 45, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0,
+	0, 0, 0, 0, 0, 0, 192, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116,
+	195, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 2, 3, 2, 2, 2, 3, 2,
+	3, 185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 202,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 228, 45, 9, 0,
+	0, 0, 0, 268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	269, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 270, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 125, 139, 0, 0, 0, 0, 0, 271, 66, 131,
+	192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 272, 119,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 0,
+	0, 158, 0, 0, 0, 0, 0, 0, 161, 135, 0, 0, 92, 0,
+	0, 0, 273, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 143,
+	0, 81, 158, 187, 0, 0, 187, 0, 198, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 274, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 275, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 141,
+	0, 0, 92, 142, 0, 143, 0, 0, 0, 116, 71, 139, 71, 139,
+	0, 0, 188, 198, 0, 0, 0, 0, 0, 145, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 276, 0, 277, 278, 279, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 143, 0, 0, 81, 158, 148, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 279,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 274, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 276, 0, 135, 180, 179, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 187, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187,
+	0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 198, 186, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 59, 201, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 195, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 281, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 259,
+	140, 282, 283, 284, 285, 0, 254, 53, 286, 128, 99, 0, 0, 0,
+	0, 0, 0, 0, 116, 129, 0, 0, 146, 140, 171, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 139,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	45, 45, 45, 45, 45, 228, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 228, 73, 233, 114, 228,
+	45, 45, 202, 114, 45, 114, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 202, 9, 114, 45, 228, 45, 228,
+	45, 45, 45, 45, 45, 45, 202, 9, 45, 5, 7, 45, 228, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 46, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 7, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	71, 195, 71, 71, 71, 71, 117, 71, 127, 255, 195, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 53, 286, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+	2, 2, 185, 0, 0, 0, 0, 0, 0, 0, 0, 71, 287, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 114,
+	45, 45, 45, 45, 45, 45, 233, 265, 114, 45, 9, 45, 288, 0,
+	73, 6, 288, 114, 233, 265, 288, 288, 233, 265, 9, 45, 9, 45,
+	114, 5, 45, 45, 202, 45, 45, 45, 45, 0, 114, 114, 202, 45,
+	45, 45, 45, 0, 45, 45, 9, 0, 45, 45, 45, 45, 45, 45,
+	45, 9, 45, 45, 45, 45, 45, 45, 45, 45, 0, 0, 0, 0,
+	0, 0, 7, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45,
+	4, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45,
+	46, 0, 140, 140, 140, 140, 140, 140, 140, 152, 0, 0, 0, 0,
+	0, 0, 0, 0,
+};
+
+static const uint16_t sn_prop_s2[1156] = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0000, 0x2800, 0x0000,
+	0x0000, 0x0000, 0x2800, 0x0000, 0x2800, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2800, 0x0000, 0x0000, 0x2800, 0x2800, 0x2800, 0x6800, 0x0000, 0x0000,
+	0x2800, 0x2800, 0x2800, 0x0000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000,
+	0x7000, 0x4000, 0x7000, 0x4000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000,
+	0x7000, 0x0000, 0x7000, 0x7000, 0x4000, 0x4000, 0x3000, 0x3000, 0x3000,
+	0x3000, 0x3000, 0x3000, 0x0000, 0x3000, 0x0000, 0x3000, 0x3000, 0x3000,
+	0x3000, 0x3000, 0x3000, 0x0000, 0x7000, 0x3000, 0x7000, 0x3000, 0x4000,
+	0x0000, 0x7000, 0x3000, 0x7000, 0x3000, 0x4000, 0x0000, 0x7000, 0x0000,
+	0x6800, 0x2800, 0x0000, 0x7000, 0x3000, 0x7000, 0x3000, 0x7000, 0x3000,
+	0x6800, 0x2800, 0x4000, 0x0000, 0x7000, 0x3000, 0x7000, 0x3000, 0x7000,
+	0x3000, 0x6800, 0x4000, 0x0000, 0x7000, 0x7000, 0x3000, 0x7000, 0x0000,
+	0x4000, 0x4000, 0x0000, 0x4000, 0x0000, 0x4000, 0x4000, 0x0000, 0x0000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x0000, 0x4000, 0x4000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x4000, 0x0000, 0x0000, 0x4000, 0x0000, 0x4000, 0x7000,
+	0x3000, 0x4000, 0x4000, 0x4000, 0x0000, 0x4000, 0x0000, 0x4000, 0x6800,
+	0x6800, 0x2800, 0x6800, 0x6800, 0x2800, 0x6800, 0x6800, 0x2800, 0x7000,
+	0x3000, 0x7000, 0x3000, 0x0000, 0x7000, 0x3000, 0x7000, 0x6800, 0x6800,
+	0x2800, 0x7000, 0x3000, 0x4000, 0x4000, 0x4000, 0x0000, 0x4000, 0x0000,
+	0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x0000, 0x0000, 0x05e6,
+	0x05e6, 0x05e6, 0x05e6, 0x05e6, 0x00e6, 0x05e6, 0x05e6, 0x05e6, 0x00e6,
+	0x00e6, 0x05e6, 0x00e6, 0x05e6, 0x00e6, 0x05e6, 0x05e6, 0x00e8, 0x00dc,
+	0x00dc, 0x00dc, 0x00dc, 0x00e8, 0x05d8, 0x00dc, 0x00dc, 0x00dc, 0x00dc,
+	0x00dc, 0x00ca, 0x00ca, 0x05dc, 0x05dc, 0x05dc, 0x05dc, 0x05ca, 0x05ca,
+	0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x05dc, 0x05dc, 0x00dc, 0x05dc, 0x05dc,
+	0x00dc, 0x00dc, 0x0001, 0x0001, 0x0001, 0x0001, 0x0501, 0x00dc, 0x00dc,
+	0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x3ae6, 0x3ae6, 0x05e6, 0x3ae6,
+	0x3ae6, 0x45f0, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6,
+	0x00dc, 0x00dc, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc,
+	0x00dc, 0x00e6, 0x00e8, 0x00dc, 0x00dc, 0x00e6, 0x00e9, 0x00ea, 0x00ea,
+	0x00e9, 0x00ea, 0x00ea, 0x00e9, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+	0x3a00, 0x0000, 0x4000, 0x0000, 0x0000, 0x0000, 0x2800, 0x0000, 0x0000,
+	0x0000, 0x3a00, 0x4000, 0x2800, 0x3800, 0x7000, 0x3a00, 0x7000, 0x0000,
+	0x7000, 0x7000, 0x7000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x7000,
+	0x7000, 0x7000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4000, 0x0000,
+	0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x4000, 0x6800,
+	0x6800, 0x2800, 0x3800, 0x3800, 0x6800, 0x6800, 0x0000, 0x6800, 0x6800,
+	0x2800, 0x0000, 0x6800, 0x6800, 0x0000, 0x4000, 0x0000, 0x6800, 0x4000,
+	0x0000, 0x4000, 0x4000, 0x4000, 0x7000, 0x7000, 0x7000, 0x7000, 0x4000,
+	0x4000, 0x7000, 0x4000, 0x4000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x3000, 0x4000, 0x0000, 0x0000, 0x00e6, 0x4000, 0x7000,
+	0x3000, 0x4000, 0x0000, 0x0000, 0x0000, 0x6800, 0x0000, 0x00dc, 0x00e6,
+	0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00de, 0x00dc,
+	0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00e6, 0x00de, 0x00e4, 0x00e6, 0x000a,
+	0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013,
+	0x0013, 0x0014, 0x0015, 0x0016, 0x0000, 0x0017, 0x0000, 0x0018, 0x0019,
+	0x0000, 0x00e6, 0x00dc, 0x0000, 0x0012, 0x001e, 0x001f, 0x0020, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020,
+	0x0021, 0x0022, 0x05e6, 0x05e6, 0x05dc, 0x00dc, 0x00e6, 0x00dc, 0x00e6,
+	0x00e6, 0x00dc, 0x0023, 0x0000, 0x0000, 0x0000, 0x0000, 0x2800, 0x2800,
+	0x2800, 0x3000, 0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6,
+	0x00e6, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x00dc, 0x00e6, 0x00e6,
+	0x00dc, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x00e6, 0x00dc,
+	0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00e6, 0x00dc, 0x00dc, 0x00e6, 0x00dc,
+	0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6,
+	0x0000, 0x00dc, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x0000,
+	0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x00dc,
+	0x00dc, 0x00dc, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x0000,
+	0x00dc, 0x001b, 0x001c, 0x001d, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00e6,
+	0x3000, 0x0000, 0x0000, 0x0000, 0x0507, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0009, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x0000,
+	0x0000, 0x0000, 0x3a00, 0x3a00, 0x3a00, 0x3a00, 0x0007, 0x0000, 0x0500,
+	0x0000, 0x3000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0500,
+	0x3a00, 0x3a00, 0x0000, 0x3a00, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x3a00, 0x0000, 0x0000, 0x3a00, 0x0000, 0x0007, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x3a00, 0x3a00, 0x3a00, 0x3000, 0x0000, 0x0000,
+	0x3000, 0x0000, 0x0000, 0x0500, 0x0500, 0x3a00, 0x3a00, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0500, 0x0000, 0x0000, 0x0054, 0x055b, 0x0000, 0x3000,
+	0x0000, 0x0500, 0x0000, 0x3000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0500,
+	0x0500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0500,
+	0x0000, 0x0000, 0x0000, 0x0509, 0x0000, 0x0000, 0x0000, 0x3000, 0x0000,
+	0x3000, 0x3000, 0x3000, 0x0500, 0x0067, 0x0067, 0x0009, 0x0000, 0x006b,
+	0x006b, 0x006b, 0x006b, 0x0076, 0x0076, 0x0009, 0x0000, 0x007a, 0x007a,
+	0x007a, 0x007a, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000,
+	0x00dc, 0x0000, 0x00d8, 0x0000, 0x0000, 0x0000, 0x3a00, 0x0000, 0x0000,
+	0x3a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0081, 0x0082, 0x3a00, 0x0084,
+	0x3a00, 0x3a00, 0x2800, 0x3a00, 0x2800, 0x0082, 0x0082, 0x0082, 0x0082,
+	0x0000, 0x0000, 0x0082, 0x3a00, 0x00e6, 0x00e6, 0x0009, 0x0000, 0x00e6,
+	0x00e6, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+	0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0500, 0x0500, 0x0500, 0x0500,
+	0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0000, 0x0000, 0x0500, 0x0500,
+	0x0500, 0x0000, 0x4000, 0x4000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000,
+	0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+	0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x00e4, 0x0000, 0x0000, 0x0000,
+	0x00de, 0x00e6, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000,
+	0x0000, 0x00dc, 0x00e6, 0x00dc, 0x0000, 0x00dc, 0x00e6, 0x00e6, 0x00e6,
+	0x0000, 0x0007, 0x0500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009,
+	0x0000, 0x0000, 0x0007, 0x0000, 0x0001, 0x00dc, 0x00dc, 0x00dc, 0x00e6,
+	0x0000, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x2800, 0x2800,
+	0x0000, 0x2800, 0x00e6, 0x00ea, 0x00d6, 0x00dc, 0x00ca, 0x00e6, 0x00e6,
+	0x00e6, 0x00e6, 0x00e6, 0x00e8, 0x00e4, 0x00e4, 0x00dc, 0x00da, 0x00e6,
+	0x00e9, 0x00dc, 0x00e6, 0x00dc, 0x7000, 0x3000, 0x7000, 0x7000, 0x7000,
+	0x7000, 0x6800, 0x7800, 0x3000, 0x3000, 0x0000, 0x0000, 0x7000, 0x7000,
+	0x0000, 0x0000, 0x0000, 0x7000, 0x0000, 0x7000, 0x3000, 0x3a00, 0x3000,
+	0x3a00, 0x3000, 0x3a00, 0x0000, 0x0000, 0x3000, 0x3000, 0x7000, 0x7000,
+	0x7000, 0x7000, 0x7000, 0x7a00, 0x7000, 0x2800, 0x7a00, 0x2800, 0x2800,
+	0x3800, 0x7000, 0x7000, 0x7000, 0x7a00, 0x7000, 0x7a00, 0x7000, 0x3800,
+	0x3800, 0x3800, 0x3000, 0x3000, 0x7000, 0x7a00, 0x0000, 0x0000, 0x7000,
+	0x7000, 0x0000, 0x3800, 0x3800, 0x3800, 0x7000, 0x3800, 0x3a00, 0x3a00,
+	0x7000, 0x3a00, 0x2800, 0x0000, 0x3a00, 0x3a00, 0x2800, 0x2800, 0x0000,
+	0x2800, 0x0000, 0x0000, 0x2800, 0x0000, 0x2800, 0x2800, 0x00e6, 0x00e6,
+	0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00e6, 0x0000, 0x0001, 0x0001,
+	0x00e6, 0x00dc, 0x00e6, 0x0001, 0x0001, 0x0000, 0x2800, 0x2800, 0x0000,
+	0x2800, 0x0000, 0x7a00, 0x0000, 0x2800, 0x0000, 0x7a00, 0x7a00, 0x2800,
+	0x2800, 0x4000, 0x2800, 0x6800, 0x6800, 0x6800, 0x6800, 0x0000, 0x0000,
+	0x0000, 0x4000, 0x0000, 0x3a00, 0x3a00, 0x0000, 0x2800, 0x2800, 0x6800,
+	0x6800, 0x4000, 0x0000, 0x0000, 0x4000, 0x2800, 0x2800, 0x4000, 0x4000,
+	0x0000, 0x4000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x4000, 0x0000, 0x0000,
+	0x0000, 0x00da, 0x00e4, 0x00e8, 0x00de, 0x00e0, 0x00e0, 0x0000, 0x3000,
+	0x0000, 0x3000, 0x0000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0508, 0x0508,
+	0x2800, 0x2800, 0x0000, 0x3000, 0x2800, 0x0000, 0x0000, 0x3000, 0x2800,
+	0x2800, 0x2800, 0x00e6, 0x00e6, 0x2800, 0x4000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x00dc, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00dc, 0x0000,
+	0x0000, 0x00e6, 0x3a00, 0x0000, 0x3a00, 0x0000, 0x3a00, 0x3a00, 0x3a00,
+	0x0000, 0x0000, 0x0000, 0x3a00, 0x3a00, 0x6800, 0x6800, 0x6800, 0x0000,
+	0x0000, 0x3a00, 0x001a, 0x3a00, 0x2800, 0x2800, 0x3a00, 0x3a00, 0x3a00,
+	0x0000, 0x3a00, 0x3a00, 0x3a00, 0x3a00, 0x3a00, 0x2800, 0x2800, 0x0000,
+	0x0000, 0x2800, 0x2800, 0x6800, 0x6800, 0x6800, 0x6800, 0x6800, 0x6800,
+	0x2800, 0x0000, 0x00dc, 0x0000, 0x00e6, 0x00e6, 0x0001, 0x00dc, 0x0000,
+	0x0000, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x0000,
+	0x0000, 0x00e6, 0x00dc, 0x0000, 0x0009, 0x0507, 0x0000, 0x0000, 0x0009,
+	0x0007, 0x0000, 0x0000, 0x0007, 0x0009, 0x0000, 0x0500, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0500, 0x3000, 0x3000, 0x0500, 0x3000, 0x0000,
+	0x0000, 0x0000, 0x0009, 0x0007, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0001, 0x0000, 0x3a00, 0x00d8, 0x00d8, 0x0001, 0x0001, 0x0001,
+	0x0000, 0x0000, 0x0000, 0x00e2, 0x00d8, 0x00d8, 0x00d8, 0x00d8, 0x00d8,
+	0x0000, 0x00dc, 0x00dc, 0x00dc, 0x0000, 0x00e6, 0x00e6, 0x0007, 0x0000,
+	0x0000, 0x2800, 0x0000, 0x2800,
+};
+
+static const uint16_t sn_pool[8494] = {
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+	0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072,
+	0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0020,
+	0x0020, 0x0308, 0x0020, 0x0304, 0x0032, 0x0033, 0x0020, 0x0301, 0x03bc,
+	0x0020, 0x0327, 0x0031, 0x0031, 0x2044, 0x0034, 0x0031, 0x2044, 0x0032,
+	0x0033, 0x2044, 0x0034, 0x00e0, 0x0041, 0x0300, 0x00e1, 0x0041, 0x0301,
+	0x00e2, 0x0041, 0x0302, 0x00e3, 0x0041, 0x0303, 0x00e4, 0x0041, 0x0308,
+	0x00e5, 0x0041, 0x030a, 0x00e6, 0x00e7, 0x0043, 0x0327, 0x00e8, 0x0045,
+	0x0300, 0x00e9, 0x0045, 0x0301, 0x00ea, 0x0045, 0x0302, 0x00eb, 0x0045,
+	0x0308, 0x00ec, 0x0049, 0x0300, 0x00ed, 0x0049, 0x0301, 0x00ee, 0x0049,
+	0x0302, 0x00ef, 0x0049, 0x0308, 0x00f0, 0x00f1, 0x004e, 0x0303, 0x00f2,
+	0x004f, 0x0300, 0x00f3, 0x004f, 0x0301, 0x00f4, 0x004f, 0x0302, 0x00f5,
+	0x004f, 0x0303, 0x00f6, 0x004f, 0x0308, 0x00f8, 0x00f9, 0x0055, 0x0300,
+	0x00fa, 0x0055, 0x0301, 0x00fb, 0x0055, 0x0302, 0x00fc, 0x0055, 0x0308,
+	0x00fd, 0x0059, 0x0301, 0x00fe, 0x0073, 0x0073, 0x0061, 0x0300, 0x0061,
+	0x0301, 0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030a,
+	0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302, 0x0065,
+	0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069, 0x0308,
+	0x006e, 0x0303, 0x006f, 0x0300, 0x006f, 0x0301, 0x006f, 0x0302, 0x006f,
+	0x0303, 0x006f, 0x0308, 0x0075, 0x0300, 0x0075, 0x0301, 0x0075, 0x0302,
+	0x0075, 0x0308, 0x0079, 0x0301, 0x0079, 0x0308, 0x0101, 0x0041, 0x0304,
+	0x0061, 0x0304, 0x0103, 0x0041, 0x0306, 0x0061, 0x0306, 0x0105, 0x0041,
+	0x0328, 0x0061, 0x0328, 0x0107, 0x0043, 0x0301, 0x0063, 0x0301, 0x0109,
+	0x0043, 0x0302, 0x0063, 0x0302, 0x010b, 0x0043, 0x0307, 0x0063, 0x0307,
+	0x010d, 0x0043, 0x030c, 0x0063, 0x030c, 0x010f, 0x0044, 0x030c, 0x0064,
+	0x030c, 0x0111, 0x0113, 0x0045, 0x0304, 0x0065, 0x0304, 0x0115, 0x0045,
+	0x0306, 0x0065, 0x0306, 0x0117, 0x0045, 0x0307, 0x0065, 0x0307, 0x0119,
+	0x0045, 0x0328, 0x0065, 0x0328, 0x011b, 0x0045, 0x030c, 0x0065, 0x030c,
+	0x011d, 0x0047, 0x0302, 0x0067, 0x0302, 0x011f, 0x0047, 0x0306, 0x0067,
+	0x0306, 0x0121, 0x0047, 0x0307, 0x0067, 0x0307, 0x0123, 0x0047, 0x0327,
+	0x0067, 0x0327, 0x0125, 0x0048, 0x0302, 0x0068, 0x0302, 0x0127, 0x0129,
+	0x0049, 0x0303, 0x0069, 0x0303, 0x012b, 0x0049, 0x0304, 0x0069, 0x0304,
+	0x012d, 0x0049, 0x0306, 0x0069, 0x0306, 0x012f, 0x0049, 0x0328, 0x0069,
+	0x0328, 0x0069, 0x0307, 0x0049, 0x0307, 0x0133, 0x0049, 0x004a, 0x0069,
+	0x006a, 0x0135, 0x004a, 0x0302, 0x006a, 0x0302, 0x0137, 0x004b, 0x0327,
+	0x006b, 0x0327, 0x013a, 0x004c, 0x0301, 0x006c, 0x0301, 0x013c, 0x004c,
+	0x0327, 0x006c, 0x0327, 0x013e, 0x004c, 0x030c, 0x006c, 0x030c, 0x0140,
+	0x004c, 0x00b7, 0x006c, 0x00b7, 0x0142, 0x0144, 0x004e, 0x0301, 0x006e,
+	0x0301, 0x0146, 0x004e, 0x0327, 0x006e, 0x0327, 0x0148, 0x004e, 0x030c,
+	0x006e, 0x030c, 0x02bc, 0x006e, 0x014b, 0x014d, 0x004f, 0x0304, 0x006f,
+	0x0304, 0x014f, 0x004f, 0x0306, 0x006f, 0x0306, 0x0151, 0x004f, 0x030b,
+	0x006f, 0x030b, 0x0153, 0x0155, 0x0052, 0x0301, 0x0072, 0x0301, 0x0157,
+	0x0052, 0x0327, 0x0072, 0x0327, 0x0159, 0x0052, 0x030c, 0x0072, 0x030c,
+	0x015b, 0x0053, 0x0301, 0x0073, 0x0301, 0x015d, 0x0053, 0x0302, 0x0073,
+	0x0302, 0x015f, 0x0053, 0x0327, 0x0073, 0x0327, 0x0161, 0x0053, 0x030c,
+	0x0073, 0x030c, 0x0163, 0x0054, 0x0327, 0x0074, 0x0327, 0x0165, 0x0054,
+	0x030c, 0x0074, 0x030c, 0x0167, 0x0169, 0x0055, 0x0303, 0x0075, 0x0303,
+	0x016b, 0x0055, 0x0304, 0x0075, 0x0304, 0x016d, 0x0055, 0x0306, 0x0075,
+	0x0306, 0x016f, 0x0055, 0x030a, 0x0075, 0x030a, 0x0171, 0x0055, 0x030b,
+	0x0075, 0x030b, 0x0173, 0x0055, 0x0328, 0x0075, 0x0328, 0x0175, 0x0057,
+	0x0302, 0x0077, 0x0302, 0x0177, 0x0059, 0x0302, 0x0079, 0x0302, 0x00ff,
+	0x0059, 0x0308, 0x017a, 0x005a, 0x0301, 0x007a, 0x0301, 0x017c, 0x005a,
+	0x0307, 0x007a, 0x0307, 0x017e, 0x005a, 0x030c, 0x007a, 0x030c, 0x0253,
+	0x0183, 0x0185, 0x0254, 0x0188, 0x0256, 0x0257, 0x018c, 0x01dd, 0x0259,
+	0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f, 0x0272,
+	0x0275, 0x01a1, 0x004f, 0x031b, 0x006f, 0x031b, 0x01a3, 0x01a5, 0x0280,
+	0x01a8, 0x0283, 0x01ad, 0x0288, 0x01b0, 0x0055, 0x031b, 0x0075, 0x031b,
+	0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292, 0x01b9, 0x01bd, 0x01c6, 0x0044,
+	0x005a, 0x030c, 0x0044, 0x007a, 0x030c, 0x0064, 0x007a, 0x030c, 0x01c9,
+	0x004c, 0x004a, 0x004c, 0x006a, 0x006c, 0x006a, 0x01cc, 0x004e, 0x004a,
+	0x004e, 0x006a, 0x006e, 0x006a, 0x01ce, 0x0041, 0x030c, 0x0061, 0x030c,
+	0x01d0, 0x0049, 0x030c, 0x0069, 0x030c, 0x01d2, 0x004f, 0x030c, 0x006f,
+	0x030c, 0x01d4, 0x0055, 0x030c, 0x0075, 0x030c, 0x01d6, 0x0055, 0x0308,
+	0x0304, 0x0075, 0x0308, 0x0304, 0x01d8, 0x0055, 0x0308, 0x0301, 0x0075,
+	0x0308, 0x0301, 0x01da, 0x0055, 0x0308, 0x030c, 0x0075, 0x0308, 0x030c,
+	0x01dc, 0x0055, 0x0308, 0x0300, 0x0075, 0x0308, 0x0300, 0x01df, 0x0041,
+	0x0308, 0x0304, 0x0061, 0x0308, 0x0304, 0x01e1, 0x0041, 0x0307, 0x0304,
+	0x0061, 0x0307, 0x0304, 0x01e3, 0x00c6, 0x0304, 0x00e6, 0x0304, 0x01e5,
+	0x01e7, 0x0047, 0x030c, 0x0067, 0x030c, 0x01e9, 0x004b, 0x030c, 0x006b,
+	0x030c, 0x01eb, 0x004f, 0x0328, 0x006f, 0x0328, 0x01ed, 0x004f, 0x0328,
+	0x0304, 0x006f, 0x0328, 0x0304, 0x01ef, 0x01b7, 0x030c, 0x0292, 0x030c,
+	0x006a, 0x030c, 0x01f3, 0x0044, 0x005a, 0x0044, 0x007a, 0x0064, 0x007a,
+	0x01f5, 0x0047, 0x0301, 0x0067, 0x0301, 0x0195, 0x01bf, 0x01f9, 0x004e,
+	0x0300, 0x006e, 0x0300, 0x01fb, 0x0041, 0x030a, 0x0301, 0x0061, 0x030a,
+	0x0301, 0x01fd, 0x00c6, 0x0301, 0x00e6, 0x0301, 0x01ff, 0x00d8, 0x0301,
+	0x00f8, 0x0301, 0x0201, 0x0041, 0x030f, 0x0061, 0x030f, 0x0203, 0x0041,
+	0x0311, 0x0061, 0x0311, 0x0205, 0x0045, 0x030f, 0x0065, 0x030f, 0x0207,
+	0x0045, 0x0311, 0x0065, 0x0311, 0x0209, 0x0049, 0x030f, 0x0069, 0x030f,
+	0x020b, 0x0049, 0x0311, 0x0069, 0x0311, 0x020d, 0x004f, 0x030f, 0x006f,
+	0x030f, 0x020f, 0x004f, 0x0311, 0x006f, 0x0311, 0x0211, 0x0052, 0x030f,
+	0x0072, 0x030f, 0x0213, 0x0052, 0x0311, 0x0072, 0x0311, 0x0215, 0x0055,
+	0x030f, 0x0075, 0x030f, 0x0217, 0x0055, 0x0311, 0x0075, 0x0311, 0x0219,
+	0x0053, 0x0326, 0x0073, 0x0326, 0x021b, 0x0054, 0x0326, 0x0074, 0x0326,
+	0x021d, 0x021f, 0x0048, 0x030c, 0x0068, 0x030c, 0x019e, 0x0223, 0x0225,
+	0x0227, 0x0041, 0x0307, 0x0061, 0x0307, 0x0229, 0x0045, 0x0327, 0x0065,
+	0x0327, 0x022b, 0x004f, 0x0308, 0x0304, 0x006f, 0x0308, 0x0304, 0x022d,
+	0x004f, 0x0303, 0x0304, 0x006f, 0x0303, 0x0304, 0x022f, 0x004f, 0x0307,
+	0x006f, 0x0307, 0x0231, 0x004f, 0x0307, 0x0304, 0x006f, 0x0307, 0x0304,
+	0x0233, 0x0059, 0x0304, 0x0079, 0x0304, 0x2c65, 0x023c, 0x019a, 0x2c66,
+	0x0242, 0x0180, 0x0289, 0x028c, 0x0247, 0x0249, 0x024b, 0x024d, 0x024f,
+	0x0266, 0x0279, 0x027b, 0x0281, 0x0020, 0x0306, 0x0020, 0x0307, 0x0020,
+	0x030a, 0x0020, 0x0328, 0x0020, 0x0303, 0x0020, 0x030b, 0x0295, 0x0300,
+	0x0301, 0x0313, 0x0308, 0x0301, 0x03b9, 0x0371, 0x0373, 0x02b9, 0x0377,
+	0x0020, 0x0345, 0x003b, 0x03f3, 0x00a8, 0x0301, 0x0020, 0x0308, 0x0301,
+	0x03ac, 0x0391, 0x0301, 0x00b7, 0x03ad, 0x0395, 0x0301, 0x03ae, 0x0397,
+	0x0301, 0x03af, 0x0399, 0x0301, 0x03cc, 0x039f, 0x0301, 0x03cd, 0x03a5,
+	0x0301, 0x03ce, 0x03a9, 0x0301, 0x03b9, 0x0308, 0x0301, 0x03b1, 0x03b2,
+	0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03ba, 0x03bb, 0x03bd,
+	0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+	0x03c8, 0x03c9, 0x03ca, 0x0399, 0x0308, 0x03cb, 0x03a5, 0x0308, 0x03b1,
+	0x0301, 0x03b5, 0x0301, 0x03b7, 0x0301, 0x03b9, 0x0301, 0x03c5, 0x0308,
+	0x0301, 0x03b9, 0x0308, 0x03c5, 0x0308, 0x03bf, 0x0301, 0x03c5, 0x0301,
+	0x03c9, 0x0301, 0x03d7, 0x03a5, 0x03d2, 0x0301, 0x03d2, 0x0308, 0x03d9,
+	0x03db, 0x03dd, 0x03df, 0x03e1, 0x03e3, 0x03e5, 0x03e7, 0x03e9, 0x03eb,
+	0x03ed, 0x03ef, 0x03c2, 0x0398, 0x03f8, 0x03f2, 0x03a3, 0x03fb, 0x037b,
+	0x037c, 0x037d, 0x0450, 0x0415, 0x0300, 0x0451, 0x0415, 0x0308, 0x0452,
+	0x0453, 0x0413, 0x0301, 0x0454, 0x0455, 0x0456, 0x0457, 0x0406, 0x0308,
+	0x0458, 0x0459, 0x045a, 0x045b, 0x045c, 0x041a, 0x0301, 0x045d, 0x0418,
+	0x0300, 0x045e, 0x0423, 0x0306, 0x045f, 0x0430, 0x0431, 0x0432, 0x0433,
+	0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x0418, 0x0306, 0x043a,
+	0x043b, 0x043c, 0x043d, 0x043e, 0x043f, 0x0440, 0x0441, 0x0442, 0x0443,
+	0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044a, 0x044b, 0x044c,
+	0x044d, 0x044e, 0x044f, 0x0438, 0x0306, 0x0435, 0x0300, 0x0435, 0x0308,
+	0x0433, 0x0301, 0x0456, 0x0308, 0x043a, 0x0301, 0x0438, 0x0300, 0x0443,
+	0x0306, 0x0461, 0x0463, 0x0465, 0x0467, 0x0469, 0x046b, 0x046d, 0x046f,
+	0x0471, 0x0473, 0x0475, 0x0477, 0x0474, 0x030f, 0x0475, 0x030f, 0x0479,
+	0x047b, 0x047d, 0x047f, 0x0481, 0x048b, 0x048d, 0x048f, 0x0491, 0x0493,
+	0x0495, 0x0497, 0x0499, 0x049b, 0x049d, 0x049f, 0x04a1, 0x04a3, 0x04a5,
+	0x04a7, 0x04a9, 0x04ab, 0x04ad, 0x04af, 0x04b1, 0x04b3, 0x04b5, 0x04b7,
+	0x04b9, 0x04bb, 0x04bd, 0x04bf, 0x04cf, 0x04c2, 0x0416, 0x0306, 0x0436,
+	0x0306, 0x04c4, 0x04c6, 0x04c8, 0x04ca, 0x04cc, 0x04ce, 0x04d1, 0x0410,
+	0x0306, 0x0430, 0x0306, 0x04d3, 0x0410, 0x0308, 0x0430, 0x0308, 0x04d5,
+	0x04d7, 0x0415, 0x0306, 0x0435, 0x0306, 0x04d9, 0x04db, 0x04d8, 0x0308,
+	0x04d9, 0x0308, 0x04dd, 0x0416, 0x0308, 0x0436, 0x0308, 0x04df, 0x0417,
+	0x0308, 0x0437, 0x0308, 0x04e1, 0x04e3, 0x0418, 0x0304, 0x0438, 0x0304,
+	0x04e5, 0x0418, 0x0308, 0x0438, 0x0308, 0x04e7, 0x041e, 0x0308, 0x043e,
+	0x0308, 0x04e9, 0x04eb, 0x04e8, 0x0308, 0x04e9, 0x0308, 0x04ed, 0x042d,
+	0x0308, 0x044d, 0x0308, 0x04ef, 0x0423, 0x0304, 0x0443, 0x0304, 0x04f1,
+	0x0423, 0x0308, 0x0443, 0x0308, 0x04f3, 0x0423, 0x030b, 0x0443, 0x030b,
+	0x04f5, 0x0427, 0x0308, 0x0447, 0x0308, 0x04f7, 0x04f9, 0x042b, 0x0308,
+	0x044b, 0x0308, 0x04fb, 0x04fd, 0x04ff, 0x0501, 0x0503, 0x0505, 0x0507,
+	0x0509, 0x050b, 0x050d, 0x050f, 0x0511, 0x0513, 0x0515, 0x0517, 0x0519,
+	0x051b, 0x051d, 0x051f, 0x0521, 0x0523, 0x0525, 0x0527, 0x0529, 0x052b,
+	0x052d, 0x052f, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+	0x0568, 0x0569, 0x056a, 0x056b, 0x056c, 0x056d, 0x056e, 0x056f, 0x0570,
+	0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579,
+	0x057a, 0x057b, 0x057c, 0x057d, 0x057e, 0x057f, 0x0580, 0x0581, 0x0582,
+	0x0583, 0x0584, 0x0585, 0x0586, 0x0565, 0x0582, 0x0627, 0x0653, 0x0627,
+	0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064a, 0x0654, 0x0627, 0x0674,
+	0x0648, 0x0674, 0x06c7, 0x0674, 0x064a, 0x0674, 0x06d5, 0x0654, 0x06c1,
+	0x0654, 0x06d2, 0x0654, 0x0928, 0x093c, 0x0930, 0x093c, 0x0933, 0x093c,
+	0x0915, 0x093c, 0x0916, 0x093c, 0x0917, 0x093c, 0x091c, 0x093c, 0x0921,
+	0x093c, 0x0922, 0x093c, 0x092b, 0x093c, 0x092f, 0x093c, 0x09c7, 0x09be,
+	0x09c7, 0x09d7, 0x09a1, 0x09bc, 0x09a2, 0x09bc, 0x09af, 0x09bc, 0x0a32,
+	0x0a3c, 0x0a38, 0x0a3c, 0x0a16, 0x0a3c, 0x0a17, 0x0a3c, 0x0a1c, 0x0a3c,
+	0x0a2b, 0x0a3c, 0x0b47, 0x0b56, 0x0b47, 0x0b3e, 0x0b47, 0x0b57, 0x0b21,
+	0x0b3c, 0x0b22, 0x0b3c, 0x0b92, 0x0bd7, 0x0bc6, 0x0bbe, 0x0bc7, 0x0bbe,
+	0x0bc6, 0x0bd7, 0x0c46, 0x0c56, 0x0cbf, 0x0cd5, 0x0cc6, 0x0cd5, 0x0cc6,
+	0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2, 0x0cd5, 0x0d46, 0x0d3e, 0x0d47,
+	0x0d3e, 0x0d46, 0x0d57, 0x0dd9, 0x0dca, 0x0dd9, 0x0dcf, 0x0dd9, 0x0dcf,
+	0x0dca, 0x0dd9, 0x0ddf, 0x0e4d, 0x0e32, 0x0ecd, 0x0eb2, 0x0eab, 0x0e99,
+	0x0eab, 0x0ea1, 0x0f0b, 0x0f42, 0x0fb7, 0x0f4c, 0x0fb7, 0x0f51, 0x0fb7,
+	0x0f56, 0x0fb7, 0x0f5b, 0x0fb7, 0x0f40, 0x0fb5, 0x0f71, 0x0f72, 0x0f71,
+	0x0f74, 0x0fb2, 0x0f80, 0x0fb2, 0x0f71, 0x0f80, 0x0fb3, 0x0f80, 0x0fb3,
+	0x0f71, 0x0f80, 0x0f71, 0x0f80, 0x0f92, 0x0fb7, 0x0f9c, 0x0fb7, 0x0fa1,
+	0x0fb7, 0x0fa6, 0x0fb7, 0x0fab, 0x0fb7, 0x0f90, 0x0fb5, 0x1025, 0x102e,
+	0x2d00, 0x2d01, 0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06, 0x2d07, 0x2d08,
+	0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d, 0x2d0e, 0x2d0f, 0x2d10, 0x2d11,
+	0x2d12, 0x2d13, 0x2d14, 0x2d15, 0x2d16, 0x2d17, 0x2d18, 0x2d19, 0x2d1a,
+	0x2d1b, 0x2d1c, 0x2d1d, 0x2d1e, 0x2d1f, 0x2d20, 0x2d21, 0x2d22, 0x2d23,
+	0x2d24, 0x2d25, 0x2d27, 0x2d2d, 0x10dc, 0x13f0, 0x13f1, 0x13f2, 0x13f3,
+	0x13f4, 0x13f5, 0x1b05, 0x1b35, 0x1b07, 0x1b35, 0x1b09, 0x1b35, 0x1b0b,
+	0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35, 0x1b3a, 0x1b35, 0x1b3c, 0x1b35,
+	0x1b3e, 0x1b35, 0x1b3f, 0x1b35, 0x1b42, 0x1b35, 0xa64b, 0x10d0, 0x10d1,
+	0x10d2, 0x10d3, 0x10d4, 0x10d5, 0x10d6, 0x10d7, 0x10d8, 0x10d9, 0x10da,
+	0x10db, 0x10dd, 0x10de, 0x10df, 0x10e0, 0x10e1, 0x10e2, 0x10e3, 0x10e4,
+	0x10e5, 0x10e6, 0x10e7, 0x10e8, 0x10e9, 0x10ea, 0x10eb, 0x10ec, 0x10ed,
+	0x10ee, 0x10ef, 0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4, 0x10f5, 0x10f6,
+	0x10f7, 0x10f8, 0x10f9, 0x10fa, 0x10fd, 0x10fe, 0x10ff, 0x0041, 0x00c6,
+	0x0042, 0x0044, 0x0045, 0x018e, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b,
+	0x004c, 0x004d, 0x004e, 0x004f, 0x0222, 0x0050, 0x0052, 0x0054, 0x0055,
+	0x0057, 0x0250, 0x0251, 0x1d02, 0x025c, 0x1d16, 0x1d17, 0x1d1d, 0x1d25,
+	0x0252, 0x0255, 0x025f, 0x0261, 0x0265, 0x026a, 0x1d7b, 0x029d, 0x026d,
+	0x1d85, 0x029f, 0x0271, 0x0270, 0x0273, 0x0274, 0x0278, 0x0282, 0x01ab,
+	0x1d1c, 0x0290, 0x0291, 0x1e01, 0x0041, 0x0325, 0x0061, 0x0325, 0x1e03,
+	0x0042, 0x0307, 0x0062, 0x0307, 0x1e05, 0x0042, 0x0323, 0x0062, 0x0323,
+	0x1e07, 0x0042, 0x0331, 0x0062, 0x0331, 0x1e09, 0x0043, 0x0327, 0x0301,
+	0x0063, 0x0327, 0x0301, 0x1e0b, 0x0044, 0x0307, 0x0064, 0x0307, 0x1e0d,
+	0x0044, 0x0323, 0x0064, 0x0323, 0x1e0f, 0x0044, 0x0331, 0x0064, 0x0331,
+	0x1e11, 0x0044, 0x0327, 0x0064, 0x0327, 0x1e13, 0x0044, 0x032d, 0x0064,
+	0x032d, 0x1e15, 0x0045, 0x0304, 0x0300, 0x0065, 0x0304, 0x0300, 0x1e17,
+	0x0045, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301, 0x1e19, 0x0045, 0x032d,
+	0x0065, 0x032d, 0x1e1b, 0x0045, 0x0330, 0x0065, 0x0330, 0x1e1d, 0x0045,
+	0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x1e1f, 0x0046, 0x0307, 0x0066,
+	0x0307, 0x1e21, 0x0047, 0x0304, 0x0067, 0x0304, 0x1e23, 0x0048, 0x0307,
+	0x0068, 0x0307, 0x1e25, 0x0048, 0x0323, 0x0068, 0x0323, 0x1e27, 0x0048,
+	0x0308, 0x0068, 0x0308, 0x1e29, 0x0048, 0x0327, 0x0068, 0x0327, 0x1e2b,
+	0x0048, 0x032e, 0x0068, 0x032e, 0x1e2d, 0x0049, 0x0330, 0x0069, 0x0330,
+	0x1e2f, 0x0049, 0x0308, 0x0301, 0x0069, 0x0308, 0x0301, 0x1e31, 0x004b,
+	0x0301, 0x006b, 0x0301, 0x1e33, 0x004b, 0x0323, 0x006b, 0x0323, 0x1e35,
+	0x004b, 0x0331, 0x006b, 0x0331, 0x1e37, 0x004c, 0x0323, 0x006c, 0x0323,
+	0x1e39, 0x004c, 0x0323, 0x0304, 0x006c, 0x0323, 0x0304, 0x1e3b, 0x004c,
+	0x0331, 0x006c, 0x0331, 0x1e3d, 0x004c, 0x032d, 0x006c, 0x032d, 0x1e3f,
+	0x004d, 0x0301, 0x006d, 0x0301, 0x1e41, 0x004d, 0x0307, 0x006d, 0x0307,
+	0x1e43, 0x004d, 0x0323, 0x006d, 0x0323, 0x1e45, 0x004e, 0x0307, 0x006e,
+	0x0307, 0x1e47, 0x004e, 0x0323, 0x006e, 0x0323, 0x1e49, 0x004e, 0x0331,
+	0x006e, 0x0331, 0x1e4b, 0x004e, 0x032d, 0x006e, 0x032d, 0x1e4d, 0x004f,
+	0x0303, 0x0301, 0x006f, 0x0303, 0x0301, 0x1e4f, 0x004f, 0x0303, 0x0308,
+	0x006f, 0x0303, 0x0308, 0x1e51, 0x004f, 0x0304, 0x0300, 0x006f, 0x0304,
+	0x0300, 0x1e53, 0x004f, 0x0304, 0x0301, 0x006f, 0x0304, 0x0301, 0x1e55,
+	0x0050, 0x0301, 0x0070, 0x0301, 0x1e57, 0x0050, 0x0307, 0x0070, 0x0307,
+	0x1e59, 0x0052, 0x0307, 0x0072, 0x0307, 0x1e5b, 0x0052, 0x0323, 0x0072,
+	0x0323, 0x1e5d, 0x0052, 0x0323, 0x0304, 0x0072, 0x0323, 0x0304, 0x1e5f,
+	0x0052, 0x0331, 0x0072, 0x0331, 0x1e61, 0x0053, 0x0307, 0x0073, 0x0307,
+	0x1e63, 0x0053, 0x0323, 0x0073, 0x0323, 0x1e65, 0x0053, 0x0301, 0x0307,
+	0x0073, 0x0301, 0x0307, 0x1e67, 0x0053, 0x030c, 0x0307, 0x0073, 0x030c,
+	0x0307, 0x1e69, 0x0053, 0x0323, 0x0307, 0x0073, 0x0323, 0x0307, 0x1e6b,
+	0x0054, 0x0307, 0x0074, 0x0307, 0x1e6d, 0x0054, 0x0323, 0x0074, 0x0323,
+	0x1e6f, 0x0054, 0x0331, 0x0074, 0x0331, 0x1e71, 0x0054, 0x032d, 0x0074,
+	0x032d, 0x1e73, 0x0055, 0x0324, 0x0075, 0x0324, 0x1e75, 0x0055, 0x0330,
+	0x0075, 0x0330, 0x1e77, 0x0055, 0x032d, 0x0075, 0x032d, 0x1e79, 0x0055,
+	0x0303, 0x0301, 0x0075, 0x0303, 0x0301, 0x1e7b, 0x0055, 0x0304, 0x0308,
+	0x0075, 0x0304, 0x0308, 0x1e7d, 0x0056, 0x0303, 0x0076, 0x0303, 0x1e7f,
+	0x0056, 0x0323, 0x0076, 0x0323, 0x1e81, 0x0057, 0x0300, 0x0077, 0x0300,
+	0x1e83, 0x0057, 0x0301, 0x0077, 0x0301, 0x1e85, 0x0057, 0x0308, 0x0077,
+	0x0308, 0x1e87, 0x0057, 0x0307, 0x0077, 0x0307, 0x1e89, 0x0057, 0x0323,
+	0x0077, 0x0323, 0x1e8b, 0x0058, 0x0307, 0x0078, 0x0307, 0x1e8d, 0x0058,
+	0x0308, 0x0078, 0x0308, 0x1e8f, 0x0059, 0x0307, 0x0079, 0x0307, 0x1e91,
+	0x005a, 0x0302, 0x007a, 0x0302, 0x1e93, 0x005a, 0x0323, 0x007a, 0x0323,
+	0x1e95, 0x005a, 0x0331, 0x007a, 0x0331, 0x0068, 0x0331, 0x0074, 0x0308,
+	0x0077, 0x030a, 0x0079, 0x030a, 0x0061, 0x02be, 0x017f, 0x0307, 0x1ea1,
+	0x0041, 0x0323, 0x0061, 0x0323, 0x1ea3, 0x0041, 0x0309, 0x0061, 0x0309,
+	0x1ea5, 0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x1ea7, 0x0041,
+	0x0302, 0x0300, 0x0061, 0x0302, 0x0300, 0x1ea9, 0x0041, 0x0302, 0x0309,
+	0x0061, 0x0302, 0x0309, 0x1eab, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302,
+	0x0303, 0x1ead, 0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x1eaf,
+	0x0041, 0x0306, 0x0301, 0x0061, 0x0306, 0x0301, 0x1eb1, 0x0041, 0x0306,
+	0x0300, 0x0061, 0x0306, 0x0300, 0x1eb3, 0x0041, 0x0306, 0x0309, 0x0061,
+	0x0306, 0x0309, 0x1eb5, 0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303,
+	0x1eb7, 0x0041, 0x0323, 0x0306, 0x0061, 0x0323, 0x0306, 0x1eb9, 0x0045,
+	0x0323, 0x0065, 0x0323, 0x1ebb, 0x0045, 0x0309, 0x0065, 0x0309, 0x1ebd,
+	0x0045, 0x0303, 0x0065, 0x0303, 0x1ebf, 0x0045, 0x0302, 0x0301, 0x0065,
+	0x0302, 0x0301, 0x1ec1, 0x0045, 0x0302, 0x0300, 0x0065, 0x0302, 0x0300,
+	0x1ec3, 0x0045, 0x0302, 0x0309, 0x0065, 0x0302, 0x0309, 0x1ec5, 0x0045,
+	0x0302, 0x0303, 0x0065, 0x0302, 0x0303, 0x1ec7, 0x0045, 0x0323, 0x0302,
+	0x0065, 0x0323, 0x0302, 0x1ec9, 0x0049, 0x0309, 0x0069, 0x0309, 0x1ecb,
+	0x0049, 0x0323, 0x0069, 0x0323, 0x1ecd, 0x004f, 0x0323, 0x006f, 0x0323,
+	0x1ecf, 0x004f, 0x0309, 0x006f, 0x0309, 0x1ed1, 0x004f, 0x0302, 0x0301,
+	0x006f, 0x0302, 0x0301, 0x1ed3, 0x004f, 0x0302, 0x0300, 0x006f, 0x0302,
+	0x0300, 0x1ed5, 0x004f, 0x0302, 0x0309, 0x006f, 0x0302, 0x0309, 0x1ed7,
+	0x004f, 0x0302, 0x0303, 0x006f, 0x0302, 0x0303, 0x1ed9, 0x004f, 0x0323,
+	0x0302, 0x006f, 0x0323, 0x0302, 0x1edb, 0x004f, 0x031b, 0x0301, 0x006f,
+	0x031b, 0x0301, 0x1edd, 0x004f, 0x031b, 0x0300, 0x006f, 0x031b, 0x0300,
+	0x1edf, 0x004f, 0x031b, 0x0309, 0x006f, 0x031b, 0x0309, 0x1ee1, 0x004f,
+	0x031b, 0x0303, 0x006f, 0x031b, 0x0303, 0x1ee3, 0x004f, 0x031b, 0x0323,
+	0x006f, 0x031b, 0x0323, 0x1ee5, 0x0055, 0x0323, 0x0075, 0x0323, 0x1ee7,
+	0x0055, 0x0309, 0x0075, 0x0309, 0x1ee9, 0x0055, 0x031b, 0x0301, 0x0075,
+	0x031b, 0x0301, 0x1eeb, 0x0055, 0x031b, 0x0300, 0x0075, 0x031b, 0x0300,
+	0x1eed, 0x0055, 0x031b, 0x0309, 0x0075, 0x031b, 0x0309, 0x1eef, 0x0055,
+	0x031b, 0x0303, 0x0075, 0x031b, 0x0303, 0x1ef1, 0x0055, 0x031b, 0x0323,
+	0x0075, 0x031b, 0x0323, 0x1ef3, 0x0059, 0x0300, 0x0079, 0x0300, 0x1ef5,
+	0x0059, 0x0323, 0x0079, 0x0323, 0x1ef7, 0x0059, 0x0309, 0x0079, 0x0309,
+	0x1ef9, 0x0059, 0x0303, 0x0079, 0x0303, 0x1efb, 0x1efd, 0x1eff, 0x03b1,
+	0x0313, 0x03b1, 0x0314, 0x03b1, 0x0313, 0x0300, 0x03b1, 0x0314, 0x0300,
+	0x03b1, 0x0313, 0x0301, 0x03b1, 0x0314, 0x0301, 0x03b1, 0x0313, 0x0342,
+	0x03b1, 0x0314, 0x0342, 0x1f00, 0x0391, 0x0313, 0x1f01, 0x0391, 0x0314,
+	0x1f02, 0x0391, 0x0313, 0x0300, 0x1f03, 0x0391, 0x0314, 0x0300, 0x1f04,
+	0x0391, 0x0313, 0x0301, 0x1f05, 0x0391, 0x0314, 0x0301, 0x1f06, 0x0391,
+	0x0313, 0x0342, 0x1f07, 0x0391, 0x0314, 0x0342, 0x03b5, 0x0313, 0x03b5,
+	0x0314, 0x03b5, 0x0313, 0x0300, 0x03b5, 0x0314, 0x0300, 0x03b5, 0x0313,
+	0x0301, 0x03b5, 0x0314, 0x0301, 0x1f10, 0x0395, 0x0313, 0x1f11, 0x0395,
+	0x0314, 0x1f12, 0x0395, 0x0313, 0x0300, 0x1f13, 0x0395, 0x0314, 0x0300,
+	0x1f14, 0x0395, 0x0313, 0x0301, 0x1f15, 0x0395, 0x0314, 0x0301, 0x03b7,
+	0x0313, 0x03b7, 0x0314, 0x03b7, 0x0313, 0x0300, 0x03b7, 0x0314, 0x0300,
+	0x03b7, 0x0313, 0x0301, 0x03b7, 0x0314, 0x0301, 0x03b7, 0x0313, 0x0342,
+	0x03b7, 0x0314, 0x0342, 0x1f20, 0x0397, 0x0313, 0x1f21, 0x0397, 0x0314,
+	0x1f22, 0x0397, 0x0313, 0x0300, 0x1f23, 0x0397, 0x0314, 0x0300, 0x1f24,
+	0x0397, 0x0313, 0x0301, 0x1f25, 0x0397, 0x0314, 0x0301, 0x1f26, 0x0397,
+	0x0313, 0x0342, 0x1f27, 0x0397, 0x0314, 0x0342, 0x03b9, 0x0313, 0x03b9,
+	0x0314, 0x03b9, 0x0313, 0x0300, 0x03b9, 0x0314, 0x0300, 0x03b9, 0x0313,
+	0x0301, 0x03b9, 0x0314, 0x0301, 0x03b9, 0x0313, 0x0342, 0x03b9, 0x0314,
+	0x0342, 0x1f30, 0x0399, 0x0313, 0x1f31, 0x0399, 0x0314, 0x1f32, 0x0399,
+	0x0313, 0x0300, 0x1f33, 0x0399, 0x0314, 0x0300, 0x1f34, 0x0399, 0x0313,
+	0x0301, 0x1f35, 0x0399, 0x0314, 0x0301, 0x1f36, 0x0399, 0x0313, 0x0342,
+	0x1f37, 0x0399, 0x0314, 0x0342, 0x03bf, 0x0313, 0x03bf, 0x0314, 0x03bf,
+	0x0313, 0x0300, 0x03bf, 0x0314, 0x0300, 0x03bf, 0x0313, 0x0301, 0x03bf,
+	0x0314, 0x0301, 0x1f40, 0x039f, 0x0313, 0x1f41, 0x039f, 0x0314, 0x1f42,
+	0x039f, 0x0313, 0x0300, 0x1f43, 0x039f, 0x0314, 0x0300, 0x1f44, 0x039f,
+	0x0313, 0x0301, 0x1f45, 0x039f, 0x0314, 0x0301, 0x03c5, 0x0313, 0x03c5,
+	0x0314, 0x03c5, 0x0313, 0x0300, 0x03c5, 0x0314, 0x0300, 0x03c5, 0x0313,
+	0x0301, 0x03c5, 0x0314, 0x0301, 0x03c5, 0x0313, 0x0342, 0x03c5, 0x0314,
+	0x0342, 0x1f51, 0x03a5, 0x0314, 0x1f53, 0x03a5, 0x0314, 0x0300, 0x1f55,
+	0x03a5, 0x0314, 0x0301, 0x1f57, 0x03a5, 0x0314, 0x0342, 0x03c9, 0x0313,
+	0x03c9, 0x0314, 0x03c9, 0x0313, 0x0300, 0x03c9, 0x0314, 0x0300, 0x03c9,
+	0x0313, 0x0301, 0x03c9, 0x0314, 0x0301, 0x03c9, 0x0313, 0x0342, 0x03c9,
+	0x0314, 0x0342, 0x1f60, 0x03a9, 0x0313, 0x1f61, 0x03a9, 0x0314, 0x1f62,
+	0x03a9, 0x0313, 0x0300, 0x1f63, 0x03a9, 0x0314, 0x0300, 0x1f64, 0x03a9,
+	0x0313, 0x0301, 0x1f65, 0x03a9, 0x0314, 0x0301, 0x1f66, 0x03a9, 0x0313,
+	0x0342, 0x1f67, 0x03a9, 0x0314, 0x0342, 0x03b1, 0x0300, 0x03b5, 0x0300,
+	0x03b7, 0x0300, 0x03b9, 0x0300, 0x03bf, 0x0300, 0x03c5, 0x0300, 0x03c9,
+	0x0300, 0x1f00, 0x03b9, 0x03b1, 0x0313, 0x0345, 0x1f01, 0x03b9, 0x03b1,
+	0x0314, 0x0345, 0x1f02, 0x03b9, 0x03b1, 0x0313, 0x0300, 0x0345, 0x1f03,
+	0x03b9, 0x03b1, 0x0314, 0x0300, 0x0345, 0x1f04, 0x03b9, 0x03b1, 0x0313,
+	0x0301, 0x0345, 0x1f05, 0x03b9, 0x03b1, 0x0314, 0x0301, 0x0345, 0x1f06,
+	0x03b9, 0x03b1, 0x0313, 0x0342, 0x0345, 0x1f07, 0x03b9, 0x03b1, 0x0314,
+	0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314, 0x0345, 0x0391,
+	0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300, 0x0345, 0x0391, 0x0313,
+	0x0301, 0x0345, 0x0391, 0x0314, 0x0301, 0x0345, 0x0391, 0x0313, 0x0342,
+	0x0345, 0x0391, 0x0314, 0x0342, 0x0345, 0x1f20, 0x03b9, 0x03b7, 0x0313,
+	0x0345, 0x1f21, 0x03b9, 0x03b7, 0x0314, 0x0345, 0x1f22, 0x03b9, 0x03b7,
+	0x0313, 0x0300, 0x0345, 0x1f23, 0x03b9, 0x03b7, 0x0314, 0x0300, 0x0345,
+	0x1f24, 0x03b9, 0x03b7, 0x0313, 0x0301, 0x0345, 0x1f25, 0x03b9, 0x03b7,
+	0x0314, 0x0301, 0x0345, 0x1f26, 0x03b9, 0x03b7, 0x0313, 0x0342, 0x0345,
+	0x1f27, 0x03b9, 0x03b7, 0x0314, 0x0342, 0x0345, 0x0397, 0x0313, 0x0345,
+	0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300, 0x0345, 0x0397, 0x0314,
+	0x0300, 0x0345, 0x0397, 0x0313, 0x0301, 0x0345, 0x0397, 0x0314, 0x0301,
+	0x0345, 0x0397, 0x0313, 0x0342, 0x0345, 0x0397, 0x0314, 0x0342, 0x0345,
+	0x1f60, 0x03b9, 0x03c9, 0x0313, 0x0345, 0x1f61, 0x03b9, 0x03c9, 0x0314,
+	0x0345, 0x1f62, 0x03b9, 0x03c9, 0x0313, 0x0300, 0x0345, 0x1f63, 0x03b9,
+	0x03c9, 0x0314, 0x0300, 0x0345, 0x1f64, 0x03b9, 0x03c9, 0x0313, 0x0301,
+	0x0345, 0x1f65, 0x03b9, 0x03c9, 0x0314, 0x0301, 0x0345, 0x1f66, 0x03b9,
+	0x03c9, 0x0313, 0x0342, 0x0345, 0x1f67, 0x03b9, 0x03c9, 0x0314, 0x0342,
+	0x0345, 0x03a9, 0x0313, 0x0345, 0x03a9, 0x0314, 0x0345, 0x03a9, 0x0313,
+	0x0300, 0x0345, 0x03a9, 0x0314, 0x0300, 0x0345, 0x03a9, 0x0313, 0x0301,
+	0x0345, 0x03a9, 0x0314, 0x0301, 0x0345, 0x03a9, 0x0313, 0x0342, 0x0345,
+	0x03a9, 0x0314, 0x0342, 0x0345, 0x03b1, 0x0306, 0x03b1, 0x0304, 0x1f70,
+	0x03b9, 0x03b1, 0x0300, 0x0345, 0x03b1, 0x03b9, 0x03b1, 0x0345, 0x03ac,
+	0x03b9, 0x03b1, 0x0301, 0x0345, 0x03b1, 0x0342, 0x03b1, 0x0342, 0x03b9,
+	0x03b1, 0x0342, 0x0345, 0x1fb0, 0x0391, 0x0306, 0x1fb1, 0x0391, 0x0304,
+	0x1f70, 0x0391, 0x0300, 0x1f71, 0x0391, 0x0345, 0x0020, 0x0313, 0x0020,
+	0x0342, 0x00a8, 0x0342, 0x0020, 0x0308, 0x0342, 0x1f74, 0x03b9, 0x03b7,
+	0x0300, 0x0345, 0x03b7, 0x03b9, 0x03b7, 0x0345, 0x03ae, 0x03b9, 0x03b7,
+	0x0301, 0x0345, 0x03b7, 0x0342, 0x03b7, 0x0342, 0x03b9, 0x03b7, 0x0342,
+	0x0345, 0x1f72, 0x0395, 0x0300, 0x1f73, 0x1f74, 0x0397, 0x0300, 0x1f75,
+	0x0397, 0x0345, 0x1fbf, 0x0300, 0x0020, 0x0313, 0x0300, 0x1fbf, 0x0301,
+	0x0020, 0x0313, 0x0301, 0x1fbf, 0x0342, 0x0020, 0x0313, 0x0342, 0x03b9,
+	0x0306, 0x03b9, 0x0304, 0x03b9, 0x0308, 0x0300, 0x03b9, 0x0342, 0x03b9,
+	0x0308, 0x0342, 0x1fd0, 0x0399, 0x0306, 0x1fd1, 0x0399, 0x0304, 0x1f76,
+	0x0399, 0x0300, 0x1f77, 0x1ffe, 0x0300, 0x0020, 0x0314, 0x0300, 0x1ffe,
+	0x0301, 0x0020, 0x0314, 0x0301, 0x1ffe, 0x0342, 0x0020, 0x0314, 0x0342,
+	0x03c5, 0x0306, 0x03c5, 0x0304, 0x03c5, 0x0308, 0x0300, 0x03c1, 0x0313,
+	0x03c1, 0x0314, 0x03c5, 0x0342, 0x03c5, 0x0308, 0x0342, 0x1fe0, 0x03a5,
+	0x0306, 0x1fe1, 0x03a5, 0x0304, 0x1f7a, 0x03a5, 0x0300, 0x1f7b, 0x1fe5,
+	0x03a1, 0x0314, 0x00a8, 0x0300, 0x0020, 0x0308, 0x0300, 0x0060, 0x1f7c,
+	0x03b9, 0x03c9, 0x0300, 0x0345, 0x03c9, 0x03b9, 0x03c9, 0x0345, 0x03ce,
+	0x03b9, 0x03c9, 0x0301, 0x0345, 0x03c9, 0x0342, 0x03c9, 0x0342, 0x03b9,
+	0x03c9, 0x0342, 0x0345, 0x1f78, 0x039f, 0x0300, 0x1f79, 0x1f7c, 0x03a9,
+	0x0300, 0x1f7d, 0x03a9, 0x0345, 0x00b4, 0x0020, 0x0314, 0x2002, 0x2003,
+	0x2010, 0x0020, 0x0333, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e,
+	0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035,
+	0x2035, 0x0021, 0x0021, 0x0020, 0x0305, 0x003f, 0x003f, 0x003f, 0x0021,
+	0x0021, 0x003f, 0x2032, 0x2032, 0x2032, 0x2032, 0x0030, 0x0034, 0x0035,
+	0x0036, 0x0037, 0x0038, 0x0039, 0x002b, 0x2212, 0x003d, 0x0028, 0x0029,
+	0x0052, 0x0073, 0x0061, 0x002f, 0x0063, 0x0061, 0x002f, 0x0073, 0x0043,
+	0x00b0, 0x0043, 0x0063, 0x002f, 0x006f, 0x0063, 0x002f, 0x0075, 0x0190,
+	0x00b0, 0x0046, 0x004e, 0x006f, 0x0051, 0x0053, 0x004d, 0x0054, 0x0045,
+	0x004c, 0x0054, 0x004d, 0x005a, 0x03a9, 0x0046, 0x214e, 0x05d0, 0x05d1,
+	0x05d2, 0x05d3, 0x0046, 0x0041, 0x0058, 0x0393, 0x03a0, 0x2211, 0x0031,
+	0x2044, 0x0037, 0x0031, 0x2044, 0x0039, 0x0031, 0x2044, 0x0031, 0x0030,
+	0x0031, 0x2044, 0x0033, 0x0032, 0x2044, 0x0033, 0x0031, 0x2044, 0x0035,
+	0x0032, 0x2044, 0x0035, 0x0033, 0x2044, 0x0035, 0x0034, 0x2044, 0x0035,
+	0x0031, 0x2044, 0x0036, 0x0035, 0x2044, 0x0036, 0x0031, 0x2044, 0x0038,
+	0x0033, 0x2044, 0x0038, 0x0035, 0x2044, 0x0038, 0x0037, 0x2044, 0x0038,
+	0x0031, 0x2044, 0x2170, 0x2171, 0x0049, 0x0049, 0x2172, 0x0049, 0x0049,
+	0x0049, 0x2173, 0x0049, 0x0056, 0x2174, 0x0056, 0x2175, 0x0056, 0x0049,
+	0x2176, 0x0056, 0x0049, 0x0049, 0x2177, 0x0056, 0x0049, 0x0049, 0x0049,
+	0x2178, 0x0049, 0x0058, 0x2179, 0x0058, 0x217a, 0x0058, 0x0049, 0x217b,
+	0x0058, 0x0049, 0x0049, 0x217c, 0x217d, 0x217e, 0x217f, 0x0069, 0x0069,
+	0x0069, 0x0069, 0x0069, 0x0069, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069,
+	0x0069, 0x0076, 0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078, 0x0069,
+	0x0078, 0x0069, 0x0069, 0x2184, 0x0030, 0x2044, 0x0033, 0x2190, 0x0338,
+	0x2192, 0x0338, 0x2194, 0x0338, 0x21d0, 0x0338, 0x21d4, 0x0338, 0x21d2,
+	0x0338, 0x2203, 0x0338, 0x2208, 0x0338, 0x220b, 0x0338, 0x2223, 0x0338,
+	0x2225, 0x0338, 0x222b, 0x222b, 0x222b, 0x222b, 0x222b, 0x222e, 0x222e,
+	0x222e, 0x222e, 0x222e, 0x223c, 0x0338, 0x2243, 0x0338, 0x2245, 0x0338,
+	0x2248, 0x0338, 0x003d, 0x0338, 0x2261, 0x0338, 0x224d, 0x0338, 0x003c,
+	0x0338, 0x003e, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338,
+	0x2273, 0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227a, 0x0338, 0x227b,
+	0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287, 0x0338,
+	0x22a2, 0x0338, 0x22a8, 0x0338, 0x22a9, 0x0338, 0x22ab, 0x0338, 0x227c,
+	0x0338, 0x227d, 0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22b2, 0x0338,
+	0x22b3, 0x0338, 0x22b4, 0x0338, 0x22b5, 0x0338, 0x3008, 0x3009, 0x0031,
+	0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0033, 0x0031, 0x0034,
+	0x0031, 0x0035, 0x0031, 0x0036, 0x0031, 0x0037, 0x0031, 0x0038, 0x0031,
+	0x0039, 0x0032, 0x0030, 0x0028, 0x0031, 0x0029, 0x0028, 0x0032, 0x0029,
+	0x0028, 0x0033, 0x0029, 0x0028, 0x0034, 0x0029, 0x0028, 0x0035, 0x0029,
+	0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029, 0x0028, 0x0038, 0x0029,
+	0x0028, 0x0039, 0x0029, 0x0028, 0x0031, 0x0030, 0x0029, 0x0028, 0x0031,
+	0x0031, 0x0029, 0x0028, 0x0031, 0x0032, 0x0029, 0x0028, 0x0031, 0x0033,
+	0x0029, 0x0028, 0x0031, 0x0034, 0x0029, 0x0028, 0x0031, 0x0035, 0x0029,
+	0x0028, 0x0031, 0x0036, 0x0029, 0x0028, 0x0031, 0x0037, 0x0029, 0x0028,
+	0x0031, 0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032,
+	0x0030, 0x0029, 0x0031, 0x002e, 0x0032, 0x002e, 0x0033, 0x002e, 0x0034,
+	0x002e, 0x0035, 0x002e, 0x0036, 0x002e, 0x0037, 0x002e, 0x0038, 0x002e,
+	0x0039, 0x002e, 0x0031, 0x0030, 0x002e, 0x0031, 0x0031, 0x002e, 0x0031,
+	0x0032, 0x002e, 0x0031, 0x0033, 0x002e, 0x0031, 0x0034, 0x002e, 0x0031,
+	0x0035, 0x002e, 0x0031, 0x0036, 0x002e, 0x0031, 0x0037, 0x002e, 0x0031,
+	0x0038, 0x002e, 0x0031, 0x0039, 0x002e, 0x0032, 0x0030, 0x002e, 0x0028,
+	0x0061, 0x0029, 0x0028, 0x0062, 0x0029, 0x0028, 0x0063, 0x0029, 0x0028,
+	0x0064, 0x0029, 0x0028, 0x0065, 0x0029, 0x0028, 0x0066, 0x0029, 0x0028,
+	0x0067, 0x0029, 0x0028, 0x0068, 0x0029, 0x0028, 0x0069, 0x0029, 0x0028,
+	0x006a, 0x0029, 0x0028, 0x006b, 0x0029, 0x0028, 0x006c, 0x0029, 0x0028,
+	0x006d, 0x0029, 0x0028, 0x006e, 0x0029, 0x0028, 0x006f, 0x0029, 0x0028,
+	0x0070, 0x0029, 0x0028, 0x0071, 0x0029, 0x0028, 0x0072, 0x0029, 0x0028,
+	0x0073, 0x0029, 0x0028, 0x0074, 0x0029, 0x0028, 0x0075, 0x0029, 0x0028,
+	0x0076, 0x0029, 0x0028, 0x0077, 0x0029, 0x0028, 0x0078, 0x0029, 0x0028,
+	0x0079, 0x0029, 0x0028, 0x007a, 0x0029, 0x24d0, 0x24d1, 0x24d2, 0x24d3,
+	0x24d4, 0x24d5, 0x24d6, 0x24d7, 0x24d8, 0x24d9, 0x24da, 0x24db, 0x24dc,
+	0x24dd, 0x24de, 0x24df, 0x24e0, 0x24e1, 0x24e2, 0x0053, 0x24e3, 0x24e4,
+	0x24e5, 0x24e6, 0x24e7, 0x24e8, 0x0059, 0x24e9, 0x222b, 0x222b, 0x222b,
+	0x222b, 0x003a, 0x003a, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d,
+	0x2add, 0x0338, 0x2c30, 0x2c31, 0x2c32, 0x2c33, 0x2c34, 0x2c35, 0x2c36,
+	0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3b, 0x2c3c, 0x2c3d, 0x2c3e, 0x2c3f,
+	0x2c40, 0x2c41, 0x2c42, 0x2c43, 0x2c44, 0x2c45, 0x2c46, 0x2c47, 0x2c48,
+	0x2c49, 0x2c4a, 0x2c4b, 0x2c4c, 0x2c4d, 0x2c4e, 0x2c4f, 0x2c50, 0x2c51,
+	0x2c52, 0x2c53, 0x2c54, 0x2c55, 0x2c56, 0x2c57, 0x2c58, 0x2c59, 0x2c5a,
+	0x2c5b, 0x2c5c, 0x2c5d, 0x2c5e, 0x2c5f, 0x2c61, 0x026b, 0x1d7d, 0x027d,
+	0x2c68, 0x2c6a, 0x2c6c, 0x2c73, 0x2c76, 0x023f, 0x0240, 0x2c81, 0x2c83,
+	0x2c85, 0x2c87, 0x2c89, 0x2c8b, 0x2c8d, 0x2c8f, 0x2c91, 0x2c93, 0x2c95,
+	0x2c97, 0x2c99, 0x2c9b, 0x2c9d, 0x2c9f, 0x2ca1, 0x2ca3, 0x2ca5, 0x2ca7,
+	0x2ca9, 0x2cab, 0x2cad, 0x2caf, 0x2cb1, 0x2cb3, 0x2cb5, 0x2cb7, 0x2cb9,
+	0x2cbb, 0x2cbd, 0x2cbf, 0x2cc1, 0x2cc3, 0x2cc5, 0x2cc7, 0x2cc9, 0x2ccb,
+	0x2ccd, 0x2ccf, 0x2cd1, 0x2cd3, 0x2cd5, 0x2cd7, 0x2cd9, 0x2cdb, 0x2cdd,
+	0x2cdf, 0x2ce1, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3, 0x2d61, 0x6bcd, 0x9f9f,
+	0x4e00, 0x4e28, 0x4e36, 0x4e3f, 0x4e59, 0x4e85, 0x4e8c, 0x4ea0, 0x4eba,
+	0x513f, 0x5165, 0x516b, 0x5182, 0x5196, 0x51ab, 0x51e0, 0x51f5, 0x5200,
+	0x529b, 0x52f9, 0x5315, 0x531a, 0x5338, 0x5341, 0x535c, 0x5369, 0x5382,
+	0x53b6, 0x53c8, 0x53e3, 0x56d7, 0x571f, 0x58eb, 0x5902, 0x590a, 0x5915,
+	0x5927, 0x5973, 0x5b50, 0x5b80, 0x5bf8, 0x5c0f, 0x5c22, 0x5c38, 0x5c6e,
+	0x5c71, 0x5ddb, 0x5de5, 0x5df1, 0x5dfe, 0x5e72, 0x5e7a, 0x5e7f, 0x5ef4,
+	0x5efe, 0x5f0b, 0x5f13, 0x5f50, 0x5f61, 0x5f73, 0x5fc3, 0x6208, 0x6236,
+	0x624b, 0x652f, 0x6534, 0x6587, 0x6597, 0x65a4, 0x65b9, 0x65e0, 0x65e5,
+	0x66f0, 0x6708, 0x6728, 0x6b20, 0x6b62, 0x6b79, 0x6bb3, 0x6bcb, 0x6bd4,
+	0x6bdb, 0x6c0f, 0x6c14, 0x6c34, 0x706b, 0x722a, 0x7236, 0x723b, 0x723f,
+	0x7247, 0x7259, 0x725b, 0x72ac, 0x7384, 0x7389, 0x74dc, 0x74e6, 0x7518,
+	0x751f, 0x7528, 0x7530, 0x758b, 0x7592, 0x7676, 0x767d, 0x76ae, 0x76bf,
+	0x76ee, 0x77db, 0x77e2, 0x77f3, 0x793a, 0x79b8, 0x79be, 0x7a74, 0x7acb,
+	0x7af9, 0x7c73, 0x7cf8, 0x7f36, 0x7f51, 0x7f8a, 0x7fbd, 0x8001, 0x800c,
+	0x8012, 0x8033, 0x807f, 0x8089, 0x81e3, 0x81ea, 0x81f3, 0x81fc, 0x820c,
+	0x821b, 0x821f, 0x826e, 0x8272, 0x8278, 0x864d, 0x866b, 0x8840, 0x884c,
+	0x8863, 0x897e, 0x898b, 0x89d2, 0x8a00, 0x8c37, 0x8c46, 0x8c55, 0x8c78,
+	0x8c9d, 0x8d64, 0x8d70, 0x8db3, 0x8eab, 0x8eca, 0x8f9b, 0x8fb0, 0x8fb5,
+	0x9091, 0x9149, 0x91c6, 0x91cc, 0x91d1, 0x9577, 0x9580, 0x961c, 0x96b6,
+	0x96b9, 0x96e8, 0x9751, 0x975e, 0x9762, 0x9769, 0x97cb, 0x97ed, 0x97f3,
+	0x9801, 0x98a8, 0x98db, 0x98df, 0x9996, 0x9999, 0x99ac, 0x9aa8, 0x9ad8,
+	0x9adf, 0x9b25, 0x9b2f, 0x9b32, 0x9b3c, 0x9b5a, 0x9ce5, 0x9e75, 0x9e7f,
+	0x9ea5, 0x9ebb, 0x9ec3, 0x9ecd, 0x9ed1, 0x9ef9, 0x9efd, 0x9f0e, 0x9f13,
+	0x9f20, 0x9f3b, 0x9f4a, 0x9f52, 0x9f8d, 0x9f9c, 0x9fa0, 0x3012, 0x5344,
+	0x5345, 0x304b, 0x3099, 0x304d, 0x3099, 0x304f, 0x3099, 0x3051, 0x3099,
+	0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305b,
+	0x3099, 0x305d, 0x3099, 0x305f, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099,
+	0x3066, 0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f, 0x309a, 0x3072,
+	0x3099, 0x3072, 0x309a, 0x3075, 0x3099, 0x3075, 0x309a, 0x3078, 0x3099,
+	0x3078, 0x309a, 0x307b, 0x3099, 0x307b, 0x309a, 0x3046, 0x3099, 0x0020,
+	0x3099, 0x0020, 0x309a, 0x309d, 0x3099, 0x3088, 0x308a, 0x30ab, 0x3099,
+	0x30ad, 0x3099, 0x30af, 0x3099, 0x30b1, 0x3099, 0x30b3, 0x3099, 0x30b5,
+	0x3099, 0x30b7, 0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd, 0x3099,
+	0x30bf, 0x3099, 0x30c1, 0x3099, 0x30c4, 0x3099, 0x30c6, 0x3099, 0x30c8,
+	0x3099, 0x30cf, 0x3099, 0x30cf, 0x309a, 0x30d2, 0x3099, 0x30d2, 0x309a,
+	0x30d5, 0x3099, 0x30d5, 0x309a, 0x30d8, 0x3099, 0x30d8, 0x309a, 0x30db,
+	0x3099, 0x30db, 0x309a, 0x30a6, 0x3099, 0x30ef, 0x3099, 0x30f0, 0x3099,
+	0x30f1, 0x3099, 0x30f2, 0x3099, 0x30fd, 0x3099, 0x30b3, 0x30c8, 0x1100,
+	0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103, 0x1104, 0x1105, 0x11b0,
+	0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5, 0x111a, 0x1106, 0x1107, 0x1108,
+	0x1121, 0x1109, 0x110a, 0x110b, 0x110c, 0x110d, 0x110e, 0x110f, 0x1110,
+	0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167,
+	0x1168, 0x1169, 0x116a, 0x116b, 0x116c, 0x116d, 0x116e, 0x116f, 0x1170,
+	0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11c7,
+	0x11c8, 0x11cc, 0x11ce, 0x11d3, 0x11d7, 0x11d9, 0x111c, 0x11dd, 0x11df,
+	0x111d, 0x111e, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112b, 0x112c,
+	0x112d, 0x112e, 0x112f, 0x1132, 0x1136, 0x1140, 0x1147, 0x114c, 0x11f1,
+	0x11f2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192,
+	0x1194, 0x119e, 0x11a1, 0x4e09, 0x56db, 0x4e0a, 0x4e2d, 0x4e0b, 0x7532,
+	0x4e19, 0x4e01, 0x5929, 0x5730, 0x0028, 0x1100, 0x0029, 0x0028, 0x1102,
+	0x0029, 0x0028, 0x1103, 0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106,
+	0x0029, 0x0028, 0x1107, 0x0029, 0x0028, 0x1109, 0x0029, 0x0028, 0x110b,
+	0x0029, 0x0028, 0x110c, 0x0029, 0x0028, 0x110e, 0x0029, 0x0028, 0x110f,
+	0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111, 0x0029, 0x0028, 0x1112,
+	0x0029, 0x0028, 0x1100, 0x1161, 0x0029, 0x0028, 0x1102, 0x1161, 0x0029,
+	0x0028, 0x1103, 0x1161, 0x0029, 0x0028, 0x1105, 0x1161, 0x0029, 0x0028,
+	0x1106, 0x1161, 0x0029, 0x0028, 0x1107, 0x1161, 0x0029, 0x0028, 0x1109,
+	0x1161, 0x0029, 0x0028, 0x110b, 0x1161, 0x0029, 0x0028, 0x110c, 0x1161,
+	0x0029, 0x0028, 0x110e, 0x1161, 0x0029, 0x0028, 0x110f, 0x1161, 0x0029,
+	0x0028, 0x1110, 0x1161, 0x0029, 0x0028, 0x1111, 0x1161, 0x0029, 0x0028,
+	0x1112, 0x1161, 0x0029, 0x0028, 0x110c, 0x116e, 0x0029, 0x0028, 0x110b,
+	0x1169, 0x110c, 0x1165, 0x11ab, 0x0029, 0x0028, 0x110b, 0x1169, 0x1112,
+	0x116e, 0x0029, 0x0028, 0x4e00, 0x0029, 0x0028, 0x4e8c, 0x0029, 0x0028,
+	0x4e09, 0x0029, 0x0028, 0x56db, 0x0029, 0x0028, 0x4e94, 0x0029, 0x0028,
+	0x516d, 0x0029, 0x0028, 0x4e03, 0x0029, 0x0028, 0x516b, 0x0029, 0x0028,
+	0x4e5d, 0x0029, 0x0028, 0x5341, 0x0029, 0x0028, 0x6708, 0x0029, 0x0028,
+	0x706b, 0x0029, 0x0028, 0x6c34, 0x0029, 0x0028, 0x6728, 0x0029, 0x0028,
+	0x91d1, 0x0029, 0x0028, 0x571f, 0x0029, 0x0028, 0x65e5, 0x0029, 0x0028,
+	0x682a, 0x0029, 0x0028, 0x6709, 0x0029, 0x0028, 0x793e, 0x0029, 0x0028,
+	0x540d, 0x0029, 0x0028, 0x7279, 0x0029, 0x0028, 0x8ca1, 0x0029, 0x0028,
+	0x795d, 0x0029, 0x0028, 0x52b4, 0x0029, 0x0028, 0x4ee3, 0x0029, 0x0028,
+	0x547c, 0x0029, 0x0028, 0x5b66, 0x0029, 0x0028, 0x76e3, 0x0029, 0x0028,
+	0x4f01, 0x0029, 0x0028, 0x8cc7, 0x0029, 0x0028, 0x5354, 0x0029, 0x0028,
+	0x796d, 0x0029, 0x0028, 0x4f11, 0x0029, 0x0028, 0x81ea, 0x0029, 0x0028,
+	0x81f3, 0x0029, 0x554f, 0x5e7c, 0x7b8f, 0x0050, 0x0054, 0x0045, 0x0032,
+	0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0034, 0x0032, 0x0035,
+	0x0032, 0x0036, 0x0032, 0x0037, 0x0032, 0x0038, 0x0032, 0x0039, 0x0033,
+	0x0030, 0x0033, 0x0031, 0x0033, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034,
+	0x0033, 0x0035, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105,
+	0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110b, 0x1161,
+	0x110c, 0x1161, 0x110e, 0x1161, 0x110f, 0x1161, 0x1110, 0x1161, 0x1111,
+	0x1161, 0x1112, 0x1161, 0x110e, 0x1161, 0x11b7, 0x1100, 0x1169, 0x110c,
+	0x116e, 0x110b, 0x1174, 0x110b, 0x116e, 0x4e94, 0x516d, 0x4e03, 0x4e5d,
+	0x682a, 0x6709, 0x793e, 0x540d, 0x7279, 0x8ca1, 0x795d, 0x52b4, 0x79d8,
+	0x7537, 0x9069, 0x512a, 0x5370, 0x6ce8, 0x9805, 0x4f11, 0x5199, 0x6b63,
+	0x5de6, 0x53f3, 0x533b, 0x5b97, 0x5b66, 0x76e3, 0x4f01, 0x8cc7, 0x5354,
+	0x591c, 0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038, 0x0033, 0x0039,
+	0x0034, 0x0030, 0x0034, 0x0031, 0x0034, 0x0032, 0x0034, 0x0033, 0x0034,
+	0x0034, 0x0034, 0x0035, 0x0034, 0x0036, 0x0034, 0x0037, 0x0034, 0x0038,
+	0x0034, 0x0039, 0x0035, 0x0030, 0x0031, 0x6708, 0x0032, 0x6708, 0x0033,
+	0x6708, 0x0034, 0x6708, 0x0035, 0x6708, 0x0036, 0x6708, 0x0037, 0x6708,
+	0x0038, 0x6708, 0x0039, 0x6708, 0x0031, 0x0030, 0x6708, 0x0031, 0x0031,
+	0x6708, 0x0031, 0x0032, 0x6708, 0x0048, 0x0067, 0x0065, 0x0072, 0x0067,
+	0x0065, 0x0056, 0x004c, 0x0054, 0x0044, 0x30a2, 0x30a4, 0x30a6, 0x30a8,
+	0x30aa, 0x30ab, 0x30ad, 0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7, 0x30b9,
+	0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4, 0x30c6, 0x30c8, 0x30ca, 0x30cb,
+	0x30cc, 0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db, 0x30de,
+	0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4, 0x30e6, 0x30e8, 0x30e9, 0x30ea,
+	0x30eb, 0x30ec, 0x30ed, 0x30ef, 0x30f0, 0x30f1, 0x30f2, 0x4ee4, 0x548c,
+	0x30a2, 0x30cf, 0x309a, 0x30fc, 0x30c8, 0x30a2, 0x30eb, 0x30d5, 0x30a1,
+	0x30a2, 0x30f3, 0x30d8, 0x309a, 0x30a2, 0x30a2, 0x30fc, 0x30eb, 0x30a4,
+	0x30cb, 0x30f3, 0x30af, 0x3099, 0x30a4, 0x30f3, 0x30c1, 0x30a6, 0x30a9,
+	0x30f3, 0x30a8, 0x30b9, 0x30af, 0x30fc, 0x30c8, 0x3099, 0x30a8, 0x30fc,
+	0x30ab, 0x30fc, 0x30aa, 0x30f3, 0x30b9, 0x30aa, 0x30fc, 0x30e0, 0x30ab,
+	0x30a4, 0x30ea, 0x30ab, 0x30e9, 0x30c3, 0x30c8, 0x30ab, 0x30ed, 0x30ea,
+	0x30fc, 0x30ab, 0x3099, 0x30ed, 0x30f3, 0x30ab, 0x3099, 0x30f3, 0x30de,
+	0x30ad, 0x3099, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30cb, 0x30fc, 0x30ad,
+	0x30e5, 0x30ea, 0x30fc, 0x30ad, 0x3099, 0x30eb, 0x30bf, 0x3099, 0x30fc,
+	0x30ad, 0x30ed, 0x30ad, 0x30ed, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30ad,
+	0x30ed, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x30ad, 0x30ed, 0x30ef, 0x30c3,
+	0x30c8, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30af, 0x3099, 0x30e9, 0x30e0,
+	0x30c8, 0x30f3, 0x30af, 0x30eb, 0x30bb, 0x3099, 0x30a4, 0x30ed, 0x30af,
+	0x30ed, 0x30fc, 0x30cd, 0x30b1, 0x30fc, 0x30b9, 0x30b3, 0x30eb, 0x30ca,
+	0x30b3, 0x30fc, 0x30db, 0x309a, 0x30b5, 0x30a4, 0x30af, 0x30eb, 0x30b5,
+	0x30f3, 0x30c1, 0x30fc, 0x30e0, 0x30b7, 0x30ea, 0x30f3, 0x30af, 0x3099,
+	0x30bb, 0x30f3, 0x30c1, 0x30bb, 0x30f3, 0x30c8, 0x30bf, 0x3099, 0x30fc,
+	0x30b9, 0x30c6, 0x3099, 0x30b7, 0x30c8, 0x3099, 0x30eb, 0x30c8, 0x30f3,
+	0x30ca, 0x30ce, 0x30ce, 0x30c3, 0x30c8, 0x30cf, 0x30a4, 0x30c4, 0x30cf,
+	0x309a, 0x30fc, 0x30bb, 0x30f3, 0x30c8, 0x30cf, 0x309a, 0x30fc, 0x30c4,
+	0x30cf, 0x3099, 0x30fc, 0x30ec, 0x30eb, 0x30d2, 0x309a, 0x30a2, 0x30b9,
+	0x30c8, 0x30eb, 0x30d2, 0x309a, 0x30af, 0x30eb, 0x30d2, 0x309a, 0x30b3,
+	0x30d2, 0x3099, 0x30eb, 0x30d5, 0x30a1, 0x30e9, 0x30c3, 0x30c8, 0x3099,
+	0x30d5, 0x30a3, 0x30fc, 0x30c8, 0x30d5, 0x3099, 0x30c3, 0x30b7, 0x30a7,
+	0x30eb, 0x30d5, 0x30e9, 0x30f3, 0x30d8, 0x30af, 0x30bf, 0x30fc, 0x30eb,
+	0x30d8, 0x309a, 0x30bd, 0x30d8, 0x309a, 0x30cb, 0x30d2, 0x30d8, 0x30eb,
+	0x30c4, 0x30d8, 0x309a, 0x30f3, 0x30b9, 0x30d8, 0x309a, 0x30fc, 0x30b7,
+	0x3099, 0x30d8, 0x3099, 0x30fc, 0x30bf, 0x30db, 0x309a, 0x30a4, 0x30f3,
+	0x30c8, 0x30db, 0x3099, 0x30eb, 0x30c8, 0x30db, 0x30f3, 0x30db, 0x309a,
+	0x30f3, 0x30c8, 0x3099, 0x30db, 0x30fc, 0x30eb, 0x30db, 0x30fc, 0x30f3,
+	0x30de, 0x30a4, 0x30af, 0x30ed, 0x30de, 0x30a4, 0x30eb, 0x30de, 0x30c3,
+	0x30cf, 0x30de, 0x30eb, 0x30af, 0x30de, 0x30f3, 0x30b7, 0x30e7, 0x30f3,
+	0x30df, 0x30af, 0x30ed, 0x30f3, 0x30df, 0x30ea, 0x30df, 0x30ea, 0x30cf,
+	0x3099, 0x30fc, 0x30eb, 0x30e1, 0x30ab, 0x3099, 0x30e1, 0x30ab, 0x3099,
+	0x30c8, 0x30f3, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x30e4, 0x30fc, 0x30c8,
+	0x3099, 0x30e4, 0x30fc, 0x30eb, 0x30e6, 0x30a2, 0x30f3, 0x30ea, 0x30c3,
+	0x30c8, 0x30eb, 0x30ea, 0x30e9, 0x30eb, 0x30d2, 0x309a, 0x30fc, 0x30eb,
+	0x30fc, 0x30d5, 0x3099, 0x30eb, 0x30ec, 0x30e0, 0x30ec, 0x30f3, 0x30c8,
+	0x30b1, 0x3099, 0x30f3, 0x30ef, 0x30c3, 0x30c8, 0x0030, 0x70b9, 0x0031,
+	0x70b9, 0x0032, 0x70b9, 0x0033, 0x70b9, 0x0034, 0x70b9, 0x0035, 0x70b9,
+	0x0036, 0x70b9, 0x0037, 0x70b9, 0x0038, 0x70b9, 0x0039, 0x70b9, 0x0031,
+	0x0030, 0x70b9, 0x0031, 0x0031, 0x70b9, 0x0031, 0x0032, 0x70b9, 0x0031,
+	0x0033, 0x70b9, 0x0031, 0x0034, 0x70b9, 0x0031, 0x0035, 0x70b9, 0x0031,
+	0x0036, 0x70b9, 0x0031, 0x0037, 0x70b9, 0x0031, 0x0038, 0x70b9, 0x0031,
+	0x0039, 0x70b9, 0x0032, 0x0030, 0x70b9, 0x0032, 0x0031, 0x70b9, 0x0032,
+	0x0032, 0x70b9, 0x0032, 0x0033, 0x70b9, 0x0032, 0x0034, 0x70b9, 0x0068,
+	0x0050, 0x0061, 0x0064, 0x0061, 0x0041, 0x0055, 0x0062, 0x0061, 0x0072,
+	0x006f, 0x0056, 0x0070, 0x0063, 0x0064, 0x006d, 0x0064, 0x006d, 0x0032,
+	0x0064, 0x006d, 0x0033, 0x0049, 0x0055, 0x5e73, 0x6210, 0x662d, 0x548c,
+	0x5927, 0x6b63, 0x660e, 0x6cbb, 0x682a, 0x5f0f, 0x4f1a, 0x793e, 0x0070,
+	0x0041, 0x006e, 0x0041, 0x03bc, 0x0041, 0x006d, 0x0041, 0x006b, 0x0041,
+	0x004b, 0x0042, 0x004d, 0x0042, 0x0047, 0x0042, 0x0063, 0x0061, 0x006c,
+	0x006b, 0x0063, 0x0061, 0x006c, 0x0070, 0x0046, 0x006e, 0x0046, 0x03bc,
+	0x0046, 0x03bc, 0x0067, 0x006d, 0x0067, 0x006b, 0x0067, 0x0048, 0x007a,
+	0x006b, 0x0048, 0x007a, 0x004d, 0x0048, 0x007a, 0x0047, 0x0048, 0x007a,
+	0x0054, 0x0048, 0x007a, 0x03bc, 0x006c, 0x006d, 0x006c, 0x0064, 0x006c,
+	0x006b, 0x006c, 0x0066, 0x006d, 0x006e, 0x006d, 0x03bc, 0x006d, 0x006d,
+	0x006d, 0x0063, 0x006d, 0x006b, 0x006d, 0x006d, 0x006d, 0x0032, 0x0063,
+	0x006d, 0x0032, 0x006d, 0x0032, 0x006b, 0x006d, 0x0032, 0x006d, 0x006d,
+	0x0033, 0x0063, 0x006d, 0x0033, 0x006d, 0x0033, 0x006b, 0x006d, 0x0033,
+	0x006d, 0x2215, 0x0073, 0x006d, 0x2215, 0x0073, 0x0032, 0x0050, 0x0061,
+	0x006b, 0x0050, 0x0061, 0x004d, 0x0050, 0x0061, 0x0047, 0x0050, 0x0061,
+	0x0072, 0x0061, 0x0064, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0072,
+	0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0070, 0x0073, 0x006e, 0x0073,
+	0x03bc, 0x0073, 0x006d, 0x0073, 0x0070, 0x0056, 0x006e, 0x0056, 0x03bc,
+	0x0056, 0x006d, 0x0056, 0x006b, 0x0056, 0x004d, 0x0056, 0x0070, 0x0057,
+	0x006e, 0x0057, 0x03bc, 0x0057, 0x006d, 0x0057, 0x006b, 0x0057, 0x004d,
+	0x0057, 0x006b, 0x03a9, 0x004d, 0x03a9, 0x0061, 0x002e, 0x006d, 0x002e,
+	0x0042, 0x0071, 0x0063, 0x0063, 0x0063, 0x0064, 0x0043, 0x2215, 0x006b,
+	0x0067, 0x0043, 0x006f, 0x002e, 0x0064, 0x0042, 0x0047, 0x0079, 0x0068,
+	0x0061, 0x0048, 0x0050, 0x0069, 0x006e, 0x004b, 0x004b, 0x004b, 0x004d,
+	0x006b, 0x0074, 0x006c, 0x006d, 0x006c, 0x006e, 0x006c, 0x006f, 0x0067,
+	0x006c, 0x0078, 0x006d, 0x0062, 0x006d, 0x0069, 0x006c, 0x006d, 0x006f,
+	0x006c, 0x0050, 0x0048, 0x0070, 0x002e, 0x006d, 0x002e, 0x0050, 0x0050,
+	0x004d, 0x0050, 0x0052, 0x0073, 0x0072, 0x0053, 0x0076, 0x0057, 0x0062,
+	0x0056, 0x2215, 0x006d, 0x0041, 0x2215, 0x006d, 0x0031, 0x65e5, 0x0032,
+	0x65e5, 0x0033, 0x65e5, 0x0034, 0x65e5, 0x0035, 0x65e5, 0x0036, 0x65e5,
+	0x0037, 0x65e5, 0x0038, 0x65e5, 0x0039, 0x65e5, 0x0031, 0x0030, 0x65e5,
+	0x0031, 0x0031, 0x65e5, 0x0031, 0x0032, 0x65e5, 0x0031, 0x0033, 0x65e5,
+	0x0031, 0x0034, 0x65e5, 0x0031, 0x0035, 0x65e5, 0x0031, 0x0036, 0x65e5,
+	0x0031, 0x0037, 0x65e5, 0x0031, 0x0038, 0x65e5, 0x0031, 0x0039, 0x65e5,
+	0x0032, 0x0030, 0x65e5, 0x0032, 0x0031, 0x65e5, 0x0032, 0x0032, 0x65e5,
+	0x0032, 0x0033, 0x65e5, 0x0032, 0x0034, 0x65e5, 0x0032, 0x0035, 0x65e5,
+	0x0032, 0x0036, 0x65e5, 0x0032, 0x0037, 0x65e5, 0x0032, 0x0038, 0x65e5,
+	0x0032, 0x0039, 0x65e5, 0x0033, 0x0030, 0x65e5, 0x0033, 0x0031, 0x65e5,
+	0x0067, 0x0061, 0x006c, 0xa641, 0xa643, 0xa645, 0xa647, 0xa649, 0xa64d,
+	0xa64f, 0xa651, 0xa653, 0xa655, 0xa657, 0xa659, 0xa65b, 0xa65d, 0xa65f,
+	0xa661, 0xa663, 0xa665, 0xa667, 0xa669, 0xa66b, 0xa66d, 0xa681, 0xa683,
+	0xa685, 0xa687, 0xa689, 0xa68b, 0xa68d, 0xa68f, 0xa691, 0xa693, 0xa695,
+	0xa697, 0xa699, 0xa69b, 0xa723, 0xa725, 0xa727, 0xa729, 0xa72b, 0xa72d,
+	0xa72f, 0xa733, 0xa735, 0xa737, 0xa739, 0xa73b, 0xa73d, 0xa73f, 0xa741,
+	0xa743, 0xa745, 0xa747, 0xa749, 0xa74b, 0xa74d, 0xa74f, 0xa751, 0xa753,
+	0xa755, 0xa757, 0xa759, 0xa75b, 0xa75d, 0xa75f, 0xa761, 0xa763, 0xa765,
+	0xa767, 0xa769, 0xa76b, 0xa76d, 0xa76f, 0xa77a, 0xa77c, 0x1d79, 0xa77f,
+	0xa781, 0xa783, 0xa785, 0xa787, 0xa78c, 0xa791, 0xa793, 0xa797, 0xa799,
+	0xa79b, 0xa79d, 0xa79f, 0xa7a1, 0xa7a3, 0xa7a5, 0xa7a7, 0xa7a9, 0x026c,
+	0x029e, 0x0287, 0xab53, 0xa7b5, 0xa7b7, 0xa7b9, 0xa7bb, 0xa7bd, 0xa7bf,
+	0xa7c1, 0xa7c3, 0xa794, 0x1d8e, 0xa7c8, 0xa7ca, 0xa7d1, 0xa7d7, 0xa7d9,
+	0xa7f6, 0x0126, 0xab37, 0xab52, 0x028d, 0x13a0, 0x13a1, 0x13a2, 0x13a3,
+	0x13a4, 0x13a5, 0x13a6, 0x13a7, 0x13a8, 0x13a9, 0x13aa, 0x13ab, 0x13ac,
+	0x13ad, 0x13ae, 0x13af, 0x13b0, 0x13b1, 0x13b2, 0x13b3, 0x13b4, 0x13b5,
+	0x13b6, 0x13b7, 0x13b8, 0x13b9, 0x13ba, 0x13bb, 0x13bc, 0x13bd, 0x13be,
+	0x13bf, 0x13c0, 0x13c1, 0x13c2, 0x13c3, 0x13c4, 0x13c5, 0x13c6, 0x13c7,
+	0x13c8, 0x13c9, 0x13ca, 0x13cb, 0x13cc, 0x13cd, 0x13ce, 0x13cf, 0x13d0,
+	0x13d1, 0x13d2, 0x13d3, 0x13d4, 0x13d5, 0x13d6, 0x13d7, 0x13d8, 0x13d9,
+	0x13da, 0x13db, 0x13dc, 0x13dd, 0x13de, 0x13df, 0x13e0, 0x13e1, 0x13e2,
+	0x13e3, 0x13e4, 0x13e5, 0x13e6, 0x13e7, 0x13e8, 0x13e9, 0x13ea, 0x13eb,
+	0x13ec, 0x13ed, 0x13ee, 0x13ef, 0x8c48, 0x66f4, 0x8cc8, 0x6ed1, 0x4e32,
+	0x53e5, 0x5951, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f, 0x87ba,
+	0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d, 0x916a, 0x99f1,
+	0x4e82, 0x5375, 0x6b04, 0x721b, 0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd,
+	0x8964, 0x62c9, 0x81d8, 0x881f, 0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce,
+	0x4f86, 0x51b7, 0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8606, 0x865c,
+	0x8def, 0x9732, 0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304,
+	0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e, 0x7262, 0x78ca, 0x8cc2, 0x96f7,
+	0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f, 0x7d2f, 0x7e37, 0x964b, 0x52d2,
+	0x808b, 0x51dc, 0x51cc, 0x7a1c, 0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf,
+	0x8afe, 0x4e39, 0x5be7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf,
+	0x5fa9, 0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449,
+	0x8aaa, 0x6bba, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565, 0x4eae, 0x5169,
+	0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf, 0x52f5, 0x5442, 0x5eec,
+	0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a, 0x9e97, 0x9ece, 0x66c6, 0x6b77,
+	0x8f62, 0x5e74, 0x6190, 0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca,
+	0x7df4, 0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd,
+	0x70c8, 0x88c2, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375, 0x4ee4,
+	0x56f9, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046, 0x9234, 0x96f6,
+	0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8, 0x60e1, 0x4e86, 0x50da,
+	0x5bee, 0x5c3f, 0x6599, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x6688, 0x962e,
+	0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10,
+	0x985e, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b, 0x6144,
+	0x6817, 0x9686, 0x5229, 0x540f, 0x5c65, 0x6613, 0x674e, 0x68a8, 0x6ce5,
+	0x7406, 0x75e2, 0x7f79, 0x88cf, 0x88e1, 0x96e2, 0x533f, 0x6eba, 0x541d,
+	0x71d0, 0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+	0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207,
+	0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x964d, 0x5ed3,
+	0x5140, 0x55c0, 0x585a, 0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e,
+	0x7965, 0x798f, 0x9756, 0x7cbe, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef,
+	0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d, 0x52c9,
+	0x52e4, 0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64, 0x6094,
+	0x6168, 0x618e, 0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a,
+	0x6f22, 0x716e, 0x722b, 0x7422, 0x7891, 0x7949, 0x7948, 0x7950, 0x7956,
+	0x798d, 0x798e, 0x7a40, 0x7a81, 0x7bc0, 0x7e09, 0x7e41, 0x7f72, 0x8005,
+	0x81ed, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08,
+	0x8fb6, 0x96e3, 0x97ff, 0x983b, 0x6075, 0xd850, 0xdeee, 0x8218, 0x4e26,
+	0x51b5, 0x5168, 0x4f80, 0x5145, 0x5180, 0x52c7, 0x52fa, 0x5555, 0x5599,
+	0x55e2, 0x58b3, 0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69,
+	0x5fad, 0x60d8, 0x614e, 0x6108, 0x6160, 0x6234, 0x63c4, 0x641c, 0x6452,
+	0x6556, 0x671b, 0x6756, 0x6edb, 0x6ecb, 0x701e, 0x77a7, 0x7235, 0x72af,
+	0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76db, 0x76f4, 0x774a, 0x7740,
+	0x78cc, 0x7ab1, 0x7c7b, 0x7d5b, 0x7f3e, 0x8352, 0x83ef, 0x8779, 0x8941,
+	0x8986, 0x8abf, 0x8acb, 0x8aed, 0x8b8a, 0x8f38, 0x9072, 0x9199, 0x9276,
+	0x967c, 0x97db, 0x980b, 0x9b12, 0xd84a, 0xdc4a, 0xd84a, 0xdc44, 0xd84c,
+	0xdfd5, 0x3b9d, 0x4018, 0x4039, 0xd854, 0xde49, 0xd857, 0xdcd0, 0xd85f,
+	0xded3, 0x9f43, 0x9f8e, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006c,
+	0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006c, 0x0073, 0x0074, 0x0574,
+	0x0576, 0x0574, 0x0565, 0x0574, 0x056b, 0x057e, 0x0576, 0x0574, 0x056d,
+	0x05d9, 0x05b4, 0x05f2, 0x05b7, 0x05e2, 0x05d4, 0x05db, 0x05dc, 0x05dd,
+	0x05e8, 0x05ea, 0x05e9, 0x05c1, 0x05e9, 0x05c2, 0x05e9, 0x05bc, 0x05c1,
+	0x05e9, 0x05bc, 0x05c2, 0x05d0, 0x05b7, 0x05d0, 0x05b8, 0x05d0, 0x05bc,
+	0x05d1, 0x05bc, 0x05d2, 0x05bc, 0x05d3, 0x05bc, 0x05d4, 0x05bc, 0x05d5,
+	0x05bc, 0x05d6, 0x05bc, 0x05d8, 0x05bc, 0x05d9, 0x05bc, 0x05da, 0x05bc,
+	0x05db, 0x05bc, 0x05dc, 0x05bc, 0x05de, 0x05bc, 0x05e0, 0x05bc, 0x05e1,
+	0x05bc, 0x05e3, 0x05bc, 0x05e4, 0x05bc, 0x05e6, 0x05bc, 0x05e7, 0x05bc,
+	0x05e8, 0x05bc, 0x05e9, 0x05bc, 0x05ea, 0x05bc, 0x05d5, 0x05b9, 0x05d1,
+	0x05bf, 0x05db, 0x05bf, 0x05e4, 0x05bf, 0x05d0, 0x05dc, 0x0671, 0x067b,
+	0x067e, 0x0680, 0x067a, 0x067f, 0x0679, 0x06a4, 0x06a6, 0x0684, 0x0683,
+	0x0686, 0x0687, 0x068d, 0x068c, 0x068e, 0x0688, 0x0698, 0x0691, 0x06a9,
+	0x06af, 0x06b3, 0x06b1, 0x06ba, 0x06bb, 0x06c1, 0x06be, 0x06d2, 0x06ad,
+	0x06c7, 0x06c6, 0x06c8, 0x06cb, 0x06c5, 0x06c9, 0x06d0, 0x0649, 0x064a,
+	0x0654, 0x0627, 0x064a, 0x0654, 0x06d5, 0x064a, 0x0654, 0x0648, 0x064a,
+	0x0654, 0x06c7, 0x064a, 0x0654, 0x06c6, 0x064a, 0x0654, 0x06c8, 0x064a,
+	0x0654, 0x06d0, 0x064a, 0x0654, 0x0649, 0x06cc, 0x064a, 0x0654, 0x062c,
+	0x064a, 0x0654, 0x062d, 0x064a, 0x0654, 0x0645, 0x064a, 0x0654, 0x064a,
+	0x0628, 0x062c, 0x0628, 0x062d, 0x0628, 0x062e, 0x0628, 0x0645, 0x0628,
+	0x0649, 0x0628, 0x064a, 0x062a, 0x062c, 0x062a, 0x062d, 0x062a, 0x062e,
+	0x062a, 0x0645, 0x062a, 0x0649, 0x062a, 0x064a, 0x062b, 0x062c, 0x062b,
+	0x0645, 0x062b, 0x0649, 0x062b, 0x064a, 0x062c, 0x062d, 0x062c, 0x0645,
+	0x062d, 0x062c, 0x062d, 0x0645, 0x062e, 0x062c, 0x062e, 0x062d, 0x062e,
+	0x0645, 0x0633, 0x062c, 0x0633, 0x062d, 0x0633, 0x062e, 0x0633, 0x0645,
+	0x0635, 0x062d, 0x0635, 0x0645, 0x0636, 0x062c, 0x0636, 0x062d, 0x0636,
+	0x062e, 0x0636, 0x0645, 0x0637, 0x062d, 0x0637, 0x0645, 0x0638, 0x0645,
+	0x0639, 0x062c, 0x0639, 0x0645, 0x063a, 0x062c, 0x063a, 0x0645, 0x0641,
+	0x062c, 0x0641, 0x062d, 0x0641, 0x062e, 0x0641, 0x0645, 0x0641, 0x0649,
+	0x0641, 0x064a, 0x0642, 0x062d, 0x0642, 0x0645, 0x0642, 0x0649, 0x0642,
+	0x064a, 0x0643, 0x0627, 0x0643, 0x062c, 0x0643, 0x062d, 0x0643, 0x062e,
+	0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064a, 0x0644,
+	0x062c, 0x0644, 0x062d, 0x0644, 0x062e, 0x0644, 0x0645, 0x0644, 0x0649,
+	0x0644, 0x064a, 0x0645, 0x062c, 0x0645, 0x062d, 0x0645, 0x062e, 0x0645,
+	0x0645, 0x0645, 0x0649, 0x0645, 0x064a, 0x0646, 0x062c, 0x0646, 0x062d,
+	0x0646, 0x062e, 0x0646, 0x0645, 0x0646, 0x0649, 0x0646, 0x064a, 0x0647,
+	0x062c, 0x0647, 0x0645, 0x0647, 0x0649, 0x0647, 0x064a, 0x064a, 0x062c,
+	0x064a, 0x062d, 0x064a, 0x062e, 0x064a, 0x0645, 0x064a, 0x0649, 0x064a,
+	0x064a, 0x0630, 0x0670, 0x0631, 0x0670, 0x0649, 0x0670, 0x0020, 0x064c,
+	0x0651, 0x0020, 0x064d, 0x0651, 0x0020, 0x064e, 0x0651, 0x0020, 0x064f,
+	0x0651, 0x0020, 0x0650, 0x0651, 0x0020, 0x0651, 0x0670, 0x064a, 0x0654,
+	0x0631, 0x064a, 0x0654, 0x0632, 0x064a, 0x0654, 0x0646, 0x0628, 0x0631,
+	0x0628, 0x0632, 0x0628, 0x0646, 0x062a, 0x0631, 0x062a, 0x0632, 0x062a,
+	0x0646, 0x062b, 0x0631, 0x062b, 0x0632, 0x062b, 0x0646, 0x0645, 0x0627,
+	0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0646, 0x064a, 0x0631, 0x064a,
+	0x0632, 0x064a, 0x0646, 0x064a, 0x0654, 0x062e, 0x064a, 0x0654, 0x0647,
+	0x0628, 0x0647, 0x062a, 0x0647, 0x0635, 0x062e, 0x0644, 0x0647, 0x0646,
+	0x0647, 0x0647, 0x0670, 0x064a, 0x0647, 0x062b, 0x0647, 0x0633, 0x0647,
+	0x0634, 0x0645, 0x0634, 0x0647, 0x0640, 0x064e, 0x0651, 0x0640, 0x064f,
+	0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649, 0x0637, 0x064a, 0x0639,
+	0x0649, 0x0639, 0x064a, 0x063a, 0x0649, 0x063a, 0x064a, 0x0633, 0x0649,
+	0x0633, 0x064a, 0x0634, 0x0649, 0x0634, 0x064a, 0x062d, 0x0649, 0x062d,
+	0x064a, 0x062c, 0x0649, 0x062c, 0x064a, 0x062e, 0x0649, 0x062e, 0x064a,
+	0x0635, 0x0649, 0x0635, 0x064a, 0x0636, 0x0649, 0x0636, 0x064a, 0x0634,
+	0x062c, 0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0631, 0x0633, 0x0631,
+	0x0635, 0x0631, 0x0636, 0x0631, 0x0627, 0x064b, 0x062a, 0x062c, 0x0645,
+	0x062a, 0x062d, 0x062c, 0x062a, 0x062d, 0x0645, 0x062a, 0x062e, 0x0645,
+	0x062a, 0x0645, 0x062c, 0x062a, 0x0645, 0x062d, 0x062a, 0x0645, 0x062e,
+	0x062c, 0x0645, 0x062d, 0x062d, 0x0645, 0x064a, 0x062d, 0x0645, 0x0649,
+	0x0633, 0x062d, 0x062c, 0x0633, 0x062c, 0x062d, 0x0633, 0x062c, 0x0649,
+	0x0633, 0x0645, 0x062d, 0x0633, 0x0645, 0x062c, 0x0633, 0x0645, 0x0645,
+	0x0635, 0x062d, 0x062d, 0x0635, 0x0645, 0x0645, 0x0634, 0x062d, 0x0645,
+	0x0634, 0x062c, 0x064a, 0x0634, 0x0645, 0x062e, 0x0634, 0x0645, 0x0645,
+	0x0636, 0x062d, 0x0649, 0x0636, 0x062e, 0x0645, 0x0637, 0x0645, 0x062d,
+	0x0637, 0x0645, 0x0645, 0x0637, 0x0645, 0x064a, 0x0639, 0x062c, 0x0645,
+	0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063a, 0x0645, 0x0645,
+	0x063a, 0x0645, 0x064a, 0x063a, 0x0645, 0x0649, 0x0641, 0x062e, 0x0645,
+	0x0642, 0x0645, 0x062d, 0x0642, 0x0645, 0x0645, 0x0644, 0x062d, 0x0645,
+	0x0644, 0x062d, 0x064a, 0x0644, 0x062d, 0x0649, 0x0644, 0x062c, 0x062c,
+	0x0644, 0x062e, 0x0645, 0x0644, 0x0645, 0x062d, 0x0645, 0x062d, 0x062c,
+	0x0645, 0x062d, 0x0645, 0x0645, 0x062d, 0x064a, 0x0645, 0x062c, 0x062d,
+	0x0645, 0x062c, 0x0645, 0x0645, 0x062e, 0x062c, 0x0645, 0x062e, 0x0645,
+	0x0645, 0x062c, 0x062e, 0x0647, 0x0645, 0x062c, 0x0647, 0x0645, 0x0645,
+	0x0646, 0x062d, 0x0645, 0x0646, 0x062d, 0x0649, 0x0646, 0x062c, 0x0645,
+	0x0646, 0x062c, 0x0649, 0x0646, 0x0645, 0x064a, 0x0646, 0x0645, 0x0649,
+	0x064a, 0x0645, 0x0645, 0x0628, 0x062e, 0x064a, 0x062a, 0x062c, 0x064a,
+	0x062a, 0x062c, 0x0649, 0x062a, 0x062e, 0x064a, 0x062a, 0x062e, 0x0649,
+	0x062a, 0x0645, 0x064a, 0x062a, 0x0645, 0x0649, 0x062c, 0x0645, 0x064a,
+	0x062c, 0x062d, 0x0649, 0x062c, 0x0645, 0x0649, 0x0633, 0x062e, 0x0649,
+	0x0635, 0x062d, 0x064a, 0x0634, 0x062d, 0x064a, 0x0636, 0x062d, 0x064a,
+	0x0644, 0x062c, 0x064a, 0x0644, 0x0645, 0x064a, 0x064a, 0x062d, 0x064a,
+	0x064a, 0x062c, 0x064a, 0x064a, 0x0645, 0x064a, 0x0645, 0x0645, 0x064a,
+	0x0642, 0x0645, 0x064a, 0x0646, 0x062d, 0x064a, 0x0639, 0x0645, 0x064a,
+	0x0643, 0x0645, 0x064a, 0x0646, 0x062c, 0x062d, 0x0645, 0x062e, 0x064a,
+	0x0644, 0x062c, 0x0645, 0x0643, 0x0645, 0x0645, 0x062c, 0x062d, 0x064a,
+	0x062d, 0x062c, 0x064a, 0x0645, 0x062c, 0x064a, 0x0641, 0x0645, 0x064a,
+	0x0628, 0x062d, 0x064a, 0x0633, 0x062e, 0x064a, 0x0646, 0x062c, 0x064a,
+	0x0635, 0x0644, 0x06d2, 0x0642, 0x0644, 0x06d2, 0x0627, 0x0644, 0x0644,
+	0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062d, 0x0645, 0x062f,
+	0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648, 0x0644, 0x0639,
+	0x0644, 0x064a, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645, 0x0635, 0x0644,
+	0x0649, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647,
+	0x0020, 0x0639, 0x0644, 0x064a, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644,
+	0x0645, 0x062c, 0x0644, 0x0020, 0x062c, 0x0644, 0x0627, 0x0644, 0x0647,
+	0x0631, 0x06cc, 0x0627, 0x0644, 0x002c, 0x3001, 0x3002, 0x003a, 0x0021,
+	0x003f, 0x3016, 0x3017, 0x2014, 0x2013, 0x005f, 0x007b, 0x007d, 0x3014,
+	0x3015, 0x3010, 0x3011, 0x300a, 0x300b, 0x300c, 0x300d, 0x300e, 0x300f,
+	0x005b, 0x005d, 0x0023, 0x0026, 0x002a, 0x002d, 0x003c, 0x003e, 0x005c,
+	0x0024, 0x0025, 0x0040, 0x0020, 0x064b, 0x0640, 0x064b, 0x0020, 0x064c,
+	0x0020, 0x064d, 0x0020, 0x064e, 0x0640, 0x064e, 0x0020, 0x064f, 0x0640,
+	0x064f, 0x0020, 0x0650, 0x0640, 0x0650, 0x0020, 0x0651, 0x0640, 0x0651,
+	0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0628, 0x0629, 0x062a,
+	0x062b, 0x062c, 0x062d, 0x062e, 0x062f, 0x0630, 0x0631, 0x0632, 0x0633,
+	0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063a, 0x0641, 0x0642,
+	0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x064a, 0x0644, 0x0627,
+	0x0653, 0x0644, 0x0627, 0x0654, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627,
+	0x0022, 0x0027, 0x002f, 0xff41, 0xff42, 0xff43, 0xff44, 0xff45, 0xff46,
+	0xff47, 0xff48, 0xff49, 0xff4a, 0xff4b, 0xff4c, 0xff4d, 0xff4e, 0xff4f,
+	0xff50, 0xff51, 0xff52, 0xff53, 0xff54, 0xff55, 0xff56, 0xff57, 0xff58,
+	0xff59, 0xff5a, 0x005e, 0x007c, 0x007e, 0x2985, 0x2986, 0x30fb, 0x30a1,
+	0x30a3, 0x30a5, 0x30a7, 0x30a9, 0x30e3, 0x30e5, 0x30e7, 0x30c3, 0x30fc,
+	0x30f3, 0x3099, 0x309a, 0x00a2, 0x00a3, 0x00ac, 0x00a6, 0x00a5, 0x20a9,
+	0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25a0, 0x25cb, 0xd801, 0xdc28,
+	0xd801, 0xdc29, 0xd801, 0xdc2a, 0xd801, 0xdc2b, 0xd801, 0xdc2c, 0xd801,
+	0xdc2d, 0xd801, 0xdc2e, 0xd801, 0xdc2f, 0xd801, 0xdc30, 0xd801, 0xdc31,
+	0xd801, 0xdc32, 0xd801, 0xdc33, 0xd801, 0xdc34, 0xd801, 0xdc35, 0xd801,
+	0xdc36, 0xd801, 0xdc37, 0xd801, 0xdc38, 0xd801, 0xdc39, 0xd801, 0xdc3a,
+	0xd801, 0xdc3b, 0xd801, 0xdc3c, 0xd801, 0xdc3d, 0xd801, 0xdc3e, 0xd801,
+	0xdc3f, 0xd801, 0xdc40, 0xd801, 0xdc41, 0xd801, 0xdc42, 0xd801, 0xdc43,
+	0xd801, 0xdc44, 0xd801, 0xdc45, 0xd801, 0xdc46, 0xd801, 0xdc47, 0xd801,
+	0xdc48, 0xd801, 0xdc49, 0xd801, 0xdc4a, 0xd801, 0xdc4b, 0xd801, 0xdc4c,
+	0xd801, 0xdc4d, 0xd801, 0xdc4e, 0xd801, 0xdc4f, 0xd801, 0xdcd8, 0xd801,
+	0xdcd9, 0xd801, 0xdcda, 0xd801, 0xdcdb, 0xd801, 0xdcdc, 0xd801, 0xdcdd,
+	0xd801, 0xdcde, 0xd801, 0xdcdf, 0xd801, 0xdce0, 0xd801, 0xdce1, 0xd801,
+	0xdce2, 0xd801, 0xdce3, 0xd801, 0xdce4, 0xd801, 0xdce5, 0xd801, 0xdce6,
+	0xd801, 0xdce7, 0xd801, 0xdce8, 0xd801, 0xdce9, 0xd801, 0xdcea, 0xd801,
+	0xdceb, 0xd801, 0xdcec, 0xd801, 0xdced, 0xd801, 0xdcee, 0xd801, 0xdcef,
+	0xd801, 0xdcf0, 0xd801, 0xdcf1, 0xd801, 0xdcf2, 0xd801, 0xdcf3, 0xd801,
+	0xdcf4, 0xd801, 0xdcf5, 0xd801, 0xdcf6, 0xd801, 0xdcf7, 0xd801, 0xdcf8,
+	0xd801, 0xdcf9, 0xd801, 0xdcfa, 0xd801, 0xdcfb, 0xd801, 0xdd97, 0xd801,
+	0xdd98, 0xd801, 0xdd99, 0xd801, 0xdd9a, 0xd801, 0xdd9b, 0xd801, 0xdd9c,
+	0xd801, 0xdd9d, 0xd801, 0xdd9e, 0xd801, 0xdd9f, 0xd801, 0xdda0, 0xd801,
+	0xdda1, 0xd801, 0xdda3, 0xd801, 0xdda4, 0xd801, 0xdda5, 0xd801, 0xdda6,
+	0xd801, 0xdda7, 0xd801, 0xdda8, 0xd801, 0xdda9, 0xd801, 0xddaa, 0xd801,
+	0xddab, 0xd801, 0xddac, 0xd801, 0xddad, 0xd801, 0xddae, 0xd801, 0xddaf,
+	0xd801, 0xddb0, 0xd801, 0xddb1, 0xd801, 0xddb3, 0xd801, 0xddb4, 0xd801,
+	0xddb5, 0xd801, 0xddb6, 0xd801, 0xddb7, 0xd801, 0xddb8, 0xd801, 0xddb9,
+	0xd801, 0xddbb, 0xd801, 0xddbc, 0x02d0, 0x02d1, 0x0299, 0x02a3, 0xab66,
+	0x02a5, 0x02a4, 0x1d91, 0x0258, 0x025e, 0x02a9, 0x0264, 0x0262, 0x029b,
+	0x029c, 0x0267, 0x0284, 0x02aa, 0x02ab, 0xd837, 0xdf04, 0xa78e, 0x026e,
+	0xd837, 0xdf05, 0x028e, 0xd837, 0xdf06, 0x0276, 0x0277, 0x027a, 0xd837,
+	0xdf08, 0x027e, 0x02a8, 0x02a6, 0xab67, 0x02a7, 0x2c71, 0x028f, 0x02a1,
+	0x02a2, 0x0298, 0x01c0, 0x01c1, 0x01c2, 0xd837, 0xdf0a, 0xd837, 0xdf1e,
+	0xd803, 0xdcc0, 0xd803, 0xdcc1, 0xd803, 0xdcc2, 0xd803, 0xdcc3, 0xd803,
+	0xdcc4, 0xd803, 0xdcc5, 0xd803, 0xdcc6, 0xd803, 0xdcc7, 0xd803, 0xdcc8,
+	0xd803, 0xdcc9, 0xd803, 0xdcca, 0xd803, 0xdccb, 0xd803, 0xdccc, 0xd803,
+	0xdccd, 0xd803, 0xdcce, 0xd803, 0xdccf, 0xd803, 0xdcd0, 0xd803, 0xdcd1,
+	0xd803, 0xdcd2, 0xd803, 0xdcd3, 0xd803, 0xdcd4, 0xd803, 0xdcd5, 0xd803,
+	0xdcd6, 0xd803, 0xdcd7, 0xd803, 0xdcd8, 0xd803, 0xdcd9, 0xd803, 0xdcda,
+	0xd803, 0xdcdb, 0xd803, 0xdcdc, 0xd803, 0xdcdd, 0xd803, 0xdcde, 0xd803,
+	0xdcdf, 0xd803, 0xdce0, 0xd803, 0xdce1, 0xd803, 0xdce2, 0xd803, 0xdce3,
+	0xd803, 0xdce4, 0xd803, 0xdce5, 0xd803, 0xdce6, 0xd803, 0xdce7, 0xd803,
+	0xdce8, 0xd803, 0xdce9, 0xd803, 0xdcea, 0xd803, 0xdceb, 0xd803, 0xdcec,
+	0xd803, 0xdced, 0xd803, 0xdcee, 0xd803, 0xdcef, 0xd803, 0xdcf0, 0xd803,
+	0xdcf1, 0xd803, 0xdcf2, 0xd804, 0xdc99, 0xd804, 0xdcba, 0xd804, 0xdc9b,
+	0xd804, 0xdcba, 0xd804, 0xdca5, 0xd804, 0xdcba, 0xd804, 0xdd31, 0xd804,
+	0xdd27, 0xd804, 0xdd32, 0xd804, 0xdd27, 0xd804, 0xdf47, 0xd804, 0xdf3e,
+	0xd804, 0xdf47, 0xd804, 0xdf57, 0xd805, 0xdcb9, 0xd805, 0xdcba, 0xd805,
+	0xdcb9, 0xd805, 0xdcb0, 0xd805, 0xdcb9, 0xd805, 0xdcbd, 0xd805, 0xddb8,
+	0xd805, 0xddaf, 0xd805, 0xddb9, 0xd805, 0xddaf, 0xd806, 0xdcc0, 0xd806,
+	0xdcc1, 0xd806, 0xdcc2, 0xd806, 0xdcc3, 0xd806, 0xdcc4, 0xd806, 0xdcc5,
+	0xd806, 0xdcc6, 0xd806, 0xdcc7, 0xd806, 0xdcc8, 0xd806, 0xdcc9, 0xd806,
+	0xdcca, 0xd806, 0xdccb, 0xd806, 0xdccc, 0xd806, 0xdccd, 0xd806, 0xdcce,
+	0xd806, 0xdccf, 0xd806, 0xdcd0, 0xd806, 0xdcd1, 0xd806, 0xdcd2, 0xd806,
+	0xdcd3, 0xd806, 0xdcd4, 0xd806, 0xdcd5, 0xd806, 0xdcd6, 0xd806, 0xdcd7,
+	0xd806, 0xdcd8, 0xd806, 0xdcd9, 0xd806, 0xdcda, 0xd806, 0xdcdb, 0xd806,
+	0xdcdc, 0xd806, 0xdcdd, 0xd806, 0xdcde, 0xd806, 0xdcdf, 0xd806, 0xdd35,
+	0xd806, 0xdd30, 0xd81b, 0xde60, 0xd81b, 0xde61, 0xd81b, 0xde62, 0xd81b,
+	0xde63, 0xd81b, 0xde64, 0xd81b, 0xde65, 0xd81b, 0xde66, 0xd81b, 0xde67,
+	0xd81b, 0xde68, 0xd81b, 0xde69, 0xd81b, 0xde6a, 0xd81b, 0xde6b, 0xd81b,
+	0xde6c, 0xd81b, 0xde6d, 0xd81b, 0xde6e, 0xd81b, 0xde6f, 0xd81b, 0xde70,
+	0xd81b, 0xde71, 0xd81b, 0xde72, 0xd81b, 0xde73, 0xd81b, 0xde74, 0xd81b,
+	0xde75, 0xd81b, 0xde76, 0xd81b, 0xde77, 0xd81b, 0xde78, 0xd81b, 0xde79,
+	0xd81b, 0xde7a, 0xd81b, 0xde7b, 0xd81b, 0xde7c, 0xd81b, 0xde7d, 0xd81b,
+	0xde7e, 0xd81b, 0xde7f, 0xd834, 0xdd57, 0xd834, 0xdd65, 0xd834, 0xdd58,
+	0xd834, 0xdd65, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd6e, 0xd834,
+	0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd6f, 0xd834, 0xdd58, 0xd834, 0xdd65,
+	0xd834, 0xdd70, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd71, 0xd834,
+	0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd72, 0xd834, 0xddb9, 0xd834, 0xdd65,
+	0xd834, 0xddba, 0xd834, 0xdd65, 0xd834, 0xddb9, 0xd834, 0xdd65, 0xd834,
+	0xdd6e, 0xd834, 0xddba, 0xd834, 0xdd65, 0xd834, 0xdd6e, 0xd834, 0xddb9,
+	0xd834, 0xdd65, 0xd834, 0xdd6f, 0xd834, 0xddba, 0xd834, 0xdd65, 0xd834,
+	0xdd6f, 0x0131, 0x0237, 0x0391, 0x0392, 0x0394, 0x0395, 0x0396, 0x0397,
+	0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a1, 0x03a4,
+	0x03a6, 0x03a7, 0x03a8, 0x2207, 0x2202, 0x03dc, 0xd83a, 0xdd22, 0xd83a,
+	0xdd23, 0xd83a, 0xdd24, 0xd83a, 0xdd25, 0xd83a, 0xdd26, 0xd83a, 0xdd27,
+	0xd83a, 0xdd28, 0xd83a, 0xdd29, 0xd83a, 0xdd2a, 0xd83a, 0xdd2b, 0xd83a,
+	0xdd2c, 0xd83a, 0xdd2d, 0xd83a, 0xdd2e, 0xd83a, 0xdd2f, 0xd83a, 0xdd30,
+	0xd83a, 0xdd31, 0xd83a, 0xdd32, 0xd83a, 0xdd33, 0xd83a, 0xdd34, 0xd83a,
+	0xdd35, 0xd83a, 0xdd36, 0xd83a, 0xdd37, 0xd83a, 0xdd38, 0xd83a, 0xdd39,
+	0xd83a, 0xdd3a, 0xd83a, 0xdd3b, 0xd83a, 0xdd3c, 0xd83a, 0xdd3d, 0xd83a,
+	0xdd3e, 0xd83a, 0xdd3f, 0xd83a, 0xdd40, 0xd83a, 0xdd41, 0xd83a, 0xdd42,
+	0xd83a, 0xdd43, 0x066e, 0x06a1, 0x066f, 0x0030, 0x002e, 0x0030, 0x002c,
+	0x0031, 0x002c, 0x0032, 0x002c, 0x0033, 0x002c, 0x0034, 0x002c, 0x0035,
+	0x002c, 0x0036, 0x002c, 0x0037, 0x002c, 0x0038, 0x002c, 0x0039, 0x002c,
+	0x0028, 0x0041, 0x0029, 0x0028, 0x0042, 0x0029, 0x0028, 0x0043, 0x0029,
+	0x0028, 0x0044, 0x0029, 0x0028, 0x0045, 0x0029, 0x0028, 0x0046, 0x0029,
+	0x0028, 0x0047, 0x0029, 0x0028, 0x0048, 0x0029, 0x0028, 0x0049, 0x0029,
+	0x0028, 0x004a, 0x0029, 0x0028, 0x004b, 0x0029, 0x0028, 0x004c, 0x0029,
+	0x0028, 0x004d, 0x0029, 0x0028, 0x004e, 0x0029, 0x0028, 0x004f, 0x0029,
+	0x0028, 0x0050, 0x0029, 0x0028, 0x0051, 0x0029, 0x0028, 0x0052, 0x0029,
+	0x0028, 0x0053, 0x0029, 0x0028, 0x0054, 0x0029, 0x0028, 0x0055, 0x0029,
+	0x0028, 0x0056, 0x0029, 0x0028, 0x0057, 0x0029, 0x0028, 0x0058, 0x0029,
+	0x0028, 0x0059, 0x0029, 0x0028, 0x005a, 0x0029, 0x3014, 0x0053, 0x3015,
+	0x0043, 0x0044, 0x0057, 0x005a, 0x0048, 0x0056, 0x0053, 0x0044, 0x0053,
+	0x0053, 0x0050, 0x0050, 0x0056, 0x0057, 0x0043, 0x004d, 0x0043, 0x004d,
+	0x0044, 0x004d, 0x0052, 0x0044, 0x004a, 0x307b, 0x304b, 0x30b3, 0x30b3,
+	0x5b57, 0x53cc, 0x591a, 0x89e3, 0x4ea4, 0x6620, 0x7121, 0x524d, 0x5f8c,
+	0x518d, 0x65b0, 0x521d, 0x7d42, 0x8ca9, 0x58f0, 0x5439, 0x6f14, 0x6295,
+	0x6355, 0x904a, 0x6307, 0x6253, 0x7981, 0x7a7a, 0x5408, 0x6e80, 0x7533,
+	0x5272, 0x55b6, 0x914d, 0x3014, 0x672c, 0x3015, 0x3014, 0x4e09, 0x3015,
+	0x3014, 0x4e8c, 0x3015, 0x3014, 0x5b89, 0x3015, 0x3014, 0x70b9, 0x3015,
+	0x3014, 0x6253, 0x3015, 0x3014, 0x76d7, 0x3015, 0x3014, 0x52dd, 0x3015,
+	0x3014, 0x6557, 0x3015, 0x5f97, 0x53ef, 0x4e3d, 0x4e38, 0x4e41, 0xd840,
+	0xdd22, 0x4f60, 0x4fbb, 0x5002, 0x507a, 0x5099, 0x50cf, 0x349e, 0xd841,
+	0xde3a, 0x5154, 0x5164, 0x5177, 0xd841, 0xdd1c, 0x34b9, 0x5167, 0xd841,
+	0xdd4b, 0x5197, 0x51a4, 0x4ecc, 0x51ac, 0xd864, 0xdddf, 0x5203, 0x34df,
+	0x523b, 0x5246, 0x5277, 0x3515, 0x5305, 0x5306, 0x5349, 0x535a, 0x5373,
+	0x537d, 0x537f, 0xd842, 0xde2c, 0x7070, 0x53ca, 0x53df, 0xd842, 0xdf63,
+	0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6,
+	0x5510, 0x5553, 0x5563, 0x5584, 0x55ab, 0x55b3, 0x55c2, 0x5716, 0x5717,
+	0x5651, 0x5674, 0x58ee, 0x57ce, 0x57f4, 0x580d, 0x578b, 0x5832, 0x5831,
+	0x58ac, 0xd845, 0xdce4, 0x58f2, 0x58f7, 0x5906, 0x5922, 0x5962, 0xd845,
+	0xdea8, 0xd845, 0xdeea, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee,
+	0x36fc, 0x5b08, 0x5b3e, 0xd846, 0xddc8, 0x5bc3, 0x5bd8, 0x5bf3, 0xd846,
+	0xdf18, 0x5bff, 0x5c06, 0x5f53, 0x3781, 0x5c60, 0x5cc0, 0x5c8d, 0xd847,
+	0xdde4, 0x5d43, 0xd847, 0xdde6, 0x5d6e, 0x5d6b, 0x5d7c, 0x5de1, 0x5de2,
+	0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69, 0x3862, 0xd848, 0xdd83, 0x387c,
+	0x5eb0, 0x5eb3, 0x5eb6, 0xd868, 0xdf92, 0xd848, 0xdf31, 0x8201, 0x5f22,
+	0x38c7, 0xd84c, 0xdeb8, 0xd858, 0xddda, 0x5f62, 0x5f6b, 0x38e3, 0x5f9a,
+	0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a, 0x391c, 0xd849, 0xded4, 0x60c7,
+	0x6148, 0x614c, 0x617a, 0x61b2, 0x61a4, 0x61af, 0x61de, 0x6210, 0x621b,
+	0x625d, 0x62b1, 0x62d4, 0x6350, 0xd84a, 0xdf0c, 0x633d, 0x62fc, 0x6368,
+	0x6383, 0x63e4, 0xd84a, 0xdff1, 0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469,
+	0x647e, 0x649d, 0x6477, 0x3a6c, 0x656c, 0xd84c, 0xdc0a, 0x65e3, 0x66f8,
+	0x6649, 0x3b19, 0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad,
+	0x43d9, 0x6721, 0x675e, 0x6753, 0xd84c, 0xdfc3, 0x3b49, 0x67fa, 0x6785,
+	0x6852, 0xd84d, 0xdc6d, 0x688e, 0x681f, 0x6914, 0x6942, 0x69a3, 0x69ea,
+	0x6aa8, 0xd84d, 0xdea3, 0x6adb, 0x3c18, 0x6b21, 0xd84e, 0xdca7, 0x6b54,
+	0x3c4e, 0x6b72, 0x6b9f, 0x6bbb, 0xd84e, 0xde8d, 0xd847, 0xdd0b, 0xd84e,
+	0xdefa, 0x6c4e, 0xd84f, 0xdcbc, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16, 0x6d3e,
+	0x6d69, 0x6d78, 0x6d85, 0xd84f, 0xdd1e, 0x6d34, 0x6e2f, 0x6e6e, 0x3d33,
+	0x6ec7, 0xd84f, 0xded1, 0x6df9, 0x6f6e, 0xd84f, 0xdf5e, 0xd84f, 0xdf8e,
+	0x6fc6, 0x7039, 0x701b, 0x3d96, 0x704a, 0x707d, 0x7077, 0x70ad, 0xd841,
+	0xdd25, 0x7145, 0xd850, 0xde63, 0x719c, 0xd850, 0xdfab, 0x7228, 0x7250,
+	0xd851, 0xde08, 0x7280, 0x7295, 0xd851, 0xdf35, 0xd852, 0xdc14, 0x737a,
+	0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x7447, 0x745c, 0x7485, 0x74ca, 0x3f1b,
+	0x7524, 0xd853, 0xdc36, 0x753e, 0xd853, 0xdc92, 0xd848, 0xdd9f, 0x7610,
+	0xd853, 0xdfa1, 0xd853, 0xdfb8, 0xd854, 0xdc44, 0x3ffc, 0x4008, 0xd854,
+	0xdcf3, 0xd854, 0xdcf2, 0xd854, 0xdd19, 0xd854, 0xdd33, 0x771e, 0x771f,
+	0x778b, 0x4046, 0x4096, 0xd855, 0xdc1d, 0x784e, 0x40e3, 0xd855, 0xde26,
+	0xd855, 0xde9a, 0xd855, 0xdec5, 0x79eb, 0x412f, 0x7a4a, 0x7a4f, 0xd856,
+	0xdd7c, 0xd856, 0xdea7, 0x7aee, 0x4202, 0xd856, 0xdfab, 0x7bc6, 0x7bc9,
+	0x4227, 0xd857, 0xdc80, 0x7cd2, 0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0xd857,
+	0xdf86, 0x7d63, 0x4301, 0x7dc7, 0x7e02, 0x7e45, 0x4334, 0xd858, 0xde28,
+	0xd858, 0xde47, 0x4359, 0xd858, 0xded9, 0x7f7a, 0xd858, 0xdf3e, 0x7f95,
+	0x7ffa, 0xd859, 0xdcda, 0xd859, 0xdd23, 0x8060, 0xd859, 0xdda8, 0x8070,
+	0xd84c, 0xdf5f, 0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5, 0xd859,
+	0xdfa7, 0xd859, 0xdfb5, 0xd84c, 0xdf93, 0xd84c, 0xdf9c, 0x8204, 0x8f9e,
+	0x446b, 0x8291, 0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6,
+	0xd85a, 0xdf3c, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7, 0x8353,
+	0x83ca, 0x83cc, 0x83dc, 0xd85b, 0xdc36, 0xd85b, 0xdd6b, 0xd85b, 0xdcd5,
+	0x452b, 0x84f1, 0x84f3, 0x8516, 0xd85c, 0xdfca, 0x8564, 0xd85b, 0xdf2c,
+	0x455d, 0x4561, 0xd85b, 0xdfb1, 0xd85c, 0xdcd2, 0x456b, 0x8650, 0x8667,
+	0x8669, 0x86a9, 0x8688, 0x870e, 0x86e2, 0x8728, 0x876b, 0x8786, 0x45d7,
+	0x87e1, 0x8801, 0x45f9, 0x8860, 0xd85d, 0xde67, 0x88d7, 0x88de, 0x4635,
+	0x88fa, 0x34bb, 0xd85e, 0xdcae, 0xd85e, 0xdd66, 0x46be, 0x46c7, 0x8aa0,
+	0xd85f, 0xdca8, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77, 0xd85f, 0xdf2f, 0xd842,
+	0xdc04, 0x8dcb, 0x8dbc, 0x8df0, 0xd842, 0xdcde, 0x8ed4, 0xd861, 0xddd2,
+	0xd861, 0xdded, 0x9094, 0x90f1, 0x9111, 0xd861, 0xdf2e, 0x911b, 0x9238,
+	0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0xd862, 0xdffa, 0x958b, 0x4995,
+	0x95b7, 0xd863, 0xdd77, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0xd864, 0xdd45,
+	0xd864, 0xde1a, 0x4a6e, 0x4a76, 0x97e0, 0xd865, 0xdc0a, 0x4ab2, 0xd865,
+	0xdc96, 0x9829, 0xd865, 0xddb6, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2,
+	0x99fe, 0x4bce, 0xd866, 0xdf30, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67,
+	0xd868, 0xdcce, 0x4cf8, 0xd868, 0xdd05, 0xd868, 0xde0e, 0xd868, 0xde91,
+	0x4d56, 0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0xd869, 0xde00,
+};
+
+static const uint32_t sn_canon_k[2061] = {
+	0x020000c0, 0x020000c1, 0x020000c2, 0x020000c3, 0x020000c4, 0x020000c5,
+	0x020000c7, 0x020000c8, 0x020000c9, 0x020000ca, 0x020000cb, 0x020000cc,
+	0x020000cd, 0x020000ce, 0x020000cf, 0x020000d1, 0x020000d2, 0x020000d3,
+	0x020000d4, 0x020000d5, 0x020000d6, 0x020000d9, 0x020000da, 0x020000db,
+	0x020000dc, 0x020000dd, 0x020000e0, 0x020000e1, 0x020000e2, 0x020000e3,
+	0x020000e4, 0x020000e5, 0x020000e7, 0x020000e8, 0x020000e9, 0x020000ea,
+	0x020000eb, 0x020000ec, 0x020000ed, 0x020000ee, 0x020000ef, 0x020000f1,
+	0x020000f2, 0x020000f3, 0x020000f4, 0x020000f5, 0x020000f6, 0x020000f9,
+	0x020000fa, 0x020000fb, 0x020000fc, 0x020000fd, 0x020000ff, 0x02000100,
+	0x02000101, 0x02000102, 0x02000103, 0x02000104, 0x02000105, 0x02000106,
+	0x02000107, 0x02000108, 0x02000109, 0x0200010a, 0x0200010b, 0x0200010c,
+	0x0200010d, 0x0200010e, 0x0200010f, 0x02000112, 0x02000113, 0x02000114,
+	0x02000115, 0x02000116, 0x02000117, 0x02000118, 0x02000119, 0x0200011a,
+	0x0200011b, 0x0200011c, 0x0200011d, 0x0200011e, 0x0200011f, 0x02000120,
+	0x02000121, 0x02000122, 0x02000123, 0x02000124, 0x02000125, 0x02000128,
+	0x02000129, 0x0200012a, 0x0200012b, 0x0200012c, 0x0200012d, 0x0200012e,
+	0x0200012f, 0x02000130, 0x02000134, 0x02000135, 0x02000136, 0x02000137,
+	0x02000139, 0x0200013a, 0x0200013b, 0x0200013c, 0x0200013d, 0x0200013e,
+	0x02000143, 0x02000144, 0x02000145, 0x02000146, 0x02000147, 0x02000148,
+	0x0200014c, 0x0200014d, 0x0200014e, 0x0200014f, 0x02000150, 0x02000151,
+	0x02000154, 0x02000155, 0x02000156, 0x02000157, 0x02000158, 0x02000159,
+	0x0200015a, 0x0200015b, 0x0200015c, 0x0200015d, 0x0200015e, 0x0200015f,
+	0x02000160, 0x02000161, 0x02000162, 0x02000163, 0x02000164, 0x02000165,
+	0x02000168, 0x02000169, 0x0200016a, 0x0200016b, 0x0200016c, 0x0200016d,
+	0x0200016e, 0x0200016f, 0x02000170, 0x02000171, 0x02000172, 0x02000173,
+	0x02000174, 0x02000175, 0x02000176, 0x02000177, 0x02000178, 0x02000179,
+	0x0200017a, 0x0200017b, 0x0200017c, 0x0200017d, 0x0200017e, 0x020001a0,
+	0x020001a1, 0x020001af, 0x020001b0, 0x020001cd, 0x020001ce, 0x020001cf,
+	0x020001d0, 0x020001d1, 0x020001d2, 0x020001d3, 0x020001d4, 0x030001d5,
+	0x030001d6, 0x030001d7, 0x030001d8, 0x030001d9, 0x030001da, 0x030001db,
+	0x030001dc, 0x030001de, 0x030001df, 0x030001e0, 0x030001e1, 0x020001e2,
+	0x020001e3, 0x020001e6, 0x020001e7, 0x020001e8, 0x020001e9, 0x020001ea,
+	0x020001eb, 0x030001ec, 0x030001ed, 0x020001ee, 0x020001ef, 0x020001f0,
+	0x020001f4, 0x020001f5, 0x020001f8, 0x020001f9, 0x030001fa, 0x030001fb,
+	0x020001fc, 0x020001fd, 0x020001fe, 0x020001ff, 0x02000200, 0x02000201,
+	0x02000202, 0x02000203, 0x02000204, 0x02000205, 0x02000206, 0x02000207,
+	0x02000208, 0x02000209, 0x0200020a, 0x0200020b, 0x0200020c, 0x0200020d,
+	0x0200020e, 0x0200020f, 0x02000210, 0x02000211, 0x02000212, 0x02000213,
+	0x02000214, 0x02000215, 0x02000216, 0x02000217, 0x02000218, 0x02000219,
+	0x0200021a, 0x0200021b, 0x0200021e, 0x0200021f, 0x02000226, 0x02000227,
+	0x02000228, 0x02000229, 0x0300022a, 0x0300022b, 0x0300022c, 0x0300022d,
+	0x0200022e, 0x0200022f, 0x03000230, 0x03000231, 0x02000232, 0x02000233,
+	0x01000340, 0x01000341, 0x01000343, 0x02000344, 0x01000374, 0x0100037e,
+	0x02000385, 0x02000386, 0x01000387, 0x02000388, 0x02000389, 0x0200038a,
+	0x0200038c, 0x0200038e, 0x0200038f, 0x03000390, 0x020003aa, 0x020003ab,
+	0x020003ac, 0x020003ad, 0x020003ae, 0x020003af, 0x030003b0, 0x020003ca,
+	0x020003cb, 0x020003cc, 0x020003cd, 0x020003ce, 0x020003d3, 0x020003d4,
+	0x02000400, 0x02000401, 0x02000403, 0x02000407, 0x0200040c, 0x0200040d,
+	0x0200040e, 0x02000419, 0x02000439, 0x02000450, 0x02000451, 0x02000453,
+	0x02000457, 0x0200045c, 0x0200045d, 0x0200045e, 0x02000476, 0x02000477,
+	0x020004c1, 0x020004c2, 0x020004d0, 0x020004d1, 0x020004d2, 0x020004d3,
+	0x020004d6, 0x020004d7, 0x020004da, 0x020004db, 0x020004dc, 0x020004dd,
+	0x020004de, 0x020004df, 0x020004e2, 0x020004e3, 0x020004e4, 0x020004e5,
+	0x020004e6, 0x020004e7, 0x020004ea, 0x020004eb, 0x020004ec, 0x020004ed,
+	0x020004ee, 0x020004ef, 0x020004f0, 0x020004f1, 0x020004f2, 0x020004f3,
+	0x020004f4, 0x020004f5, 0x020004f8, 0x020004f9, 0x02000622, 0x02000623,
+	0x02000624, 0x02000625, 0x02000626, 0x020006c0, 0x020006c2, 0x020006d3,
+	0x02000929, 0x02000931, 0x02000934, 0x02000958, 0x02000959, 0x0200095a,
+	0x0200095b, 0x0200095c, 0x0200095d, 0x0200095e, 0x0200095f, 0x020009cb,
+	0x020009cc, 0x020009dc, 0x020009dd, 0x020009df, 0x02000a33, 0x02000a36,
+	0x02000a59, 0x02000a5a, 0x02000a5b, 0x02000a5e, 0x02000b48, 0x02000b4b,
+	0x02000b4c, 0x02000b5c, 0x02000b5d, 0x02000b94, 0x02000bca, 0x02000bcb,
+	0x02000bcc, 0x02000c48, 0x02000cc0, 0x02000cc7, 0x02000cc8, 0x02000cca,
+	0x03000ccb, 0x02000d4a, 0x02000d4b, 0x02000d4c, 0x02000dda, 0x02000ddc,
+	0x03000ddd, 0x02000dde, 0x02000f43, 0x02000f4d, 0x02000f52, 0x02000f57,
+	0x02000f5c, 0x02000f69, 0x02000f73, 0x02000f75, 0x02000f76, 0x02000f78,
+	0x02000f81, 0x02000f93, 0x02000f9d, 0x02000fa2, 0x02000fa7, 0x02000fac,
+	0x02000fb9, 0x02001026, 0x02001b06, 0x02001b08, 0x02001b0a, 0x02001b0c,
+	0x02001b0e, 0x02001b12, 0x02001b3b, 0x02001b3d, 0x02001b40, 0x02001b41,
+	0x02001b43, 0x02001e00, 0x02001e01, 0x02001e02, 0x02001e03, 0x02001e04,
+	0x02001e05, 0x02001e06, 0x02001e07, 0x03001e08, 0x03001e09, 0x02001e0a,
+	0x02001e0b, 0x02001e0c, 0x02001e0d, 0x02001e0e, 0x02001e0f, 0x02001e10,
+	0x02001e11, 0x02001e12, 0x02001e13, 0x03001e14, 0x03001e15, 0x03001e16,
+	0x03001e17, 0x02001e18, 0x02001e19, 0x02001e1a, 0x02001e1b, 0x03001e1c,
+	0x03001e1d, 0x02001e1e, 0x02001e1f, 0x02001e20, 0x02001e21, 0x02001e22,
+	0x02001e23, 0x02001e24, 0x02001e25, 0x02001e26, 0x02001e27, 0x02001e28,
+	0x02001e29, 0x02001e2a, 0x02001e2b, 0x02001e2c, 0x02001e2d, 0x03001e2e,
+	0x03001e2f, 0x02001e30, 0x02001e31, 0x02001e32, 0x02001e33, 0x02001e34,
+	0x02001e35, 0x02001e36, 0x02001e37, 0x03001e38, 0x03001e39, 0x02001e3a,
+	0x02001e3b, 0x02001e3c, 0x02001e3d, 0x02001e3e, 0x02001e3f, 0x02001e40,
+	0x02001e41, 0x02001e42, 0x02001e43, 0x02001e44, 0x02001e45, 0x02001e46,
+	0x02001e47, 0x02001e48, 0x02001e49, 0x02001e4a, 0x02001e4b, 0x03001e4c,
+	0x03001e4d, 0x03001e4e, 0x03001e4f, 0x03001e50, 0x03001e51, 0x03001e52,
+	0x03001e53, 0x02001e54, 0x02001e55, 0x02001e56, 0x02001e57, 0x02001e58,
+	0x02001e59, 0x02001e5a, 0x02001e5b, 0x03001e5c, 0x03001e5d, 0x02001e5e,
+	0x02001e5f, 0x02001e60, 0x02001e61, 0x02001e62, 0x02001e63, 0x03001e64,
+	0x03001e65, 0x03001e66, 0x03001e67, 0x03001e68, 0x03001e69, 0x02001e6a,
+	0x02001e6b, 0x02001e6c, 0x02001e6d, 0x02001e6e, 0x02001e6f, 0x02001e70,
+	0x02001e71, 0x02001e72, 0x02001e73, 0x02001e74, 0x02001e75, 0x02001e76,
+	0x02001e77, 0x03001e78, 0x03001e79, 0x03001e7a, 0x03001e7b, 0x02001e7c,
+	0x02001e7d, 0x02001e7e, 0x02001e7f, 0x02001e80, 0x02001e81, 0x02001e82,
+	0x02001e83, 0x02001e84, 0x02001e85, 0x02001e86, 0x02001e87, 0x02001e88,
+	0x02001e89, 0x02001e8a, 0x02001e8b, 0x02001e8c, 0x02001e8d, 0x02001e8e,
+	0x02001e8f, 0x02001e90, 0x02001e91, 0x02001e92, 0x02001e93, 0x02001e94,
+	0x02001e95, 0x02001e96, 0x02001e97, 0x02001e98, 0x02001e99, 0x02001e9b,
+	0x02001ea0, 0x02001ea1, 0x02001ea2, 0x02001ea3, 0x03001ea4, 0x03001ea5,
+	0x03001ea6, 0x03001ea7, 0x03001ea8, 0x03001ea9, 0x03001eaa, 0x03001eab,
+	0x03001eac, 0x03001ead, 0x03001eae, 0x03001eaf, 0x03001eb0, 0x03001eb1,
+	0x03001eb2, 0x03001eb3, 0x03001eb4, 0x03001eb5, 0x03001eb6, 0x03001eb7,
+	0x02001eb8, 0x02001eb9, 0x02001eba, 0x02001ebb, 0x02001ebc, 0x02001ebd,
+	0x03001ebe, 0x03001ebf, 0x03001ec0, 0x03001ec1, 0x03001ec2, 0x03001ec3,
+	0x03001ec4, 0x03001ec5, 0x03001ec6, 0x03001ec7, 0x02001ec8, 0x02001ec9,
+	0x02001eca, 0x02001ecb, 0x02001ecc, 0x02001ecd, 0x02001ece, 0x02001ecf,
+	0x03001ed0, 0x03001ed1, 0x03001ed2, 0x03001ed3, 0x03001ed4, 0x03001ed5,
+	0x03001ed6, 0x03001ed7, 0x03001ed8, 0x03001ed9, 0x03001eda, 0x03001edb,
+	0x03001edc, 0x03001edd, 0x03001ede, 0x03001edf, 0x03001ee0, 0x03001ee1,
+	0x03001ee2, 0x03001ee3, 0x02001ee4, 0x02001ee5, 0x02001ee6, 0x02001ee7,
+	0x03001ee8, 0x03001ee9, 0x03001eea, 0x03001eeb, 0x03001eec, 0x03001eed,
+	0x03001eee, 0x03001eef, 0x03001ef0, 0x03001ef1, 0x02001ef2, 0x02001ef3,
+	0x02001ef4, 0x02001ef5, 0x02001ef6, 0x02001ef7, 0x02001ef8, 0x02001ef9,
+	0x02001f00, 0x02001f01, 0x03001f02, 0x03001f03, 0x03001f04, 0x03001f05,
+	0x03001f06, 0x03001f07, 0x02001f08, 0x02001f09, 0x03001f0a, 0x03001f0b,
+	0x03001f0c, 0x03001f0d, 0x03001f0e, 0x03001f0f, 0x02001f10, 0x02001f11,
+	0x03001f12, 0x03001f13, 0x03001f14, 0x03001f15, 0x02001f18, 0x02001f19,
+	0x03001f1a, 0x03001f1b, 0x03001f1c, 0x03001f1d, 0x02001f20, 0x02001f21,
+	0x03001f22, 0x03001f23, 0x03001f24, 0x03001f25, 0x03001f26, 0x03001f27,
+	0x02001f28, 0x02001f29, 0x03001f2a, 0x03001f2b, 0x03001f2c, 0x03001f2d,
+	0x03001f2e, 0x03001f2f, 0x02001f30, 0x02001f31, 0x03001f32, 0x03001f33,
+	0x03001f34, 0x03001f35, 0x03001f36, 0x03001f37, 0x02001f38, 0x02001f39,
+	0x03001f3a, 0x03001f3b, 0x03001f3c, 0x03001f3d, 0x03001f3e, 0x03001f3f,
+	0x02001f40, 0x02001f41, 0x03001f42, 0x03001f43, 0x03001f44, 0x03001f45,
+	0x02001f48, 0x02001f49, 0x03001f4a, 0x03001f4b, 0x03001f4c, 0x03001f4d,
+	0x02001f50, 0x02001f51, 0x03001f52, 0x03001f53, 0x03001f54, 0x03001f55,
+	0x03001f56, 0x03001f57, 0x02001f59, 0x03001f5b, 0x03001f5d, 0x03001f5f,
+	0x02001f60, 0x02001f61, 0x03001f62, 0x03001f63, 0x03001f64, 0x03001f65,
+	0x03001f66, 0x03001f67, 0x02001f68, 0x02001f69, 0x03001f6a, 0x03001f6b,
+	0x03001f6c, 0x03001f6d, 0x03001f6e, 0x03001f6f, 0x02001f70, 0x02001f71,
+	0x02001f72, 0x02001f73, 0x02001f74, 0x02001f75, 0x02001f76, 0x02001f77,
+	0x02001f78, 0x02001f79, 0x02001f7a, 0x02001f7b, 0x02001f7c, 0x02001f7d,
+	0x03001f80, 0x03001f81, 0x04001f82, 0x04001f83, 0x04001f84, 0x04001f85,
+	0x04001f86, 0x04001f87, 0x03001f88, 0x03001f89, 0x04001f8a, 0x04001f8b,
+	0x04001f8c, 0x04001f8d, 0x04001f8e, 0x04001f8f, 0x03001f90, 0x03001f91,
+	0x04001f92, 0x04001f93, 0x04001f94, 0x04001f95, 0x04001f96, 0x04001f97,
+	0x03001f98, 0x03001f99, 0x04001f9a, 0x04001f9b, 0x04001f9c, 0x04001f9d,
+	0x04001f9e, 0x04001f9f, 0x03001fa0, 0x03001fa1, 0x04001fa2, 0x04001fa3,
+	0x04001fa4, 0x04001fa5, 0x04001fa6, 0x04001fa7, 0x03001fa8, 0x03001fa9,
+	0x04001faa, 0x04001fab, 0x04001fac, 0x04001fad, 0x04001fae, 0x04001faf,
+	0x02001fb0, 0x02001fb1, 0x03001fb2, 0x02001fb3, 0x03001fb4, 0x02001fb6,
+	0x03001fb7, 0x02001fb8, 0x02001fb9, 0x02001fba, 0x02001fbb, 0x02001fbc,
+	0x01001fbe, 0x02001fc1, 0x03001fc2, 0x02001fc3, 0x03001fc4, 0x02001fc6,
+	0x03001fc7, 0x02001fc8, 0x02001fc9, 0x02001fca, 0x02001fcb, 0x02001fcc,
+	0x02001fcd, 0x02001fce, 0x02001fcf, 0x02001fd0, 0x02001fd1, 0x03001fd2,
+	0x03001fd3, 0x02001fd6, 0x03001fd7, 0x02001fd8, 0x02001fd9, 0x02001fda,
+	0x02001fdb, 0x02001fdd, 0x02001fde, 0x02001fdf, 0x02001fe0, 0x02001fe1,
+	0x03001fe2, 0x03001fe3, 0x02001fe4, 0x02001fe5, 0x02001fe6, 0x03001fe7,
+	0x02001fe8, 0x02001fe9, 0x02001fea, 0x02001feb, 0x02001fec, 0x02001fed,
+	0x02001fee, 0x01001fef, 0x03001ff2, 0x02001ff3, 0x03001ff4, 0x02001ff6,
+	0x03001ff7, 0x02001ff8, 0x02001ff9, 0x02001ffa, 0x02001ffb, 0x02001ffc,
+	0x01001ffd, 0x01002000, 0x01002001, 0x01002126, 0x0100212a, 0x0200212b,
+	0x0200219a, 0x0200219b, 0x020021ae, 0x020021cd, 0x020021ce, 0x020021cf,
+	0x02002204, 0x02002209, 0x0200220c, 0x02002224, 0x02002226, 0x02002241,
+	0x02002244, 0x02002247, 0x02002249, 0x02002260, 0x02002262, 0x0200226d,
+	0x0200226e, 0x0200226f, 0x02002270, 0x02002271, 0x02002274, 0x02002275,
+	0x02002278, 0x02002279, 0x02002280, 0x02002281, 0x02002284, 0x02002285,
+	0x02002288, 0x02002289, 0x020022ac, 0x020022ad, 0x020022ae, 0x020022af,
+	0x020022e0, 0x020022e1, 0x020022e2, 0x020022e3, 0x020022ea, 0x020022eb,
+	0x020022ec, 0x020022ed, 0x01002329, 0x0100232a, 0x02002adc, 0x0200304c,
+	0x0200304e, 0x02003050, 0x02003052, 0x02003054, 0x02003056, 0x02003058,
+	0x0200305a, 0x0200305c, 0x0200305e, 0x02003060, 0x02003062, 0x02003065,
+	0x02003067, 0x02003069, 0x02003070, 0x02003071, 0x02003073, 0x02003074,
+	0x02003076, 0x02003077, 0x02003079, 0x0200307a, 0x0200307c, 0x0200307d,
+	0x02003094, 0x0200309e, 0x020030ac, 0x020030ae, 0x020030b0, 0x020030b2,
+	0x020030b4, 0x020030b6, 0x020030b8, 0x020030ba, 0x020030bc, 0x020030be,
+	0x020030c0, 0x020030c2, 0x020030c5, 0x020030c7, 0x020030c9, 0x020030d0,
+	0x020030d1, 0x020030d3, 0x020030d4, 0x020030d6, 0x020030d7, 0x020030d9,
+	0x020030da, 0x020030dc, 0x020030dd, 0x020030f4, 0x020030f7, 0x020030f8,
+	0x020030f9, 0x020030fa, 0x020030fe, 0x0100f900, 0x0100f901, 0x0100f902,
+	0x0100f903, 0x0100f904, 0x0100f905, 0x0100f906, 0x0100f907, 0x0100f908,
+	0x0100f909, 0x0100f90a, 0x0100f90b, 0x0100f90c, 0x0100f90d, 0x0100f90e,
+	0x0100f90f, 0x0100f910, 0x0100f911, 0x0100f912, 0x0100f913, 0x0100f914,
+	0x0100f915, 0x0100f916, 0x0100f917, 0x0100f918, 0x0100f919, 0x0100f91a,
+	0x0100f91b, 0x0100f91c, 0x0100f91d, 0x0100f91e, 0x0100f91f, 0x0100f920,
+	0x0100f921, 0x0100f922, 0x0100f923, 0x0100f924, 0x0100f925, 0x0100f926,
+	0x0100f927, 0x0100f928, 0x0100f929, 0x0100f92a, 0x0100f92b, 0x0100f92c,
+	0x0100f92d, 0x0100f92e, 0x0100f92f, 0x0100f930, 0x0100f931, 0x0100f932,
+	0x0100f933, 0x0100f934, 0x0100f935, 0x0100f936, 0x0100f937, 0x0100f938,
+	0x0100f939, 0x0100f93a, 0x0100f93b, 0x0100f93c, 0x0100f93d, 0x0100f93e,
+	0x0100f93f, 0x0100f940, 0x0100f941, 0x0100f942, 0x0100f943, 0x0100f944,
+	0x0100f945, 0x0100f946, 0x0100f947, 0x0100f948, 0x0100f949, 0x0100f94a,
+	0x0100f94b, 0x0100f94c, 0x0100f94d, 0x0100f94e, 0x0100f94f, 0x0100f950,
+	0x0100f951, 0x0100f952, 0x0100f953, 0x0100f954, 0x0100f955, 0x0100f956,
+	0x0100f957, 0x0100f958, 0x0100f959, 0x0100f95a, 0x0100f95b, 0x0100f95c,
+	0x0100f95d, 0x0100f95e, 0x0100f95f, 0x0100f960, 0x0100f961, 0x0100f962,
+	0x0100f963, 0x0100f964, 0x0100f965, 0x0100f966, 0x0100f967, 0x0100f968,
+	0x0100f969, 0x0100f96a, 0x0100f96b, 0x0100f96c, 0x0100f96d, 0x0100f96e,
+	0x0100f96f, 0x0100f970, 0x0100f971, 0x0100f972, 0x0100f973, 0x0100f974,
+	0x0100f975, 0x0100f976, 0x0100f977, 0x0100f978, 0x0100f979, 0x0100f97a,
+	0x0100f97b, 0x0100f97c, 0x0100f97d, 0x0100f97e, 0x0100f97f, 0x0100f980,
+	0x0100f981, 0x0100f982, 0x0100f983, 0x0100f984, 0x0100f985, 0x0100f986,
+	0x0100f987, 0x0100f988, 0x0100f989, 0x0100f98a, 0x0100f98b, 0x0100f98c,
+	0x0100f98d, 0x0100f98e, 0x0100f98f, 0x0100f990, 0x0100f991, 0x0100f992,
+	0x0100f993, 0x0100f994, 0x0100f995, 0x0100f996, 0x0100f997, 0x0100f998,
+	0x0100f999, 0x0100f99a, 0x0100f99b, 0x0100f99c, 0x0100f99d, 0x0100f99e,
+	0x0100f99f, 0x0100f9a0, 0x0100f9a1, 0x0100f9a2, 0x0100f9a3, 0x0100f9a4,
+	0x0100f9a5, 0x0100f9a6, 0x0100f9a7, 0x0100f9a8, 0x0100f9a9, 0x0100f9aa,
+	0x0100f9ab, 0x0100f9ac, 0x0100f9ad, 0x0100f9ae, 0x0100f9af, 0x0100f9b0,
+	0x0100f9b1, 0x0100f9b2, 0x0100f9b3, 0x0100f9b4, 0x0100f9b5, 0x0100f9b6,
+	0x0100f9b7, 0x0100f9b8, 0x0100f9b9, 0x0100f9ba, 0x0100f9bb, 0x0100f9bc,
+	0x0100f9bd, 0x0100f9be, 0x0100f9bf, 0x0100f9c0, 0x0100f9c1, 0x0100f9c2,
+	0x0100f9c3, 0x0100f9c4, 0x0100f9c5, 0x0100f9c6, 0x0100f9c7, 0x0100f9c8,
+	0x0100f9c9, 0x0100f9ca, 0x0100f9cb, 0x0100f9cc, 0x0100f9cd, 0x0100f9ce,
+	0x0100f9cf, 0x0100f9d0, 0x0100f9d1, 0x0100f9d2, 0x0100f9d3, 0x0100f9d4,
+	0x0100f9d5, 0x0100f9d6, 0x0100f9d7, 0x0100f9d8, 0x0100f9d9, 0x0100f9da,
+	0x0100f9db, 0x0100f9dc, 0x0100f9dd, 0x0100f9de, 0x0100f9df, 0x0100f9e0,
+	0x0100f9e1, 0x0100f9e2, 0x0100f9e3, 0x0100f9e4, 0x0100f9e5, 0x0100f9e6,
+	0x0100f9e7, 0x0100f9e8, 0x0100f9e9, 0x0100f9ea, 0x0100f9eb, 0x0100f9ec,
+	0x0100f9ed, 0x0100f9ee, 0x0100f9ef, 0x0100f9f0, 0x0100f9f1, 0x0100f9f2,
+	0x0100f9f3, 0x0100f9f4, 0x0100f9f5, 0x0100f9f6, 0x0100f9f7, 0x0100f9f8,
+	0x0100f9f9, 0x0100f9fa, 0x0100f9fb, 0x0100f9fc, 0x0100f9fd, 0x0100f9fe,
+	0x0100f9ff, 0x0100fa00, 0x0100fa01, 0x0100fa02, 0x0100fa03, 0x0100fa04,
+	0x0100fa05, 0x0100fa06, 0x0100fa07, 0x0100fa08, 0x0100fa09, 0x0100fa0a,
+	0x0100fa0b, 0x0100fa0c, 0x0100fa0d, 0x0100fa10, 0x0100fa12, 0x0100fa15,
+	0x0100fa16, 0x0100fa17, 0x0100fa18, 0x0100fa19, 0x0100fa1a, 0x0100fa1b,
+	0x0100fa1c, 0x0100fa1d, 0x0100fa1e, 0x0100fa20, 0x0100fa22, 0x0100fa25,
+	0x0100fa26, 0x0100fa2a, 0x0100fa2b, 0x0100fa2c, 0x0100fa2d, 0x0100fa2e,
+	0x0100fa2f, 0x0100fa30, 0x0100fa31, 0x0100fa32, 0x0100fa33, 0x0100fa34,
+	0x0100fa35, 0x0100fa36, 0x0100fa37, 0x0100fa38, 0x0100fa39, 0x0100fa3a,
+	0x0100fa3b, 0x0100fa3c, 0x0100fa3d, 0x0100fa3e, 0x0100fa3f, 0x0100fa40,
+	0x0100fa41, 0x0100fa42, 0x0100fa43, 0x0100fa44, 0x0100fa45, 0x0100fa46,
+	0x0100fa47, 0x0100fa48, 0x0100fa49, 0x0100fa4a, 0x0100fa4b, 0x0100fa4c,
+	0x0100fa4d, 0x0100fa4e, 0x0100fa4f, 0x0100fa50, 0x0100fa51, 0x0100fa52,
+	0x0100fa53, 0x0100fa54, 0x0100fa55, 0x0100fa56, 0x0100fa57, 0x0100fa58,
+	0x0100fa59, 0x0100fa5a, 0x0100fa5b, 0x0100fa5c, 0x0100fa5d, 0x0100fa5e,
+	0x0100fa5f, 0x0100fa60, 0x0100fa61, 0x0100fa62, 0x0100fa63, 0x0100fa64,
+	0x0100fa65, 0x0100fa66, 0x0100fa67, 0x0100fa68, 0x0100fa69, 0x0100fa6a,
+	0x0100fa6b, 0x0200fa6c, 0x0100fa6d, 0x0100fa70, 0x0100fa71, 0x0100fa72,
+	0x0100fa73, 0x0100fa74, 0x0100fa75, 0x0100fa76, 0x0100fa77, 0x0100fa78,
+	0x0100fa79, 0x0100fa7a, 0x0100fa7b, 0x0100fa7c, 0x0100fa7d, 0x0100fa7e,
+	0x0100fa7f, 0x0100fa80, 0x0100fa81, 0x0100fa82, 0x0100fa83, 0x0100fa84,
+	0x0100fa85, 0x0100fa86, 0x0100fa87, 0x0100fa88, 0x0100fa89, 0x0100fa8a,
+	0x0100fa8b, 0x0100fa8c, 0x0100fa8d, 0x0100fa8e, 0x0100fa8f, 0x0100fa90,
+	0x0100fa91, 0x0100fa92, 0x0100fa93, 0x0100fa94, 0x0100fa95, 0x0100fa96,
+	0x0100fa97, 0x0100fa98, 0x0100fa99, 0x0100fa9a, 0x0100fa9b, 0x0100fa9c,
+	0x0100fa9d, 0x0100fa9e, 0x0100fa9f, 0x0100faa0, 0x0100faa1, 0x0100faa2,
+	0x0100faa3, 0x0100faa4, 0x0100faa5, 0x0100faa6, 0x0100faa7, 0x0100faa8,
+	0x0100faa9, 0x0100faaa, 0x0100faab, 0x0100faac, 0x0100faad, 0x0100faae,
+	0x0100faaf, 0x0100fab0, 0x0100fab1, 0x0100fab2, 0x0100fab3, 0x0100fab4,
+	0x0100fab5, 0x0100fab6, 0x0100fab7, 0x0100fab8, 0x0100fab9, 0x0100faba,
+	0x0100fabb, 0x0100fabc, 0x0100fabd, 0x0100fabe, 0x0100fabf, 0x0100fac0,
+	0x0100fac1, 0x0100fac2, 0x0100fac3, 0x0100fac4, 0x0100fac5, 0x0100fac6,
+	0x0100fac7, 0x0100fac8, 0x0100fac9, 0x0100faca, 0x0100facb, 0x0100facc,
+	0x0100facd, 0x0100face, 0x0200facf, 0x0200fad0, 0x0200fad1, 0x0100fad2,
+	0x0100fad3, 0x0100fad4, 0x0200fad5, 0x0200fad6, 0x0200fad7, 0x0100fad8,
+	0x0100fad9, 0x0200fb1d, 0x0200fb1f, 0x0200fb2a, 0x0200fb2b, 0x0300fb2c,
+	0x0300fb2d, 0x0200fb2e, 0x0200fb2f, 0x0200fb30, 0x0200fb31, 0x0200fb32,
+	0x0200fb33, 0x0200fb34, 0x0200fb35, 0x0200fb36, 0x0200fb38, 0x0200fb39,
+	0x0200fb3a, 0x0200fb3b, 0x0200fb3c, 0x0200fb3e, 0x0200fb40, 0x0200fb41,
+	0x0200fb43, 0x0200fb44, 0x0200fb46, 0x0200fb47, 0x0200fb48, 0x0200fb49,
+	0x0200fb4a, 0x0200fb4b, 0x0200fb4c, 0x0200fb4d, 0x0200fb4e, 0x0401109a,
+	0x0401109c, 0x040110ab, 0x0401112e, 0x0401112f, 0x0401134b, 0x0401134c,
+	0x040114bb, 0x040114bc, 0x040114be, 0x040115ba, 0x040115bb, 0x04011938,
+	0x0401d15e, 0x0401d15f, 0x0601d160, 0x0601d161, 0x0601d162, 0x0601d163,
+	0x0601d164, 0x0401d1bb, 0x0401d1bc, 0x0601d1bd, 0x0601d1be, 0x0601d1bf,
+	0x0601d1c0, 0x0102f800, 0x0102f801, 0x0102f802, 0x0202f803, 0x0102f804,
+	0x0102f805, 0x0102f806, 0x0102f807, 0x0102f808, 0x0102f809, 0x0102f80a,
+	0x0102f80b, 0x0102f80c, 0x0202f80d, 0x0102f80e, 0x0102f80f, 0x0102f810,
+	0x0102f811, 0x0202f812, 0x0102f813, 0x0102f814, 0x0102f815, 0x0202f816,
+	0x0102f817, 0x0102f818, 0x0102f819, 0x0102f81a, 0x0102f81b, 0x0202f81c,
+	0x0102f81d, 0x0102f81e, 0x0102f81f, 0x0102f820, 0x0102f821, 0x0102f822,
+	0x0102f823, 0x0102f824, 0x0102f825, 0x0102f826, 0x0102f827, 0x0102f828,
+	0x0102f829, 0x0102f82a, 0x0102f82b, 0x0102f82c, 0x0102f82d, 0x0102f82e,
+	0x0102f82f, 0x0102f830, 0x0102f831, 0x0102f832, 0x0102f833, 0x0202f834,
+	0x0102f835, 0x0102f836, 0x0102f837, 0x0202f838, 0x0102f839, 0x0102f83a,
+	0x0102f83b, 0x0102f83c, 0x0102f83d, 0x0102f83e, 0x0102f83f, 0x0102f840,
+	0x0102f841, 0x0102f842, 0x0102f843, 0x0102f844, 0x0102f845, 0x0102f846,
+	0x0102f847, 0x0102f848, 0x0102f849, 0x0102f84a, 0x0102f84b, 0x0102f84c,
+	0x0102f84d, 0x0102f84e, 0x0102f84f, 0x0102f850, 0x0102f851, 0x0102f852,
+	0x0102f853, 0x0102f854, 0x0102f855, 0x0102f856, 0x0102f857, 0x0102f858,
+	0x0202f859, 0x0102f85a, 0x0102f85b, 0x0102f85c, 0x0102f85d, 0x0102f85e,
+	0x0102f85f, 0x0202f860, 0x0202f861, 0x0102f862, 0x0102f863, 0x0102f864,
+	0x0102f865, 0x0102f866, 0x0102f867, 0x0102f868, 0x0102f869, 0x0102f86a,
+	0x0102f86b, 0x0202f86c, 0x0102f86d, 0x0102f86e, 0x0102f86f, 0x0102f870,
+	0x0202f871, 0x0102f872, 0x0102f873, 0x0102f874, 0x0102f875, 0x0102f876,
+	0x0102f877, 0x0102f878, 0x0102f879, 0x0102f87a, 0x0202f87b, 0x0102f87c,
+	0x0202f87d, 0x0102f87e, 0x0102f87f, 0x0102f880, 0x0102f881, 0x0102f882,
+	0x0102f883, 0x0102f884, 0x0102f885, 0x0102f886, 0x0102f887, 0x0102f888,
+	0x0202f889, 0x0102f88a, 0x0102f88b, 0x0102f88c, 0x0102f88d, 0x0102f88e,
+	0x0202f88f, 0x0102f890, 0x0202f891, 0x0202f892, 0x0102f893, 0x0102f894,
+	0x0102f895, 0x0102f896, 0x0202f897, 0x0202f898, 0x0102f899, 0x0102f89a,
+	0x0102f89b, 0x0102f89c, 0x0102f89d, 0x0102f89e, 0x0102f89f, 0x0102f8a0,
+	0x0102f8a1, 0x0102f8a2, 0x0102f8a3, 0x0202f8a4, 0x0102f8a5, 0x0102f8a6,
+	0x0102f8a7, 0x0102f8a8, 0x0102f8a9, 0x0102f8aa, 0x0102f8ab, 0x0102f8ac,
+	0x0102f8ad, 0x0102f8ae, 0x0102f8af, 0x0102f8b0, 0x0102f8b1, 0x0102f8b2,
+	0x0102f8b3, 0x0102f8b4, 0x0102f8b5, 0x0102f8b6, 0x0102f8b7, 0x0202f8b8,
+	0x0102f8b9, 0x0102f8ba, 0x0102f8bb, 0x0102f8bc, 0x0102f8bd, 0x0202f8be,
+	0x0102f8bf, 0x0102f8c0, 0x0102f8c1, 0x0102f8c2, 0x0102f8c3, 0x0102f8c4,
+	0x0102f8c5, 0x0102f8c6, 0x0102f8c7, 0x0102f8c8, 0x0102f8c9, 0x0202f8ca,
+	0x0102f8cb, 0x0102f8cc, 0x0102f8cd, 0x0102f8ce, 0x0102f8cf, 0x0102f8d0,
+	0x0102f8d1, 0x0102f8d2, 0x0102f8d3, 0x0102f8d4, 0x0102f8d5, 0x0102f8d6,
+	0x0102f8d7, 0x0102f8d8, 0x0102f8d9, 0x0102f8da, 0x0102f8db, 0x0102f8dc,
+	0x0202f8dd, 0x0102f8de, 0x0102f8df, 0x0102f8e0, 0x0102f8e1, 0x0102f8e2,
+	0x0202f8e3, 0x0102f8e4, 0x0102f8e5, 0x0102f8e6, 0x0102f8e7, 0x0102f8e8,
+	0x0102f8e9, 0x0102f8ea, 0x0102f8eb, 0x0202f8ec, 0x0102f8ed, 0x0102f8ee,
+	0x0102f8ef, 0x0202f8f0, 0x0102f8f1, 0x0102f8f2, 0x0102f8f3, 0x0102f8f4,
+	0x0102f8f5, 0x0102f8f6, 0x0202f8f7, 0x0202f8f8, 0x0202f8f9, 0x0102f8fa,
+	0x0202f8fb, 0x0102f8fc, 0x0102f8fd, 0x0102f8fe, 0x0102f8ff, 0x0102f900,
+	0x0102f901, 0x0102f902, 0x0102f903, 0x0102f904, 0x0102f905, 0x0202f906,
+	0x0102f907, 0x0102f908, 0x0102f909, 0x0102f90a, 0x0102f90b, 0x0102f90c,
+	0x0202f90d, 0x0102f90e, 0x0102f90f, 0x0202f910, 0x0202f911, 0x0102f912,
+	0x0102f913, 0x0102f914, 0x0102f915, 0x0102f916, 0x0102f917, 0x0102f918,
+	0x0102f919, 0x0102f91a, 0x0202f91b, 0x0102f91c, 0x0202f91d, 0x0102f91e,
+	0x0202f91f, 0x0102f920, 0x0102f921, 0x0102f922, 0x0202f923, 0x0102f924,
+	0x0102f925, 0x0202f926, 0x0202f927, 0x0102f928, 0x0102f929, 0x0102f92a,
+	0x0102f92b, 0x0102f92c, 0x0102f92d, 0x0102f92e, 0x0102f92f, 0x0102f930,
+	0x0102f931, 0x0102f932, 0x0102f933, 0x0102f934, 0x0202f935, 0x0102f936,
+	0x0202f937, 0x0102f938, 0x0202f939, 0x0102f93a, 0x0202f93b, 0x0202f93c,
+	0x0202f93d, 0x0102f93e, 0x0102f93f, 0x0102f940, 0x0202f941, 0x0202f942,
+	0x0202f943, 0x0202f944, 0x0102f945, 0x0102f946, 0x0102f947, 0x0102f948,
+	0x0102f949, 0x0102f94a, 0x0102f94b, 0x0102f94c, 0x0202f94d, 0x0102f94e,
+	0x0102f94f, 0x0102f950, 0x0102f951, 0x0202f952, 0x0102f953, 0x0202f954,
+	0x0202f955, 0x0102f956, 0x0102f957, 0x0102f958, 0x0102f959, 0x0102f95a,
+	0x0102f95b, 0x0202f95c, 0x0202f95d, 0x0202f95e, 0x0102f95f, 0x0102f960,
+	0x0202f961, 0x0102f962, 0x0102f963, 0x0102f964, 0x0202f965, 0x0102f966,
+	0x0102f967, 0x0102f968, 0x0102f969, 0x0102f96a, 0x0202f96b, 0x0102f96c,
+	0x0102f96d, 0x0102f96e, 0x0102f96f, 0x0102f970, 0x0102f971, 0x0202f972,
+	0x0202f973, 0x0102f974, 0x0202f975, 0x0102f976, 0x0202f977, 0x0102f978,
+	0x0102f979, 0x0102f97a, 0x0202f97b, 0x0202f97c, 0x0102f97d, 0x0202f97e,
+	0x0102f97f, 0x0202f980, 0x0102f981, 0x0102f982, 0x0102f983, 0x0102f984,
+	0x0102f985, 0x0102f986, 0x0202f987, 0x0202f988, 0x0202f989, 0x0202f98a,
+	0x0102f98b, 0x0102f98c, 0x0102f98d, 0x0102f98e, 0x0102f98f, 0x0102f990,
+	0x0102f991, 0x0102f992, 0x0102f993, 0x0102f994, 0x0102f995, 0x0102f996,
+	0x0202f997, 0x0102f998, 0x0102f999, 0x0102f99a, 0x0102f99b, 0x0102f99c,
+	0x0102f99d, 0x0102f99e, 0x0102f99f, 0x0102f9a0, 0x0102f9a1, 0x0102f9a2,
+	0x0102f9a3, 0x0202f9a4, 0x0202f9a5, 0x0202f9a6, 0x0102f9a7, 0x0102f9a8,
+	0x0102f9a9, 0x0102f9aa, 0x0202f9ab, 0x0102f9ac, 0x0202f9ad, 0x0102f9ae,
+	0x0102f9af, 0x0202f9b0, 0x0202f9b1, 0x0102f9b2, 0x0102f9b3, 0x0102f9b4,
+	0x0102f9b5, 0x0102f9b6, 0x0102f9b7, 0x0102f9b8, 0x0102f9b9, 0x0102f9ba,
+	0x0102f9bb, 0x0102f9bc, 0x0102f9bd, 0x0102f9be, 0x0102f9bf, 0x0102f9c0,
+	0x0102f9c1, 0x0102f9c2, 0x0102f9c3, 0x0102f9c4, 0x0202f9c5, 0x0102f9c6,
+	0x0102f9c7, 0x0102f9c8, 0x0102f9c9, 0x0102f9ca, 0x0202f9cb, 0x0202f9cc,
+	0x0102f9cd, 0x0102f9ce, 0x0102f9cf, 0x0102f9d0, 0x0102f9d1, 0x0102f9d2,
+	0x0202f9d3, 0x0102f9d4, 0x0102f9d5, 0x0102f9d6, 0x0102f9d7, 0x0202f9d8,
+	0x0202f9d9, 0x0102f9da, 0x0102f9db, 0x0102f9dc, 0x0202f9dd, 0x0102f9de,
+	0x0102f9df, 0x0202f9e0, 0x0202f9e1, 0x0102f9e2, 0x0102f9e3, 0x0102f9e4,
+	0x0202f9e5, 0x0102f9e6, 0x0102f9e7, 0x0102f9e8, 0x0102f9e9, 0x0102f9ea,
+	0x0102f9eb, 0x0102f9ec, 0x0202f9ed, 0x0102f9ee, 0x0102f9ef, 0x0102f9f0,
+	0x0202f9f1, 0x0102f9f2, 0x0102f9f3, 0x0102f9f4, 0x0102f9f5, 0x0202f9f6,
+	0x0202f9f7, 0x0102f9f8, 0x0102f9f9, 0x0102f9fa, 0x0202f9fb, 0x0102f9fc,
+	0x0202f9fd, 0x0102f9fe, 0x0102f9ff, 0x0102fa00, 0x0202fa01, 0x0102fa02,
+	0x0102fa03, 0x0102fa04, 0x0102fa05, 0x0102fa06, 0x0102fa07, 0x0102fa08,
+	0x0202fa09, 0x0102fa0a, 0x0102fa0b, 0x0102fa0c, 0x0102fa0d, 0x0102fa0e,
+	0x0102fa0f, 0x0202fa10, 0x0102fa11, 0x0202fa12, 0x0202fa13, 0x0202fa14,
+	0x0102fa15, 0x0102fa16, 0x0102fa17, 0x0102fa18, 0x0102fa19, 0x0102fa1a,
+	0x0102fa1b, 0x0102fa1c, 0x0202fa1d,
+};
+
+static const uint16_t sn_canon_off[2061] = {
+	49, 52, 55, 58, 61, 64, 68, 71, 74, 77, 80, 83,
+	86, 89, 92, 96, 99, 102, 105, 108, 111, 115, 118, 121,
+	124, 127, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150,
+	152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174,
+	176, 178, 180, 182, 184, 187, 189, 192, 194, 197, 199, 202,
+	204, 207, 209, 212, 214, 217, 219, 222, 224, 228, 230, 233,
+	235, 238, 240, 243, 245, 248, 250, 253, 255, 258, 260, 263,
+	265, 268, 270, 273, 275, 279, 281, 284, 286, 289, 291, 294,
+	296, 300, 308, 310, 313, 315, 318, 320, 323, 325, 328, 330,
+	339, 341, 344, 346, 349, 351, 357, 359, 362, 364, 367, 369,
+	373, 375, 378, 380, 383, 385, 388, 390, 393, 395, 398, 400,
+	403, 405, 408, 410, 413, 415, 419, 421, 424, 426, 429, 431,
+	434, 436, 439, 441, 444, 446, 449, 451, 454, 456, 459, 462,
+	464, 467, 469, 472, 474, 497, 499, 509, 511, 545, 547, 550,
+	552, 555, 557, 560, 562, 565, 568, 572, 575, 579, 582, 586,
+	589, 593, 596, 600, 603, 607, 609, 613, 615, 618, 620, 623,
+	625, 628, 631, 635, 637, 639, 649, 651, 656, 658, 661, 664,
+	668, 670, 673, 675, 678, 680, 683, 685, 688, 690, 693, 695,
+	698, 700, 703, 705, 708, 710, 713, 715, 718, 720, 723, 725,
+	728, 730, 733, 735, 738, 740, 743, 745, 749, 751, 757, 759,
+	762, 764, 767, 770, 774, 777, 781, 783, 786, 789, 793, 795,
+	827, 828, 829, 830, 835, 839, 841, 847, 849, 851, 854, 857,
+	860, 863, 866, 868, 894, 897, 899, 901, 903, 905, 907, 910,
+	912, 914, 916, 918, 922, 924, 948, 951, 955, 961, 968, 971,
+	974, 987, 1011, 1013, 1015, 1017, 1019, 1021, 1023, 1025, 1039, 1041,
+	1077, 1079, 1088, 1090, 1093, 1095, 1099, 1101, 1105, 1107, 1110, 1112,
+	1115, 1117, 1121, 1123, 1126, 1128, 1131, 1133, 1137, 1139, 1142, 1144,
+	1147, 1149, 1152, 1154, 1157, 1159, 1162, 1164, 1168, 1170, 1239, 1241,
+	1243, 1245, 1247, 1257, 1259, 1261, 1263, 1265, 1267, 1269, 1271, 1273,
+	1275, 1277, 1279, 1281, 1283, 1285, 1287, 1289, 1291, 1293, 1295, 1297,
+	1299, 1301, 1303, 1305, 1307, 1309, 1311, 1313, 1315, 1317, 1319, 1321,
+	1323, 1325, 1327, 1329, 1331, 1333, 1335, 1338, 1340, 1342, 1344, 1346,
+	1348, 1351, 1362, 1364, 1366, 1368, 1370, 1372, 1374, 1376, 1378, 1383,
+	1388, 1390, 1392, 1394, 1396, 1398, 1400, 1402, 1451, 1453, 1455, 1457,
+	1459, 1461, 1463, 1465, 1467, 1469, 1471, 1570, 1572, 1575, 1577, 1580,
+	1582, 1585, 1587, 1590, 1593, 1597, 1599, 1602, 1604, 1607, 1609, 1612,
+	1614, 1617, 1619, 1622, 1625, 1629, 1632, 1636, 1638, 1641, 1643, 1646,
+	1649, 1653, 1655, 1658, 1660, 1663, 1665, 1668, 1670, 1673, 1675, 1678,
+	1680, 1683, 1685, 1688, 1690, 1693, 1696, 1700, 1702, 1705, 1707, 1710,
+	1712, 1715, 1717, 1720, 1723, 1727, 1729, 1732, 1734, 1737, 1739, 1742,
+	1744, 1747, 1749, 1752, 1754, 1757, 1759, 1762, 1764, 1767, 1769, 1772,
+	1775, 1779, 1782, 1786, 1789, 1793, 1796, 1800, 1802, 1805, 1807, 1810,
+	1812, 1815, 1817, 1820, 1823, 1827, 1829, 1832, 1834, 1837, 1839, 1842,
+	1845, 1849, 1852, 1856, 1859, 1863, 1865, 1868, 1870, 1873, 1875, 1878,
+	1880, 1883, 1885, 1888, 1890, 1893, 1895, 1898, 1901, 1905, 1908, 1912,
+	1914, 1917, 1919, 1922, 1924, 1927, 1929, 1932, 1934, 1937, 1939, 1942,
+	1944, 1947, 1949, 1952, 1954, 1957, 1959, 1962, 1964, 1967, 1969, 1972,
+	1974, 1976, 1978, 1980, 1982, 1986, 1989, 1991, 1994, 1996, 1999, 2002,
+	2006, 2009, 2013, 2016, 2020, 2023, 2027, 2030, 2034, 2037, 2041, 2044,
+	2048, 2051, 2055, 2058, 2062, 2065, 2069, 2071, 2074, 2076, 2079, 2081,
+	2084, 2087, 2091, 2094, 2098, 2101, 2105, 2108, 2112, 2115, 2119, 2121,
+	2124, 2126, 2129, 2131, 2134, 2136, 2139, 2142, 2146, 2149, 2153, 2156,
+	2160, 2163, 2167, 2170, 2174, 2177, 2181, 2184, 2188, 2191, 2195, 2198,
+	2202, 2205, 2209, 2211, 2214, 2216, 2219, 2222, 2226, 2229, 2233, 2236,
+	2240, 2243, 2247, 2250, 2254, 2256, 2259, 2261, 2264, 2266, 2269, 2271,
+	2276, 2278, 2280, 2283, 2286, 2289, 2292, 2295, 2299, 2302, 2305, 2309,
+	2313, 2317, 2321, 2325, 2328, 2330, 2332, 2335, 2338, 2341, 2345, 2348,
+	2351, 2355, 2359, 2363, 2366, 2368, 2370, 2373, 2376, 2379, 2382, 2385,
+	2389, 2392, 2395, 2399, 2403, 2407, 2411, 2415, 2418, 2420, 2422, 2425,
+	2428, 2431, 2434, 2437, 2441, 2444, 2447, 2451, 2455, 2459, 2463, 2467,
+	2470, 2472, 2474, 2477, 2480, 2483, 2487, 2490, 2493, 2497, 2501, 2505,
+	2508, 2510, 2512, 2515, 2518, 2521, 2524, 2527, 2531, 2534, 2538, 2542,
+	2545, 2547, 2549, 2552, 2555, 2558, 2561, 2564, 2568, 2571, 2574, 2578,
+	2582, 2586, 2590, 2594, 2597, 899, 2599, 901, 2601, 903, 2603, 905,
+	2605, 914, 2607, 916, 2609, 918, 2613, 2618, 2623, 2629, 2635, 2641,
+	2647, 2653, 2657, 2660, 2663, 2667, 2671, 2675, 2679, 2683, 2689, 2694,
+	2699, 2705, 2711, 2717, 2723, 2729, 2733, 2736, 2739, 2743, 2747, 2751,
+	2755, 2759, 2765, 2770, 2775, 2781, 2787, 2793, 2799, 2805, 2809, 2812,
+	2815, 2819, 2823, 2827, 2831, 2835, 2839, 2841, 2845, 2850, 2854, 2857,
+	2862, 2866, 2869, 2872, 847, 2875, 832, 2881, 2888, 2893, 2897, 2900,
+	2905, 2909, 851, 2913, 854, 2916, 2918, 2923, 2928, 2933, 2935, 2937,
+	868, 2940, 2942, 2946, 2949, 2952, 857, 2955, 2960, 2965, 2970, 2972,
+	2974, 907, 2977, 2979, 2981, 2983, 2987, 2990, 2993, 863, 2997, 2999,
+	841, 3004, 3007, 3012, 3016, 3019, 3024, 3028, 860, 3032, 866, 3035,
+	3037, 3040, 3041, 3118, 1529, 64, 3247, 3249, 3251, 3253, 3255, 3257,
+	3259, 3261, 3263, 3265, 3267, 3279, 3281, 3283, 3285, 3287, 3289, 3291,
+	3293, 3295, 3297, 3299, 3301, 3303, 3305, 3307, 3309, 3311, 3313, 3315,
+	3317, 3319, 3321, 3323, 3325, 3327, 3329, 3331, 3333, 3335, 3337, 3339,
+	3341, 3343, 3345, 3346, 3609, 3943, 3945, 3947, 3949, 3951, 3953, 3955,
+	3957, 3959, 3961, 3963, 3965, 3967, 3969, 3971, 3973, 3975, 3977, 3979,
+	3981, 3983, 3985, 3987, 3989, 3991, 3993, 3999, 4003, 4005, 4007, 4009,
+	4011, 4013, 4015, 4017, 4019, 4021, 4023, 4025, 4027, 4029, 4031, 4033,
+	4035, 4037, 4039, 4041, 4043, 4045, 4047, 4049, 4051, 4053, 4055, 4057,
+	4059, 4061, 4063, 5584, 5585, 3884, 5586, 5587, 5588, 5589, 3938, 3938,
+	5590, 3892, 5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598, 5599, 5600,
+	5601, 5602, 5603, 5604, 5605, 5606, 5607, 5608, 5609, 5610, 5611, 5612,
+	5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621, 5622, 5623, 5624,
+	5625, 5626, 5627, 5628, 5629, 5630, 5631, 3850, 5632, 5633, 5634, 5635,
+	5636, 5637, 5638, 5639, 5640, 5641, 5642, 3923, 5643, 5644, 5645, 5646,
+	5647, 5648, 5649, 5650, 5651, 5652, 5653, 5654, 5655, 5656, 5657, 5658,
+	5659, 5660, 5661, 5662, 5663, 5664, 5665, 5666, 5667, 5668, 5669, 5600,
+	5670, 5671, 5672, 5673, 5674, 5675, 5676, 5677, 5678, 5679, 5680, 5681,
+	5682, 5683, 5684, 5685, 5686, 5687, 5688, 5689, 3886, 5690, 5691, 5692,
+	5693, 5694, 5695, 5696, 5697, 5698, 5699, 5700, 5701, 5702, 5703, 5704,
+	3763, 5705, 5706, 5707, 5708, 5709, 5710, 5711, 5712, 3744, 5713, 5714,
+	5715, 5716, 5717, 5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725, 5726,
+	5727, 5728, 5729, 5730, 5731, 5732, 5733, 5734, 5688, 5735, 5736, 5737,
+	5738, 5739, 5740, 5741, 5742, 5672, 5743, 5744, 5745, 5746, 5747, 5748,
+	5749, 5750, 5751, 5752, 5753, 5754, 5755, 5756, 5757, 5758, 5759, 5760,
+	5761, 5762, 5600, 5763, 5764, 5765, 5766, 3937, 5767, 5768, 5769, 5770,
+	5771, 5772, 5773, 5774, 5775, 5776, 5777, 5778, 4470, 5779, 5780, 5781,
+	5782, 5783, 5784, 5785, 5786, 5787, 5674, 5788, 5789, 5790, 5791, 5792,
+	5793, 5794, 5795, 5796, 5797, 5798, 5799, 5800, 3891, 5801, 5802, 5803,
+	5804, 5805, 5806, 5807, 5808, 5809, 5810, 5811, 5812, 5813, 3842, 5814,
+	5815, 5816, 5817, 5818, 5819, 5820, 5821, 5822, 5823, 5824, 5825, 5826,
+	5827, 5828, 5829, 3869, 5830, 3872, 5831, 5832, 5833, 5834, 5835, 5836,
+	5837, 5838, 5839, 5840, 5841, 5842, 5843, 5844, 3849, 5845, 5846, 5847,
+	5848, 5849, 5850, 5851, 5852, 5853, 5854, 5855, 5856, 5857, 5858, 5859,
+	5860, 5861, 5862, 5863, 5864, 5865, 5866, 3770, 5867, 5868, 5869, 5870,
+	5871, 5872, 5873, 5874, 5875, 5876, 5877, 5878, 5879, 5880, 5881, 4475,
+	5882, 5883, 5884, 5885, 4479, 5886, 5887, 5888, 5889, 5890, 5724, 5891,
+	5892, 5893, 5894, 5895, 5896, 5896, 5897, 5898, 5899, 5900, 5901, 5902,
+	5903, 5904, 5847, 5905, 5906, 5907, 5908, 5909, 5911, 5912, 5913, 5914,
+	5915, 5916, 5917, 5918, 5919, 5861, 5920, 5921, 5922, 5834, 5923, 5924,
+	5925, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933, 5934, 5869, 5935,
+	5870, 5936, 5937, 5938, 5939, 5940, 5835, 5621, 5941, 5942, 3803, 5689,
+	5772, 5943, 5944, 5877, 5945, 5878, 5946, 5947, 5948, 5837, 5949, 5950,
+	5951, 5952, 5953, 5838, 5954, 5955, 5956, 5957, 5958, 5959, 5890, 5960,
+	5961, 5724, 5962, 5894, 5963, 5964, 5965, 5966, 5967, 5899, 5968, 5846,
+	5969, 5900, 5670, 5970, 5901, 5971, 5903, 5972, 5973, 5974, 5975, 5976,
+	5905, 5843, 5977, 5906, 5978, 5907, 5979, 3938, 5980, 5982, 5984, 5986,
+	5987, 5988, 5989, 5991, 5993, 5995, 5996, 6021, 6023, 6032, 6034, 6036,
+	6039, 6042, 6044, 6046, 6048, 6050, 6052, 6054, 6056, 6058, 6060, 6062,
+	6064, 6066, 6068, 6070, 6072, 6074, 6076, 6078, 6080, 6082, 6084, 6086,
+	6088, 6090, 6092, 6094, 6096, 7392, 7396, 7400, 7404, 7408, 7412, 7416,
+	7420, 7424, 7428, 7432, 7436, 7504, 7572, 7576, 7580, 7586, 7592, 7598,
+	7604, 7610, 7614, 7618, 7624, 7630, 7636, 7925, 7926, 7927, 7928, 7930,
+	5855, 7931, 7932, 7933, 7934, 5856, 7935, 7936, 7937, 5857, 7939, 7940,
+	7941, 7942, 7944, 7945, 7875, 7946, 7948, 7949, 7950, 7951, 5913, 7952,
+	3742, 7954, 7955, 7956, 7957, 7893, 7958, 7959, 5918, 5858, 5859, 5919,
+	7960, 7961, 5676, 7962, 5860, 7963, 7964, 7965, 7966, 7966, 7966, 7967,
+	7969, 7970, 7971, 7972, 7974, 7975, 7976, 7977, 7978, 7979, 7980, 7981,
+	7982, 7983, 7984, 7985, 7986, 7986, 5921, 7987, 7988, 7989, 7990, 5862,
+	7991, 7992, 7993, 5822, 7994, 7995, 7996, 7997, 7998, 7999, 8000, 8001,
+	8002, 8004, 8005, 8006, 7868, 8007, 8008, 8009, 8011, 8013, 8014, 8015,
+	8016, 8017, 8018, 8019, 8020, 8021, 8021, 8022, 8024, 8025, 5672, 8026,
+	8027, 8029, 8030, 8031, 3768, 8032, 8033, 3770, 8034, 8035, 8036, 8038,
+	8039, 8041, 8042, 8043, 8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051,
+	8052, 8054, 8055, 8056, 8057, 5620, 8058, 3780, 8060, 8060, 8062, 8063,
+	8063, 8064, 8065, 8067, 8069, 8070, 8071, 8072, 8073, 8074, 8075, 8076,
+	8077, 8078, 5867, 8079, 8081, 8082, 8083, 5933, 8083, 8084, 5869, 8085,
+	8086, 8087, 8088, 5870, 5593, 8089, 8090, 8091, 8092, 8093, 8094, 8095,
+	8097, 8098, 8099, 8100, 8101, 8102, 8104, 8105, 8106, 8107, 8108, 8109,
+	8110, 8111, 8112, 5871, 8113, 8114, 8116, 8117, 8118, 8119, 5873, 8120,
+	8121, 8122, 8123, 8124, 8125, 8126, 8127, 5621, 5941, 8128, 8129, 8130,
+	8131, 8133, 8134, 8135, 8136, 5874, 8137, 8139, 8140, 8141, 5986, 8142,
+	8143, 8144, 8145, 8146, 8148, 8149, 8150, 8151, 8153, 8154, 8155, 8156,
+	5689, 8157, 8158, 8160, 8162, 8164, 8165, 8167, 8168, 8169, 8170, 8171,
+	5875, 5772, 8172, 8173, 8174, 8175, 8177, 8178, 8179, 8180, 5944, 8181,
+	8182, 8184, 8185, 8186, 8188, 8190, 8191, 5945, 8192, 8193, 8194, 8195,
+	8196, 8197, 8198, 8200, 8201, 8203, 8204, 8206, 5947, 8207, 8208, 8210,
+	8211, 8212, 8214, 8216, 8217, 8218, 8219, 8220, 8220, 8221, 8222, 5949,
+	8223, 8224, 8225, 8226, 8227, 8229, 8230, 5675, 8232, 8234, 8235, 8237,
+	8239, 8241, 8242, 5955, 8243, 8245, 8247, 8249, 8251, 8252, 8252, 5956,
+	5988, 8253, 8254, 8255, 8256, 8258, 5638, 5958, 8259, 8260, 5885, 8262,
+	8264, 5842, 8266, 8267, 5888, 8268, 8269, 8270, 8272, 8272, 8274, 8275,
+	8276, 8278, 8279, 8280, 8281, 8283, 8284, 8285, 8286, 8287, 8288, 8290,
+	8291, 8292, 8293, 8294, 8295, 8296, 8298, 8300, 8301, 8303, 8304, 8306,
+	8307, 5894, 8308, 8310, 8312, 8313, 8315, 8316, 8318, 8319, 8320, 8321,
+	8322, 8323, 8324, 8326, 8328, 8330, 8062, 8332, 8333, 8334, 8335, 8336,
+	8337, 8338, 8339, 8340, 8341, 8342, 8343, 5692, 8345, 8346, 8347, 8348,
+	8349, 8350, 5897, 8351, 8352, 8353, 8354, 8355, 8357, 8359, 8361, 8362,
+	8363, 8364, 8365, 8367, 8368, 8370, 8371, 8372, 8374, 8376, 8377, 5633,
+	8378, 8379, 8380, 8381, 8382, 8383, 5965, 8384, 8385, 8386, 8387, 8388,
+	8389, 8390, 8391, 3870, 8392, 8394, 8395, 8396, 8397, 8398, 8399, 8401,
+	8403, 8404, 8405, 5970, 5971, 3877, 8406, 8408, 8409, 8410, 8411, 8412,
+	8414, 8416, 8417, 8418, 8419, 8421, 5972, 8422, 8424, 8426, 8427, 8428,
+	8429, 8431, 8432, 8433, 8434, 8435, 8436, 8437, 8438, 8440, 8441, 8442,
+	8443, 8445, 8446, 8447, 8448, 8449, 8451, 8453, 8454, 8455, 8456, 8458,
+	8459, 5978, 5978, 8461, 8462, 8464, 8465, 8466, 8467, 8468, 8469, 8470,
+	8471, 5979, 8473, 8474, 8475, 8476, 8477, 8478, 8480, 8481, 8483, 8485,
+	3925, 8487, 3929, 8488, 8489, 8490, 8491, 3934, 8492,
+};
+
+static const uint32_t sn_compat_k[3750] = {
+	0x010000a0, 0x020000a8, 0x010000aa, 0x020000af, 0x010000b2, 0x010000b3,
+	0x020000b4, 0x010000b5, 0x020000b8, 0x010000b9, 0x010000ba, 0x030000bc,
+	0x030000bd, 0x030000be, 0x02000132, 0x02000133, 0x0200013f, 0x02000140,
+	0x02000149, 0x0100017f, 0x030001c4, 0x030001c5, 0x030001c6, 0x020001c7,
+	0x020001c8, 0x020001c9, 0x020001ca, 0x020001cb, 0x020001cc, 0x020001f1,
+	0x020001f2, 0x020001f3, 0x010002b0, 0x010002b1, 0x010002b2, 0x010002b3,
+	0x010002b4, 0x010002b5, 0x010002b6, 0x010002b7, 0x010002b8, 0x020002d8,
+	0x020002d9, 0x020002da, 0x020002db, 0x020002dc, 0x020002dd, 0x010002e0,
+	0x010002e1, 0x010002e2, 0x010002e3, 0x010002e4, 0x0200037a, 0x02000384,
+	0x03000385, 0x010003d0, 0x010003d1, 0x010003d2, 0x020003d3, 0x020003d4,
+	0x010003d5, 0x010003d6, 0x010003f0, 0x010003f1, 0x010003f2, 0x010003f4,
+	0x010003f5, 0x010003f9, 0x02000587, 0x02000675, 0x02000676, 0x02000677,
+	0x02000678, 0x02000e33, 0x02000eb3, 0x02000edc, 0x02000edd, 0x01000f0c,
+	0x03000f77, 0x03000f79, 0x010010fc, 0x01001d2c, 0x01001d2d, 0x01001d2e,
+	0x01001d30, 0x01001d31, 0x01001d32, 0x01001d33, 0x01001d34, 0x01001d35,
+	0x01001d36, 0x01001d37, 0x01001d38, 0x01001d39, 0x01001d3a, 0x01001d3c,
+	0x01001d3d, 0x01001d3e, 0x01001d3f, 0x01001d40, 0x01001d41, 0x01001d42,
+	0x01001d43, 0x01001d44, 0x01001d45, 0x01001d46, 0x01001d47, 0x01001d48,
+	0x01001d49, 0x01001d4a, 0x01001d4b, 0x01001d4c, 0x01001d4d, 0x01001d4f,
+	0x01001d50, 0x01001d51, 0x01001d52, 0x01001d53, 0x01001d54, 0x01001d55,
+	0x01001d56, 0x01001d57, 0x01001d58, 0x01001d59, 0x01001d5a, 0x01001d5b,
+	0x01001d5c, 0x01001d5d, 0x01001d5e, 0x01001d5f, 0x01001d60, 0x01001d61,
+	0x01001d62, 0x01001d63, 0x01001d64, 0x01001d65, 0x01001d66, 0x01001d67,
+	0x01001d68, 0x01001d69, 0x01001d6a, 0x01001d78, 0x01001d9b, 0x01001d9c,
+	0x01001d9d, 0x01001d9e, 0x01001d9f, 0x01001da0, 0x01001da1, 0x01001da2,
+	0x01001da3, 0x01001da4, 0x01001da5, 0x01001da6, 0x01001da7, 0x01001da8,
+	0x01001da9, 0x01001daa, 0x01001dab, 0x01001dac, 0x01001dad, 0x01001dae,
+	0x01001daf, 0x01001db0, 0x01001db1, 0x01001db2, 0x01001db3, 0x01001db4,
+	0x01001db5, 0x01001db6, 0x01001db7, 0x01001db8, 0x01001db9, 0x01001dba,
+	0x01001dbb, 0x01001dbc, 0x01001dbd, 0x01001dbe, 0x01001dbf, 0x02001e9a,
+	0x02001e9b, 0x02001fbd, 0x02001fbf, 0x02001fc0, 0x03001fc1, 0x03001fcd,
+	0x03001fce, 0x03001fcf, 0x03001fdd, 0x03001fde, 0x03001fdf, 0x03001fed,
+	0x03001fee, 0x02001ffd, 0x02001ffe, 0x01002000, 0x01002001, 0x01002002,
+	0x01002003, 0x01002004, 0x01002005, 0x01002006, 0x01002007, 0x01002008,
+	0x01002009, 0x0100200a, 0x01002011, 0x02002017, 0x01002024, 0x02002025,
+	0x03002026, 0x0100202f, 0x02002033, 0x03002034, 0x02002036, 0x03002037,
+	0x0200203c, 0x0200203e, 0x02002047, 0x02002048, 0x02002049, 0x04002057,
+	0x0100205f, 0x01002070, 0x01002071, 0x01002074, 0x01002075, 0x01002076,
+	0x01002077, 0x01002078, 0x01002079, 0x0100207a, 0x0100207b, 0x0100207c,
+	0x0100207d, 0x0100207e, 0x0100207f, 0x01002080, 0x01002081, 0x01002082,
+	0x01002083, 0x01002084, 0x01002085, 0x01002086, 0x01002087, 0x01002088,
+	0x01002089, 0x0100208a, 0x0100208b, 0x0100208c, 0x0100208d, 0x0100208e,
+	0x01002090, 0x01002091, 0x01002092, 0x01002093, 0x01002094, 0x01002095,
+	0x01002096, 0x01002097, 0x01002098, 0x01002099, 0x0100209a, 0x0100209b,
+	0x0100209c, 0x020020a8, 0x03002100, 0x03002101, 0x01002102, 0x02002103,
+	0x03002105, 0x03002106, 0x01002107, 0x02002109, 0x0100210a, 0x0100210b,
+	0x0100210c, 0x0100210d, 0x0100210e, 0x0100210f, 0x01002110, 0x01002111,
+	0x01002112, 0x01002113, 0x01002115, 0x02002116, 0x01002119, 0x0100211a,
+	0x0100211b, 0x0100211c, 0x0100211d, 0x02002120, 0x03002121, 0x02002122,
+	0x01002124, 0x01002128, 0x0100212c, 0x0100212d, 0x0100212f, 0x01002130,
+	0x01002131, 0x01002133, 0x01002134, 0x01002135, 0x01002136, 0x01002137,
+	0x01002138, 0x01002139, 0x0300213b, 0x0100213c, 0x0100213d, 0x0100213e,
+	0x0100213f, 0x01002140, 0x01002145, 0x01002146, 0x01002147, 0x01002148,
+	0x01002149, 0x03002150, 0x03002151, 0x04002152, 0x03002153, 0x03002154,
+	0x03002155, 0x03002156, 0x03002157, 0x03002158, 0x03002159, 0x0300215a,
+	0x0300215b, 0x0300215c, 0x0300215d, 0x0300215e, 0x0200215f, 0x01002160,
+	0x02002161, 0x03002162, 0x02002163, 0x01002164, 0x02002165, 0x03002166,
+	0x04002167, 0x02002168, 0x01002169, 0x0200216a, 0x0300216b, 0x0100216c,
+	0x0100216d, 0x0100216e, 0x0100216f, 0x01002170, 0x02002171, 0x03002172,
+	0x02002173, 0x01002174, 0x02002175, 0x03002176, 0x04002177, 0x02002178,
+	0x01002179, 0x0200217a, 0x0300217b, 0x0100217c, 0x0100217d, 0x0100217e,
+	0x0100217f, 0x03002189, 0x0200222c, 0x0300222d, 0x0200222f, 0x03002230,
+	0x01002460, 0x01002461, 0x01002462, 0x01002463, 0x01002464, 0x01002465,
+	0x01002466, 0x01002467, 0x01002468, 0x02002469, 0x0200246a, 0x0200246b,
+	0x0200246c, 0x0200246d, 0x0200246e, 0x0200246f, 0x02002470, 0x02002471,
+	0x02002472, 0x02002473, 0x03002474, 0x03002475, 0x03002476, 0x03002477,
+	0x03002478, 0x03002479, 0x0300247a, 0x0300247b, 0x0300247c, 0x0400247d,
+	0x0400247e, 0x0400247f, 0x04002480, 0x04002481, 0x04002482, 0x04002483,
+	0x04002484, 0x04002485, 0x04002486, 0x04002487, 0x02002488, 0x02002489,
+	0x0200248a, 0x0200248b, 0x0200248c, 0x0200248d, 0x0200248e, 0x0200248f,
+	0x02002490, 0x03002491, 0x03002492, 0x03002493, 0x03002494, 0x03002495,
+	0x03002496, 0x03002497, 0x03002498, 0x03002499, 0x0300249a, 0x0300249b,
+	0x0300249c, 0x0300249d, 0x0300249e, 0x0300249f, 0x030024a0, 0x030024a1,
+	0x030024a2, 0x030024a3, 0x030024a4, 0x030024a5, 0x030024a6, 0x030024a7,
+	0x030024a8, 0x030024a9, 0x030024aa, 0x030024ab, 0x030024ac, 0x030024ad,
+	0x030024ae, 0x030024af, 0x030024b0, 0x030024b1, 0x030024b2, 0x030024b3,
+	0x030024b4, 0x030024b5, 0x010024b6, 0x010024b7, 0x010024b8, 0x010024b9,
+	0x010024ba, 0x010024bb, 0x010024bc, 0x010024bd, 0x010024be, 0x010024bf,
+	0x010024c0, 0x010024c1, 0x010024c2, 0x010024c3, 0x010024c4, 0x010024c5,
+	0x010024c6, 0x010024c7, 0x010024c8, 0x010024c9, 0x010024ca, 0x010024cb,
+	0x010024cc, 0x010024cd, 0x010024ce, 0x010024cf, 0x010024d0, 0x010024d1,
+	0x010024d2, 0x010024d3, 0x010024d4, 0x010024d5, 0x010024d6, 0x010024d7,
+	0x010024d8, 0x010024d9, 0x010024da, 0x010024db, 0x010024dc, 0x010024dd,
+	0x010024de, 0x010024df, 0x010024e0, 0x010024e1, 0x010024e2, 0x010024e3,
+	0x010024e4, 0x010024e5, 0x010024e6, 0x010024e7, 0x010024e8, 0x010024e9,
+	0x010024ea, 0x04002a0c, 0x03002a74, 0x02002a75, 0x03002a76, 0x01002c7c,
+	0x01002c7d, 0x01002d6f, 0x01002e9f, 0x01002ef3, 0x01002f00, 0x01002f01,
+	0x01002f02, 0x01002f03, 0x01002f04, 0x01002f05, 0x01002f06, 0x01002f07,
+	0x01002f08, 0x01002f09, 0x01002f0a, 0x01002f0b, 0x01002f0c, 0x01002f0d,
+	0x01002f0e, 0x01002f0f, 0x01002f10, 0x01002f11, 0x01002f12, 0x01002f13,
+	0x01002f14, 0x01002f15, 0x01002f16, 0x01002f17, 0x01002f18, 0x01002f19,
+	0x01002f1a, 0x01002f1b, 0x01002f1c, 0x01002f1d, 0x01002f1e, 0x01002f1f,
+	0x01002f20, 0x01002f21, 0x01002f22, 0x01002f23, 0x01002f24, 0x01002f25,
+	0x01002f26, 0x01002f27, 0x01002f28, 0x01002f29, 0x01002f2a, 0x01002f2b,
+	0x01002f2c, 0x01002f2d, 0x01002f2e, 0x01002f2f, 0x01002f30, 0x01002f31,
+	0x01002f32, 0x01002f33, 0x01002f34, 0x01002f35, 0x01002f36, 0x01002f37,
+	0x01002f38, 0x01002f39, 0x01002f3a, 0x01002f3b, 0x01002f3c, 0x01002f3d,
+	0x01002f3e, 0x01002f3f, 0x01002f40, 0x01002f41, 0x01002f42, 0x01002f43,
+	0x01002f44, 0x01002f45, 0x01002f46, 0x01002f47, 0x01002f48, 0x01002f49,
+	0x01002f4a, 0x01002f4b, 0x01002f4c, 0x01002f4d, 0x01002f4e, 0x01002f4f,
+	0x01002f50, 0x01002f51, 0x01002f52, 0x01002f53, 0x01002f54, 0x01002f55,
+	0x01002f56, 0x01002f57, 0x01002f58, 0x01002f59, 0x01002f5a, 0x01002f5b,
+	0x01002f5c, 0x01002f5d, 0x01002f5e, 0x01002f5f, 0x01002f60, 0x01002f61,
+	0x01002f62, 0x01002f63, 0x01002f64, 0x01002f65, 0x01002f66, 0x01002f67,
+	0x01002f68, 0x01002f69, 0x01002f6a, 0x01002f6b, 0x01002f6c, 0x01002f6d,
+	0x01002f6e, 0x01002f6f, 0x01002f70, 0x01002f71, 0x01002f72, 0x01002f73,
+	0x01002f74, 0x01002f75, 0x01002f76, 0x01002f77, 0x01002f78, 0x01002f79,
+	0x01002f7a, 0x01002f7b, 0x01002f7c, 0x01002f7d, 0x01002f7e, 0x01002f7f,
+	0x01002f80, 0x01002f81, 0x01002f82, 0x01002f83, 0x01002f84, 0x01002f85,
+	0x01002f86, 0x01002f87, 0x01002f88, 0x01002f89, 0x01002f8a, 0x01002f8b,
+	0x01002f8c, 0x01002f8d, 0x01002f8e, 0x01002f8f, 0x01002f90, 0x01002f91,
+	0x01002f92, 0x01002f93, 0x01002f94, 0x01002f95, 0x01002f96, 0x01002f97,
+	0x01002f98, 0x01002f99, 0x01002f9a, 0x01002f9b, 0x01002f9c, 0x01002f9d,
+	0x01002f9e, 0x01002f9f, 0x01002fa0, 0x01002fa1, 0x01002fa2, 0x01002fa3,
+	0x01002fa4, 0x01002fa5, 0x01002fa6, 0x01002fa7, 0x01002fa8, 0x01002fa9,
+	0x01002faa, 0x01002fab, 0x01002fac, 0x01002fad, 0x01002fae, 0x01002faf,
+	0x01002fb0, 0x01002fb1, 0x01002fb2, 0x01002fb3, 0x01002fb4, 0x01002fb5,
+	0x01002fb6, 0x01002fb7, 0x01002fb8, 0x01002fb9, 0x01002fba, 0x01002fbb,
+	0x01002fbc, 0x01002fbd, 0x01002fbe, 0x01002fbf, 0x01002fc0, 0x01002fc1,
+	0x01002fc2, 0x01002fc3, 0x01002fc4, 0x01002fc5, 0x01002fc6, 0x01002fc7,
+	0x01002fc8, 0x01002fc9, 0x01002fca, 0x01002fcb, 0x01002fcc, 0x01002fcd,
+	0x01002fce, 0x01002fcf, 0x01002fd0, 0x01002fd1, 0x01002fd2, 0x01002fd3,
+	0x01002fd4, 0x01002fd5, 0x01003000, 0x01003036, 0x01003038, 0x01003039,
+	0x0100303a, 0x0200309b, 0x0200309c, 0x0200309f, 0x020030ff, 0x01003131,
+	0x01003132, 0x01003133, 0x01003134, 0x01003135, 0x01003136, 0x01003137,
+	0x01003138, 0x01003139, 0x0100313a, 0x0100313b, 0x0100313c, 0x0100313d,
+	0x0100313e, 0x0100313f, 0x01003140, 0x01003141, 0x01003142, 0x01003143,
+	0x01003144, 0x01003145, 0x01003146, 0x01003147, 0x01003148, 0x01003149,
+	0x0100314a, 0x0100314b, 0x0100314c, 0x0100314d, 0x0100314e, 0x0100314f,
+	0x01003150, 0x01003151, 0x01003152, 0x01003153, 0x01003154, 0x01003155,
+	0x01003156, 0x01003157, 0x01003158, 0x01003159, 0x0100315a, 0x0100315b,
+	0x0100315c, 0x0100315d, 0x0100315e, 0x0100315f, 0x01003160, 0x01003161,
+	0x01003162, 0x01003163, 0x01003164, 0x01003165, 0x01003166, 0x01003167,
+	0x01003168, 0x01003169, 0x0100316a, 0x0100316b, 0x0100316c, 0x0100316d,
+	0x0100316e, 0x0100316f, 0x01003170, 0x01003171, 0x01003172, 0x01003173,
+	0x01003174, 0x01003175, 0x01003176, 0x01003177, 0x01003178, 0x01003179,
+	0x0100317a, 0x0100317b, 0x0100317c, 0x0100317d, 0x0100317e, 0x0100317f,
+	0x01003180, 0x01003181, 0x01003182, 0x01003183, 0x01003184, 0x01003185,
+	0x01003186, 0x01003187, 0x01003188, 0x01003189, 0x0100318a, 0x0100318b,
+	0x0100318c, 0x0100318d, 0x0100318e, 0x01003192, 0x01003193, 0x01003194,
+	0x01003195, 0x01003196, 0x01003197, 0x01003198, 0x01003199, 0x0100319a,
+	0x0100319b, 0x0100319c, 0x0100319d, 0x0100319e, 0x0100319f, 0x03003200,
+	0x03003201, 0x03003202, 0x03003203, 0x03003204, 0x03003205, 0x03003206,
+	0x03003207, 0x03003208, 0x03003209, 0x0300320a, 0x0300320b, 0x0300320c,
+	0x0300320d, 0x0400320e, 0x0400320f, 0x04003210, 0x04003211, 0x04003212,
+	0x04003213, 0x04003214, 0x04003215, 0x04003216, 0x04003217, 0x04003218,
+	0x04003219, 0x0400321a, 0x0400321b, 0x0400321c, 0x0700321d, 0x0600321e,
+	0x03003220, 0x03003221, 0x03003222, 0x03003223, 0x03003224, 0x03003225,
+	0x03003226, 0x03003227, 0x03003228, 0x03003229, 0x0300322a, 0x0300322b,
+	0x0300322c, 0x0300322d, 0x0300322e, 0x0300322f, 0x03003230, 0x03003231,
+	0x03003232, 0x03003233, 0x03003234, 0x03003235, 0x03003236, 0x03003237,
+	0x03003238, 0x03003239, 0x0300323a, 0x0300323b, 0x0300323c, 0x0300323d,
+	0x0300323e, 0x0300323f, 0x03003240, 0x03003241, 0x03003242, 0x03003243,
+	0x01003244, 0x01003245, 0x01003246, 0x01003247, 0x03003250, 0x02003251,
+	0x02003252, 0x02003253, 0x02003254, 0x02003255, 0x02003256, 0x02003257,
+	0x02003258, 0x02003259, 0x0200325a, 0x0200325b, 0x0200325c, 0x0200325d,
+	0x0200325e, 0x0200325f, 0x01003260, 0x01003261, 0x01003262, 0x01003263,
+	0x01003264, 0x01003265, 0x01003266, 0x01003267, 0x01003268, 0x01003269,
+	0x0100326a, 0x0100326b, 0x0100326c, 0x0100326d, 0x0200326e, 0x0200326f,
+	0x02003270, 0x02003271, 0x02003272, 0x02003273, 0x02003274, 0x02003275,
+	0x02003276, 0x02003277, 0x02003278, 0x02003279, 0x0200327a, 0x0200327b,
+	0x0500327c, 0x0400327d, 0x0200327e, 0x01003280, 0x01003281, 0x01003282,
+	0x01003283, 0x01003284, 0x01003285, 0x01003286, 0x01003287, 0x01003288,
+	0x01003289, 0x0100328a, 0x0100328b, 0x0100328c, 0x0100328d, 0x0100328e,
+	0x0100328f, 0x01003290, 0x01003291, 0x01003292, 0x01003293, 0x01003294,
+	0x01003295, 0x01003296, 0x01003297, 0x01003298, 0x01003299, 0x0100329a,
+	0x0100329b, 0x0100329c, 0x0100329d, 0x0100329e, 0x0100329f, 0x010032a0,
+	0x010032a1, 0x010032a2, 0x010032a3, 0x010032a4, 0x010032a5, 0x010032a6,
+	0x010032a7, 0x010032a8, 0x010032a9, 0x010032aa, 0x010032ab, 0x010032ac,
+	0x010032ad, 0x010032ae, 0x010032af, 0x010032b0, 0x020032b1, 0x020032b2,
+	0x020032b3, 0x020032b4, 0x020032b5, 0x020032b6, 0x020032b7, 0x020032b8,
+	0x020032b9, 0x020032ba, 0x020032bb, 0x020032bc, 0x020032bd, 0x020032be,
+	0x020032bf, 0x020032c0, 0x020032c1, 0x020032c2, 0x020032c3, 0x020032c4,
+	0x020032c5, 0x020032c6, 0x020032c7, 0x020032c8, 0x030032c9, 0x030032ca,
+	0x030032cb, 0x020032cc, 0x030032cd, 0x020032ce, 0x030032cf, 0x010032d0,
+	0x010032d1, 0x010032d2, 0x010032d3, 0x010032d4, 0x010032d5, 0x010032d6,
+	0x010032d7, 0x010032d8, 0x010032d9, 0x010032da, 0x010032db, 0x010032dc,
+	0x010032dd, 0x010032de, 0x010032df, 0x010032e0, 0x010032e1, 0x010032e2,
+	0x010032e3, 0x010032e4, 0x010032e5, 0x010032e6, 0x010032e7, 0x010032e8,
+	0x010032e9, 0x010032ea, 0x010032eb, 0x010032ec, 0x010032ed, 0x010032ee,
+	0x010032ef, 0x010032f0, 0x010032f1, 0x010032f2, 0x010032f3, 0x010032f4,
+	0x010032f5, 0x010032f6, 0x010032f7, 0x010032f8, 0x010032f9, 0x010032fa,
+	0x010032fb, 0x010032fc, 0x010032fd, 0x010032fe, 0x020032ff, 0x05003300,
+	0x04003301, 0x05003302, 0x03003303, 0x05003304, 0x03003305, 0x03003306,
+	0x06003307, 0x04003308, 0x03003309, 0x0300330a, 0x0300330b, 0x0400330c,
+	0x0400330d, 0x0400330e, 0x0400330f, 0x04003310, 0x04003311, 0x04003312,
+	0x06003313, 0x02003314, 0x06003315, 0x06003316, 0x05003317, 0x04003318,
+	0x06003319, 0x0600331a, 0x0400331b, 0x0300331c, 0x0300331d, 0x0400331e,
+	0x0400331f, 0x05003320, 0x05003321, 0x03003322, 0x03003323, 0x04003324,
+	0x03003325, 0x03003326, 0x02003327, 0x02003328, 0x03003329, 0x0300332a,
+	0x0600332b, 0x0400332c, 0x0500332d, 0x0600332e, 0x0400332f, 0x03003330,
+	0x03003331, 0x06003332, 0x04003333, 0x06003334, 0x03003335, 0x05003336,
+	0x03003337, 0x04003338, 0x03003339, 0x0400333a, 0x0500333b, 0x0400333c,
+	0x0500333d, 0x0400333e, 0x0200333f, 0x05003340, 0x03003341, 0x03003342,
+	0x04003343, 0x03003344, 0x03003345, 0x03003346, 0x05003347, 0x04003348,
+	0x02003349, 0x0600334a, 0x0300334b, 0x0500334c, 0x0400334d, 0x0400334e,
+	0x0300334f, 0x03003350, 0x04003351, 0x02003352, 0x04003353, 0x05003354,
+	0x02003355, 0x06003356, 0x03003357, 0x02003358, 0x02003359, 0x0200335a,
+	0x0200335b, 0x0200335c, 0x0200335d, 0x0200335e, 0x0200335f, 0x02003360,
+	0x02003361, 0x03003362, 0x03003363, 0x03003364, 0x03003365, 0x03003366,
+	0x03003367, 0x03003368, 0x03003369, 0x0300336a, 0x0300336b, 0x0300336c,
+	0x0300336d, 0x0300336e, 0x0300336f, 0x03003370, 0x03003371, 0x02003372,
+	0x02003373, 0x03003374, 0x02003375, 0x02003376, 0x02003377, 0x03003378,
+	0x03003379, 0x0200337a, 0x0200337b, 0x0200337c, 0x0200337d, 0x0200337e,
+	0x0400337f, 0x02003380, 0x02003381, 0x02003382, 0x02003383, 0x02003384,
+	0x02003385, 0x02003386, 0x02003387, 0x03003388, 0x04003389, 0x0200338a,
+	0x0200338b, 0x0200338c, 0x0200338d, 0x0200338e, 0x0200338f, 0x02003390,
+	0x03003391, 0x03003392, 0x03003393, 0x03003394, 0x02003395, 0x02003396,
+	0x02003397, 0x02003398, 0x02003399, 0x0200339a, 0x0200339b, 0x0200339c,
+	0x0200339d, 0x0200339e, 0x0300339f, 0x030033a0, 0x020033a1, 0x030033a2,
+	0x030033a3, 0x030033a4, 0x020033a5, 0x030033a6, 0x030033a7, 0x040033a8,
+	0x020033a9, 0x030033aa, 0x030033ab, 0x030033ac, 0x030033ad, 0x050033ae,
+	0x060033af, 0x020033b0, 0x020033b1, 0x020033b2, 0x020033b3, 0x020033b4,
+	0x020033b5, 0x020033b6, 0x020033b7, 0x020033b8, 0x020033b9, 0x020033ba,
+	0x020033bb, 0x020033bc, 0x020033bd, 0x020033be, 0x020033bf, 0x020033c0,
+	0x020033c1, 0x040033c2, 0x020033c3, 0x020033c4, 0x020033c5, 0x040033c6,
+	0x030033c7, 0x020033c8, 0x020033c9, 0x020033ca, 0x020033cb, 0x020033cc,
+	0x020033cd, 0x020033ce, 0x020033cf, 0x020033d0, 0x020033d1, 0x030033d2,
+	0x020033d3, 0x020033d4, 0x030033d5, 0x030033d6, 0x020033d7, 0x040033d8,
+	0x030033d9, 0x020033da, 0x020033db, 0x020033dc, 0x020033dd, 0x030033de,
+	0x030033df, 0x020033e0, 0x020033e1, 0x020033e2, 0x020033e3, 0x020033e4,
+	0x020033e5, 0x020033e6, 0x020033e7, 0x020033e8, 0x030033e9, 0x030033ea,
+	0x030033eb, 0x030033ec, 0x030033ed, 0x030033ee, 0x030033ef, 0x030033f0,
+	0x030033f1, 0x030033f2, 0x030033f3, 0x030033f4, 0x030033f5, 0x030033f6,
+	0x030033f7, 0x030033f8, 0x030033f9, 0x030033fa, 0x030033fb, 0x030033fc,
+	0x030033fd, 0x030033fe, 0x030033ff, 0x0100a69c, 0x0100a69d, 0x0100a770,
+	0x0100a7f2, 0x0100a7f3, 0x0100a7f4, 0x0100a7f8, 0x0100a7f9, 0x0100ab5c,
+	0x0100ab5d, 0x0100ab5e, 0x0100ab5f, 0x0100ab69, 0x0200fb00, 0x0200fb01,
+	0x0200fb02, 0x0300fb03, 0x0300fb04, 0x0200fb05, 0x0200fb06, 0x0200fb13,
+	0x0200fb14, 0x0200fb15, 0x0200fb16, 0x0200fb17, 0x0100fb20, 0x0100fb21,
+	0x0100fb22, 0x0100fb23, 0x0100fb24, 0x0100fb25, 0x0100fb26, 0x0100fb27,
+	0x0100fb28, 0x0100fb29, 0x0200fb4f, 0x0100fb50, 0x0100fb51, 0x0100fb52,
+	0x0100fb53, 0x0100fb54, 0x0100fb55, 0x0100fb56, 0x0100fb57, 0x0100fb58,
+	0x0100fb59, 0x0100fb5a, 0x0100fb5b, 0x0100fb5c, 0x0100fb5d, 0x0100fb5e,
+	0x0100fb5f, 0x0100fb60, 0x0100fb61, 0x0100fb62, 0x0100fb63, 0x0100fb64,
+	0x0100fb65, 0x0100fb66, 0x0100fb67, 0x0100fb68, 0x0100fb69, 0x0100fb6a,
+	0x0100fb6b, 0x0100fb6c, 0x0100fb6d, 0x0100fb6e, 0x0100fb6f, 0x0100fb70,
+	0x0100fb71, 0x0100fb72, 0x0100fb73, 0x0100fb74, 0x0100fb75, 0x0100fb76,
+	0x0100fb77, 0x0100fb78, 0x0100fb79, 0x0100fb7a, 0x0100fb7b, 0x0100fb7c,
+	0x0100fb7d, 0x0100fb7e, 0x0100fb7f, 0x0100fb80, 0x0100fb81, 0x0100fb82,
+	0x0100fb83, 0x0100fb84, 0x0100fb85, 0x0100fb86, 0x0100fb87, 0x0100fb88,
+	0x0100fb89, 0x0100fb8a, 0x0100fb8b, 0x0100fb8c, 0x0100fb8d, 0x0100fb8e,
+	0x0100fb8f, 0x0100fb90, 0x0100fb91, 0x0100fb92, 0x0100fb93, 0x0100fb94,
+	0x0100fb95, 0x0100fb96, 0x0100fb97, 0x0100fb98, 0x0100fb99, 0x0100fb9a,
+	0x0100fb9b, 0x0100fb9c, 0x0100fb9d, 0x0100fb9e, 0x0100fb9f, 0x0100fba0,
+	0x0100fba1, 0x0100fba2, 0x0100fba3, 0x0200fba4, 0x0200fba5, 0x0100fba6,
+	0x0100fba7, 0x0100fba8, 0x0100fba9, 0x0100fbaa, 0x0100fbab, 0x0100fbac,
+	0x0100fbad, 0x0100fbae, 0x0100fbaf, 0x0200fbb0, 0x0200fbb1, 0x0100fbd3,
+	0x0100fbd4, 0x0100fbd5, 0x0100fbd6, 0x0100fbd7, 0x0100fbd8, 0x0100fbd9,
+	0x0100fbda, 0x0100fbdb, 0x0100fbdc, 0x0200fbdd, 0x0100fbde, 0x0100fbdf,
+	0x0100fbe0, 0x0100fbe1, 0x0100fbe2, 0x0100fbe3, 0x0100fbe4, 0x0100fbe5,
+	0x0100fbe6, 0x0100fbe7, 0x0100fbe8, 0x0100fbe9, 0x0300fbea, 0x0300fbeb,
+	0x0300fbec, 0x0300fbed, 0x0300fbee, 0x0300fbef, 0x0300fbf0, 0x0300fbf1,
+	0x0300fbf2, 0x0300fbf3, 0x0300fbf4, 0x0300fbf5, 0x0300fbf6, 0x0300fbf7,
+	0x0300fbf8, 0x0300fbf9, 0x0300fbfa, 0x0300fbfb, 0x0100fbfc, 0x0100fbfd,
+	0x0100fbfe, 0x0100fbff, 0x0300fc00, 0x0300fc01, 0x0300fc02, 0x0300fc03,
+	0x0300fc04, 0x0200fc05, 0x0200fc06, 0x0200fc07, 0x0200fc08, 0x0200fc09,
+	0x0200fc0a, 0x0200fc0b, 0x0200fc0c, 0x0200fc0d, 0x0200fc0e, 0x0200fc0f,
+	0x0200fc10, 0x0200fc11, 0x0200fc12, 0x0200fc13, 0x0200fc14, 0x0200fc15,
+	0x0200fc16, 0x0200fc17, 0x0200fc18, 0x0200fc19, 0x0200fc1a, 0x0200fc1b,
+	0x0200fc1c, 0x0200fc1d, 0x0200fc1e, 0x0200fc1f, 0x0200fc20, 0x0200fc21,
+	0x0200fc22, 0x0200fc23, 0x0200fc24, 0x0200fc25, 0x0200fc26, 0x0200fc27,
+	0x0200fc28, 0x0200fc29, 0x0200fc2a, 0x0200fc2b, 0x0200fc2c, 0x0200fc2d,
+	0x0200fc2e, 0x0200fc2f, 0x0200fc30, 0x0200fc31, 0x0200fc32, 0x0200fc33,
+	0x0200fc34, 0x0200fc35, 0x0200fc36, 0x0200fc37, 0x0200fc38, 0x0200fc39,
+	0x0200fc3a, 0x0200fc3b, 0x0200fc3c, 0x0200fc3d, 0x0200fc3e, 0x0200fc3f,
+	0x0200fc40, 0x0200fc41, 0x0200fc42, 0x0200fc43, 0x0200fc44, 0x0200fc45,
+	0x0200fc46, 0x0200fc47, 0x0200fc48, 0x0200fc49, 0x0200fc4a, 0x0200fc4b,
+	0x0200fc4c, 0x0200fc4d, 0x0200fc4e, 0x0200fc4f, 0x0200fc50, 0x0200fc51,
+	0x0200fc52, 0x0200fc53, 0x0200fc54, 0x0200fc55, 0x0200fc56, 0x0200fc57,
+	0x0200fc58, 0x0200fc59, 0x0200fc5a, 0x0200fc5b, 0x0200fc5c, 0x0200fc5d,
+	0x0300fc5e, 0x0300fc5f, 0x0300fc60, 0x0300fc61, 0x0300fc62, 0x0300fc63,
+	0x0300fc64, 0x0300fc65, 0x0300fc66, 0x0300fc67, 0x0300fc68, 0x0300fc69,
+	0x0200fc6a, 0x0200fc6b, 0x0200fc6c, 0x0200fc6d, 0x0200fc6e, 0x0200fc6f,
+	0x0200fc70, 0x0200fc71, 0x0200fc72, 0x0200fc73, 0x0200fc74, 0x0200fc75,
+	0x0200fc76, 0x0200fc77, 0x0200fc78, 0x0200fc79, 0x0200fc7a, 0x0200fc7b,
+	0x0200fc7c, 0x0200fc7d, 0x0200fc7e, 0x0200fc7f, 0x0200fc80, 0x0200fc81,
+	0x0200fc82, 0x0200fc83, 0x0200fc84, 0x0200fc85, 0x0200fc86, 0x0200fc87,
+	0x0200fc88, 0x0200fc89, 0x0200fc8a, 0x0200fc8b, 0x0200fc8c, 0x0200fc8d,
+	0x0200fc8e, 0x0200fc8f, 0x0200fc90, 0x0200fc91, 0x0200fc92, 0x0200fc93,
+	0x0200fc94, 0x0200fc95, 0x0200fc96, 0x0300fc97, 0x0300fc98, 0x0300fc99,
+	0x0300fc9a, 0x0300fc9b, 0x0200fc9c, 0x0200fc9d, 0x0200fc9e, 0x0200fc9f,
+	0x0200fca0, 0x0200fca1, 0x0200fca2, 0x0200fca3, 0x0200fca4, 0x0200fca5,
+	0x0200fca6, 0x0200fca7, 0x0200fca8, 0x0200fca9, 0x0200fcaa, 0x0200fcab,
+	0x0200fcac, 0x0200fcad, 0x0200fcae, 0x0200fcaf, 0x0200fcb0, 0x0200fcb1,
+	0x0200fcb2, 0x0200fcb3, 0x0200fcb4, 0x0200fcb5, 0x0200fcb6, 0x0200fcb7,
+	0x0200fcb8, 0x0200fcb9, 0x0200fcba, 0x0200fcbb, 0x0200fcbc, 0x0200fcbd,
+	0x0200fcbe, 0x0200fcbf, 0x0200fcc0, 0x0200fcc1, 0x0200fcc2, 0x0200fcc3,
+	0x0200fcc4, 0x0200fcc5, 0x0200fcc6, 0x0200fcc7, 0x0200fcc8, 0x0200fcc9,
+	0x0200fcca, 0x0200fccb, 0x0200fccc, 0x0200fccd, 0x0200fcce, 0x0200fccf,
+	0x0200fcd0, 0x0200fcd1, 0x0200fcd2, 0x0200fcd3, 0x0200fcd4, 0x0200fcd5,
+	0x0200fcd6, 0x0200fcd7, 0x0200fcd8, 0x0200fcd9, 0x0200fcda, 0x0200fcdb,
+	0x0200fcdc, 0x0200fcdd, 0x0200fcde, 0x0300fcdf, 0x0300fce0, 0x0200fce1,
+	0x0200fce2, 0x0200fce3, 0x0200fce4, 0x0200fce5, 0x0200fce6, 0x0200fce7,
+	0x0200fce8, 0x0200fce9, 0x0200fcea, 0x0200fceb, 0x0200fcec, 0x0200fced,
+	0x0200fcee, 0x0200fcef, 0x0200fcf0, 0x0200fcf1, 0x0300fcf2, 0x0300fcf3,
+	0x0300fcf4, 0x0200fcf5, 0x0200fcf6, 0x0200fcf7, 0x0200fcf8, 0x0200fcf9,
+	0x0200fcfa, 0x0200fcfb, 0x0200fcfc, 0x0200fcfd, 0x0200fcfe, 0x0200fcff,
+	0x0200fd00, 0x0200fd01, 0x0200fd02, 0x0200fd03, 0x0200fd04, 0x0200fd05,
+	0x0200fd06, 0x0200fd07, 0x0200fd08, 0x0200fd09, 0x0200fd0a, 0x0200fd0b,
+	0x0200fd0c, 0x0200fd0d, 0x0200fd0e, 0x0200fd0f, 0x0200fd10, 0x0200fd11,
+	0x0200fd12, 0x0200fd13, 0x0200fd14, 0x0200fd15, 0x0200fd16, 0x0200fd17,
+	0x0200fd18, 0x0200fd19, 0x0200fd1a, 0x0200fd1b, 0x0200fd1c, 0x0200fd1d,
+	0x0200fd1e, 0x0200fd1f, 0x0200fd20, 0x0200fd21, 0x0200fd22, 0x0200fd23,
+	0x0200fd24, 0x0200fd25, 0x0200fd26, 0x0200fd27, 0x0200fd28, 0x0200fd29,
+	0x0200fd2a, 0x0200fd2b, 0x0200fd2c, 0x0200fd2d, 0x0200fd2e, 0x0200fd2f,
+	0x0200fd30, 0x0200fd31, 0x0200fd32, 0x0200fd33, 0x0200fd34, 0x0200fd35,
+	0x0200fd36, 0x0200fd37, 0x0200fd38, 0x0200fd39, 0x0200fd3a, 0x0200fd3b,
+	0x0200fd3c, 0x0200fd3d, 0x0300fd50, 0x0300fd51, 0x0300fd52, 0x0300fd53,
+	0x0300fd54, 0x0300fd55, 0x0300fd56, 0x0300fd57, 0x0300fd58, 0x0300fd59,
+	0x0300fd5a, 0x0300fd5b, 0x0300fd5c, 0x0300fd5d, 0x0300fd5e, 0x0300fd5f,
+	0x0300fd60, 0x0300fd61, 0x0300fd62, 0x0300fd63, 0x0300fd64, 0x0300fd65,
+	0x0300fd66, 0x0300fd67, 0x0300fd68, 0x0300fd69, 0x0300fd6a, 0x0300fd6b,
+	0x0300fd6c, 0x0300fd6d, 0x0300fd6e, 0x0300fd6f, 0x0300fd70, 0x0300fd71,
+	0x0300fd72, 0x0300fd73, 0x0300fd74, 0x0300fd75, 0x0300fd76, 0x0300fd77,
+	0x0300fd78, 0x0300fd79, 0x0300fd7a, 0x0300fd7b, 0x0300fd7c, 0x0300fd7d,
+	0x0300fd7e, 0x0300fd7f, 0x0300fd80, 0x0300fd81, 0x0300fd82, 0x0300fd83,
+	0x0300fd84, 0x0300fd85, 0x0300fd86, 0x0300fd87, 0x0300fd88, 0x0300fd89,
+	0x0300fd8a, 0x0300fd8b, 0x0300fd8c, 0x0300fd8d, 0x0300fd8e, 0x0300fd8f,
+	0x0300fd92, 0x0300fd93, 0x0300fd94, 0x0300fd95, 0x0300fd96, 0x0300fd97,
+	0x0300fd98, 0x0300fd99, 0x0300fd9a, 0x0300fd9b, 0x0300fd9c, 0x0300fd9d,
+	0x0300fd9e, 0x0300fd9f, 0x0300fda0, 0x0300fda1, 0x0300fda2, 0x0300fda3,
+	0x0300fda4, 0x0300fda5, 0x0300fda6, 0x0300fda7, 0x0300fda8, 0x0300fda9,
+	0x0300fdaa, 0x0300fdab, 0x0300fdac, 0x0300fdad, 0x0300fdae, 0x0300fdaf,
+	0x0300fdb0, 0x0300fdb1, 0x0300fdb2, 0x0300fdb3, 0x0300fdb4, 0x0300fdb5,
+	0x0300fdb6, 0x0300fdb7, 0x0300fdb8, 0x0300fdb9, 0x0300fdba, 0x0300fdbb,
+	0x0300fdbc, 0x0300fdbd, 0x0300fdbe, 0x0300fdbf, 0x0300fdc0, 0x0300fdc1,
+	0x0300fdc2, 0x0300fdc3, 0x0300fdc4, 0x0300fdc5, 0x0300fdc6, 0x0300fdc7,
+	0x0300fdf0, 0x0300fdf1, 0x0400fdf2, 0x0400fdf3, 0x0400fdf4, 0x0400fdf5,
+	0x0400fdf6, 0x0400fdf7, 0x0400fdf8, 0x0300fdf9, 0x1200fdfa, 0x0800fdfb,
+	0x0400fdfc, 0x0100fe10, 0x0100fe11, 0x0100fe12, 0x0100fe13, 0x0100fe14,
+	0x0100fe15, 0x0100fe16, 0x0100fe17, 0x0100fe18, 0x0300fe19, 0x0200fe30,
+	0x0100fe31, 0x0100fe32, 0x0100fe33, 0x0100fe34, 0x0100fe35, 0x0100fe36,
+	0x0100fe37, 0x0100fe38, 0x0100fe39, 0x0100fe3a, 0x0100fe3b, 0x0100fe3c,
+	0x0100fe3d, 0x0100fe3e, 0x0100fe3f, 0x0100fe40, 0x0100fe41, 0x0100fe42,
+	0x0100fe43, 0x0100fe44, 0x0100fe47, 0x0100fe48, 0x0200fe49, 0x0200fe4a,
+	0x0200fe4b, 0x0200fe4c, 0x0100fe4d, 0x0100fe4e, 0x0100fe4f, 0x0100fe50,
+	0x0100fe51, 0x0100fe52, 0x0100fe54, 0x0100fe55, 0x0100fe56, 0x0100fe57,
+	0x0100fe58, 0x0100fe59, 0x0100fe5a, 0x0100fe5b, 0x0100fe5c, 0x0100fe5d,
+	0x0100fe5e, 0x0100fe5f, 0x0100fe60, 0x0100fe61, 0x0100fe62, 0x0100fe63,
+	0x0100fe64, 0x0100fe65, 0x0100fe66, 0x0100fe68, 0x0100fe69, 0x0100fe6a,
+	0x0100fe6b, 0x0200fe70, 0x0200fe71, 0x0200fe72, 0x0200fe74, 0x0200fe76,
+	0x0200fe77, 0x0200fe78, 0x0200fe79, 0x0200fe7a, 0x0200fe7b, 0x0200fe7c,
+	0x0200fe7d, 0x0200fe7e, 0x0200fe7f, 0x0100fe80, 0x0200fe81, 0x0200fe82,
+	0x0200fe83, 0x0200fe84, 0x0200fe85, 0x0200fe86, 0x0200fe87, 0x0200fe88,
+	0x0200fe89, 0x0200fe8a, 0x0200fe8b, 0x0200fe8c, 0x0100fe8d, 0x0100fe8e,
+	0x0100fe8f, 0x0100fe90, 0x0100fe91, 0x0100fe92, 0x0100fe93, 0x0100fe94,
+	0x0100fe95, 0x0100fe96, 0x0100fe97, 0x0100fe98, 0x0100fe99, 0x0100fe9a,
+	0x0100fe9b, 0x0100fe9c, 0x0100fe9d, 0x0100fe9e, 0x0100fe9f, 0x0100fea0,
+	0x0100fea1, 0x0100fea2, 0x0100fea3, 0x0100fea4, 0x0100fea5, 0x0100fea6,
+	0x0100fea7, 0x0100fea8, 0x0100fea9, 0x0100feaa, 0x0100feab, 0x0100feac,
+	0x0100fead, 0x0100feae, 0x0100feaf, 0x0100feb0, 0x0100feb1, 0x0100feb2,
+	0x0100feb3, 0x0100feb4, 0x0100feb5, 0x0100feb6, 0x0100feb7, 0x0100feb8,
+	0x0100feb9, 0x0100feba, 0x0100febb, 0x0100febc, 0x0100febd, 0x0100febe,
+	0x0100febf, 0x0100fec0, 0x0100fec1, 0x0100fec2, 0x0100fec3, 0x0100fec4,
+	0x0100fec5, 0x0100fec6, 0x0100fec7, 0x0100fec8, 0x0100fec9, 0x0100feca,
+	0x0100fecb, 0x0100fecc, 0x0100fecd, 0x0100fece, 0x0100fecf, 0x0100fed0,
+	0x0100fed1, 0x0100fed2, 0x0100fed3, 0x0100fed4, 0x0100fed5, 0x0100fed6,
+	0x0100fed7, 0x0100fed8, 0x0100fed9, 0x0100feda, 0x0100fedb, 0x0100fedc,
+	0x0100fedd, 0x0100fede, 0x0100fedf, 0x0100fee0, 0x0100fee1, 0x0100fee2,
+	0x0100fee3, 0x0100fee4, 0x0100fee5, 0x0100fee6, 0x0100fee7, 0x0100fee8,
+	0x0100fee9, 0x0100feea, 0x0100feeb, 0x0100feec, 0x0100feed, 0x0100feee,
+	0x0100feef, 0x0100fef0, 0x0100fef1, 0x0100fef2, 0x0100fef3, 0x0100fef4,
+	0x0300fef5, 0x0300fef6, 0x0300fef7, 0x0300fef8, 0x0300fef9, 0x0300fefa,
+	0x0200fefb, 0x0200fefc, 0x0100ff01, 0x0100ff02, 0x0100ff03, 0x0100ff04,
+	0x0100ff05, 0x0100ff06, 0x0100ff07, 0x0100ff08, 0x0100ff09, 0x0100ff0a,
+	0x0100ff0b, 0x0100ff0c, 0x0100ff0d, 0x0100ff0e, 0x0100ff0f, 0x0100ff10,
+	0x0100ff11, 0x0100ff12, 0x0100ff13, 0x0100ff14, 0x0100ff15, 0x0100ff16,
+	0x0100ff17, 0x0100ff18, 0x0100ff19, 0x0100ff1a, 0x0100ff1b, 0x0100ff1c,
+	0x0100ff1d, 0x0100ff1e, 0x0100ff1f, 0x0100ff20, 0x0100ff21, 0x0100ff22,
+	0x0100ff23, 0x0100ff24, 0x0100ff25, 0x0100ff26, 0x0100ff27, 0x0100ff28,
+	0x0100ff29, 0x0100ff2a, 0x0100ff2b, 0x0100ff2c, 0x0100ff2d, 0x0100ff2e,
+	0x0100ff2f, 0x0100ff30, 0x0100ff31, 0x0100ff32, 0x0100ff33, 0x0100ff34,
+	0x0100ff35, 0x0100ff36, 0x0100ff37, 0x0100ff38, 0x0100ff39, 0x0100ff3a,
+	0x0100ff3b, 0x0100ff3c, 0x0100ff3d, 0x0100ff3e, 0x0100ff3f, 0x0100ff40,
+	0x0100ff41, 0x0100ff42, 0x0100ff43, 0x0100ff44, 0x0100ff45, 0x0100ff46,
+	0x0100ff47, 0x0100ff48, 0x0100ff49, 0x0100ff4a, 0x0100ff4b, 0x0100ff4c,
+	0x0100ff4d, 0x0100ff4e, 0x0100ff4f, 0x0100ff50, 0x0100ff51, 0x0100ff52,
+	0x0100ff53, 0x0100ff54, 0x0100ff55, 0x0100ff56, 0x0100ff57, 0x0100ff58,
+	0x0100ff59, 0x0100ff5a, 0x0100ff5b, 0x0100ff5c, 0x0100ff5d, 0x0100ff5e,
+	0x0100ff5f, 0x0100ff60, 0x0100ff61, 0x0100ff62, 0x0100ff63, 0x0100ff64,
+	0x0100ff65, 0x0100ff66, 0x0100ff67, 0x0100ff68, 0x0100ff69, 0x0100ff6a,
+	0x0100ff6b, 0x0100ff6c, 0x0100ff6d, 0x0100ff6e, 0x0100ff6f, 0x0100ff70,
+	0x0100ff71, 0x0100ff72, 0x0100ff73, 0x0100ff74, 0x0100ff75, 0x0100ff76,
+	0x0100ff77, 0x0100ff78, 0x0100ff79, 0x0100ff7a, 0x0100ff7b, 0x0100ff7c,
+	0x0100ff7d, 0x0100ff7e, 0x0100ff7f, 0x0100ff80, 0x0100ff81, 0x0100ff82,
+	0x0100ff83, 0x0100ff84, 0x0100ff85, 0x0100ff86, 0x0100ff87, 0x0100ff88,
+	0x0100ff89, 0x0100ff8a, 0x0100ff8b, 0x0100ff8c, 0x0100ff8d, 0x0100ff8e,
+	0x0100ff8f, 0x0100ff90, 0x0100ff91, 0x0100ff92, 0x0100ff93, 0x0100ff94,
+	0x0100ff95, 0x0100ff96, 0x0100ff97, 0x0100ff98, 0x0100ff99, 0x0100ff9a,
+	0x0100ff9b, 0x0100ff9c, 0x0100ff9d, 0x0100ff9e, 0x0100ff9f, 0x0100ffa0,
+	0x0100ffa1, 0x0100ffa2, 0x0100ffa3, 0x0100ffa4, 0x0100ffa5, 0x0100ffa6,
+	0x0100ffa7, 0x0100ffa8, 0x0100ffa9, 0x0100ffaa, 0x0100ffab, 0x0100ffac,
+	0x0100ffad, 0x0100ffae, 0x0100ffaf, 0x0100ffb0, 0x0100ffb1, 0x0100ffb2,
+	0x0100ffb3, 0x0100ffb4, 0x0100ffb5, 0x0100ffb6, 0x0100ffb7, 0x0100ffb8,
+	0x0100ffb9, 0x0100ffba, 0x0100ffbb, 0x0100ffbc, 0x0100ffbd, 0x0100ffbe,
+	0x0100ffc2, 0x0100ffc3, 0x0100ffc4, 0x0100ffc5, 0x0100ffc6, 0x0100ffc7,
+	0x0100ffca, 0x0100ffcb, 0x0100ffcc, 0x0100ffcd, 0x0100ffce, 0x0100ffcf,
+	0x0100ffd2, 0x0100ffd3, 0x0100ffd4, 0x0100ffd5, 0x0100ffd6, 0x0100ffd7,
+	0x0100ffda, 0x0100ffdb, 0x0100ffdc, 0x0100ffe0, 0x0100ffe1, 0x0100ffe2,
+	0x0200ffe3, 0x0100ffe4, 0x0100ffe5, 0x0100ffe6, 0x0100ffe8, 0x0100ffe9,
+	0x0100ffea, 0x0100ffeb, 0x0100ffec, 0x0100ffed, 0x0100ffee, 0x01010781,
+	0x01010782, 0x01010783, 0x01010784, 0x01010785, 0x01010787, 0x01010788,
+	0x01010789, 0x0101078a, 0x0101078b, 0x0101078c, 0x0101078d, 0x0101078e,
+	0x0101078f, 0x01010790, 0x01010791, 0x01010792, 0x01010793, 0x01010794,
+	0x01010795, 0x01010796, 0x01010797, 0x01010798, 0x01010799, 0x0101079a,
+	0x0101079b, 0x0201079c, 0x0101079d, 0x0101079e, 0x0201079f, 0x010107a0,
+	0x020107a1, 0x010107a2, 0x010107a3, 0x010107a4, 0x010107a5, 0x010107a6,
+	0x020107a7, 0x010107a8, 0x010107a9, 0x010107aa, 0x010107ab, 0x010107ac,
+	0x010107ad, 0x010107ae, 0x010107af, 0x010107b0, 0x010107b2, 0x010107b3,
+	0x010107b4, 0x010107b5, 0x010107b6, 0x010107b7, 0x010107b8, 0x020107b9,
+	0x020107ba, 0x0101d400, 0x0101d401, 0x0101d402, 0x0101d403, 0x0101d404,
+	0x0101d405, 0x0101d406, 0x0101d407, 0x0101d408, 0x0101d409, 0x0101d40a,
+	0x0101d40b, 0x0101d40c, 0x0101d40d, 0x0101d40e, 0x0101d40f, 0x0101d410,
+	0x0101d411, 0x0101d412, 0x0101d413, 0x0101d414, 0x0101d415, 0x0101d416,
+	0x0101d417, 0x0101d418, 0x0101d419, 0x0101d41a, 0x0101d41b, 0x0101d41c,
+	0x0101d41d, 0x0101d41e, 0x0101d41f, 0x0101d420, 0x0101d421, 0x0101d422,
+	0x0101d423, 0x0101d424, 0x0101d425, 0x0101d426, 0x0101d427, 0x0101d428,
+	0x0101d429, 0x0101d42a, 0x0101d42b, 0x0101d42c, 0x0101d42d, 0x0101d42e,
+	0x0101d42f, 0x0101d430, 0x0101d431, 0x0101d432, 0x0101d433, 0x0101d434,
+	0x0101d435, 0x0101d436, 0x0101d437, 0x0101d438, 0x0101d439, 0x0101d43a,
+	0x0101d43b, 0x0101d43c, 0x0101d43d, 0x0101d43e, 0x0101d43f, 0x0101d440,
+	0x0101d441, 0x0101d442, 0x0101d443, 0x0101d444, 0x0101d445, 0x0101d446,
+	0x0101d447, 0x0101d448, 0x0101d449, 0x0101d44a, 0x0101d44b, 0x0101d44c,
+	0x0101d44d, 0x0101d44e, 0x0101d44f, 0x0101d450, 0x0101d451, 0x0101d452,
+	0x0101d453, 0x0101d454, 0x0101d456, 0x0101d457, 0x0101d458, 0x0101d459,
+	0x0101d45a, 0x0101d45b, 0x0101d45c, 0x0101d45d, 0x0101d45e, 0x0101d45f,
+	0x0101d460, 0x0101d461, 0x0101d462, 0x0101d463, 0x0101d464, 0x0101d465,
+	0x0101d466, 0x0101d467, 0x0101d468, 0x0101d469, 0x0101d46a, 0x0101d46b,
+	0x0101d46c, 0x0101d46d, 0x0101d46e, 0x0101d46f, 0x0101d470, 0x0101d471,
+	0x0101d472, 0x0101d473, 0x0101d474, 0x0101d475, 0x0101d476, 0x0101d477,
+	0x0101d478, 0x0101d479, 0x0101d47a, 0x0101d47b, 0x0101d47c, 0x0101d47d,
+	0x0101d47e, 0x0101d47f, 0x0101d480, 0x0101d481, 0x0101d482, 0x0101d483,
+	0x0101d484, 0x0101d485, 0x0101d486, 0x0101d487, 0x0101d488, 0x0101d489,
+	0x0101d48a, 0x0101d48b, 0x0101d48c, 0x0101d48d, 0x0101d48e, 0x0101d48f,
+	0x0101d490, 0x0101d491, 0x0101d492, 0x0101d493, 0x0101d494, 0x0101d495,
+	0x0101d496, 0x0101d497, 0x0101d498, 0x0101d499, 0x0101d49a, 0x0101d49b,
+	0x0101d49c, 0x0101d49e, 0x0101d49f, 0x0101d4a2, 0x0101d4a5, 0x0101d4a6,
+	0x0101d4a9, 0x0101d4aa, 0x0101d4ab, 0x0101d4ac, 0x0101d4ae, 0x0101d4af,
+	0x0101d4b0, 0x0101d4b1, 0x0101d4b2, 0x0101d4b3, 0x0101d4b4, 0x0101d4b5,
+	0x0101d4b6, 0x0101d4b7, 0x0101d4b8, 0x0101d4b9, 0x0101d4bb, 0x0101d4bd,
+	0x0101d4be, 0x0101d4bf, 0x0101d4c0, 0x0101d4c1, 0x0101d4c2, 0x0101d4c3,
+	0x0101d4c5, 0x0101d4c6, 0x0101d4c7, 0x0101d4c8, 0x0101d4c9, 0x0101d4ca,
+	0x0101d4cb, 0x0101d4cc, 0x0101d4cd, 0x0101d4ce, 0x0101d4cf, 0x0101d4d0,
+	0x0101d4d1, 0x0101d4d2, 0x0101d4d3, 0x0101d4d4, 0x0101d4d5, 0x0101d4d6,
+	0x0101d4d7, 0x0101d4d8, 0x0101d4d9, 0x0101d4da, 0x0101d4db, 0x0101d4dc,
+	0x0101d4dd, 0x0101d4de, 0x0101d4df, 0x0101d4e0, 0x0101d4e1, 0x0101d4e2,
+	0x0101d4e3, 0x0101d4e4, 0x0101d4e5, 0x0101d4e6, 0x0101d4e7, 0x0101d4e8,
+	0x0101d4e9, 0x0101d4ea, 0x0101d4eb, 0x0101d4ec, 0x0101d4ed, 0x0101d4ee,
+	0x0101d4ef, 0x0101d4f0, 0x0101d4f1, 0x0101d4f2, 0x0101d4f3, 0x0101d4f4,
+	0x0101d4f5, 0x0101d4f6, 0x0101d4f7, 0x0101d4f8, 0x0101d4f9, 0x0101d4fa,
+	0x0101d4fb, 0x0101d4fc, 0x0101d4fd, 0x0101d4fe, 0x0101d4ff, 0x0101d500,
+	0x0101d501, 0x0101d502, 0x0101d503, 0x0101d504, 0x0101d505, 0x0101d507,
+	0x0101d508, 0x0101d509, 0x0101d50a, 0x0101d50d, 0x0101d50e, 0x0101d50f,
+	0x0101d510, 0x0101d511, 0x0101d512, 0x0101d513, 0x0101d514, 0x0101d516,
+	0x0101d517, 0x0101d518, 0x0101d519, 0x0101d51a, 0x0101d51b, 0x0101d51c,
+	0x0101d51e, 0x0101d51f, 0x0101d520, 0x0101d521, 0x0101d522, 0x0101d523,
+	0x0101d524, 0x0101d525, 0x0101d526, 0x0101d527, 0x0101d528, 0x0101d529,
+	0x0101d52a, 0x0101d52b, 0x0101d52c, 0x0101d52d, 0x0101d52e, 0x0101d52f,
+	0x0101d530, 0x0101d531, 0x0101d532, 0x0101d533, 0x0101d534, 0x0101d535,
+	0x0101d536, 0x0101d537, 0x0101d538, 0x0101d539, 0x0101d53b, 0x0101d53c,
+	0x0101d53d, 0x0101d53e, 0x0101d540, 0x0101d541, 0x0101d542, 0x0101d543,
+	0x0101d544, 0x0101d546, 0x0101d54a, 0x0101d54b, 0x0101d54c, 0x0101d54d,
+	0x0101d54e, 0x0101d54f, 0x0101d550, 0x0101d552, 0x0101d553, 0x0101d554,
+	0x0101d555, 0x0101d556, 0x0101d557, 0x0101d558, 0x0101d559, 0x0101d55a,
+	0x0101d55b, 0x0101d55c, 0x0101d55d, 0x0101d55e, 0x0101d55f, 0x0101d560,
+	0x0101d561, 0x0101d562, 0x0101d563, 0x0101d564, 0x0101d565, 0x0101d566,
+	0x0101d567, 0x0101d568, 0x0101d569, 0x0101d56a, 0x0101d56b, 0x0101d56c,
+	0x0101d56d, 0x0101d56e, 0x0101d56f, 0x0101d570, 0x0101d571, 0x0101d572,
+	0x0101d573, 0x0101d574, 0x0101d575, 0x0101d576, 0x0101d577, 0x0101d578,
+	0x0101d579, 0x0101d57a, 0x0101d57b, 0x0101d57c, 0x0101d57d, 0x0101d57e,
+	0x0101d57f, 0x0101d580, 0x0101d581, 0x0101d582, 0x0101d583, 0x0101d584,
+	0x0101d585, 0x0101d586, 0x0101d587, 0x0101d588, 0x0101d589, 0x0101d58a,
+	0x0101d58b, 0x0101d58c, 0x0101d58d, 0x0101d58e, 0x0101d58f, 0x0101d590,
+	0x0101d591, 0x0101d592, 0x0101d593, 0x0101d594, 0x0101d595, 0x0101d596,
+	0x0101d597, 0x0101d598, 0x0101d599, 0x0101d59a, 0x0101d59b, 0x0101d59c,
+	0x0101d59d, 0x0101d59e, 0x0101d59f, 0x0101d5a0, 0x0101d5a1, 0x0101d5a2,
+	0x0101d5a3, 0x0101d5a4, 0x0101d5a5, 0x0101d5a6, 0x0101d5a7, 0x0101d5a8,
+	0x0101d5a9, 0x0101d5aa, 0x0101d5ab, 0x0101d5ac, 0x0101d5ad, 0x0101d5ae,
+	0x0101d5af, 0x0101d5b0, 0x0101d5b1, 0x0101d5b2, 0x0101d5b3, 0x0101d5b4,
+	0x0101d5b5, 0x0101d5b6, 0x0101d5b7, 0x0101d5b8, 0x0101d5b9, 0x0101d5ba,
+	0x0101d5bb, 0x0101d5bc, 0x0101d5bd, 0x0101d5be, 0x0101d5bf, 0x0101d5c0,
+	0x0101d5c1, 0x0101d5c2, 0x0101d5c3, 0x0101d5c4, 0x0101d5c5, 0x0101d5c6,
+	0x0101d5c7, 0x0101d5c8, 0x0101d5c9, 0x0101d5ca, 0x0101d5cb, 0x0101d5cc,
+	0x0101d5cd, 0x0101d5ce, 0x0101d5cf, 0x0101d5d0, 0x0101d5d1, 0x0101d5d2,
+	0x0101d5d3, 0x0101d5d4, 0x0101d5d5, 0x0101d5d6, 0x0101d5d7, 0x0101d5d8,
+	0x0101d5d9, 0x0101d5da, 0x0101d5db, 0x0101d5dc, 0x0101d5dd, 0x0101d5de,
+	0x0101d5df, 0x0101d5e0, 0x0101d5e1, 0x0101d5e2, 0x0101d5e3, 0x0101d5e4,
+	0x0101d5e5, 0x0101d5e6, 0x0101d5e7, 0x0101d5e8, 0x0101d5e9, 0x0101d5ea,
+	0x0101d5eb, 0x0101d5ec, 0x0101d5ed, 0x0101d5ee, 0x0101d5ef, 0x0101d5f0,
+	0x0101d5f1, 0x0101d5f2, 0x0101d5f3, 0x0101d5f4, 0x0101d5f5, 0x0101d5f6,
+	0x0101d5f7, 0x0101d5f8, 0x0101d5f9, 0x0101d5fa, 0x0101d5fb, 0x0101d5fc,
+	0x0101d5fd, 0x0101d5fe, 0x0101d5ff, 0x0101d600, 0x0101d601, 0x0101d602,
+	0x0101d603, 0x0101d604, 0x0101d605, 0x0101d606, 0x0101d607, 0x0101d608,
+	0x0101d609, 0x0101d60a, 0x0101d60b, 0x0101d60c, 0x0101d60d, 0x0101d60e,
+	0x0101d60f, 0x0101d610, 0x0101d611, 0x0101d612, 0x0101d613, 0x0101d614,
+	0x0101d615, 0x0101d616, 0x0101d617, 0x0101d618, 0x0101d619, 0x0101d61a,
+	0x0101d61b, 0x0101d61c, 0x0101d61d, 0x0101d61e, 0x0101d61f, 0x0101d620,
+	0x0101d621, 0x0101d622, 0x0101d623, 0x0101d624, 0x0101d625, 0x0101d626,
+	0x0101d627, 0x0101d628, 0x0101d629, 0x0101d62a, 0x0101d62b, 0x0101d62c,
+	0x0101d62d, 0x0101d62e, 0x0101d62f, 0x0101d630, 0x0101d631, 0x0101d632,
+	0x0101d633, 0x0101d634, 0x0101d635, 0x0101d636, 0x0101d637, 0x0101d638,
+	0x0101d639, 0x0101d63a, 0x0101d63b, 0x0101d63c, 0x0101d63d, 0x0101d63e,
+	0x0101d63f, 0x0101d640, 0x0101d641, 0x0101d642, 0x0101d643, 0x0101d644,
+	0x0101d645, 0x0101d646, 0x0101d647, 0x0101d648, 0x0101d649, 0x0101d64a,
+	0x0101d64b, 0x0101d64c, 0x0101d64d, 0x0101d64e, 0x0101d64f, 0x0101d650,
+	0x0101d651, 0x0101d652, 0x0101d653, 0x0101d654, 0x0101d655, 0x0101d656,
+	0x0101d657, 0x0101d658, 0x0101d659, 0x0101d65a, 0x0101d65b, 0x0101d65c,
+	0x0101d65d, 0x0101d65e, 0x0101d65f, 0x0101d660, 0x0101d661, 0x0101d662,
+	0x0101d663, 0x0101d664, 0x0101d665, 0x0101d666, 0x0101d667, 0x0101d668,
+	0x0101d669, 0x0101d66a, 0x0101d66b, 0x0101d66c, 0x0101d66d, 0x0101d66e,
+	0x0101d66f, 0x0101d670, 0x0101d671, 0x0101d672, 0x0101d673, 0x0101d674,
+	0x0101d675, 0x0101d676, 0x0101d677, 0x0101d678, 0x0101d679, 0x0101d67a,
+	0x0101d67b, 0x0101d67c, 0x0101d67d, 0x0101d67e, 0x0101d67f, 0x0101d680,
+	0x0101d681, 0x0101d682, 0x0101d683, 0x0101d684, 0x0101d685, 0x0101d686,
+	0x0101d687, 0x0101d688, 0x0101d689, 0x0101d68a, 0x0101d68b, 0x0101d68c,
+	0x0101d68d, 0x0101d68e, 0x0101d68f, 0x0101d690, 0x0101d691, 0x0101d692,
+	0x0101d693, 0x0101d694, 0x0101d695, 0x0101d696, 0x0101d697, 0x0101d698,
+	0x0101d699, 0x0101d69a, 0x0101d69b, 0x0101d69c, 0x0101d69d, 0x0101d69e,
+	0x0101d69f, 0x0101d6a0, 0x0101d6a1, 0x0101d6a2, 0x0101d6a3, 0x0101d6a4,
+	0x0101d6a5, 0x0101d6a8, 0x0101d6a9, 0x0101d6aa, 0x0101d6ab, 0x0101d6ac,
+	0x0101d6ad, 0x0101d6ae, 0x0101d6af, 0x0101d6b0, 0x0101d6b1, 0x0101d6b2,
+	0x0101d6b3, 0x0101d6b4, 0x0101d6b5, 0x0101d6b6, 0x0101d6b7, 0x0101d6b8,
+	0x0101d6b9, 0x0101d6ba, 0x0101d6bb, 0x0101d6bc, 0x0101d6bd, 0x0101d6be,
+	0x0101d6bf, 0x0101d6c0, 0x0101d6c1, 0x0101d6c2, 0x0101d6c3, 0x0101d6c4,
+	0x0101d6c5, 0x0101d6c6, 0x0101d6c7, 0x0101d6c8, 0x0101d6c9, 0x0101d6ca,
+	0x0101d6cb, 0x0101d6cc, 0x0101d6cd, 0x0101d6ce, 0x0101d6cf, 0x0101d6d0,
+	0x0101d6d1, 0x0101d6d2, 0x0101d6d3, 0x0101d6d4, 0x0101d6d5, 0x0101d6d6,
+	0x0101d6d7, 0x0101d6d8, 0x0101d6d9, 0x0101d6da, 0x0101d6db, 0x0101d6dc,
+	0x0101d6dd, 0x0101d6de, 0x0101d6df, 0x0101d6e0, 0x0101d6e1, 0x0101d6e2,
+	0x0101d6e3, 0x0101d6e4, 0x0101d6e5, 0x0101d6e6, 0x0101d6e7, 0x0101d6e8,
+	0x0101d6e9, 0x0101d6ea, 0x0101d6eb, 0x0101d6ec, 0x0101d6ed, 0x0101d6ee,
+	0x0101d6ef, 0x0101d6f0, 0x0101d6f1, 0x0101d6f2, 0x0101d6f3, 0x0101d6f4,
+	0x0101d6f5, 0x0101d6f6, 0x0101d6f7, 0x0101d6f8, 0x0101d6f9, 0x0101d6fa,
+	0x0101d6fb, 0x0101d6fc, 0x0101d6fd, 0x0101d6fe, 0x0101d6ff, 0x0101d700,
+	0x0101d701, 0x0101d702, 0x0101d703, 0x0101d704, 0x0101d705, 0x0101d706,
+	0x0101d707, 0x0101d708, 0x0101d709, 0x0101d70a, 0x0101d70b, 0x0101d70c,
+	0x0101d70d, 0x0101d70e, 0x0101d70f, 0x0101d710, 0x0101d711, 0x0101d712,
+	0x0101d713, 0x0101d714, 0x0101d715, 0x0101d716, 0x0101d717, 0x0101d718,
+	0x0101d719, 0x0101d71a, 0x0101d71b, 0x0101d71c, 0x0101d71d, 0x0101d71e,
+	0x0101d71f, 0x0101d720, 0x0101d721, 0x0101d722, 0x0101d723, 0x0101d724,
+	0x0101d725, 0x0101d726, 0x0101d727, 0x0101d728, 0x0101d729, 0x0101d72a,
+	0x0101d72b, 0x0101d72c, 0x0101d72d, 0x0101d72e, 0x0101d72f, 0x0101d730,
+	0x0101d731, 0x0101d732, 0x0101d733, 0x0101d734, 0x0101d735, 0x0101d736,
+	0x0101d737, 0x0101d738, 0x0101d739, 0x0101d73a, 0x0101d73b, 0x0101d73c,
+	0x0101d73d, 0x0101d73e, 0x0101d73f, 0x0101d740, 0x0101d741, 0x0101d742,
+	0x0101d743, 0x0101d744, 0x0101d745, 0x0101d746, 0x0101d747, 0x0101d748,
+	0x0101d749, 0x0101d74a, 0x0101d74b, 0x0101d74c, 0x0101d74d, 0x0101d74e,
+	0x0101d74f, 0x0101d750, 0x0101d751, 0x0101d752, 0x0101d753, 0x0101d754,
+	0x0101d755, 0x0101d756, 0x0101d757, 0x0101d758, 0x0101d759, 0x0101d75a,
+	0x0101d75b, 0x0101d75c, 0x0101d75d, 0x0101d75e, 0x0101d75f, 0x0101d760,
+	0x0101d761, 0x0101d762, 0x0101d763, 0x0101d764, 0x0101d765, 0x0101d766,
+	0x0101d767, 0x0101d768, 0x0101d769, 0x0101d76a, 0x0101d76b, 0x0101d76c,
+	0x0101d76d, 0x0101d76e, 0x0101d76f, 0x0101d770, 0x0101d771, 0x0101d772,
+	0x0101d773, 0x0101d774, 0x0101d775, 0x0101d776, 0x0101d777, 0x0101d778,
+	0x0101d779, 0x0101d77a, 0x0101d77b, 0x0101d77c, 0x0101d77d, 0x0101d77e,
+	0x0101d77f, 0x0101d780, 0x0101d781, 0x0101d782, 0x0101d783, 0x0101d784,
+	0x0101d785, 0x0101d786, 0x0101d787, 0x0101d788, 0x0101d789, 0x0101d78a,
+	0x0101d78b, 0x0101d78c, 0x0101d78d, 0x0101d78e, 0x0101d78f, 0x0101d790,
+	0x0101d791, 0x0101d792, 0x0101d793, 0x0101d794, 0x0101d795, 0x0101d796,
+	0x0101d797, 0x0101d798, 0x0101d799, 0x0101d79a, 0x0101d79b, 0x0101d79c,
+	0x0101d79d, 0x0101d79e, 0x0101d79f, 0x0101d7a0, 0x0101d7a1, 0x0101d7a2,
+	0x0101d7a3, 0x0101d7a4, 0x0101d7a5, 0x0101d7a6, 0x0101d7a7, 0x0101d7a8,
+	0x0101d7a9, 0x0101d7aa, 0x0101d7ab, 0x0101d7ac, 0x0101d7ad, 0x0101d7ae,
+	0x0101d7af, 0x0101d7b0, 0x0101d7b1, 0x0101d7b2, 0x0101d7b3, 0x0101d7b4,
+	0x0101d7b5, 0x0101d7b6, 0x0101d7b7, 0x0101d7b8, 0x0101d7b9, 0x0101d7ba,
+	0x0101d7bb, 0x0101d7bc, 0x0101d7bd, 0x0101d7be, 0x0101d7bf, 0x0101d7c0,
+	0x0101d7c1, 0x0101d7c2, 0x0101d7c3, 0x0101d7c4, 0x0101d7c5, 0x0101d7c6,
+	0x0101d7c7, 0x0101d7c8, 0x0101d7c9, 0x0101d7ca, 0x0101d7cb, 0x0101d7ce,
+	0x0101d7cf, 0x0101d7d0, 0x0101d7d1, 0x0101d7d2, 0x0101d7d3, 0x0101d7d4,
+	0x0101d7d5, 0x0101d7d6, 0x0101d7d7, 0x0101d7d8, 0x0101d7d9, 0x0101d7da,
+	0x0101d7db, 0x0101d7dc, 0x0101d7dd, 0x0101d7de, 0x0101d7df, 0x0101d7e0,
+	0x0101d7e1, 0x0101d7e2, 0x0101d7e3, 0x0101d7e4, 0x0101d7e5, 0x0101d7e6,
+	0x0101d7e7, 0x0101d7e8, 0x0101d7e9, 0x0101d7ea, 0x0101d7eb, 0x0101d7ec,
+	0x0101d7ed, 0x0101d7ee, 0x0101d7ef, 0x0101d7f0, 0x0101d7f1, 0x0101d7f2,
+	0x0101d7f3, 0x0101d7f4, 0x0101d7f5, 0x0101d7f6, 0x0101d7f7, 0x0101d7f8,
+	0x0101d7f9, 0x0101d7fa, 0x0101d7fb, 0x0101d7fc, 0x0101d7fd, 0x0101d7fe,
+	0x0101d7ff, 0x0101ee00, 0x0101ee01, 0x0101ee02, 0x0101ee03, 0x0101ee05,
+	0x0101ee06, 0x0101ee07, 0x0101ee08, 0x0101ee09, 0x0101ee0a, 0x0101ee0b,
+	0x0101ee0c, 0x0101ee0d, 0x0101ee0e, 0x0101ee0f, 0x0101ee10, 0x0101ee11,
+	0x0101ee12, 0x0101ee13, 0x0101ee14, 0x0101ee15, 0x0101ee16, 0x0101ee17,
+	0x0101ee18, 0x0101ee19, 0x0101ee1a, 0x0101ee1b, 0x0101ee1c, 0x0101ee1d,
+	0x0101ee1e, 0x0101ee1f, 0x0101ee21, 0x0101ee22, 0x0101ee24, 0x0101ee27,
+	0x0101ee29, 0x0101ee2a, 0x0101ee2b, 0x0101ee2c, 0x0101ee2d, 0x0101ee2e,
+	0x0101ee2f, 0x0101ee30, 0x0101ee31, 0x0101ee32, 0x0101ee34, 0x0101ee35,
+	0x0101ee36, 0x0101ee37, 0x0101ee39, 0x0101ee3b, 0x0101ee42, 0x0101ee47,
+	0x0101ee49, 0x0101ee4b, 0x0101ee4d, 0x0101ee4e, 0x0101ee4f, 0x0101ee51,
+	0x0101ee52, 0x0101ee54, 0x0101ee57, 0x0101ee59, 0x0101ee5b, 0x0101ee5d,
+	0x0101ee5f, 0x0101ee61, 0x0101ee62, 0x0101ee64, 0x0101ee67, 0x0101ee68,
+	0x0101ee69, 0x0101ee6a, 0x0101ee6c, 0x0101ee6d, 0x0101ee6e, 0x0101ee6f,
+	0x0101ee70, 0x0101ee71, 0x0101ee72, 0x0101ee74, 0x0101ee75, 0x0101ee76,
+	0x0101ee77, 0x0101ee79, 0x0101ee7a, 0x0101ee7b, 0x0101ee7c, 0x0101ee7e,
+	0x0101ee80, 0x0101ee81, 0x0101ee82, 0x0101ee83, 0x0101ee84, 0x0101ee85,
+	0x0101ee86, 0x0101ee87, 0x0101ee88, 0x0101ee89, 0x0101ee8b, 0x0101ee8c,
+	0x0101ee8d, 0x0101ee8e, 0x0101ee8f, 0x0101ee90, 0x0101ee91, 0x0101ee92,
+	0x0101ee93, 0x0101ee94, 0x0101ee95, 0x0101ee96, 0x0101ee97, 0x0101ee98,
+	0x0101ee99, 0x0101ee9a, 0x0101ee9b, 0x0101eea1, 0x0101eea2, 0x0101eea3,
+	0x0101eea5, 0x0101eea6, 0x0101eea7, 0x0101eea8, 0x0101eea9, 0x0101eeab,
+	0x0101eeac, 0x0101eead, 0x0101eeae, 0x0101eeaf, 0x0101eeb0, 0x0101eeb1,
+	0x0101eeb2, 0x0101eeb3, 0x0101eeb4, 0x0101eeb5, 0x0101eeb6, 0x0101eeb7,
+	0x0101eeb8, 0x0101eeb9, 0x0101eeba, 0x0101eebb, 0x0201f100, 0x0201f101,
+	0x0201f102, 0x0201f103, 0x0201f104, 0x0201f105, 0x0201f106, 0x0201f107,
+	0x0201f108, 0x0201f109, 0x0201f10a, 0x0301f110, 0x0301f111, 0x0301f112,
+	0x0301f113, 0x0301f114, 0x0301f115, 0x0301f116, 0x0301f117, 0x0301f118,
+	0x0301f119, 0x0301f11a, 0x0301f11b, 0x0301f11c, 0x0301f11d, 0x0301f11e,
+	0x0301f11f, 0x0301f120, 0x0301f121, 0x0301f122, 0x0301f123, 0x0301f124,
+	0x0301f125, 0x0301f126, 0x0301f127, 0x0301f128, 0x0301f129, 0x0301f12a,
+	0x0101f12b, 0x0101f12c, 0x0201f12d, 0x0201f12e, 0x0101f130, 0x0101f131,
+	0x0101f132, 0x0101f133, 0x0101f134, 0x0101f135, 0x0101f136, 0x0101f137,
+	0x0101f138, 0x0101f139, 0x0101f13a, 0x0101f13b, 0x0101f13c, 0x0101f13d,
+	0x0101f13e, 0x0101f13f, 0x0101f140, 0x0101f141, 0x0101f142, 0x0101f143,
+	0x0101f144, 0x0101f145, 0x0101f146, 0x0101f147, 0x0101f148, 0x0101f149,
+	0x0201f14a, 0x0201f14b, 0x0201f14c, 0x0201f14d, 0x0301f14e, 0x0201f14f,
+	0x0201f16a, 0x0201f16b, 0x0201f16c, 0x0201f190, 0x0201f200, 0x0201f201,
+	0x0101f202, 0x0101f210, 0x0101f211, 0x0101f212, 0x0201f213, 0x0101f214,
+	0x0101f215, 0x0101f216, 0x0101f217, 0x0101f218, 0x0101f219, 0x0101f21a,
+	0x0101f21b, 0x0101f21c, 0x0101f21d, 0x0101f21e, 0x0101f21f, 0x0101f220,
+	0x0101f221, 0x0101f222, 0x0101f223, 0x0101f224, 0x0101f225, 0x0101f226,
+	0x0101f227, 0x0101f228, 0x0101f229, 0x0101f22a, 0x0101f22b, 0x0101f22c,
+	0x0101f22d, 0x0101f22e, 0x0101f22f, 0x0101f230, 0x0101f231, 0x0101f232,
+	0x0101f233, 0x0101f234, 0x0101f235, 0x0101f236, 0x0101f237, 0x0101f238,
+	0x0101f239, 0x0101f23a, 0x0101f23b, 0x0301f240, 0x0301f241, 0x0301f242,
+	0x0301f243, 0x0301f244, 0x0301f245, 0x0301f246, 0x0301f247, 0x0301f248,
+	0x0101f250, 0x0101f251, 0x0101fbf0, 0x0101fbf1, 0x0101fbf2, 0x0101fbf3,
+	0x0101fbf4, 0x0101fbf5, 0x0101fbf6, 0x0101fbf7, 0x0101fbf8, 0x0101fbf9,
+};
+
+static const uint16_t sn_compat_off[3750] = {
+	26, 27, 0, 29, 31, 32, 33, 35, 36, 38, 14, 39,
+	42, 45, 303, 305, 333, 335, 353, 18, 521, 524, 527, 531,
+	533, 535, 538, 540, 542, 642, 644, 646, 7, 810, 9, 17,
+	811, 812, 813, 22, 24, 814, 816, 818, 820, 822, 824, 489,
+	11, 18, 23, 826, 837, 33, 843, 872, 878, 921, 863, 897,
+	889, 884, 879, 885, 938, 939, 875, 942, 1237, 1249, 1251, 1253,
+	1255, 1353, 1355, 1357, 1359, 1361, 1380, 1385, 1444, 1519, 1520, 1521,
+	1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533,
+	1534, 1535, 1536, 1537, 1538, 1539, 0, 1540, 1541, 1542, 1, 3,
+	4, 485, 486, 1543, 6, 10, 12, 355, 14, 479, 1544, 1545,
+	15, 19, 20, 1546, 493, 21, 1547, 872, 873, 874, 889, 890,
+	8, 17, 20, 21, 872, 873, 885, 889, 890, 992, 1548, 2,
+	1549, 94, 1543, 5, 1550, 1551, 1552, 491, 490, 1553, 1554, 1555,
+	1556, 1557, 1558, 1559, 1560, 494, 1561, 1562, 495, 1563, 1564, 505,
+	1565, 803, 513, 1566, 514, 804, 25, 1567, 1568, 517, 878, 1984,
+	1834, 2877, 2877, 2879, 2883, 2920, 2925, 2930, 2957, 2962, 2967, 3001,
+	843, 33, 3038, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 3042, 3043, 3045, 3046, 3048, 26, 3051, 3053, 3056, 3058,
+	3061, 3063, 3065, 3067, 3069, 3071, 26, 3075, 8, 3076, 3077, 3078,
+	3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 13, 3075, 38, 31,
+	32, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086,
+	0, 4, 14, 23, 485, 7, 10, 11, 12, 13, 15, 18,
+	19, 3087, 3089, 3092, 3095, 3096, 3098, 3101, 3104, 3105, 6, 1526,
+	1526, 1526, 7, 277, 1527, 1527, 1530, 11, 1532, 3107, 1535, 3109,
+	1536, 1536, 1536, 3110, 3112, 3115, 3117, 3117, 1521, 3095, 4, 1523,
+	3119, 1531, 14, 3121, 3122, 3123, 3124, 8, 3125, 884, 873, 3128,
+	3129, 3130, 1522, 3, 4, 8, 9, 3131, 3134, 3137, 3141, 3144,
+	3147, 3150, 3153, 3156, 3159, 3162, 3165, 3168, 3171, 3174, 3177, 1527,
+	3181, 3184, 3188, 3191, 3193, 3196, 3200, 3205, 3208, 3210, 3213, 1530,
+	3095, 1522, 1531, 8, 3220, 3222, 3225, 21, 3227, 3229, 3232, 3236,
+	23, 3238, 3240, 11, 2, 3, 12, 3244, 3269, 3271, 3274, 3276,
+	38, 31, 32, 3076, 3077, 3078, 3079, 3080, 3081, 3347, 3349, 3351,
+	3353, 3355, 3357, 3359, 3361, 3363, 3365, 3367, 3369, 3372, 3375, 3378,
+	3381, 3384, 3387, 3390, 3393, 3396, 3400, 3404, 3408, 3412, 3416, 3420,
+	3424, 3428, 3432, 3436, 3440, 3442, 3444, 3446, 3448, 3450, 3452, 3454,
+	3456, 3458, 3461, 3464, 3467, 3470, 3473, 3476, 3479, 3482, 3485, 3488,
+	3491, 3494, 3497, 3500, 3503, 3506, 3509, 3512, 3515, 3518, 3521, 3524,
+	3527, 3530, 3533, 3536, 3539, 3542, 3545, 3548, 3551, 3554, 3557, 3560,
+	3563, 3566, 1519, 1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528,
+	1529, 1530, 1531, 1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191,
+	1539, 3208, 3595, 3117, 0, 1, 2, 3, 4, 5, 6, 7,
+	8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+	20, 21, 22, 23, 24, 25, 3075, 3597, 3601, 3604, 3606, 9,
+	3191, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733,
+	3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745,
+	3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757,
+	3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769,
+	3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781,
+	3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793,
+	3794, 3795, 3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805,
+	3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817,
+	3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 3827, 3828, 3829,
+	3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841,
+	3842, 3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853,
+	3854, 3855, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865,
+	3866, 3867, 3868, 3869, 3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877,
+	3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889,
+	3890, 3891, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901,
+	3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913,
+	3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922, 3923, 3924, 3925,
+	3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937,
+	3938, 3939, 26, 3940, 3749, 3941, 3942, 3995, 3997, 4001, 4065, 4067,
+	4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079,
+	4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091,
+	4092, 4093, 4094, 4095, 4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103,
+	4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115,
+	4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127,
+	4128, 4129, 4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137, 4138, 4139,
+	4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149, 4150, 4151,
+	4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 3726, 3732, 4161,
+	4162, 4163, 4164, 4165, 4166, 3730, 4167, 4168, 4169, 4170, 3734, 4171,
+	4174, 4177, 4180, 4183, 4186, 4189, 4192, 4195, 4198, 4201, 4204, 4207,
+	4210, 4213, 4217, 4221, 4225, 4229, 4233, 4237, 4241, 4245, 4249, 4253,
+	4257, 4261, 4265, 4269, 4273, 4280, 4286, 4289, 4292, 4295, 4298, 4301,
+	4304, 4307, 4310, 4313, 4316, 4319, 4322, 4325, 4328, 4331, 4334, 4337,
+	4340, 4343, 4346, 4349, 4352, 4355, 4358, 4361, 4364, 4367, 4370, 4373,
+	4376, 4379, 4382, 4385, 4388, 4391, 4394, 4395, 3792, 4396, 4397, 4400,
+	4402, 4404, 4406, 4408, 4410, 4412, 4414, 4416, 4418, 4420, 4422, 4424,
+	4426, 4428, 4067, 4070, 4073, 4075, 4083, 4084, 4087, 4089, 4090, 4092,
+	4093, 4094, 4095, 4096, 4430, 4432, 4434, 4436, 4438, 4440, 4442, 4444,
+	4446, 4448, 4450, 4452, 4454, 4456, 4458, 4463, 4467, 3726, 3732, 4161,
+	4162, 4469, 4470, 4471, 3737, 4472, 3749, 3799, 3811, 3810, 3800, 3892,
+	3757, 3797, 4473, 4474, 4475, 4476, 4477, 4478, 4479, 4480, 4481, 4482,
+	3763, 4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490, 4163, 4164, 4165,
+	4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 4499, 4500, 4501, 4503,
+	4505, 4507, 4509, 4511, 4513, 4515, 4517, 4519, 4521, 4523, 4525, 4527,
+	4529, 4531, 4533, 4535, 4537, 4539, 4541, 4543, 4545, 4547, 4549, 4552,
+	4555, 4558, 4560, 4563, 4565, 4568, 4569, 4570, 4571, 4572, 4573, 4574,
+	4575, 4576, 4577, 4578, 4579, 4580, 4581, 4582, 4583, 4584, 4585, 4586,
+	4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594, 4595, 4596, 4597, 4598,
+	4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610,
+	4611, 4612, 4613, 4614, 4615, 4617, 4622, 4626, 4631, 4634, 4639, 4642,
+	4645, 4651, 4655, 4658, 4661, 4664, 4668, 4672, 4676, 4680, 4684, 4688,
+	4692, 4698, 4700, 4706, 4712, 4717, 4721, 4727, 4733, 4737, 4740, 4743,
+	4747, 4751, 4756, 4761, 4764, 4767, 4771, 4774, 4777, 4779, 4781, 4784,
+	4787, 4793, 4797, 4802, 4808, 4812, 4815, 4818, 4824, 4828, 4834, 4837,
+	4842, 4845, 4849, 4852, 4856, 4861, 4865, 4870, 4874, 4876, 4881, 4884,
+	4887, 4891, 4894, 4897, 4900, 4905, 4909, 4911, 4917, 4920, 4925, 4929,
+	4933, 4936, 4939, 4943, 4945, 4949, 4954, 4956, 4962, 4965, 4967, 4969,
+	4971, 4973, 4975, 4977, 4979, 4981, 4983, 4985, 4988, 4991, 4994, 4997,
+	5000, 5003, 5006, 5009, 5012, 5015, 5018, 5021, 5024, 5027, 5030, 5033,
+	5035, 5037, 5040, 5042, 5044, 5046, 5049, 5052, 5054, 5056, 5058, 5060,
+	5062, 5066, 5068, 5070, 5072, 5074, 5076, 5078, 5080, 5082, 5085, 5089,
+	5091, 5093, 5095, 5097, 5099, 5101, 5103, 5106, 5109, 5112, 5115, 5117,
+	5119, 5121, 5123, 5125, 5127, 5129, 5131, 5133, 5135, 5138, 5141, 5143,
+	5146, 5149, 5152, 5154, 5157, 5160, 5164, 5166, 5169, 5172, 5175, 5178,
+	5183, 5189, 5191, 5193, 5195, 5197, 5199, 5201, 5203, 5205, 5207, 5209,
+	5211, 5213, 5215, 5217, 5219, 5221, 5223, 5225, 5229, 5231, 5233, 5235,
+	5239, 5242, 5244, 5246, 5248, 5250, 5252, 5254, 5256, 5258, 5260, 5262,
+	5265, 5267, 5269, 5272, 5275, 5277, 5281, 5284, 5286, 5288, 5290, 5292,
+	5295, 5298, 5300, 5302, 5304, 5306, 5308, 5310, 5312, 5314, 5316, 5319,
+	5322, 5325, 5328, 5331, 5334, 5337, 5340, 5343, 5346, 5349, 5352, 5355,
+	5358, 5361, 5364, 5367, 5370, 5373, 5376, 5379, 5382, 1005, 1007, 5458,
+	3095, 3119, 3109, 5500, 371, 5423, 5501, 3660, 5502, 5503, 5997, 5999,
+	6001, 6003, 6006, 6009, 6009, 6011, 6013, 6015, 6017, 6019, 6025, 3121,
+	3124, 6026, 6027, 6028, 6029, 6030, 6031, 3082, 6098, 6100, 6100, 6101,
+	6101, 6101, 6101, 6102, 6102, 6102, 6102, 6103, 6103, 6103, 6103, 6104,
+	6104, 6104, 6104, 6105, 6105, 6105, 6105, 6106, 6106, 6106, 6106, 6107,
+	6107, 6107, 6107, 6108, 6108, 6108, 6108, 6109, 6109, 6109, 6109, 6110,
+	6110, 6110, 6110, 6111, 6111, 6111, 6111, 6112, 6112, 6112, 6112, 6113,
+	6113, 6114, 6114, 6115, 6115, 6116, 6116, 6117, 6117, 6118, 6118, 6119,
+	6119, 6119, 6119, 6120, 6120, 6120, 6120, 6121, 6121, 6121, 6121, 6122,
+	6122, 6122, 6122, 6123, 6123, 6124, 6124, 6124, 6124, 1257, 1257, 6125,
+	6125, 6125, 6125, 6126, 6126, 6126, 6126, 6127, 6127, 1261, 1261, 6128,
+	6128, 6128, 6128, 6129, 6129, 6130, 6130, 6131, 6131, 1253, 6132, 6132,
+	6133, 6133, 6134, 6134, 6135, 6135, 6135, 6135, 6136, 6136, 6137, 6137,
+	6140, 6140, 6143, 6143, 6146, 6146, 6149, 6149, 6152, 6152, 6155, 6155,
+	6155, 6158, 6158, 6158, 6161, 6161, 6161, 6161, 6162, 6165, 6168, 6158,
+	6171, 6174, 6176, 6178, 6180, 6182, 6184, 6186, 6188, 6190, 6192, 6194,
+	6196, 6198, 6200, 6202, 6204, 6206, 6208, 6210, 6212, 6214, 6216, 6218,
+	6220, 6222, 6224, 6226, 6228, 6230, 6232, 6234, 6236, 6238, 6240, 6242,
+	6244, 6246, 6248, 6250, 6252, 6254, 6256, 6258, 6260, 6262, 6264, 6266,
+	6268, 6270, 6272, 6274, 6276, 6278, 6280, 6282, 6284, 6286, 6288, 6290,
+	6292, 6294, 6296, 6298, 6300, 6302, 6304, 6306, 6308, 6310, 6312, 6314,
+	6316, 6318, 6320, 6322, 6324, 6326, 6328, 6330, 6332, 6334, 6336, 6338,
+	6340, 6342, 6344, 6346, 6348, 6350, 6352, 6355, 6358, 6361, 6364, 6367,
+	6370, 6373, 6168, 6376, 6158, 6171, 6379, 6381, 6180, 6383, 6182, 6184,
+	6385, 6387, 6192, 6389, 6194, 6196, 6391, 6393, 6200, 6395, 6202, 6204,
+	6262, 6264, 6270, 6272, 6274, 6282, 6284, 6286, 6288, 6296, 6298, 6300,
+	6397, 6308, 6399, 6401, 6320, 6403, 6322, 6324, 6350, 6405, 6407, 6340,
+	6409, 6342, 6344, 6162, 6165, 6411, 6168, 6414, 6174, 6176, 6178, 6180,
+	6417, 6186, 6188, 6190, 6192, 6419, 6200, 6206, 6208, 6210, 6212, 6214,
+	6218, 6220, 6222, 6224, 6226, 6228, 6421, 6230, 6232, 6234, 6236, 6238,
+	6240, 6244, 6246, 6248, 6250, 6252, 6254, 6256, 6258, 6260, 6266, 6268,
+	6276, 6278, 6280, 6282, 6284, 6290, 6292, 6294, 6296, 6423, 6302, 6304,
+	6306, 6308, 6314, 6316, 6318, 6320, 6425, 6326, 6328, 6427, 6334, 6336,
+	6338, 6340, 6429, 6168, 6414, 6180, 6417, 6192, 6419, 6200, 6431, 6226,
+	6433, 6435, 6437, 6282, 6284, 6296, 6320, 6425, 6340, 6429, 6439, 6442,
+	6445, 6448, 6450, 6452, 6454, 6456, 6458, 6460, 6462, 6464, 6466, 6468,
+	6470, 6472, 6474, 6476, 6478, 6480, 6482, 6484, 6486, 6488, 6490, 6492,
+	6435, 6494, 6496, 6498, 6500, 6448, 6450, 6452, 6454, 6456, 6458, 6460,
+	6462, 6464, 6466, 6468, 6470, 6472, 6474, 6476, 6478, 6480, 6482, 6484,
+	6486, 6488, 6490, 6492, 6435, 6494, 6496, 6498, 6500, 6488, 6490, 6492,
+	6435, 6433, 6437, 6242, 6220, 6222, 6224, 6488, 6490, 6492, 6242, 6244,
+	6502, 6502, 6504, 6507, 6507, 6510, 6513, 6516, 6519, 6522, 6525, 6525,
+	6528, 6531, 6534, 6537, 6540, 6543, 6543, 6546, 6549, 6549, 6552, 6552,
+	6555, 6558, 6558, 6561, 6564, 6564, 6567, 6567, 6570, 6573, 6573, 6576,
+	6576, 6579, 6582, 6585, 6588, 6588, 6591, 6594, 6597, 6600, 6603, 6603,
+	6606, 6609, 6612, 6615, 6618, 6621, 6621, 6624, 6624, 6627, 6627, 6630,
+	6633, 6636, 6639, 6642, 6645, 6648, 6651, 6654, 6657, 6660, 6663, 6666,
+	6666, 6669, 6672, 6675, 6678, 6678, 6681, 6684, 6687, 6690, 6693, 6696,
+	6699, 6702, 6705, 6708, 6711, 6714, 6717, 6720, 6723, 6726, 6729, 6732,
+	6735, 6738, 6741, 6744, 6606, 6612, 6747, 6750, 6753, 6756, 6759, 6762,
+	6759, 6753, 6765, 6768, 6771, 6774, 6777, 6762, 6585, 6555, 6780, 6783,
+	6786, 6789, 6792, 6796, 6800, 6804, 6808, 6812, 6816, 6820, 6823, 6841,
+	6849, 6853, 6854, 6855, 6856, 839, 6857, 6858, 6859, 6860, 3048, 3046,
+	6861, 6862, 6863, 6863, 3085, 3086, 6864, 6865, 6866, 6867, 6868, 6869,
+	6870, 6871, 3345, 3346, 6872, 6873, 6874, 6875, 6876, 6877, 3063, 3063,
+	3063, 3063, 6863, 6863, 6863, 6853, 6854, 3045, 839, 6856, 6858, 6857,
+	6861, 3085, 3086, 6864, 6865, 6866, 6867, 6878, 6879, 6880, 3082, 6881,
+	6882, 6883, 3084, 6884, 6885, 6886, 6887, 6888, 6890, 6892, 6894, 6896,
+	6898, 6900, 6902, 6904, 6906, 6908, 6910, 6912, 6914, 6916, 1239, 1239,
+	1241, 1241, 1243, 1243, 1245, 1245, 1247, 1247, 1247, 1247, 6917, 6917,
+	6918, 6918, 6918, 6918, 6919, 6919, 6920, 6920, 6920, 6920, 6921, 6921,
+	6921, 6921, 6922, 6922, 6922, 6922, 6923, 6923, 6923, 6923, 6924, 6924,
+	6924, 6924, 6925, 6925, 6926, 6926, 6927, 6927, 6928, 6928, 6929, 6929,
+	6929, 6929, 6930, 6930, 6930, 6930, 6931, 6931, 6931, 6931, 6932, 6932,
+	6932, 6932, 6933, 6933, 6933, 6933, 6934, 6934, 6934, 6934, 6935, 6935,
+	6935, 6935, 6936, 6936, 6936, 6936, 6937, 6937, 6937, 6937, 6938, 6938,
+	6938, 6938, 6939, 6939, 6939, 6939, 6940, 6940, 6940, 6940, 6941, 6941,
+	6941, 6941, 6942, 6942, 6942, 6942, 6943, 6943, 6943, 6943, 6944, 6944,
+	6136, 6136, 6945, 6945, 6945, 6945, 6946, 6946, 6949, 6949, 6952, 6952,
+	6955, 6955, 6857, 6957, 6878, 6885, 6886, 6879, 6958, 3085, 3086, 6880,
+	3082, 6853, 6881, 3045, 6959, 3075, 38, 31, 32, 3076, 3077, 3078,
+	3079, 3080, 3081, 6856, 839, 6882, 3084, 6883, 6858, 6887, 1519, 1521,
+	3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532,
+	1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595, 3117,
+	6876, 6884, 6877, 6986, 6863, 3004, 0, 1, 2, 3, 4, 5,
+	6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+	18, 19, 20, 21, 22, 23, 24, 25, 6864, 6987, 6865, 6988,
+	6989, 6990, 6855, 6872, 6873, 6854, 6991, 4614, 6992, 6993, 6994, 6995,
+	6996, 6997, 6998, 6999, 7000, 7001, 4568, 4569, 4570, 4571, 4572, 4573,
+	4574, 4575, 4576, 4577, 4578, 4579, 4580, 4581, 4582, 4583, 4584, 4585,
+	4586, 4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594, 4595, 4596, 4597,
+	4598, 4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609,
+	4610, 4611, 7002, 7003, 7004, 4118, 4067, 4068, 4069, 4070, 4071, 4072,
+	4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084,
+	4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096,
+	4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108,
+	4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 7005, 7006, 7007,
+	29, 7008, 7009, 7010, 7011, 7012, 7013, 7014, 7015, 7016, 7017, 7240,
+	7241, 66, 7242, 476, 7243, 7244, 7245, 7246, 481, 482, 7247, 7248,
+	7249, 7250, 7251, 7252, 488, 7253, 277, 7254, 7255, 7256, 7257, 7258,
+	5480, 7259, 7261, 7262, 7263, 7265, 7266, 113, 7268, 7269, 16, 7270,
+	7271, 3662, 7273, 503, 7274, 7275, 7276, 7277, 507, 7278, 7279, 7280,
+	7281, 7282, 7283, 7284, 7285, 7286, 7288, 1519, 1521, 3095, 1522, 1523,
+	3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1535, 3109,
+	1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595, 3117, 0, 1, 2,
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 1519,
+	1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
+	1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595,
+	3117, 0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11,
+	12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 1519, 1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528,
+	1529, 1530, 1531, 1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191,
+	1539, 3208, 3595, 3117, 0, 1, 2, 3, 4, 5, 6, 7,
+	8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+	20, 21, 22, 23, 24, 25, 1519, 3095, 1522, 1525, 1528, 1529,
+	1532, 1533, 1535, 3109, 3588, 1537, 1538, 3191, 1539, 3208, 3595, 3117,
+	0, 1, 2, 3, 5, 7, 8, 9, 10, 11, 12, 13,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 1519,
+	1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
+	1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595,
+	3117, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+	11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+	23, 24, 25, 1519, 1521, 1522, 1523, 3119, 1525, 1528, 1529, 1530,
+	1531, 1532, 1533, 1535, 3109, 3588, 1537, 1538, 3191, 1539, 3208, 3595,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 1519, 1521, 1522, 1523, 3119, 1525, 1527, 1528, 1529, 1530,
+	1531, 1533, 3588, 1537, 1538, 3191, 1539, 3208, 3595, 0, 1, 2,
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 1519,
+	1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
+	1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595,
+	3117, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+	11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+	23, 24, 25, 1519, 1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527,
+	1528, 1529, 1530, 1531, 1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538,
+	3191, 1539, 3208, 3595, 3117, 0, 1, 2, 3, 4, 5, 6,
+	7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+	19, 20, 21, 22, 23, 24, 25, 1519, 1521, 3095, 1522, 1523,
+	3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1535, 3109,
+	1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595, 3117, 0, 1, 2,
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 1519,
+	1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
+	1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595,
+	3117, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+	11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+	23, 24, 25, 1519, 1521, 3095, 1522, 1523, 3119, 1525, 1526, 1527,
+	1528, 1529, 1530, 1531, 1532, 1533, 1535, 3109, 1536, 3588, 1537, 1538,
+	3191, 1539, 3208, 3595, 3117, 0, 1, 2, 3, 4, 5, 6,
+	7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+	19, 20, 21, 22, 23, 24, 25, 1519, 1521, 3095, 1522, 1523,
+	3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1535, 3109,
+	1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595, 3117, 0, 1, 2,
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 7642,
+	7643, 7644, 7645, 3128, 7646, 7647, 7648, 7649, 939, 7650, 7651, 7652,
+	7653, 7654, 7655, 7656, 3129, 7657, 939, 942, 7658, 921, 7659, 7660,
+	7661, 3118, 7662, 871, 872, 873, 874, 875, 876, 877, 878, 832,
+	879, 880, 35, 881, 882, 883, 884, 885, 938, 886, 887, 888,
+	889, 890, 891, 892, 7663, 875, 878, 879, 889, 885, 884, 7644,
+	7645, 3128, 7646, 7647, 7648, 7649, 939, 7650, 7651, 7652, 7653, 7654,
+	7655, 7656, 3129, 7657, 939, 942, 7658, 921, 7659, 7660, 7661, 3118,
+	7662, 871, 872, 873, 874, 875, 876, 877, 878, 832, 879, 880,
+	35, 881, 882, 883, 884, 885, 938, 886, 887, 888, 889, 890,
+	891, 892, 7663, 875, 878, 879, 889, 885, 884, 7644, 7645, 3128,
+	7646, 7647, 7648, 7649, 939, 7650, 7651, 7652, 7653, 7654, 7655, 7656,
+	3129, 7657, 939, 942, 7658, 921, 7659, 7660, 7661, 3118, 7662, 871,
+	872, 873, 874, 875, 876, 877, 878, 832, 879, 880, 35, 881,
+	882, 883, 884, 885, 938, 886, 887, 888, 889, 890, 891, 892,
+	7663, 875, 878, 879, 889, 885, 884, 7644, 7645, 3128, 7646, 7647,
+	7648, 7649, 939, 7650, 7651, 7652, 7653, 7654, 7655, 7656, 3129, 7657,
+	939, 942, 7658, 921, 7659, 7660, 7661, 3118, 7662, 871, 872, 873,
+	874, 875, 876, 877, 878, 832, 879, 880, 35, 881, 882, 883,
+	884, 885, 938, 886, 887, 888, 889, 890, 891, 892, 7663, 875,
+	878, 879, 889, 885, 884, 7644, 7645, 3128, 7646, 7647, 7648, 7649,
+	939, 7650, 7651, 7652, 7653, 7654, 7655, 7656, 3129, 7657, 939, 942,
+	7658, 921, 7659, 7660, 7661, 3118, 7662, 871, 872, 873, 874, 875,
+	876, 877, 878, 832, 879, 880, 35, 881, 882, 883, 884, 885,
+	938, 886, 887, 888, 889, 890, 891, 892, 7663, 875, 878, 879,
+	889, 885, 884, 7664, 928, 3075, 38, 31, 32, 3076, 3077, 3078,
+	3079, 3080, 3081, 3075, 38, 31, 32, 3076, 3077, 3078, 3079, 3080,
+	3081, 3075, 38, 31, 32, 3076, 3077, 3078, 3079, 3080, 3081, 3075,
+	38, 31, 32, 3076, 3077, 3078, 3079, 3080, 3081, 3075, 38, 31,
+	32, 3076, 3077, 3078, 3079, 3080, 3081, 6917, 6918, 6922, 6925, 6944,
+	6928, 6923, 6933, 6945, 6939, 6940, 6941, 6942, 6929, 6935, 6937, 6931,
+	6938, 6927, 6930, 6920, 6921, 6924, 6926, 6932, 6934, 6936, 7733, 6123,
+	7734, 7735, 6918, 6922, 6943, 6923, 6945, 6939, 6940, 6941, 6942, 6929,
+	6935, 6937, 6931, 6938, 6930, 6920, 6921, 6924, 6932, 6936, 6922, 6923,
+	6945, 6940, 6942, 6929, 6935, 6931, 6938, 6930, 6924, 6932, 6936, 6123,
+	7735, 6918, 6922, 6943, 6923, 6933, 6945, 6939, 6941, 6942, 6929, 6935,
+	6937, 6931, 6938, 6930, 6920, 6921, 6924, 6932, 6934, 6936, 7733, 7734,
+	6917, 6918, 6922, 6925, 6943, 6944, 6928, 6923, 6933, 6945, 6940, 6941,
+	6942, 6929, 6935, 6937, 6931, 6938, 6927, 6930, 6920, 6921, 6924, 6926,
+	6932, 6934, 6936, 6918, 6922, 6925, 6944, 6928, 6923, 6933, 6945, 6940,
+	6941, 6942, 6929, 6935, 6937, 6931, 6938, 6927, 6930, 6920, 6921, 6924,
+	6926, 6932, 6934, 6936, 7736, 7738, 7740, 7742, 7744, 7746, 7748, 7750,
+	7752, 7754, 7756, 7758, 7761, 7764, 7767, 7770, 7773, 7776, 7779, 7782,
+	7785, 7788, 7791, 7794, 7797, 7800, 7803, 7806, 7809, 7812, 7815, 7818,
+	7821, 7824, 7827, 7830, 7833, 7836, 3095, 1536, 7839, 7841, 1519, 1521,
+	3095, 1522, 1523, 3119, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532,
+	1533, 1535, 3109, 1536, 3588, 1537, 1538, 3191, 1539, 3208, 3595, 3117,
+	7843, 5207, 7845, 7847, 7849, 7852, 7854, 7856, 7858, 7860, 7862, 7864,
+	4578, 3789, 7866, 7867, 4029, 3732, 7868, 7869, 4169, 7870, 7871, 7872,
+	5762, 7873, 7874, 7875, 7876, 7877, 7878, 3825, 7879, 7880, 7881, 7882,
+	7883, 7884, 3726, 4161, 7885, 4491, 4164, 4492, 7886, 3881, 7887, 7888,
+	7889, 7890, 7891, 4474, 3799, 7892, 7893, 7894, 7895, 7896, 7899, 7902,
+	7905, 7908, 7911, 7914, 7917, 7920, 7923, 7924, 3075, 38, 31, 32,
+	3076, 3077, 3078, 3079, 3080, 3081,
+};
+
+static const uint32_t sn_fold_k[1530] = {
+	0x01000041, 0x01000042, 0x01000043, 0x01000044, 0x01000045, 0x01000046,
+	0x01000047, 0x01000048, 0x01000049, 0x0100004a, 0x0100004b, 0x0100004c,
+	0x0100004d, 0x0100004e, 0x0100004f, 0x01000050, 0x01000051, 0x01000052,
+	0x01000053, 0x01000054, 0x01000055, 0x01000056, 0x01000057, 0x01000058,
+	0x01000059, 0x0100005a, 0x010000b5, 0x010000c0, 0x010000c1, 0x010000c2,
+	0x010000c3, 0x010000c4, 0x010000c5, 0x010000c6, 0x010000c7, 0x010000c8,
+	0x010000c9, 0x010000ca, 0x010000cb, 0x010000cc, 0x010000cd, 0x010000ce,
+	0x010000cf, 0x010000d0, 0x010000d1, 0x010000d2, 0x010000d3, 0x010000d4,
+	0x010000d5, 0x010000d6, 0x010000d8, 0x010000d9, 0x010000da, 0x010000db,
+	0x010000dc, 0x010000dd, 0x010000de, 0x020000df, 0x01000100, 0x01000102,
+	0x01000104, 0x01000106, 0x01000108, 0x0100010a, 0x0100010c, 0x0100010e,
+	0x01000110, 0x01000112, 0x01000114, 0x01000116, 0x01000118, 0x0100011a,
+	0x0100011c, 0x0100011e, 0x01000120, 0x01000122, 0x01000124, 0x01000126,
+	0x01000128, 0x0100012a, 0x0100012c, 0x0100012e, 0x02000130, 0x01000132,
+	0x01000134, 0x01000136, 0x01000139, 0x0100013b, 0x0100013d, 0x0100013f,
+	0x01000141, 0x01000143, 0x01000145, 0x01000147, 0x02000149, 0x0100014a,
+	0x0100014c, 0x0100014e, 0x01000150, 0x01000152, 0x01000154, 0x01000156,
+	0x01000158, 0x0100015a, 0x0100015c, 0x0100015e, 0x01000160, 0x01000162,
+	0x01000164, 0x01000166, 0x01000168, 0x0100016a, 0x0100016c, 0x0100016e,
+	0x01000170, 0x01000172, 0x01000174, 0x01000176, 0x01000178, 0x01000179,
+	0x0100017b, 0x0100017d, 0x0100017f, 0x01000181, 0x01000182, 0x01000184,
+	0x01000186, 0x01000187, 0x01000189, 0x0100018a, 0x0100018b, 0x0100018e,
+	0x0100018f, 0x01000190, 0x01000191, 0x01000193, 0x01000194, 0x01000196,
+	0x01000197, 0x01000198, 0x0100019c, 0x0100019d, 0x0100019f, 0x010001a0,
+	0x010001a2, 0x010001a4, 0x010001a6, 0x010001a7, 0x010001a9, 0x010001ac,
+	0x010001ae, 0x010001af, 0x010001b1, 0x010001b2, 0x010001b3, 0x010001b5,
+	0x010001b7, 0x010001b8, 0x010001bc, 0x010001c4, 0x010001c5, 0x010001c7,
+	0x010001c8, 0x010001ca, 0x010001cb, 0x010001cd, 0x010001cf, 0x010001d1,
+	0x010001d3, 0x010001d5, 0x010001d7, 0x010001d9, 0x010001db, 0x010001de,
+	0x010001e0, 0x010001e2, 0x010001e4, 0x010001e6, 0x010001e8, 0x010001ea,
+	0x010001ec, 0x010001ee, 0x020001f0, 0x010001f1, 0x010001f2, 0x010001f4,
+	0x010001f6, 0x010001f7, 0x010001f8, 0x010001fa, 0x010001fc, 0x010001fe,
+	0x01000200, 0x01000202, 0x01000204, 0x01000206, 0x01000208, 0x0100020a,
+	0x0100020c, 0x0100020e, 0x01000210, 0x01000212, 0x01000214, 0x01000216,
+	0x01000218, 0x0100021a, 0x0100021c, 0x0100021e, 0x01000220, 0x01000222,
+	0x01000224, 0x01000226, 0x01000228, 0x0100022a, 0x0100022c, 0x0100022e,
+	0x01000230, 0x01000232, 0x0100023a, 0x0100023b, 0x0100023d, 0x0100023e,
+	0x01000241, 0x01000243, 0x01000244, 0x01000245, 0x01000246, 0x01000248,
+	0x0100024a, 0x0100024c, 0x0100024e, 0x01000345, 0x01000370, 0x01000372,
+	0x01000376, 0x0100037f, 0x01000386, 0x01000388, 0x01000389, 0x0100038a,
+	0x0100038c, 0x0100038e, 0x0100038f, 0x03000390, 0x01000391, 0x01000392,
+	0x01000393, 0x01000394, 0x01000395, 0x01000396, 0x01000397, 0x01000398,
+	0x01000399, 0x0100039a, 0x0100039b, 0x0100039c, 0x0100039d, 0x0100039e,
+	0x0100039f, 0x010003a0, 0x010003a1, 0x010003a3, 0x010003a4, 0x010003a5,
+	0x010003a6, 0x010003a7, 0x010003a8, 0x010003a9, 0x010003aa, 0x010003ab,
+	0x030003b0, 0x010003c2, 0x010003cf, 0x010003d0, 0x010003d1, 0x010003d5,
+	0x010003d6, 0x010003d8, 0x010003da, 0x010003dc, 0x010003de, 0x010003e0,
+	0x010003e2, 0x010003e4, 0x010003e6, 0x010003e8, 0x010003ea, 0x010003ec,
+	0x010003ee, 0x010003f0, 0x010003f1, 0x010003f4, 0x010003f5, 0x010003f7,
+	0x010003f9, 0x010003fa, 0x010003fd, 0x010003fe, 0x010003ff, 0x01000400,
+	0x01000401, 0x01000402, 0x01000403, 0x01000404, 0x01000405, 0x01000406,
+	0x01000407, 0x01000408, 0x01000409, 0x0100040a, 0x0100040b, 0x0100040c,
+	0x0100040d, 0x0100040e, 0x0100040f, 0x01000410, 0x01000411, 0x01000412,
+	0x01000413, 0x01000414, 0x01000415, 0x01000416, 0x01000417, 0x01000418,
+	0x01000419, 0x0100041a, 0x0100041b, 0x0100041c, 0x0100041d, 0x0100041e,
+	0x0100041f, 0x01000420, 0x01000421, 0x01000422, 0x01000423, 0x01000424,
+	0x01000425, 0x01000426, 0x01000427, 0x01000428, 0x01000429, 0x0100042a,
+	0x0100042b, 0x0100042c, 0x0100042d, 0x0100042e, 0x0100042f, 0x01000460,
+	0x01000462, 0x01000464, 0x01000466, 0x01000468, 0x0100046a, 0x0100046c,
+	0x0100046e, 0x01000470, 0x01000472, 0x01000474, 0x01000476, 0x01000478,
+	0x0100047a, 0x0100047c, 0x0100047e, 0x01000480, 0x0100048a, 0x0100048c,
+	0x0100048e, 0x01000490, 0x01000492, 0x01000494, 0x01000496, 0x01000498,
+	0x0100049a, 0x0100049c, 0x0100049e, 0x010004a0, 0x010004a2, 0x010004a4,
+	0x010004a6, 0x010004a8, 0x010004aa, 0x010004ac, 0x010004ae, 0x010004b0,
+	0x010004b2, 0x010004b4, 0x010004b6, 0x010004b8, 0x010004ba, 0x010004bc,
+	0x010004be, 0x010004c0, 0x010004c1, 0x010004c3, 0x010004c5, 0x010004c7,
+	0x010004c9, 0x010004cb, 0x010004cd, 0x010004d0, 0x010004d2, 0x010004d4,
+	0x010004d6, 0x010004d8, 0x010004da, 0x010004dc, 0x010004de, 0x010004e0,
+	0x010004e2, 0x010004e4, 0x010004e6, 0x010004e8, 0x010004ea, 0x010004ec,
+	0x010004ee, 0x010004f0, 0x010004f2, 0x010004f4, 0x010004f6, 0x010004f8,
+	0x010004fa, 0x010004fc, 0x010004fe, 0x01000500, 0x01000502, 0x01000504,
+	0x01000506, 0x01000508, 0x0100050a, 0x0100050c, 0x0100050e, 0x01000510,
+	0x01000512, 0x01000514, 0x01000516, 0x01000518, 0x0100051a, 0x0100051c,
+	0x0100051e, 0x01000520, 0x01000522, 0x01000524, 0x01000526, 0x01000528,
+	0x0100052a, 0x0100052c, 0x0100052e, 0x01000531, 0x01000532, 0x01000533,
+	0x01000534, 0x01000535, 0x01000536, 0x01000537, 0x01000538, 0x01000539,
+	0x0100053a, 0x0100053b, 0x0100053c, 0x0100053d, 0x0100053e, 0x0100053f,
+	0x01000540, 0x01000541, 0x01000542, 0x01000543, 0x01000544, 0x01000545,
+	0x01000546, 0x01000547, 0x01000548, 0x01000549, 0x0100054a, 0x0100054b,
+	0x0100054c, 0x0100054d, 0x0100054e, 0x0100054f, 0x01000550, 0x01000551,
+	0x01000552, 0x01000553, 0x01000554, 0x01000555, 0x01000556, 0x02000587,
+	0x010010a0, 0x010010a1, 0x010010a2, 0x010010a3, 0x010010a4, 0x010010a5,
+	0x010010a6, 0x010010a7, 0x010010a8, 0x010010a9, 0x010010aa, 0x010010ab,
+	0x010010ac, 0x010010ad, 0x010010ae, 0x010010af, 0x010010b0, 0x010010b1,
+	0x010010b2, 0x010010b3, 0x010010b4, 0x010010b5, 0x010010b6, 0x010010b7,
+	0x010010b8, 0x010010b9, 0x010010ba, 0x010010bb, 0x010010bc, 0x010010bd,
+	0x010010be, 0x010010bf, 0x010010c0, 0x010010c1, 0x010010c2, 0x010010c3,
+	0x010010c4, 0x010010c5, 0x010010c7, 0x010010cd, 0x010013f8, 0x010013f9,
+	0x010013fa, 0x010013fb, 0x010013fc, 0x010013fd, 0x01001c80, 0x01001c81,
+	0x01001c82, 0x01001c83, 0x01001c84, 0x01001c85, 0x01001c86, 0x01001c87,
+	0x01001c88, 0x01001c90, 0x01001c91, 0x01001c92, 0x01001c93, 0x01001c94,
+	0x01001c95, 0x01001c96, 0x01001c97, 0x01001c98, 0x01001c99, 0x01001c9a,
+	0x01001c9b, 0x01001c9c, 0x01001c9d, 0x01001c9e, 0x01001c9f, 0x01001ca0,
+	0x01001ca1, 0x01001ca2, 0x01001ca3, 0x01001ca4, 0x01001ca5, 0x01001ca6,
+	0x01001ca7, 0x01001ca8, 0x01001ca9, 0x01001caa, 0x01001cab, 0x01001cac,
+	0x01001cad, 0x01001cae, 0x01001caf, 0x01001cb0, 0x01001cb1, 0x01001cb2,
+	0x01001cb3, 0x01001cb4, 0x01001cb5, 0x01001cb6, 0x01001cb7, 0x01001cb8,
+	0x01001cb9, 0x01001cba, 0x01001cbd, 0x01001cbe, 0x01001cbf, 0x01001e00,
+	0x01001e02, 0x01001e04, 0x01001e06, 0x01001e08, 0x01001e0a, 0x01001e0c,
+	0x01001e0e, 0x01001e10, 0x01001e12, 0x01001e14, 0x01001e16, 0x01001e18,
+	0x01001e1a, 0x01001e1c, 0x01001e1e, 0x01001e20, 0x01001e22, 0x01001e24,
+	0x01001e26, 0x01001e28, 0x01001e2a, 0x01001e2c, 0x01001e2e, 0x01001e30,
+	0x01001e32, 0x01001e34, 0x01001e36, 0x01001e38, 0x01001e3a, 0x01001e3c,
+	0x01001e3e, 0x01001e40, 0x01001e42, 0x01001e44, 0x01001e46, 0x01001e48,
+	0x01001e4a, 0x01001e4c, 0x01001e4e, 0x01001e50, 0x01001e52, 0x01001e54,
+	0x01001e56, 0x01001e58, 0x01001e5a, 0x01001e5c, 0x01001e5e, 0x01001e60,
+	0x01001e62, 0x01001e64, 0x01001e66, 0x01001e68, 0x01001e6a, 0x01001e6c,
+	0x01001e6e, 0x01001e70, 0x01001e72, 0x01001e74, 0x01001e76, 0x01001e78,
+	0x01001e7a, 0x01001e7c, 0x01001e7e, 0x01001e80, 0x01001e82, 0x01001e84,
+	0x01001e86, 0x01001e88, 0x01001e8a, 0x01001e8c, 0x01001e8e, 0x01001e90,
+	0x01001e92, 0x01001e94, 0x02001e96, 0x02001e97, 0x02001e98, 0x02001e99,
+	0x02001e9a, 0x01001e9b, 0x02001e9e, 0x01001ea0, 0x01001ea2, 0x01001ea4,
+	0x01001ea6, 0x01001ea8, 0x01001eaa, 0x01001eac, 0x01001eae, 0x01001eb0,
+	0x01001eb2, 0x01001eb4, 0x01001eb6, 0x01001eb8, 0x01001eba, 0x01001ebc,
+	0x01001ebe, 0x01001ec0, 0x01001ec2, 0x01001ec4, 0x01001ec6, 0x01001ec8,
+	0x01001eca, 0x01001ecc, 0x01001ece, 0x01001ed0, 0x01001ed2, 0x01001ed4,
+	0x01001ed6, 0x01001ed8, 0x01001eda, 0x01001edc, 0x01001ede, 0x01001ee0,
+	0x01001ee2, 0x01001ee4, 0x01001ee6, 0x01001ee8, 0x01001eea, 0x01001eec,
+	0x01001eee, 0x01001ef0, 0x01001ef2, 0x01001ef4, 0x01001ef6, 0x01001ef8,
+	0x01001efa, 0x01001efc, 0x01001efe, 0x01001f08, 0x01001f09, 0x01001f0a,
+	0x01001f0b, 0x01001f0c, 0x01001f0d, 0x01001f0e, 0x01001f0f, 0x01001f18,
+	0x01001f19, 0x01001f1a, 0x01001f1b, 0x01001f1c, 0x01001f1d, 0x01001f28,
+	0x01001f29, 0x01001f2a, 0x01001f2b, 0x01001f2c, 0x01001f2d, 0x01001f2e,
+	0x01001f2f, 0x01001f38, 0x01001f39, 0x01001f3a, 0x01001f3b, 0x01001f3c,
+	0x01001f3d, 0x01001f3e, 0x01001f3f, 0x01001f48, 0x01001f49, 0x01001f4a,
+	0x01001f4b, 0x01001f4c, 0x01001f4d, 0x02001f50, 0x03001f52, 0x03001f54,
+	0x03001f56, 0x01001f59, 0x01001f5b, 0x01001f5d, 0x01001f5f, 0x01001f68,
+	0x01001f69, 0x01001f6a, 0x01001f6b, 0x01001f6c, 0x01001f6d, 0x01001f6e,
+	0x01001f6f, 0x02001f80, 0x02001f81, 0x02001f82, 0x02001f83, 0x02001f84,
+	0x02001f85, 0x02001f86, 0x02001f87, 0x02001f88, 0x02001f89, 0x02001f8a,
+	0x02001f8b, 0x02001f8c, 0x02001f8d, 0x02001f8e, 0x02001f8f, 0x02001f90,
+	0x02001f91, 0x02001f92, 0x02001f93, 0x02001f94, 0x02001f95, 0x02001f96,
+	0x02001f97, 0x02001f98, 0x02001f99, 0x02001f9a, 0x02001f9b, 0x02001f9c,
+	0x02001f9d, 0x02001f9e, 0x02001f9f, 0x02001fa0, 0x02001fa1, 0x02001fa2,
+	0x02001fa3, 0x02001fa4, 0x02001fa5, 0x02001fa6, 0x02001fa7, 0x02001fa8,
+	0x02001fa9, 0x02001faa, 0x02001fab, 0x02001fac, 0x02001fad, 0x02001fae,
+	0x02001faf, 0x02001fb2, 0x02001fb3, 0x02001fb4, 0x02001fb6, 0x03001fb7,
+	0x01001fb8, 0x01001fb9, 0x01001fba, 0x01001fbb, 0x02001fbc, 0x01001fbe,
+	0x02001fc2, 0x02001fc3, 0x02001fc4, 0x02001fc6, 0x03001fc7, 0x01001fc8,
+	0x01001fc9, 0x01001fca, 0x01001fcb, 0x02001fcc, 0x03001fd2, 0x03001fd3,
+	0x02001fd6, 0x03001fd7, 0x01001fd8, 0x01001fd9, 0x01001fda, 0x01001fdb,
+	0x03001fe2, 0x03001fe3, 0x02001fe4, 0x02001fe6, 0x03001fe7, 0x01001fe8,
+	0x01001fe9, 0x01001fea, 0x01001feb, 0x01001fec, 0x02001ff2, 0x02001ff3,
+	0x02001ff4, 0x02001ff6, 0x03001ff7, 0x01001ff8, 0x01001ff9, 0x01001ffa,
+	0x01001ffb, 0x02001ffc, 0x01002126, 0x0100212a, 0x0100212b, 0x01002132,
+	0x01002160, 0x01002161, 0x01002162, 0x01002163, 0x01002164, 0x01002165,
+	0x01002166, 0x01002167, 0x01002168, 0x01002169, 0x0100216a, 0x0100216b,
+	0x0100216c, 0x0100216d, 0x0100216e, 0x0100216f, 0x01002183, 0x010024b6,
+	0x010024b7, 0x010024b8, 0x010024b9, 0x010024ba, 0x010024bb, 0x010024bc,
+	0x010024bd, 0x010024be, 0x010024bf, 0x010024c0, 0x010024c1, 0x010024c2,
+	0x010024c3, 0x010024c4, 0x010024c5, 0x010024c6, 0x010024c7, 0x010024c8,
+	0x010024c9, 0x010024ca, 0x010024cb, 0x010024cc, 0x010024cd, 0x010024ce,
+	0x010024cf, 0x01002c00, 0x01002c01, 0x01002c02, 0x01002c03, 0x01002c04,
+	0x01002c05, 0x01002c06, 0x01002c07, 0x01002c08, 0x01002c09, 0x01002c0a,
+	0x01002c0b, 0x01002c0c, 0x01002c0d, 0x01002c0e, 0x01002c0f, 0x01002c10,
+	0x01002c11, 0x01002c12, 0x01002c13, 0x01002c14, 0x01002c15, 0x01002c16,
+	0x01002c17, 0x01002c18, 0x01002c19, 0x01002c1a, 0x01002c1b, 0x01002c1c,
+	0x01002c1d, 0x01002c1e, 0x01002c1f, 0x01002c20, 0x01002c21, 0x01002c22,
+	0x01002c23, 0x01002c24, 0x01002c25, 0x01002c26, 0x01002c27, 0x01002c28,
+	0x01002c29, 0x01002c2a, 0x01002c2b, 0x01002c2c, 0x01002c2d, 0x01002c2e,
+	0x01002c2f, 0x01002c60, 0x01002c62, 0x01002c63, 0x01002c64, 0x01002c67,
+	0x01002c69, 0x01002c6b, 0x01002c6d, 0x01002c6e, 0x01002c6f, 0x01002c70,
+	0x01002c72, 0x01002c75, 0x01002c7e, 0x01002c7f, 0x01002c80, 0x01002c82,
+	0x01002c84, 0x01002c86, 0x01002c88, 0x01002c8a, 0x01002c8c, 0x01002c8e,
+	0x01002c90, 0x01002c92, 0x01002c94, 0x01002c96, 0x01002c98, 0x01002c9a,
+	0x01002c9c, 0x01002c9e, 0x01002ca0, 0x01002ca2, 0x01002ca4, 0x01002ca6,
+	0x01002ca8, 0x01002caa, 0x01002cac, 0x01002cae, 0x01002cb0, 0x01002cb2,
+	0x01002cb4, 0x01002cb6, 0x01002cb8, 0x01002cba, 0x01002cbc, 0x01002cbe,
+	0x01002cc0, 0x01002cc2, 0x01002cc4, 0x01002cc6, 0x01002cc8, 0x01002cca,
+	0x01002ccc, 0x01002cce, 0x01002cd0, 0x01002cd2, 0x01002cd4, 0x01002cd6,
+	0x01002cd8, 0x01002cda, 0x01002cdc, 0x01002cde, 0x01002ce0, 0x01002ce2,
+	0x01002ceb, 0x01002ced, 0x01002cf2, 0x0100a640, 0x0100a642, 0x0100a644,
+	0x0100a646, 0x0100a648, 0x0100a64a, 0x0100a64c, 0x0100a64e, 0x0100a650,
+	0x0100a652, 0x0100a654, 0x0100a656, 0x0100a658, 0x0100a65a, 0x0100a65c,
+	0x0100a65e, 0x0100a660, 0x0100a662, 0x0100a664, 0x0100a666, 0x0100a668,
+	0x0100a66a, 0x0100a66c, 0x0100a680, 0x0100a682, 0x0100a684, 0x0100a686,
+	0x0100a688, 0x0100a68a, 0x0100a68c, 0x0100a68e, 0x0100a690, 0x0100a692,
+	0x0100a694, 0x0100a696, 0x0100a698, 0x0100a69a, 0x0100a722, 0x0100a724,
+	0x0100a726, 0x0100a728, 0x0100a72a, 0x0100a72c, 0x0100a72e, 0x0100a732,
+	0x0100a734, 0x0100a736, 0x0100a738, 0x0100a73a, 0x0100a73c, 0x0100a73e,
+	0x0100a740, 0x0100a742, 0x0100a744, 0x0100a746, 0x0100a748, 0x0100a74a,
+	0x0100a74c, 0x0100a74e, 0x0100a750, 0x0100a752, 0x0100a754, 0x0100a756,
+	0x0100a758, 0x0100a75a, 0x0100a75c, 0x0100a75e, 0x0100a760, 0x0100a762,
+	0x0100a764, 0x0100a766, 0x0100a768, 0x0100a76a, 0x0100a76c, 0x0100a76e,
+	0x0100a779, 0x0100a77b, 0x0100a77d, 0x0100a77e, 0x0100a780, 0x0100a782,
+	0x0100a784, 0x0100a786, 0x0100a78b, 0x0100a78d, 0x0100a790, 0x0100a792,
+	0x0100a796, 0x0100a798, 0x0100a79a, 0x0100a79c, 0x0100a79e, 0x0100a7a0,
+	0x0100a7a2, 0x0100a7a4, 0x0100a7a6, 0x0100a7a8, 0x0100a7aa, 0x0100a7ab,
+	0x0100a7ac, 0x0100a7ad, 0x0100a7ae, 0x0100a7b0, 0x0100a7b1, 0x0100a7b2,
+	0x0100a7b3, 0x0100a7b4, 0x0100a7b6, 0x0100a7b8, 0x0100a7ba, 0x0100a7bc,
+	0x0100a7be, 0x0100a7c0, 0x0100a7c2, 0x0100a7c4, 0x0100a7c5, 0x0100a7c6,
+	0x0100a7c7, 0x0100a7c9, 0x0100a7d0, 0x0100a7d6, 0x0100a7d8, 0x0100a7f5,
+	0x0100ab70, 0x0100ab71, 0x0100ab72, 0x0100ab73, 0x0100ab74, 0x0100ab75,
+	0x0100ab76, 0x0100ab77, 0x0100ab78, 0x0100ab79, 0x0100ab7a, 0x0100ab7b,
+	0x0100ab7c, 0x0100ab7d, 0x0100ab7e, 0x0100ab7f, 0x0100ab80, 0x0100ab81,
+	0x0100ab82, 0x0100ab83, 0x0100ab84, 0x0100ab85, 0x0100ab86, 0x0100ab87,
+	0x0100ab88, 0x0100ab89, 0x0100ab8a, 0x0100ab8b, 0x0100ab8c, 0x0100ab8d,
+	0x0100ab8e, 0x0100ab8f, 0x0100ab90, 0x0100ab91, 0x0100ab92, 0x0100ab93,
+	0x0100ab94, 0x0100ab95, 0x0100ab96, 0x0100ab97, 0x0100ab98, 0x0100ab99,
+	0x0100ab9a, 0x0100ab9b, 0x0100ab9c, 0x0100ab9d, 0x0100ab9e, 0x0100ab9f,
+	0x0100aba0, 0x0100aba1, 0x0100aba2, 0x0100aba3, 0x0100aba4, 0x0100aba5,
+	0x0100aba6, 0x0100aba7, 0x0100aba8, 0x0100aba9, 0x0100abaa, 0x0100abab,
+	0x0100abac, 0x0100abad, 0x0100abae, 0x0100abaf, 0x0100abb0, 0x0100abb1,
+	0x0100abb2, 0x0100abb3, 0x0100abb4, 0x0100abb5, 0x0100abb6, 0x0100abb7,
+	0x0100abb8, 0x0100abb9, 0x0100abba, 0x0100abbb, 0x0100abbc, 0x0100abbd,
+	0x0100abbe, 0x0100abbf, 0x0200fb00, 0x0200fb01, 0x0200fb02, 0x0300fb03,
+	0x0300fb04, 0x0200fb05, 0x0200fb06, 0x0200fb13, 0x0200fb14, 0x0200fb15,
+	0x0200fb16, 0x0200fb17, 0x0100ff21, 0x0100ff22, 0x0100ff23, 0x0100ff24,
+	0x0100ff25, 0x0100ff26, 0x0100ff27, 0x0100ff28, 0x0100ff29, 0x0100ff2a,
+	0x0100ff2b, 0x0100ff2c, 0x0100ff2d, 0x0100ff2e, 0x0100ff2f, 0x0100ff30,
+	0x0100ff31, 0x0100ff32, 0x0100ff33, 0x0100ff34, 0x0100ff35, 0x0100ff36,
+	0x0100ff37, 0x0100ff38, 0x0100ff39, 0x0100ff3a, 0x02010400, 0x02010401,
+	0x02010402, 0x02010403, 0x02010404, 0x02010405, 0x02010406, 0x02010407,
+	0x02010408, 0x02010409, 0x0201040a, 0x0201040b, 0x0201040c, 0x0201040d,
+	0x0201040e, 0x0201040f, 0x02010410, 0x02010411, 0x02010412, 0x02010413,
+	0x02010414, 0x02010415, 0x02010416, 0x02010417, 0x02010418, 0x02010419,
+	0x0201041a, 0x0201041b, 0x0201041c, 0x0201041d, 0x0201041e, 0x0201041f,
+	0x02010420, 0x02010421, 0x02010422, 0x02010423, 0x02010424, 0x02010425,
+	0x02010426, 0x02010427, 0x020104b0, 0x020104b1, 0x020104b2, 0x020104b3,
+	0x020104b4, 0x020104b5, 0x020104b6, 0x020104b7, 0x020104b8, 0x020104b9,
+	0x020104ba, 0x020104bb, 0x020104bc, 0x020104bd, 0x020104be, 0x020104bf,
+	0x020104c0, 0x020104c1, 0x020104c2, 0x020104c3, 0x020104c4, 0x020104c5,
+	0x020104c6, 0x020104c7, 0x020104c8, 0x020104c9, 0x020104ca, 0x020104cb,
+	0x020104cc, 0x020104cd, 0x020104ce, 0x020104cf, 0x020104d0, 0x020104d1,
+	0x020104d2, 0x020104d3, 0x02010570, 0x02010571, 0x02010572, 0x02010573,
+	0x02010574, 0x02010575, 0x02010576, 0x02010577, 0x02010578, 0x02010579,
+	0x0201057a, 0x0201057c, 0x0201057d, 0x0201057e, 0x0201057f, 0x02010580,
+	0x02010581, 0x02010582, 0x02010583, 0x02010584, 0x02010585, 0x02010586,
+	0x02010587, 0x02010588, 0x02010589, 0x0201058a, 0x0201058c, 0x0201058d,
+	0x0201058e, 0x0201058f, 0x02010590, 0x02010591, 0x02010592, 0x02010594,
+	0x02010595, 0x02010c80, 0x02010c81, 0x02010c82, 0x02010c83, 0x02010c84,
+	0x02010c85, 0x02010c86, 0x02010c87, 0x02010c88, 0x02010c89, 0x02010c8a,
+	0x02010c8b, 0x02010c8c, 0x02010c8d, 0x02010c8e, 0x02010c8f, 0x02010c90,
+	0x02010c91, 0x02010c92, 0x02010c93, 0x02010c94, 0x02010c95, 0x02010c96,
+	0x02010c97, 0x02010c98, 0x02010c99, 0x02010c9a, 0x02010c9b, 0x02010c9c,
+	0x02010c9d, 0x02010c9e, 0x02010c9f, 0x02010ca0, 0x02010ca1, 0x02010ca2,
+	0x02010ca3, 0x02010ca4, 0x02010ca5, 0x02010ca6, 0x02010ca7, 0x02010ca8,
+	0x02010ca9, 0x02010caa, 0x02010cab, 0x02010cac, 0x02010cad, 0x02010cae,
+	0x02010caf, 0x02010cb0, 0x02010cb1, 0x02010cb2, 0x020118a0, 0x020118a1,
+	0x020118a2, 0x020118a3, 0x020118a4, 0x020118a5, 0x020118a6, 0x020118a7,
+	0x020118a8, 0x020118a9, 0x020118aa, 0x020118ab, 0x020118ac, 0x020118ad,
+	0x020118ae, 0x020118af, 0x020118b0, 0x020118b1, 0x020118b2, 0x020118b3,
+	0x020118b4, 0x020118b5, 0x020118b6, 0x020118b7, 0x020118b8, 0x020118b9,
+	0x020118ba, 0x020118bb, 0x020118bc, 0x020118bd, 0x020118be, 0x020118bf,
+	0x02016e40, 0x02016e41, 0x02016e42, 0x02016e43, 0x02016e44, 0x02016e45,
+	0x02016e46, 0x02016e47, 0x02016e48, 0x02016e49, 0x02016e4a, 0x02016e4b,
+	0x02016e4c, 0x02016e4d, 0x02016e4e, 0x02016e4f, 0x02016e50, 0x02016e51,
+	0x02016e52, 0x02016e53, 0x02016e54, 0x02016e55, 0x02016e56, 0x02016e57,
+	0x02016e58, 0x02016e59, 0x02016e5a, 0x02016e5b, 0x02016e5c, 0x02016e5d,
+	0x02016e5e, 0x02016e5f, 0x0201e900, 0x0201e901, 0x0201e902, 0x0201e903,
+	0x0201e904, 0x0201e905, 0x0201e906, 0x0201e907, 0x0201e908, 0x0201e909,
+	0x0201e90a, 0x0201e90b, 0x0201e90c, 0x0201e90d, 0x0201e90e, 0x0201e90f,
+	0x0201e910, 0x0201e911, 0x0201e912, 0x0201e913, 0x0201e914, 0x0201e915,
+	0x0201e916, 0x0201e917, 0x0201e918, 0x0201e919, 0x0201e91a, 0x0201e91b,
+	0x0201e91c, 0x0201e91d, 0x0201e91e, 0x0201e91f, 0x0201e920, 0x0201e921,
+};
+
+static const uint16_t sn_fold_off[1530] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 35, 48, 51, 54, 57, 60, 63, 66, 67, 70,
+	73, 76, 79, 82, 85, 88, 91, 94, 95, 98, 101, 104,
+	107, 110, 113, 114, 117, 120, 123, 126, 129, 130, 186, 191,
+	196, 201, 206, 211, 216, 221, 226, 227, 232, 237, 242, 247,
+	252, 257, 262, 267, 272, 277, 278, 283, 288, 293, 298, 302,
+	307, 312, 317, 322, 327, 332, 337, 338, 343, 348, 353, 355,
+	356, 361, 366, 371, 372, 377, 382, 387, 392, 397, 402, 407,
+	412, 417, 418, 423, 428, 433, 438, 443, 448, 453, 458, 461,
+	466, 471, 18, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+	485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+	501, 502, 503, 504, 505, 506, 507, 508, 513, 514, 515, 516,
+	517, 518, 519, 520, 520, 530, 530, 537, 537, 544, 549, 554,
+	559, 564, 571, 578, 585, 592, 599, 606, 611, 612, 617, 622,
+	627, 634, 639, 641, 641, 648, 653, 654, 655, 660, 667, 672,
+	677, 682, 687, 692, 697, 702, 707, 712, 717, 722, 727, 732,
+	737, 742, 747, 748, 753, 754, 755, 756, 761, 766, 773, 780,
+	785, 792, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806,
+	807, 808, 809, 832, 833, 834, 836, 840, 846, 850, 853, 856,
+	859, 862, 865, 868, 871, 872, 873, 874, 875, 876, 877, 878,
+	832, 879, 880, 35, 881, 882, 883, 884, 885, 886, 887, 888,
+	889, 890, 891, 892, 893, 896, 907, 886, 920, 872, 878, 889,
+	884, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936,
+	937, 879, 885, 878, 875, 940, 941, 943, 944, 945, 946, 947,
+	950, 953, 954, 957, 958, 959, 960, 963, 964, 965, 966, 967,
+	970, 973, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985,
+	986, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999,
+	1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1027,
+	1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1043,
+	1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+	1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+	1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1081, 1082, 1083,
+	1084, 1085, 1086, 1087, 1092, 1097, 1098, 1103, 1104, 1109, 1114, 1119,
+	1120, 1125, 1130, 1135, 1136, 1141, 1146, 1151, 1156, 1161, 1166, 1167,
+	1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+	1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+	1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+	1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219,
+	1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+	1232, 1233, 1234, 1235, 1236, 1237, 1404, 1405, 1406, 1407, 1408, 1409,
+	1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
+	1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433,
+	1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1445, 1446,
+	1447, 1448, 1449, 1450, 979, 981, 993, 996, 997, 997, 1005, 1028,
+	1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484,
+	1485, 1444, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
+	1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
+	1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1569,
+	1574, 1579, 1584, 1589, 1596, 1601, 1606, 1611, 1616, 1621, 1628, 1635,
+	1640, 1645, 1652, 1657, 1662, 1667, 1672, 1677, 1682, 1687, 1692, 1699,
+	1704, 1709, 1714, 1719, 1726, 1731, 1736, 1741, 1746, 1751, 1756, 1761,
+	1766, 1771, 1778, 1785, 1792, 1799, 1804, 1809, 1814, 1819, 1826, 1831,
+	1836, 1841, 1848, 1855, 1862, 1867, 1872, 1877, 1882, 1887, 1892, 1897,
+	1904, 1911, 1916, 1921, 1926, 1931, 1936, 1941, 1946, 1951, 1956, 1961,
+	1966, 1971, 1976, 1978, 1980, 1982, 1984, 1831, 130, 1988, 1993, 1998,
+	2005, 2012, 2019, 2026, 2033, 2040, 2047, 2054, 2061, 2068, 2073, 2078,
+	2083, 2090, 2097, 2104, 2111, 2118, 2123, 2128, 2133, 2138, 2145, 2152,
+	2159, 2166, 2173, 2180, 2187, 2194, 2201, 2208, 2213, 2218, 2225, 2232,
+	2239, 2246, 2253, 2258, 2263, 2268, 2273, 2274, 2275, 2298, 2301, 2304,
+	2308, 2312, 2316, 2320, 2324, 2344, 2347, 2350, 2354, 2358, 2362, 2388,
+	2391, 2394, 2398, 2402, 2406, 2410, 2414, 2440, 2443, 2446, 2450, 2454,
+	2458, 2462, 2466, 2486, 2489, 2492, 2496, 2500, 2504, 2508, 2512, 2518,
+	2524, 2530, 2533, 2537, 2541, 2567, 2570, 2573, 2577, 2581, 2585, 2589,
+	2593, 2611, 2616, 2621, 2627, 2633, 2639, 2645, 2651, 2611, 2616, 2621,
+	2627, 2633, 2639, 2645, 2651, 2687, 2692, 2697, 2703, 2709, 2715, 2721,
+	2727, 2687, 2692, 2697, 2703, 2709, 2715, 2721, 2727, 2763, 2768, 2773,
+	2779, 2785, 2791, 2797, 2803, 2763, 2768, 2773, 2779, 2785, 2791, 2797,
+	2803, 2843, 2848, 2852, 2857, 2859, 2865, 2868, 2871, 2874, 2848, 832,
+	2886, 2891, 2895, 2900, 2902, 2908, 2911, 2912, 2915, 2891, 2937, 868,
+	2940, 2942, 2945, 2948, 2951, 2954, 2974, 907, 2977, 2981, 2983, 2986,
+	2989, 2992, 2995, 2996, 3005, 3010, 3014, 3019, 3021, 3027, 3030, 3031,
+	3034, 3010, 892, 10, 63, 3120, 3179, 3180, 3183, 3187, 3190, 3192,
+	3195, 3199, 3204, 3207, 3209, 3212, 3216, 3217, 3218, 3219, 3243, 3569,
+	3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581,
+	3582, 3583, 3584, 3585, 3586, 3587, 3589, 3590, 3591, 3592, 3593, 3594,
+	3596, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621,
+	3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633,
+	3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645,
+	3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657,
+	3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 1541, 1559, 1540, 1548,
+	3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677,
+	3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689,
+	3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701,
+	3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713,
+	3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 5385, 5386, 5387,
+	5388, 5389, 1473, 5390, 5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398,
+	5399, 5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407, 5408, 5409, 5410,
+	5411, 5412, 5413, 5414, 5415, 5416, 5417, 5418, 5419, 5420, 5421, 5422,
+	5423, 5424, 5425, 5426, 5427, 5428, 5429, 5430, 5431, 5432, 5433, 5434,
+	5435, 5436, 5437, 5438, 5439, 5440, 5441, 5442, 5443, 5444, 5445, 5446,
+	5447, 5448, 5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5457, 5458,
+	5459, 5460, 5461, 5462, 5463, 5464, 5465, 5466, 5467, 1552, 5468, 5469,
+	5470, 5471, 5472, 5473, 5474, 5475, 5476, 5477, 5478, 5479, 810, 1543,
+	1551, 5480, 1553, 5481, 5482, 1555, 5483, 5484, 5485, 5486, 5487, 5488,
+	5489, 5490, 5491, 5492, 1564, 5493, 5494, 5495, 5496, 5497, 5498, 5499,
+	5504, 5505, 5506, 5507, 5508, 5509, 5510, 5511, 5512, 5513, 5514, 5515,
+	5516, 5517, 5518, 5519, 5520, 5521, 5522, 5523, 5524, 5525, 5526, 5527,
+	5528, 5529, 5530, 5531, 5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539,
+	5540, 5541, 5542, 5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550, 5551,
+	5552, 5553, 5554, 5555, 5556, 5557, 5558, 5559, 5560, 5561, 5562, 5563,
+	5564, 5565, 5566, 5567, 5568, 5569, 5570, 5571, 5572, 5573, 5574, 5575,
+	5576, 5577, 5578, 5579, 5580, 5581, 5582, 5583, 5997, 5999, 6001, 6003,
+	6006, 6009, 6009, 6011, 6013, 6015, 6017, 6019, 6960, 6961, 6962, 6963,
+	6964, 6965, 6966, 6967, 6968, 6969, 6970, 6971, 6972, 6973, 6974, 6975,
+	6976, 6977, 6978, 6979, 6980, 6981, 6982, 6983, 6984, 6985, 7018, 7020,
+	7022, 7024, 7026, 7028, 7030, 7032, 7034, 7036, 7038, 7040, 7042, 7044,
+	7046, 7048, 7050, 7052, 7054, 7056, 7058, 7060, 7062, 7064, 7066, 7068,
+	7070, 7072, 7074, 7076, 7078, 7080, 7082, 7084, 7086, 7088, 7090, 7092,
+	7094, 7096, 7098, 7100, 7102, 7104, 7106, 7108, 7110, 7112, 7114, 7116,
+	7118, 7120, 7122, 7124, 7126, 7128, 7130, 7132, 7134, 7136, 7138, 7140,
+	7142, 7144, 7146, 7148, 7150, 7152, 7154, 7156, 7158, 7160, 7162, 7164,
+	7166, 7168, 7170, 7172, 7174, 7176, 7178, 7180, 7182, 7184, 7186, 7188,
+	7190, 7192, 7194, 7196, 7198, 7200, 7202, 7204, 7206, 7208, 7210, 7212,
+	7214, 7216, 7218, 7220, 7222, 7224, 7226, 7228, 7230, 7232, 7234, 7236,
+	7238, 7290, 7292, 7294, 7296, 7298, 7300, 7302, 7304, 7306, 7308, 7310,
+	7312, 7314, 7316, 7318, 7320, 7322, 7324, 7326, 7328, 7330, 7332, 7334,
+	7336, 7338, 7340, 7342, 7344, 7346, 7348, 7350, 7352, 7354, 7356, 7358,
+	7360, 7362, 7364, 7366, 7368, 7370, 7372, 7374, 7376, 7378, 7380, 7382,
+	7384, 7386, 7388, 7390, 7440, 7442, 7444, 7446, 7448, 7450, 7452, 7454,
+	7456, 7458, 7460, 7462, 7464, 7466, 7468, 7470, 7472, 7474, 7476, 7478,
+	7480, 7482, 7484, 7486, 7488, 7490, 7492, 7494, 7496, 7498, 7500, 7502,
+	7508, 7510, 7512, 7514, 7516, 7518, 7520, 7522, 7524, 7526, 7528, 7530,
+	7532, 7534, 7536, 7538, 7540, 7542, 7544, 7546, 7548, 7550, 7552, 7554,
+	7556, 7558, 7560, 7562, 7564, 7566, 7568, 7570, 7665, 7667, 7669, 7671,
+	7673, 7675, 7677, 7679, 7681, 7683, 7685, 7687, 7689, 7691, 7693, 7695,
+	7697, 7699, 7701, 7703, 7705, 7707, 7709, 7711, 7713, 7715, 7717, 7719,
+	7721, 7723, 7725, 7727, 7729, 7731,
+};
+
+static const uint32_t sn_comp_k1[941] = {
+	0x0003c, 0x0003d, 0x0003e, 0x00041, 0x00041, 0x00041, 0x00041, 0x00041,
+	0x00041, 0x00041, 0x00041, 0x00041, 0x00041, 0x00041, 0x00041, 0x00041,
+	0x00041, 0x00041, 0x00041, 0x00042, 0x00042, 0x00042, 0x00043, 0x00043,
+	0x00043, 0x00043, 0x00043, 0x00044, 0x00044, 0x00044, 0x00044, 0x00044,
+	0x00044, 0x00045, 0x00045, 0x00045, 0x00045, 0x00045, 0x00045, 0x00045,
+	0x00045, 0x00045, 0x00045, 0x00045, 0x00045, 0x00045, 0x00045, 0x00045,
+	0x00045, 0x00045, 0x00046, 0x00047, 0x00047, 0x00047, 0x00047, 0x00047,
+	0x00047, 0x00047, 0x00048, 0x00048, 0x00048, 0x00048, 0x00048, 0x00048,
+	0x00048, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049,
+	0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049,
+	0x0004a, 0x0004b, 0x0004b, 0x0004b, 0x0004b, 0x0004b, 0x0004c, 0x0004c,
+	0x0004c, 0x0004c, 0x0004c, 0x0004c, 0x0004d, 0x0004d, 0x0004d, 0x0004e,
+	0x0004e, 0x0004e, 0x0004e, 0x0004e, 0x0004e, 0x0004e, 0x0004e, 0x0004e,
+	0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f,
+	0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f, 0x0004f,
+	0x00050, 0x00050, 0x00052, 0x00052, 0x00052, 0x00052, 0x00052, 0x00052,
+	0x00052, 0x00052, 0x00053, 0x00053, 0x00053, 0x00053, 0x00053, 0x00053,
+	0x00053, 0x00054, 0x00054, 0x00054, 0x00054, 0x00054, 0x00054, 0x00054,
+	0x00055, 0x00055, 0x00055, 0x00055, 0x00055, 0x00055, 0x00055, 0x00055,
+	0x00055, 0x00055, 0x00055, 0x00055, 0x00055, 0x00055, 0x00055, 0x00055,
+	0x00055, 0x00055, 0x00055, 0x00056, 0x00056, 0x00057, 0x00057, 0x00057,
+	0x00057, 0x00057, 0x00057, 0x00058, 0x00058, 0x00059, 0x00059, 0x00059,
+	0x00059, 0x00059, 0x00059, 0x00059, 0x00059, 0x00059, 0x0005a, 0x0005a,
+	0x0005a, 0x0005a, 0x0005a, 0x0005a, 0x00061, 0x00061, 0x00061, 0x00061,
+	0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061,
+	0x00061, 0x00061, 0x00061, 0x00061, 0x00062, 0x00062, 0x00062, 0x00063,
+	0x00063, 0x00063, 0x00063, 0x00063, 0x00064, 0x00064, 0x00064, 0x00064,
+	0x00064, 0x00064, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065,
+	0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065,
+	0x00065, 0x00065, 0x00065, 0x00066, 0x00067, 0x00067, 0x00067, 0x00067,
+	0x00067, 0x00067, 0x00067, 0x00068, 0x00068, 0x00068, 0x00068, 0x00068,
+	0x00068, 0x00068, 0x00068, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069,
+	0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069,
+	0x00069, 0x0006a, 0x0006a, 0x0006b, 0x0006b, 0x0006b, 0x0006b, 0x0006b,
+	0x0006c, 0x0006c, 0x0006c, 0x0006c, 0x0006c, 0x0006c, 0x0006d, 0x0006d,
+	0x0006d, 0x0006e, 0x0006e, 0x0006e, 0x0006e, 0x0006e, 0x0006e, 0x0006e,
+	0x0006e, 0x0006e, 0x0006f, 0x0006f, 0x0006f, 0x0006f, 0x0006f, 0x0006f,
+	0x0006f, 0x0006f, 0x0006f, 0x0006f, 0x0006f, 0x0006f, 0x0006f, 0x0006f,
+	0x0006f, 0x0006f, 0x00070, 0x00070, 0x00072, 0x00072, 0x00072, 0x00072,
+	0x00072, 0x00072, 0x00072, 0x00072, 0x00073, 0x00073, 0x00073, 0x00073,
+	0x00073, 0x00073, 0x00073, 0x00074, 0x00074, 0x00074, 0x00074, 0x00074,
+	0x00074, 0x00074, 0x00074, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075,
+	0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075,
+	0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00076, 0x00076,
+	0x00077, 0x00077, 0x00077, 0x00077, 0x00077, 0x00077, 0x00077, 0x00078,
+	0x00078, 0x00079, 0x00079, 0x00079, 0x00079, 0x00079, 0x00079, 0x00079,
+	0x00079, 0x00079, 0x00079, 0x0007a, 0x0007a, 0x0007a, 0x0007a, 0x0007a,
+	0x0007a, 0x000a8, 0x000a8, 0x000a8, 0x000c2, 0x000c2, 0x000c2, 0x000c2,
+	0x000c4, 0x000c5, 0x000c6, 0x000c6, 0x000c7, 0x000ca, 0x000ca, 0x000ca,
+	0x000ca, 0x000cf, 0x000d4, 0x000d4, 0x000d4, 0x000d4, 0x000d5, 0x000d5,
+	0x000d5, 0x000d6, 0x000d8, 0x000dc, 0x000dc, 0x000dc, 0x000dc, 0x000e2,
+	0x000e2, 0x000e2, 0x000e2, 0x000e4, 0x000e5, 0x000e6, 0x000e6, 0x000e7,
+	0x000ea, 0x000ea, 0x000ea, 0x000ea, 0x000ef, 0x000f4, 0x000f4, 0x000f4,
+	0x000f4, 0x000f5, 0x000f5, 0x000f5, 0x000f6, 0x000f8, 0x000fc, 0x000fc,
+	0x000fc, 0x000fc, 0x00102, 0x00102, 0x00102, 0x00102, 0x00103, 0x00103,
+	0x00103, 0x00103, 0x00112, 0x00112, 0x00113, 0x00113, 0x0014c, 0x0014c,
+	0x0014d, 0x0014d, 0x0015a, 0x0015b, 0x00160, 0x00161, 0x00168, 0x00169,
+	0x0016a, 0x0016b, 0x0017f, 0x001a0, 0x001a0, 0x001a0, 0x001a0, 0x001a0,
+	0x001a1, 0x001a1, 0x001a1, 0x001a1, 0x001a1, 0x001af, 0x001af, 0x001af,
+	0x001af, 0x001af, 0x001b0, 0x001b0, 0x001b0, 0x001b0, 0x001b0, 0x001b7,
+	0x001ea, 0x001eb, 0x00226, 0x00227, 0x00228, 0x00229, 0x0022e, 0x0022f,
+	0x00292, 0x00391, 0x00391, 0x00391, 0x00391, 0x00391, 0x00391, 0x00391,
+	0x00395, 0x00395, 0x00395, 0x00395, 0x00397, 0x00397, 0x00397, 0x00397,
+	0x00397, 0x00399, 0x00399, 0x00399, 0x00399, 0x00399, 0x00399, 0x00399,
+	0x0039f, 0x0039f, 0x0039f, 0x0039f, 0x003a1, 0x003a5, 0x003a5, 0x003a5,
+	0x003a5, 0x003a5, 0x003a5, 0x003a9, 0x003a9, 0x003a9, 0x003a9, 0x003a9,
+	0x003ac, 0x003ae, 0x003b1, 0x003b1, 0x003b1, 0x003b1, 0x003b1, 0x003b1,
+	0x003b1, 0x003b1, 0x003b5, 0x003b5, 0x003b5, 0x003b5, 0x003b7, 0x003b7,
+	0x003b7, 0x003b7, 0x003b7, 0x003b7, 0x003b9, 0x003b9, 0x003b9, 0x003b9,
+	0x003b9, 0x003b9, 0x003b9, 0x003b9, 0x003bf, 0x003bf, 0x003bf, 0x003bf,
+	0x003c1, 0x003c1, 0x003c5, 0x003c5, 0x003c5, 0x003c5, 0x003c5, 0x003c5,
+	0x003c5, 0x003c5, 0x003c9, 0x003c9, 0x003c9, 0x003c9, 0x003c9, 0x003c9,
+	0x003ca, 0x003ca, 0x003ca, 0x003cb, 0x003cb, 0x003cb, 0x003ce, 0x003d2,
+	0x003d2, 0x00406, 0x00410, 0x00410, 0x00413, 0x00415, 0x00415, 0x00415,
+	0x00416, 0x00416, 0x00417, 0x00418, 0x00418, 0x00418, 0x00418, 0x0041a,
+	0x0041e, 0x00423, 0x00423, 0x00423, 0x00423, 0x00427, 0x0042b, 0x0042d,
+	0x00430, 0x00430, 0x00433, 0x00435, 0x00435, 0x00435, 0x00436, 0x00436,
+	0x00437, 0x00438, 0x00438, 0x00438, 0x00438, 0x0043a, 0x0043e, 0x00443,
+	0x00443, 0x00443, 0x00443, 0x00447, 0x0044b, 0x0044d, 0x00456, 0x00474,
+	0x00475, 0x004d8, 0x004d9, 0x004e8, 0x004e9, 0x00627, 0x00627, 0x00627,
+	0x00648, 0x0064a, 0x006c1, 0x006d2, 0x006d5, 0x00928, 0x00930, 0x00933,
+	0x009c7, 0x009c7, 0x00b47, 0x00b47, 0x00b47, 0x00b92, 0x00bc6, 0x00bc6,
+	0x00bc7, 0x00c46, 0x00cbf, 0x00cc6, 0x00cc6, 0x00cc6, 0x00cca, 0x00d46,
+	0x00d46, 0x00d47, 0x00dd9, 0x00dd9, 0x00dd9, 0x00ddc, 0x01025, 0x01b05,
+	0x01b07, 0x01b09, 0x01b0b, 0x01b0d, 0x01b11, 0x01b3a, 0x01b3c, 0x01b3e,
+	0x01b3f, 0x01b42, 0x01e36, 0x01e37, 0x01e5a, 0x01e5b, 0x01e62, 0x01e63,
+	0x01ea0, 0x01ea0, 0x01ea1, 0x01ea1, 0x01eb8, 0x01eb9, 0x01ecc, 0x01ecd,
+	0x01f00, 0x01f00, 0x01f00, 0x01f00, 0x01f01, 0x01f01, 0x01f01, 0x01f01,
+	0x01f02, 0x01f03, 0x01f04, 0x01f05, 0x01f06, 0x01f07, 0x01f08, 0x01f08,
+	0x01f08, 0x01f08, 0x01f09, 0x01f09, 0x01f09, 0x01f09, 0x01f0a, 0x01f0b,
+	0x01f0c, 0x01f0d, 0x01f0e, 0x01f0f, 0x01f10, 0x01f10, 0x01f11, 0x01f11,
+	0x01f18, 0x01f18, 0x01f19, 0x01f19, 0x01f20, 0x01f20, 0x01f20, 0x01f20,
+	0x01f21, 0x01f21, 0x01f21, 0x01f21, 0x01f22, 0x01f23, 0x01f24, 0x01f25,
+	0x01f26, 0x01f27, 0x01f28, 0x01f28, 0x01f28, 0x01f28, 0x01f29, 0x01f29,
+	0x01f29, 0x01f29, 0x01f2a, 0x01f2b, 0x01f2c, 0x01f2d, 0x01f2e, 0x01f2f,
+	0x01f30, 0x01f30, 0x01f30, 0x01f31, 0x01f31, 0x01f31, 0x01f38, 0x01f38,
+	0x01f38, 0x01f39, 0x01f39, 0x01f39, 0x01f40, 0x01f40, 0x01f41, 0x01f41,
+	0x01f48, 0x01f48, 0x01f49, 0x01f49, 0x01f50, 0x01f50, 0x01f50, 0x01f51,
+	0x01f51, 0x01f51, 0x01f59, 0x01f59, 0x01f59, 0x01f60, 0x01f60, 0x01f60,
+	0x01f60, 0x01f61, 0x01f61, 0x01f61, 0x01f61, 0x01f62, 0x01f63, 0x01f64,
+	0x01f65, 0x01f66, 0x01f67, 0x01f68, 0x01f68, 0x01f68, 0x01f68, 0x01f69,
+	0x01f69, 0x01f69, 0x01f69, 0x01f6a, 0x01f6b, 0x01f6c, 0x01f6d, 0x01f6e,
+	0x01f6f, 0x01f70, 0x01f74, 0x01f7c, 0x01fb6, 0x01fbf, 0x01fbf, 0x01fbf,
+	0x01fc6, 0x01ff6, 0x01ffe, 0x01ffe, 0x01ffe, 0x02190, 0x02192, 0x02194,
+	0x021d0, 0x021d2, 0x021d4, 0x02203, 0x02208, 0x0220b, 0x02223, 0x02225,
+	0x0223c, 0x02243, 0x02245, 0x02248, 0x0224d, 0x02261, 0x02264, 0x02265,
+	0x02272, 0x02273, 0x02276, 0x02277, 0x0227a, 0x0227b, 0x0227c, 0x0227d,
+	0x02282, 0x02283, 0x02286, 0x02287, 0x02291, 0x02292, 0x022a2, 0x022a8,
+	0x022a9, 0x022ab, 0x022b2, 0x022b3, 0x022b4, 0x022b5, 0x03046, 0x0304b,
+	0x0304d, 0x0304f, 0x03051, 0x03053, 0x03055, 0x03057, 0x03059, 0x0305b,
+	0x0305d, 0x0305f, 0x03061, 0x03064, 0x03066, 0x03068, 0x0306f, 0x0306f,
+	0x03072, 0x03072, 0x03075, 0x03075, 0x03078, 0x03078, 0x0307b, 0x0307b,
+	0x0309d, 0x030a6, 0x030ab, 0x030ad, 0x030af, 0x030b1, 0x030b3, 0x030b5,
+	0x030b7, 0x030b9, 0x030bb, 0x030bd, 0x030bf, 0x030c1, 0x030c4, 0x030c6,
+	0x030c8, 0x030cf, 0x030cf, 0x030d2, 0x030d2, 0x030d5, 0x030d5, 0x030d8,
+	0x030d8, 0x030db, 0x030db, 0x030ef, 0x030f0, 0x030f1, 0x030f2, 0x030fd,
+	0x11099, 0x1109b, 0x110a5, 0x11131, 0x11132, 0x11347, 0x11347, 0x114b9,
+	0x114b9, 0x114b9, 0x115b8, 0x115b9, 0x11935,
+};
+
+static const uint32_t sn_comp_k2[941] = {
+	0x00338, 0x00338, 0x00338, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304,
+	0x00306, 0x00307, 0x00308, 0x00309, 0x0030a, 0x0030c, 0x0030f, 0x00311,
+	0x00323, 0x00325, 0x00328, 0x00307, 0x00323, 0x00331, 0x00301, 0x00302,
+	0x00307, 0x0030c, 0x00327, 0x00307, 0x0030c, 0x00323, 0x00327, 0x0032d,
+	0x00331, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304, 0x00306, 0x00307,
+	0x00308, 0x00309, 0x0030c, 0x0030f, 0x00311, 0x00323, 0x00327, 0x00328,
+	0x0032d, 0x00330, 0x00307, 0x00301, 0x00302, 0x00304, 0x00306, 0x00307,
+	0x0030c, 0x00327, 0x00302, 0x00307, 0x00308, 0x0030c, 0x00323, 0x00327,
+	0x0032e, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304, 0x00306, 0x00307,
+	0x00308, 0x00309, 0x0030c, 0x0030f, 0x00311, 0x00323, 0x00328, 0x00330,
+	0x00302, 0x00301, 0x0030c, 0x00323, 0x00327, 0x00331, 0x00301, 0x0030c,
+	0x00323, 0x00327, 0x0032d, 0x00331, 0x00301, 0x00307, 0x00323, 0x00300,
+	0x00301, 0x00303, 0x00307, 0x0030c, 0x00323, 0x00327, 0x0032d, 0x00331,
+	0x00300, 0x00301, 0x00302, 0x00303, 0x00304, 0x00306, 0x00307, 0x00308,
+	0x00309, 0x0030b, 0x0030c, 0x0030f, 0x00311, 0x0031b, 0x00323, 0x00328,
+	0x00301, 0x00307, 0x00301, 0x00307, 0x0030c, 0x0030f, 0x00311, 0x00323,
+	0x00327, 0x00331, 0x00301, 0x00302, 0x00307, 0x0030c, 0x00323, 0x00326,
+	0x00327, 0x00307, 0x0030c, 0x00323, 0x00326, 0x00327, 0x0032d, 0x00331,
+	0x00300, 0x00301, 0x00302, 0x00303, 0x00304, 0x00306, 0x00308, 0x00309,
+	0x0030a, 0x0030b, 0x0030c, 0x0030f, 0x00311, 0x0031b, 0x00323, 0x00324,
+	0x00328, 0x0032d, 0x00330, 0x00303, 0x00323, 0x00300, 0x00301, 0x00302,
+	0x00307, 0x00308, 0x00323, 0x00307, 0x00308, 0x00300, 0x00301, 0x00302,
+	0x00303, 0x00304, 0x00307, 0x00308, 0x00309, 0x00323, 0x00301, 0x00302,
+	0x00307, 0x0030c, 0x00323, 0x00331, 0x00300, 0x00301, 0x00302, 0x00303,
+	0x00304, 0x00306, 0x00307, 0x00308, 0x00309, 0x0030a, 0x0030c, 0x0030f,
+	0x00311, 0x00323, 0x00325, 0x00328, 0x00307, 0x00323, 0x00331, 0x00301,
+	0x00302, 0x00307, 0x0030c, 0x00327, 0x00307, 0x0030c, 0x00323, 0x00327,
+	0x0032d, 0x00331, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304, 0x00306,
+	0x00307, 0x00308, 0x00309, 0x0030c, 0x0030f, 0x00311, 0x00323, 0x00327,
+	0x00328, 0x0032d, 0x00330, 0x00307, 0x00301, 0x00302, 0x00304, 0x00306,
+	0x00307, 0x0030c, 0x00327, 0x00302, 0x00307, 0x00308, 0x0030c, 0x00323,
+	0x00327, 0x0032e, 0x00331, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304,
+	0x00306, 0x00308, 0x00309, 0x0030c, 0x0030f, 0x00311, 0x00323, 0x00328,
+	0x00330, 0x00302, 0x0030c, 0x00301, 0x0030c, 0x00323, 0x00327, 0x00331,
+	0x00301, 0x0030c, 0x00323, 0x00327, 0x0032d, 0x00331, 0x00301, 0x00307,
+	0x00323, 0x00300, 0x00301, 0x00303, 0x00307, 0x0030c, 0x00323, 0x00327,
+	0x0032d, 0x00331, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304, 0x00306,
+	0x00307, 0x00308, 0x00309, 0x0030b, 0x0030c, 0x0030f, 0x00311, 0x0031b,
+	0x00323, 0x00328, 0x00301, 0x00307, 0x00301, 0x00307, 0x0030c, 0x0030f,
+	0x00311, 0x00323, 0x00327, 0x00331, 0x00301, 0x00302, 0x00307, 0x0030c,
+	0x00323, 0x00326, 0x00327, 0x00307, 0x00308, 0x0030c, 0x00323, 0x00326,
+	0x00327, 0x0032d, 0x00331, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304,
+	0x00306, 0x00308, 0x00309, 0x0030a, 0x0030b, 0x0030c, 0x0030f, 0x00311,
+	0x0031b, 0x00323, 0x00324, 0x00328, 0x0032d, 0x00330, 0x00303, 0x00323,
+	0x00300, 0x00301, 0x00302, 0x00307, 0x00308, 0x0030a, 0x00323, 0x00307,
+	0x00308, 0x00300, 0x00301, 0x00302, 0x00303, 0x00304, 0x00307, 0x00308,
+	0x00309, 0x0030a, 0x00323, 0x00301, 0x00302, 0x00307, 0x0030c, 0x00323,
+	0x00331, 0x00300, 0x00301, 0x00342, 0x00300, 0x00301, 0x00303, 0x00309,
+	0x00304, 0x00301, 0x00301, 0x00304, 0x00301, 0x00300, 0x00301, 0x00303,
+	0x00309, 0x00301, 0x00300, 0x00301, 0x00303, 0x00309, 0x00301, 0x00304,
+	0x00308, 0x00304, 0x00301, 0x00300, 0x00301, 0x00304, 0x0030c, 0x00300,
+	0x00301, 0x00303, 0x00309, 0x00304, 0x00301, 0x00301, 0x00304, 0x00301,
+	0x00300, 0x00301, 0x00303, 0x00309, 0x00301, 0x00300, 0x00301, 0x00303,
+	0x00309, 0x00301, 0x00304, 0x00308, 0x00304, 0x00301, 0x00300, 0x00301,
+	0x00304, 0x0030c, 0x00300, 0x00301, 0x00303, 0x00309, 0x00300, 0x00301,
+	0x00303, 0x00309, 0x00300, 0x00301, 0x00300, 0x00301, 0x00300, 0x00301,
+	0x00300, 0x00301, 0x00307, 0x00307, 0x00307, 0x00307, 0x00301, 0x00301,
+	0x00308, 0x00308, 0x00307, 0x00300, 0x00301, 0x00303, 0x00309, 0x00323,
+	0x00300, 0x00301, 0x00303, 0x00309, 0x00323, 0x00300, 0x00301, 0x00303,
+	0x00309, 0x00323, 0x00300, 0x00301, 0x00303, 0x00309, 0x00323, 0x0030c,
+	0x00304, 0x00304, 0x00304, 0x00304, 0x00306, 0x00306, 0x00304, 0x00304,
+	0x0030c, 0x00300, 0x00301, 0x00304, 0x00306, 0x00313, 0x00314, 0x00345,
+	0x00300, 0x00301, 0x00313, 0x00314, 0x00300, 0x00301, 0x00313, 0x00314,
+	0x00345, 0x00300, 0x00301, 0x00304, 0x00306, 0x00308, 0x00313, 0x00314,
+	0x00300, 0x00301, 0x00313, 0x00314, 0x00314, 0x00300, 0x00301, 0x00304,
+	0x00306, 0x00308, 0x00314, 0x00300, 0x00301, 0x00313, 0x00314, 0x00345,
+	0x00345, 0x00345, 0x00300, 0x00301, 0x00304, 0x00306, 0x00313, 0x00314,
+	0x00342, 0x00345, 0x00300, 0x00301, 0x00313, 0x00314, 0x00300, 0x00301,
+	0x00313, 0x00314, 0x00342, 0x00345, 0x00300, 0x00301, 0x00304, 0x00306,
+	0x00308, 0x00313, 0x00314, 0x00342, 0x00300, 0x00301, 0x00313, 0x00314,
+	0x00313, 0x00314, 0x00300, 0x00301, 0x00304, 0x00306, 0x00308, 0x00313,
+	0x00314, 0x00342, 0x00300, 0x00301, 0x00313, 0x00314, 0x00342, 0x00345,
+	0x00300, 0x00301, 0x00342, 0x00300, 0x00301, 0x00342, 0x00345, 0x00301,
+	0x00308, 0x00308, 0x00306, 0x00308, 0x00301, 0x00300, 0x00306, 0x00308,
+	0x00306, 0x00308, 0x00308, 0x00300, 0x00304, 0x00306, 0x00308, 0x00301,
+	0x00308, 0x00304, 0x00306, 0x00308, 0x0030b, 0x00308, 0x00308, 0x00308,
+	0x00306, 0x00308, 0x00301, 0x00300, 0x00306, 0x00308, 0x00306, 0x00308,
+	0x00308, 0x00300, 0x00304, 0x00306, 0x00308, 0x00301, 0x00308, 0x00304,
+	0x00306, 0x00308, 0x0030b, 0x00308, 0x00308, 0x00308, 0x00308, 0x0030f,
+	0x0030f, 0x00308, 0x00308, 0x00308, 0x00308, 0x00653, 0x00654, 0x00655,
+	0x00654, 0x00654, 0x00654, 0x00654, 0x00654, 0x0093c, 0x0093c, 0x0093c,
+	0x009be, 0x009d7, 0x00b3e, 0x00b56, 0x00b57, 0x00bd7, 0x00bbe, 0x00bd7,
+	0x00bbe, 0x00c56, 0x00cd5, 0x00cc2, 0x00cd5, 0x00cd6, 0x00cd5, 0x00d3e,
+	0x00d57, 0x00d3e, 0x00dca, 0x00dcf, 0x00ddf, 0x00dca, 0x0102e, 0x01b35,
+	0x01b35, 0x01b35, 0x01b35, 0x01b35, 0x01b35, 0x01b35, 0x01b35, 0x01b35,
+	0x01b35, 0x01b35, 0x00304, 0x00304, 0x00304, 0x00304, 0x00307, 0x00307,
+	0x00302, 0x00306, 0x00302, 0x00306, 0x00302, 0x00302, 0x00302, 0x00302,
+	0x00300, 0x00301, 0x00342, 0x00345, 0x00300, 0x00301, 0x00342, 0x00345,
+	0x00345, 0x00345, 0x00345, 0x00345, 0x00345, 0x00345, 0x00300, 0x00301,
+	0x00342, 0x00345, 0x00300, 0x00301, 0x00342, 0x00345, 0x00345, 0x00345,
+	0x00345, 0x00345, 0x00345, 0x00345, 0x00300, 0x00301, 0x00300, 0x00301,
+	0x00300, 0x00301, 0x00300, 0x00301, 0x00300, 0x00301, 0x00342, 0x00345,
+	0x00300, 0x00301, 0x00342, 0x00345, 0x00345, 0x00345, 0x00345, 0x00345,
+	0x00345, 0x00345, 0x00300, 0x00301, 0x00342, 0x00345, 0x00300, 0x00301,
+	0x00342, 0x00345, 0x00345, 0x00345, 0x00345, 0x00345, 0x00345, 0x00345,
+	0x00300, 0x00301, 0x00342, 0x00300, 0x00301, 0x00342, 0x00300, 0x00301,
+	0x00342, 0x00300, 0x00301, 0x00342, 0x00300, 0x00301, 0x00300, 0x00301,
+	0x00300, 0x00301, 0x00300, 0x00301, 0x00300, 0x00301, 0x00342, 0x00300,
+	0x00301, 0x00342, 0x00300, 0x00301, 0x00342, 0x00300, 0x00301, 0x00342,
+	0x00345, 0x00300, 0x00301, 0x00342, 0x00345, 0x00345, 0x00345, 0x00345,
+	0x00345, 0x00345, 0x00345, 0x00300, 0x00301, 0x00342, 0x00345, 0x00300,
+	0x00301, 0x00342, 0x00345, 0x00345, 0x00345, 0x00345, 0x00345, 0x00345,
+	0x00345, 0x00345, 0x00345, 0x00345, 0x00345, 0x00300, 0x00301, 0x00342,
+	0x00345, 0x00345, 0x00300, 0x00301, 0x00342, 0x00338, 0x00338, 0x00338,
+	0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338,
+	0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338,
+	0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338,
+	0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338,
+	0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x00338, 0x03099, 0x03099,
+	0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099,
+	0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x0309a,
+	0x03099, 0x0309a, 0x03099, 0x0309a, 0x03099, 0x0309a, 0x03099, 0x0309a,
+	0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099,
+	0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099,
+	0x03099, 0x03099, 0x0309a, 0x03099, 0x0309a, 0x03099, 0x0309a, 0x03099,
+	0x0309a, 0x03099, 0x0309a, 0x03099, 0x03099, 0x03099, 0x03099, 0x03099,
+	0x110ba, 0x110ba, 0x110ba, 0x11127, 0x11127, 0x1133e, 0x11357, 0x114b0,
+	0x114ba, 0x114bd, 0x115af, 0x115af, 0x11930,
+};
+
+static const uint32_t sn_comp_v[941] = {
+	0x0226e, 0x02260, 0x0226f, 0x000c0, 0x000c1, 0x000c2, 0x000c3, 0x00100,
+	0x00102, 0x00226, 0x000c4, 0x01ea2, 0x000c5, 0x001cd, 0x00200, 0x00202,
+	0x01ea0, 0x01e00, 0x00104, 0x01e02, 0x01e04, 0x01e06, 0x00106, 0x00108,
+	0x0010a, 0x0010c, 0x000c7, 0x01e0a, 0x0010e, 0x01e0c, 0x01e10, 0x01e12,
+	0x01e0e, 0x000c8, 0x000c9, 0x000ca, 0x01ebc, 0x00112, 0x00114, 0x00116,
+	0x000cb, 0x01eba, 0x0011a, 0x00204, 0x00206, 0x01eb8, 0x00228, 0x00118,
+	0x01e18, 0x01e1a, 0x01e1e, 0x001f4, 0x0011c, 0x01e20, 0x0011e, 0x00120,
+	0x001e6, 0x00122, 0x00124, 0x01e22, 0x01e26, 0x0021e, 0x01e24, 0x01e28,
+	0x01e2a, 0x000cc, 0x000cd, 0x000ce, 0x00128, 0x0012a, 0x0012c, 0x00130,
+	0x000cf, 0x01ec8, 0x001cf, 0x00208, 0x0020a, 0x01eca, 0x0012e, 0x01e2c,
+	0x00134, 0x01e30, 0x001e8, 0x01e32, 0x00136, 0x01e34, 0x00139, 0x0013d,
+	0x01e36, 0x0013b, 0x01e3c, 0x01e3a, 0x01e3e, 0x01e40, 0x01e42, 0x001f8,
+	0x00143, 0x000d1, 0x01e44, 0x00147, 0x01e46, 0x00145, 0x01e4a, 0x01e48,
+	0x000d2, 0x000d3, 0x000d4, 0x000d5, 0x0014c, 0x0014e, 0x0022e, 0x000d6,
+	0x01ece, 0x00150, 0x001d1, 0x0020c, 0x0020e, 0x001a0, 0x01ecc, 0x001ea,
+	0x01e54, 0x01e56, 0x00154, 0x01e58, 0x00158, 0x00210, 0x00212, 0x01e5a,
+	0x00156, 0x01e5e, 0x0015a, 0x0015c, 0x01e60, 0x00160, 0x01e62, 0x00218,
+	0x0015e, 0x01e6a, 0x00164, 0x01e6c, 0x0021a, 0x00162, 0x01e70, 0x01e6e,
+	0x000d9, 0x000da, 0x000db, 0x00168, 0x0016a, 0x0016c, 0x000dc, 0x01ee6,
+	0x0016e, 0x00170, 0x001d3, 0x00214, 0x00216, 0x001af, 0x01ee4, 0x01e72,
+	0x00172, 0x01e76, 0x01e74, 0x01e7c, 0x01e7e, 0x01e80, 0x01e82, 0x00174,
+	0x01e86, 0x01e84, 0x01e88, 0x01e8a, 0x01e8c, 0x01ef2, 0x000dd, 0x00176,
+	0x01ef8, 0x00232, 0x01e8e, 0x00178, 0x01ef6, 0x01ef4, 0x00179, 0x01e90,
+	0x0017b, 0x0017d, 0x01e92, 0x01e94, 0x000e0, 0x000e1, 0x000e2, 0x000e3,
+	0x00101, 0x00103, 0x00227, 0x000e4, 0x01ea3, 0x000e5, 0x001ce, 0x00201,
+	0x00203, 0x01ea1, 0x01e01, 0x00105, 0x01e03, 0x01e05, 0x01e07, 0x00107,
+	0x00109, 0x0010b, 0x0010d, 0x000e7, 0x01e0b, 0x0010f, 0x01e0d, 0x01e11,
+	0x01e13, 0x01e0f, 0x000e8, 0x000e9, 0x000ea, 0x01ebd, 0x00113, 0x00115,
+	0x00117, 0x000eb, 0x01ebb, 0x0011b, 0x00205, 0x00207, 0x01eb9, 0x00229,
+	0x00119, 0x01e19, 0x01e1b, 0x01e1f, 0x001f5, 0x0011d, 0x01e21, 0x0011f,
+	0x00121, 0x001e7, 0x00123, 0x00125, 0x01e23, 0x01e27, 0x0021f, 0x01e25,
+	0x01e29, 0x01e2b, 0x01e96, 0x000ec, 0x000ed, 0x000ee, 0x00129, 0x0012b,
+	0x0012d, 0x000ef, 0x01ec9, 0x001d0, 0x00209, 0x0020b, 0x01ecb, 0x0012f,
+	0x01e2d, 0x00135, 0x001f0, 0x01e31, 0x001e9, 0x01e33, 0x00137, 0x01e35,
+	0x0013a, 0x0013e, 0x01e37, 0x0013c, 0x01e3d, 0x01e3b, 0x01e3f, 0x01e41,
+	0x01e43, 0x001f9, 0x00144, 0x000f1, 0x01e45, 0x00148, 0x01e47, 0x00146,
+	0x01e4b, 0x01e49, 0x000f2, 0x000f3, 0x000f4, 0x000f5, 0x0014d, 0x0014f,
+	0x0022f, 0x000f6, 0x01ecf, 0x00151, 0x001d2, 0x0020d, 0x0020f, 0x001a1,
+	0x01ecd, 0x001eb, 0x01e55, 0x01e57, 0x00155, 0x01e59, 0x00159, 0x00211,
+	0x00213, 0x01e5b, 0x00157, 0x01e5f, 0x0015b, 0x0015d, 0x01e61, 0x00161,
+	0x01e63, 0x00219, 0x0015f, 0x01e6b, 0x01e97, 0x00165, 0x01e6d, 0x0021b,
+	0x00163, 0x01e71, 0x01e6f, 0x000f9, 0x000fa, 0x000fb, 0x00169, 0x0016b,
+	0x0016d, 0x000fc, 0x01ee7, 0x0016f, 0x00171, 0x001d4, 0x00215, 0x00217,
+	0x001b0, 0x01ee5, 0x01e73, 0x00173, 0x01e77, 0x01e75, 0x01e7d, 0x01e7f,
+	0x01e81, 0x01e83, 0x00175, 0x01e87, 0x01e85, 0x01e98, 0x01e89, 0x01e8b,
+	0x01e8d, 0x01ef3, 0x000fd, 0x00177, 0x01ef9, 0x00233, 0x01e8f, 0x000ff,
+	0x01ef7, 0x01e99, 0x01ef5, 0x0017a, 0x01e91, 0x0017c, 0x0017e, 0x01e93,
+	0x01e95, 0x01fed, 0x00385, 0x01fc1, 0x01ea6, 0x01ea4, 0x01eaa, 0x01ea8,
+	0x001de, 0x001fa, 0x001fc, 0x001e2, 0x01e08, 0x01ec0, 0x01ebe, 0x01ec4,
+	0x01ec2, 0x01e2e, 0x01ed2, 0x01ed0, 0x01ed6, 0x01ed4, 0x01e4c, 0x0022c,
+	0x01e4e, 0x0022a, 0x001fe, 0x001db, 0x001d7, 0x001d5, 0x001d9, 0x01ea7,
+	0x01ea5, 0x01eab, 0x01ea9, 0x001df, 0x001fb, 0x001fd, 0x001e3, 0x01e09,
+	0x01ec1, 0x01ebf, 0x01ec5, 0x01ec3, 0x01e2f, 0x01ed3, 0x01ed1, 0x01ed7,
+	0x01ed5, 0x01e4d, 0x0022d, 0x01e4f, 0x0022b, 0x001ff, 0x001dc, 0x001d8,
+	0x001d6, 0x001da, 0x01eb0, 0x01eae, 0x01eb4, 0x01eb2, 0x01eb1, 0x01eaf,
+	0x01eb5, 0x01eb3, 0x01e14, 0x01e16, 0x01e15, 0x01e17, 0x01e50, 0x01e52,
+	0x01e51, 0x01e53, 0x01e64, 0x01e65, 0x01e66, 0x01e67, 0x01e78, 0x01e79,
+	0x01e7a, 0x01e7b, 0x01e9b, 0x01edc, 0x01eda, 0x01ee0, 0x01ede, 0x01ee2,
+	0x01edd, 0x01edb, 0x01ee1, 0x01edf, 0x01ee3, 0x01eea, 0x01ee8, 0x01eee,
+	0x01eec, 0x01ef0, 0x01eeb, 0x01ee9, 0x01eef, 0x01eed, 0x01ef1, 0x001ee,
+	0x001ec, 0x001ed, 0x001e0, 0x001e1, 0x01e1c, 0x01e1d, 0x00230, 0x00231,
+	0x001ef, 0x01fba, 0x00386, 0x01fb9, 0x01fb8, 0x01f08, 0x01f09, 0x01fbc,
+	0x01fc8, 0x00388, 0x01f18, 0x01f19, 0x01fca, 0x00389, 0x01f28, 0x01f29,
+	0x01fcc, 0x01fda, 0x0038a, 0x01fd9, 0x01fd8, 0x003aa, 0x01f38, 0x01f39,
+	0x01ff8, 0x0038c, 0x01f48, 0x01f49, 0x01fec, 0x01fea, 0x0038e, 0x01fe9,
+	0x01fe8, 0x003ab, 0x01f59, 0x01ffa, 0x0038f, 0x01f68, 0x01f69, 0x01ffc,
+	0x01fb4, 0x01fc4, 0x01f70, 0x003ac, 0x01fb1, 0x01fb0, 0x01f00, 0x01f01,
+	0x01fb6, 0x01fb3, 0x01f72, 0x003ad, 0x01f10, 0x01f11, 0x01f74, 0x003ae,
+	0x01f20, 0x01f21, 0x01fc6, 0x01fc3, 0x01f76, 0x003af, 0x01fd1, 0x01fd0,
+	0x003ca, 0x01f30, 0x01f31, 0x01fd6, 0x01f78, 0x003cc, 0x01f40, 0x01f41,
+	0x01fe4, 0x01fe5, 0x01f7a, 0x003cd, 0x01fe1, 0x01fe0, 0x003cb, 0x01f50,
+	0x01f51, 0x01fe6, 0x01f7c, 0x003ce, 0x01f60, 0x01f61, 0x01ff6, 0x01ff3,
+	0x01fd2, 0x00390, 0x01fd7, 0x01fe2, 0x003b0, 0x01fe7, 0x01ff4, 0x003d3,
+	0x003d4, 0x00407, 0x004d0, 0x004d2, 0x00403, 0x00400, 0x004d6, 0x00401,
+	0x004c1, 0x004dc, 0x004de, 0x0040d, 0x004e2, 0x00419, 0x004e4, 0x0040c,
+	0x004e6, 0x004ee, 0x0040e, 0x004f0, 0x004f2, 0x004f4, 0x004f8, 0x004ec,
+	0x004d1, 0x004d3, 0x00453, 0x00450, 0x004d7, 0x00451, 0x004c2, 0x004dd,
+	0x004df, 0x0045d, 0x004e3, 0x00439, 0x004e5, 0x0045c, 0x004e7, 0x004ef,
+	0x0045e, 0x004f1, 0x004f3, 0x004f5, 0x004f9, 0x004ed, 0x00457, 0x00476,
+	0x00477, 0x004da, 0x004db, 0x004ea, 0x004eb, 0x00622, 0x00623, 0x00625,
+	0x00624, 0x00626, 0x006c2, 0x006d3, 0x006c0, 0x00929, 0x00931, 0x00934,
+	0x009cb, 0x009cc, 0x00b4b, 0x00b48, 0x00b4c, 0x00b94, 0x00bca, 0x00bcc,
+	0x00bcb, 0x00c48, 0x00cc0, 0x00cca, 0x00cc7, 0x00cc8, 0x00ccb, 0x00d4a,
+	0x00d4c, 0x00d4b, 0x00dda, 0x00ddc, 0x00dde, 0x00ddd, 0x01026, 0x01b06,
+	0x01b08, 0x01b0a, 0x01b0c, 0x01b0e, 0x01b12, 0x01b3b, 0x01b3d, 0x01b40,
+	0x01b41, 0x01b43, 0x01e38, 0x01e39, 0x01e5c, 0x01e5d, 0x01e68, 0x01e69,
+	0x01eac, 0x01eb6, 0x01ead, 0x01eb7, 0x01ec6, 0x01ec7, 0x01ed8, 0x01ed9,
+	0x01f02, 0x01f04, 0x01f06, 0x01f80, 0x01f03, 0x01f05, 0x01f07, 0x01f81,
+	0x01f82, 0x01f83, 0x01f84, 0x01f85, 0x01f86, 0x01f87, 0x01f0a, 0x01f0c,
+	0x01f0e, 0x01f88, 0x01f0b, 0x01f0d, 0x01f0f, 0x01f89, 0x01f8a, 0x01f8b,
+	0x01f8c, 0x01f8d, 0x01f8e, 0x01f8f, 0x01f12, 0x01f14, 0x01f13, 0x01f15,
+	0x01f1a, 0x01f1c, 0x01f1b, 0x01f1d, 0x01f22, 0x01f24, 0x01f26, 0x01f90,
+	0x01f23, 0x01f25, 0x01f27, 0x01f91, 0x01f92, 0x01f93, 0x01f94, 0x01f95,
+	0x01f96, 0x01f97, 0x01f2a, 0x01f2c, 0x01f2e, 0x01f98, 0x01f2b, 0x01f2d,
+	0x01f2f, 0x01f99, 0x01f9a, 0x01f9b, 0x01f9c, 0x01f9d, 0x01f9e, 0x01f9f,
+	0x01f32, 0x01f34, 0x01f36, 0x01f33, 0x01f35, 0x01f37, 0x01f3a, 0x01f3c,
+	0x01f3e, 0x01f3b, 0x01f3d, 0x01f3f, 0x01f42, 0x01f44, 0x01f43, 0x01f45,
+	0x01f4a, 0x01f4c, 0x01f4b, 0x01f4d, 0x01f52, 0x01f54, 0x01f56, 0x01f53,
+	0x01f55, 0x01f57, 0x01f5b, 0x01f5d, 0x01f5f, 0x01f62, 0x01f64, 0x01f66,
+	0x01fa0, 0x01f63, 0x01f65, 0x01f67, 0x01fa1, 0x01fa2, 0x01fa3, 0x01fa4,
+	0x01fa5, 0x01fa6, 0x01fa7, 0x01f6a, 0x01f6c, 0x01f6e, 0x01fa8, 0x01f6b,
+	0x01f6d, 0x01f6f, 0x01fa9, 0x01faa, 0x01fab, 0x01fac, 0x01fad, 0x01fae,
+	0x01faf, 0x01fb2, 0x01fc2, 0x01ff2, 0x01fb7, 0x01fcd, 0x01fce, 0x01fcf,
+	0x01fc7, 0x01ff7, 0x01fdd, 0x01fde, 0x01fdf, 0x0219a, 0x0219b, 0x021ae,
+	0x021cd, 0x021cf, 0x021ce, 0x02204, 0x02209, 0x0220c, 0x02224, 0x02226,
+	0x02241, 0x02244, 0x02247, 0x02249, 0x0226d, 0x02262, 0x02270, 0x02271,
+	0x02274, 0x02275, 0x02278, 0x02279, 0x02280, 0x02281, 0x022e0, 0x022e1,
+	0x02284, 0x02285, 0x02288, 0x02289, 0x022e2, 0x022e3, 0x022ac, 0x022ad,
+	0x022ae, 0x022af, 0x022ea, 0x022eb, 0x022ec, 0x022ed, 0x03094, 0x0304c,
+	0x0304e, 0x03050, 0x03052, 0x03054, 0x03056, 0x03058, 0x0305a, 0x0305c,
+	0x0305e, 0x03060, 0x03062, 0x03065, 0x03067, 0x03069, 0x03070, 0x03071,
+	0x03073, 0x03074, 0x03076, 0x03077, 0x03079, 0x0307a, 0x0307c, 0x0307d,
+	0x0309e, 0x030f4, 0x030ac, 0x030ae, 0x030b0, 0x030b2, 0x030b4, 0x030b6,
+	0x030b8, 0x030ba, 0x030bc, 0x030be, 0x030c0, 0x030c2, 0x030c5, 0x030c7,
+	0x030c9, 0x030d0, 0x030d1, 0x030d3, 0x030d4, 0x030d6, 0x030d7, 0x030d9,
+	0x030da, 0x030dc, 0x030dd, 0x030f7, 0x030f8, 0x030f9, 0x030fa, 0x030fe,
+	0x1109a, 0x1109c, 0x110ab, 0x1112e, 0x1112f, 0x1134b, 0x1134c, 0x114bc,
+	0x114bb, 0x114be, 0x115ba, 0x115bb, 0x11938,
+};
+
+/* clang-format on */
+
+#endif /* SNORMTBL_H */
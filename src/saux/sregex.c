@@ -0,0 +1,1738 @@
+/*
+ * sregex.c
+ *
+ * Linear-time regular expressions (UTF-8).
+ *
+ * Copyright (c) 2015-2018 F. Aragon. All rights reserved.
+ * Released under the BSD 3-Clause License (see the doc/LICENSE)
+ *
+ * Pattern is parsed into a syntax tree, that is compiled twice into a
+ * byte-oriented NFA program (Unicode code point ranges are converted into
+ * UTF-8 byte range sequences): forward, with sub-match capture slots, and
+ * reverse (concatenations reversed), for locating the match start.
+ *
+ * DFA states are ordered lists of NFA threads (program counters), in
+ * priority order, so leftmost-first semantics is kept: when a thread
+ * reaches a match, lower priority threads are discarded.
+ */
+
+#include "sregex.h"
+#include "schar.h"
+#include "ssearch.h"
+
+#define SRE_MAX_REP 1000
+#define SRE_MAX_DEPTH 1000
+#define SRE_MAX_INST 32768
+#define SRE_MAX_PREFIX 255
+#define SRE_MAX_CP 0x10ffff
+#define SRE_ICASE_MAX_CP 0x1ffff /* no case mappings above this */
+#define SRE_NONE 0xffffffff
+#define SRE_FAIL (S_NPOS - 1)
+
+#define SRE_DFA_MAX_STATES 4096
+#define SRE_DFA_HT_SIZE (2 * SRE_DFA_MAX_STATES)
+#define SRE_DFA_MAX_MEM (1024 * 1024)
+#define SRE_DS_UNK -1
+#define SRE_DS_FULL -2
+#define SRE_DF_ISMATCH 1 /* match found on entering the state */
+#define SRE_DF_MATCHED 2 /* match already found (no new threads) */
+
+#define SRE_F_ICASE 1
+#define SRE_F_MULTILINE 2
+#define SRE_F_DOTALL 4
+
+enum SREOp { SRE_BYTE, SRE_SPLIT, SRE_JMP, SRE_SAVE, SRE_ASSERT, SRE_MATCH };
+
+enum SREAssert {
+	SRE_A_BEGIN,
+	SRE_A_END,
+	SRE_A_BOL,
+	SRE_A_EOL,
+	SRE_A_WORDB,
+	SRE_A_NWORDB
+};
+
+enum SRENodeType {
+	SRE_N_EMPTY,
+	SRE_N_CLASS,
+	SRE_N_CAT,
+	SRE_N_ALT,
+	SRE_N_REP,
+	SRE_N_GROUP,
+	SRE_N_ASSERT
+};
+
+/*
+ * SRE_BYTE: consume byte in [lo, hi], continue at x
+ * SRE_SPLIT: continue at x (higher priority) and y
+ * SRE_JMP: continue at x
+ * SRE_SAVE: store position in capture slot y, continue at x
+ * SRE_ASSERT: check assertion lo, continue at x
+ */
+struct SREInst {
+	unsigned char op, lo, hi;
+	uint32_t x, y;
+};
+
+struct SRERange {
+	uint32_t lo, hi;
+};
+
+struct SRENode {
+	unsigned char type, greedy, akind;
+	uint32_t child, next; /* first child, next sibling */
+	uint32_t r0, rn;      /* class ranges */
+	uint32_t min, max;    /* repetition (max SRE_NONE: unbounded) */
+	uint32_t group;
+};
+
+struct SREParser {
+	const char *p;
+	size_t ps, i, depth, ngroups;
+	unsigned flags;
+	struct SRENode *nodes;
+	size_t nn, nnmax;
+	struct SRERange *rg;
+	size_t nr, nrmax;
+	srt_bool error;
+};
+
+struct SREComp {
+	const struct SREParser *pa;
+	struct SREInst *prog;
+	size_t np, npmax;
+	srt_bool rev, error;
+};
+
+struct SREDState {
+	uint32_t off, n, h;
+	unsigned flags;
+};
+
+struct SREDfa {
+	const struct SREInst *prog;
+	srt_bool rev, full;
+	struct SREDState *st;
+	int32_t *tr, *ht;
+	size_t nst, stmax;
+	uint32_t *pool;
+	size_t pn, pmax, mem;
+	int32_t init[2]; /* start state: [0] not at begin, [1] at begin */
+};
+
+struct SREPStack {
+	uint32_t pc, slot;
+	size_t v;
+};
+
+struct SRegex {
+	struct SREInst *prog, *rprog;
+	size_t nprog, nrprog, ngroups, nslots;
+	srt_bool dfa_ok;
+	unsigned char bclass[256];
+	size_t nbclass;
+	char prefix[SRE_MAX_PREFIX];
+	size_t prefix_size;
+	struct SREDfa fwd, rev;
+	/* Work buffers */
+	uint32_t *mark, gen, *list, *stack;
+	size_t *m;
+	/* Pike VM buffers (allocated on first usage) */
+	uint32_t *tpcs;
+	size_t *tcaps, *cur, pike_slots;
+	struct SREPStack *pstack;
+};
+
+/*
+ * Parser
+ */
+
+static uint32_t sre_node(struct SREParser *pa, const enum SRENodeType type)
+{
+	size_t n;
+	struct SRENode *nodes;
+	if (pa->nn == pa->nnmax) {
+		n = pa->nnmax ? pa->nnmax * 2 : 32;
+		nodes = (struct SRENode *)s_realloc(
+			pa->nodes, n * sizeof(struct SRENode));
+		if (!nodes) {
+			pa->error = S_TRUE;
+			return SRE_NONE;
+		}
+		pa->nodes = nodes;
+		pa->nnmax = n;
+	}
+	memset(pa->nodes + pa->nn, 0, sizeof(struct SRENode));
+	pa->nodes[pa->nn].type = (unsigned char)type;
+	pa->nodes[pa->nn].child = pa->nodes[pa->nn].next = SRE_NONE;
+	return (uint32_t)pa->nn++;
+}
+
+static void sre_range(struct SREParser *pa, const uint32_t lo,
+		      const uint32_t hi)
+{
+	size_t n;
+	struct SRERange *rg;
+	if (pa->nr == pa->nrmax) {
+		n = pa->nrmax ? pa->nrmax * 2 : 32;
+		rg = (struct SRERange *)s_realloc(pa->rg,
+						  n * sizeof(struct SRERange));
+		if (!rg) {
+			pa->error = S_TRUE;
+			return;
+		}
+		pa->rg = rg;
+		pa->nrmax = n;
+	}
+	pa->rg[pa->nr].lo = lo;
+	pa->rg[pa->nr].hi = hi;
+	pa->nr++;
+}
+
+static int sre_range_cmp(const void *a, const void *b)
+{
+	const struct SRERange *ra = (const struct SRERange *)a,
+			      *rb = (const struct SRERange *)b;
+	return ra->lo < rb->lo ? -1 : ra->lo > rb->lo ? 1 : 0;
+}
+
+static void sre_case_variant(struct SREParser *pa, const size_t k,
+			     const int32_t c)
+{
+	const uint32_t u = (uint32_t)c;
+	if (c >= 0 && (u < pa->rg[k].lo || u > pa->rg[k].hi))
+		sre_range(pa, u, u);
+}
+
+/*
+ * Class ranges [r0, nr): add case variants, sort, merge, and complement
+ */
+static void sre_class_finish(struct SREParser *pa, const size_t r0,
+			     const srt_bool neg)
+{
+	int32_t l, u;
+	uint32_t c, hi, prev;
+	size_t i, j, n0 = pa->nr;
+	if (pa->flags & SRE_F_ICASE) {
+		for (i = r0; i < n0 && !pa->error; i++) {
+			hi = S_MIN(pa->rg[i].hi, SRE_ICASE_MAX_CP);
+			for (c = pa->rg[i].lo; c <= hi && !pa->error; c++) {
+				l = sc_tolower((int32_t)c);
+				u = sc_toupper((int32_t)c);
+				sre_case_variant(pa, i, l);
+				sre_case_variant(pa, i, u);
+				sre_case_variant(pa, i, sc_toupper(l));
+				sre_case_variant(pa, i, sc_tolower(u));
+			}
+		}
+	}
+	if (pa->error)
+		return;
+	if (pa->nr - r0 > 1)
+		qsort(pa->rg + r0, pa->nr - r0, sizeof(struct SRERange),
+		      sre_range_cmp);
+	for (i = r0, j = r0 + 1; j < pa->nr; j++) {
+		if (pa->rg[j].lo <= pa->rg[i].hi + 1) {
+			if (pa->rg[j].hi > pa->rg[i].hi)
+				pa->rg[i].hi = pa->rg[j].hi;
+		} else {
+			pa->rg[++i] = pa->rg[j];
+		}
+	}
+	if (pa->nr > r0)
+		pa->nr = i + 1;
+	if (neg) {
+		n0 = pa->nr;
+		for (prev = 0, i = r0; i < n0; i++) {
+			if (pa->rg[i].lo > prev)
+				sre_range(pa, prev, pa->rg[i].lo - 1);
+			prev = pa->rg[i].hi + 1;
+		}
+		if (prev <= SRE_MAX_CP)
+			sre_range(pa, prev, SRE_MAX_CP);
+		if (pa->error)
+		return;
+		memmove(pa->rg + r0, pa->rg + n0,
+			(pa->nr - n0) * sizeof(struct SRERange));
+		pa->nr = r0 + pa->nr - n0;
+	}
+}
+
+static void sre_class_esc(struct SREParser *pa, const char e)
+{
+	static const uint32_t d[] = {'0', '9'},
+			      w[] = {'0', '9', 'A', 'Z', '_', '_', 'a', 'z'},
+			      s[] = {9, 13, ' ', ' '};
+	const uint32_t *t;
+	uint32_t prev;
+	size_t i, n;
+	switch (e) {
+	case 'd':
+	case 'D':
+		t = d;
+		n = sizeof(d) / sizeof(d[0]);
+		break;
+	case 'w':
+	case 'W':
+		t = w;
+		n = sizeof(w) / sizeof(w[0]);
+		break;
+	default:
+		t = s;
+		n = sizeof(s) / sizeof(s[0]);
+		break;
+	}
+	if (e >= 'a') {
+		for (i = 0; i < n; i += 2)
+			sre_range(pa, t[i], t[i + 1]);
+	} else {
+		for (prev = 0, i = 0; i < n; i += 2) {
+			sre_range(pa, prev, t[i] - 1);
+			prev = t[i + 1] + 1;
+		}
+		sre_range(pa, prev, SRE_MAX_CP);
+	}
+}
+
+static srt_bool sre_is_class_esc(const char e)
+{
+	return e == 'd' || e == 'D' || e == 'w' || e == 'W' || e == 's'
+	       || e == 'S';
+}
+
+static int sre_hex(const char c)
+{
+	return c >= '0' && c <= '9'
+		       ? c - '0'
+		       : c >= 'a' && c <= 'f'
+				 ? c - 'a' + 10
+				 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+}
+
+/* Get code point, at p[i] (UTF-8) */
+static uint32_t sre_cp(struct SREParser *pa)
+{
+	int c = 0;
+	int32_t err = 0;
+	size_t l = sc_utf8_to_wc(pa->p, pa->i, pa->ps, &c, &err);
+	if (err || !l || c < 0 || c > SRE_MAX_CP) {
+		pa->error = S_TRUE; /* BEHAVIOR: invalid UTF-8 pattern */
+		return 0;
+	}
+	pa->i += l;
+	return (uint32_t)c;
+}
+
+/* Escaped character, after '\' */
+static uint32_t sre_esc_cp(struct SREParser *pa)
+{
+	int h;
+	uint32_t c = 0;
+	size_t n;
+	const char e = pa->p[pa->i];
+	switch (e) {
+	case 'n':
+		pa->i++;
+		return 10;
+	case 'r':
+		pa->i++;
+		return 13;
+	case 't':
+		pa->i++;
+		return 9;
+	case 'f':
+		pa->i++;
+		return 12;
+	case 'v':
+		pa->i++;
+		return 11;
+	case 'e':
+		pa->i++;
+		return 27;
+	case '0':
+		pa->i++;
+		return 0;
+	case 'x':
+		pa->i++;
+		if (pa->i < pa->ps && pa->p[pa->i] == '{') {
+			for (n = 0, pa->i++; pa->i < pa->ps; pa->i++, n++) {
+				if ((h = sre_hex(pa->p[pa->i])) < 0)
+					break;
+				c = (c << 4) | (uint32_t)h;
+			}
+			if (!n || n > 6 || c > SRE_MAX_CP || pa->i >= pa->ps
+			    || pa->p[pa->i] != '}')
+				pa->error = S_TRUE;
+			pa->i++;
+			return c;
+		}
+		for (n = 0; n < 2; n++, pa->i++) {
+			if (pa->i >= pa->ps
+			    || (h = sre_hex(pa->p[pa->i])) < 0) {
+				pa->error = S_TRUE;
+				return 0;
+			}
+			c = (c << 4) | (uint32_t)h;
+		}
+		return c;
+	default:
+		/* BEHAVIOR: unknown letter/digit escapes are not allowed */
+		if ((e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z')
+		    || (e >= '0' && e <= '9')) {
+			pa->error = S_TRUE;
+			return 0;
+		}
+		return sre_cp(pa);
+	}
+}
+
+/* Character inside a class */
+static uint32_t sre_class_cp(struct SREParser *pa)
+{
+	if (pa->p[pa->i] != '\\')
+		return sre_cp(pa);
+	pa->i++;
+	if (pa->i >= pa->ps) {
+		pa->error = S_TRUE;
+		return 0;
+	}
+	if (pa->p[pa->i] == 'b') { /* backspace */
+		pa->i++;
+		return 8;
+	}
+	return sre_esc_cp(pa);
+}
+
+static uint32_t sre_class_node(struct SREParser *pa, const size_t r0,
+			       const srt_bool neg)
+{
+	uint32_t n;
+	sre_class_finish(pa, r0, neg);
+	n = sre_node(pa, SRE_N_CLASS);
+	if (n != SRE_NONE) {
+		pa->nodes[n].r0 = (uint32_t)r0;
+		pa->nodes[n].rn = (uint32_t)(pa->nr - r0);
+	}
+	return n;
+}
+
+/* [...] */
+static uint32_t sre_parse_class(struct SREParser *pa)
+{
+	uint32_t lo, hi;
+	srt_bool neg = S_FALSE, first = S_TRUE;
+	const size_t r0 = pa->nr;
+	pa->i++;
+	if (pa->i < pa->ps && pa->p[pa->i] == '^') {
+		neg = S_TRUE;
+		pa->i++;
+	}
+	for (; !pa->error; first = S_FALSE) {
+		if (pa->i >= pa->ps) {
+			pa->error = S_TRUE; /* BEHAVIOR: missing ']' */
+			break;
+		}
+		if (pa->p[pa->i] == ']' && !first) {
+			pa->i++;
+			break;
+		}
+		if (pa->p[pa->i] == '\\' && pa->i + 1 < pa->ps
+		    && sre_is_class_esc(pa->p[pa->i + 1])) {
+			sre_class_esc(pa, pa->p[pa->i + 1]);
+			pa->i += 2;
+			continue;
+		}
+		lo = hi = sre_class_cp(pa);
+		if (pa->i + 1 < pa->ps && pa->p[pa->i] == '-'
+		    && pa->p[pa->i + 1] != ']') {
+			pa->i++;
+			hi = sre_class_cp(pa);
+			if (hi < lo)
+				pa->error = S_TRUE;
+		}
+		sre_range(pa, lo, hi);
+	}
+	return pa->error ? SRE_NONE : sre_class_node(pa, r0, neg);
+}
+
+static uint32_t sre_assert_node(struct SREParser *pa, const enum SREAssert a)
+{
+	const uint32_t n = sre_node(pa, SRE_N_ASSERT);
+	if (n != SRE_NONE)
+		pa->nodes[n].akind = (unsigned char)a;
+	return n;
+}
+
+/* "(?flags)" or "(?flags:", after "(?". Returns S_TRUE for the latter */
+static srt_bool sre_parse_flags(struct SREParser *pa)
+{
+	unsigned f;
+	srt_bool neg = S_FALSE;
+	for (; pa->i < pa->ps; pa->i++) {
+		switch (pa->p[pa->i]) {
+		case 'i':
+			f = SRE_F_ICASE;
+			break;
+		case 'm':
+			f = SRE_F_MULTILINE;
+			break;
+		case 's':
+			f = SRE_F_DOTALL;
+			break;
+		case '-':
+			neg = S_TRUE;
+			continue;
+		case ')':
+			pa->i++;
+			return S_FALSE;
+		case ':':
+			pa->i++;
+			return S_TRUE;
+		default:
+			pa->error = S_TRUE;
+			return S_FALSE;
+		}
+		pa->flags = neg ? pa->flags & ~f : pa->flags | f;
+	}
+	pa->error = S_TRUE;
+	return S_FALSE;
+}
+
+static uint32_t sre_parse_alt(struct SREParser *pa);
+
+static uint32_t sre_parse_group(struct SREParser *pa)
+{
+	uint32_t n, n0, g = SRE_NONE;
+	const unsigned flags0 = pa->flags;
+	pa->i++;
+	if (pa->i < pa->ps && pa->p[pa->i] == '?') {
+		pa->i++;
+		if (!sre_parse_flags(pa))
+			return SRE_NONE; /* "(?flags)": no node */
+	} else {
+		g = (uint32_t)++pa->ngroups;
+	}
+	if (++pa->depth > SRE_MAX_DEPTH) {
+		pa->error = S_TRUE;
+		return SRE_NONE;
+	}
+	n = sre_parse_alt(pa);
+	pa->depth--;
+	pa->flags = flags0;
+	if (pa->i >= pa->ps || pa->p[pa->i] != ')') {
+		pa->error = S_TRUE; /* BEHAVIOR: missing ')' */
+		return SRE_NONE;
+	}
+	pa->i++;
+	if (g != SRE_NONE && !pa->error) {
+		n0 = n;
+		n = sre_node(pa, SRE_N_GROUP);
+		if (n != SRE_NONE) {
+			pa->nodes[n].child = n0;
+			pa->nodes[n].group = g;
+		}
+	}
+	return n;
+}
+
+static uint32_t sre_parse_atom(struct SREParser *pa)
+{
+	char c = pa->p[pa->i];
+	size_t r0 = pa->nr;
+	switch (c) {
+	case '(':
+		return sre_parse_group(pa);
+	case '[':
+		return sre_parse_class(pa);
+	case '*':
+	case '+':
+	case '?':
+		pa->error = S_TRUE; /* BEHAVIOR: missing repetition argument */
+		return SRE_NONE;
+	case '.':
+		pa->i++;
+		if (pa->flags & SRE_F_DOTALL) {
+			sre_range(pa, 0, SRE_MAX_CP);
+		} else {
+			sre_range(pa, 0, 9);
+			sre_range(pa, 11, SRE_MAX_CP);
+		}
+		return sre_class_node(pa, r0, S_FALSE);
+	case '^':
+		pa->i++;
+		return sre_assert_node(pa, pa->flags & SRE_F_MULTILINE
+						   ? SRE_A_BOL
+						   : SRE_A_BEGIN);
+	case '$':
+		pa->i++;
+		return sre_assert_node(pa, pa->flags & SRE_F_MULTILINE
+						   ? SRE_A_EOL
+						   : SRE_A_END);
+	case '\\':
+		if (++pa->i >= pa->ps) {
+			pa->error = S_TRUE;
+			return SRE_NONE;
+		}
+		c = pa->p[pa->i];
+		if (sre_is_class_esc(c)) {
+			pa->i++;
+			sre_class_esc(pa, c);
+			return sre_class_node(pa, r0, S_FALSE);
+		}
+		switch (c) {
+		case 'b':
+			pa->i++;
+			return sre_assert_node(pa, SRE_A_WORDB);
+		case 'B':
+			pa->i++;
+			return sre_assert_node(pa, SRE_A_NWORDB);
+		case 'A':
+			pa->i++;
+			return sre_assert_node(pa, SRE_A_BEGIN);
+		case 'z':
+			pa->i++;
+			return sre_assert_node(pa, SRE_A_END);
+		default:
+			break;
+		}
+		sre_range(pa, sre_esc_cp(pa), 0);
+		break;
+	default:
+		sre_range(pa, sre_cp(pa), 0);
+		break;
+	}
+	RETURN_IF(pa->error, SRE_NONE);
+	pa->rg[r0].hi = pa->rg[r0].lo;
+	return sre_class_node(pa, r0, S_FALSE);
+}
+
+/* {n}, {n,}, {n,m}. Returns S_FALSE if not a valid count ('{' literal) */
+static srt_bool sre_parse_count(struct SREParser *pa, uint32_t *min,
+				uint32_t *max)
+{
+	size_t i = pa->i + 1, nd;
+	uint32_t v[2] = {0, 0};
+	int k;
+	for (k = 0; k < 2; k++) {
+		for (nd = 0; i < pa->ps && pa->p[i] >= '0' && pa->p[i] <= '9';
+		     i++, nd++)
+			if (v[k] <= SRE_MAX_REP)
+				v[k] = v[k] * 10 + (uint32_t)(pa->p[i] - '0');
+		if (i >= pa->ps || (!nd && !k))
+			return S_FALSE;
+		if (pa->p[i] == '}') {
+			*min = v[0];
+			*max = k == 0 ? v[0] : nd ? v[1] : SRE_NONE;
+			pa->i = i + 1;
+			if (*min > SRE_MAX_REP
+			    || (*max != SRE_NONE
+				&& (*max > SRE_MAX_REP || *max < *min)))
+				pa->error = S_TRUE;
+			return S_TRUE;
+		}
+		if (k || pa->p[i] != ',')
+			return S_FALSE;
+		i++;
+	}
+	return S_FALSE;
+}
+
+static uint32_t sre_parse_rep(struct SREParser *pa)
+{
+	uint32_t rep, min, max, n = sre_parse_atom(pa);
+	size_t nrep = 0;
+	while (n != SRE_NONE && !pa->error && pa->i < pa->ps) {
+		switch (pa->p[pa->i]) {
+		case '*':
+			min = 0;
+			max = SRE_NONE;
+			pa->i++;
+			break;
+		case '+':
+			min = 1;
+			max = SRE_NONE;
+			pa->i++;
+			break;
+		case '?':
+			min = 0;
+			max = 1;
+			pa->i++;
+			break;
+		case '{':
+			if (sre_parse_count(pa, &min, &max))
+				break;
+			return n;
+		default:
+			return n;
+		}
+		if (++nrep > SRE_MAX_DEPTH) { /* e.g. "a**...*" */
+			pa->error = S_TRUE;
+			return SRE_NONE;
+		}
+		rep = sre_node(pa, SRE_N_REP);
+		RETURN_IF(rep == SRE_NONE, SRE_NONE);
+		pa->nodes[rep].child = n;
+		pa->nodes[rep].min = min;
+		pa->nodes[rep].max = max;
+		pa->nodes[rep].greedy = 1;
+		if (pa->i < pa->ps && pa->p[pa->i] == '?') {
+			pa->nodes[rep].greedy = 0;
+			pa->i++;
+		}
+		n = rep;
+	}
+	return n;
+}
+
+static uint32_t sre_list_node(struct SREParser *pa,
+			      const enum SRENodeType type, const uint32_t first,
+			      const uint32_t last)
+{
+	uint32_t n;
+	if (first == SRE_NONE)
+		return sre_node(pa, SRE_N_EMPTY);
+	if (first == last)
+		return first;
+	n = sre_node(pa, type);
+	if (n != SRE_NONE)
+		pa->nodes[n].child = first;
+	return n;
+}
+
+static uint32_t sre_parse_cat(struct SREParser *pa)
+{
+	uint32_t n, first = SRE_NONE, last = SRE_NONE;
+	while (!pa->error && pa->i < pa->ps && pa->p[pa->i] != '|'
+	       && pa->p[pa->i] != ')') {
+		n = sre_parse_rep(pa);
+		if (n == SRE_NONE)
+			continue; /* e.g. "(?i)" */
+		if (first == SRE_NONE)
+			first = n;
+		else
+			pa->nodes[last].next = n;
+		last = n;
+	}
+	return pa->error ? SRE_NONE : sre_list_node(pa, SRE_N_CAT, first, last);
+}
+
+static uint32_t sre_parse_alt(struct SREParser *pa)
+{
+	uint32_t n, first, last;
+	first = last = sre_parse_cat(pa);
+	while (!pa->error && pa->i < pa->ps && pa->p[pa->i] == '|') {
+		pa->i++;
+		n = sre_parse_cat(pa);
+		if (n == SRE_NONE)
+			break;
+		pa->nodes[last].next = n;
+		last = n;
+	}
+	return pa->error ? SRE_NONE : sre_list_node(pa, SRE_N_ALT, first, last);
+}
+
+/*
+ * Compiler
+ */
+
+static uint32_t sre_emit(struct SREComp *c, const enum SREOp op,
+			 const unsigned lo, const unsigned hi,
+			 const uint32_t y)
+{
+	size_t n;
+	struct SREInst *prog;
+	RETURN_IF(c->error, 0);
+	if (c->np == c->npmax) {
+		n = c->npmax ? c->npmax * 2 : 64;
+		prog = n <= SRE_MAX_INST
+			       ? (struct SREInst *)s_realloc(
+					 c->prog, n * sizeof(struct SREInst))
+			       : NULL;
+		if (!prog) {
+			c->error = S_TRUE;
+			return 0;
+		}
+		c->prog = prog;
+		c->npmax = n;
+	}
+	c->prog[c->np].op = (unsigned char)op;
+	c->prog[c->np].lo = (unsigned char)lo;
+	c->prog[c->np].hi = (unsigned char)hi;
+	c->prog[c->np].x = (uint32_t)c->np + 1;
+	c->prog[c->np].y = y;
+	return (uint32_t)c->np++;
+}
+
+/* Patch chained x (list linked through x, ended with SRE_NONE) */
+static void sre_patch(struct SREComp *c, uint32_t l, const uint32_t pc)
+{
+	uint32_t next;
+	for (; l != SRE_NONE && !c->error; l = next) {
+		next = c->prog[l].x;
+		c->prog[l].x = pc;
+	}
+}
+
+
+/* Patch chained y (list linked through y, ended with SRE_NONE) */
+static void sre_patch_y(struct SREComp *c, uint32_t l, const uint32_t pc)
+{
+	uint32_t next;
+	for (; l != SRE_NONE && !c->error; l = next) {
+		next = c->prog[l].y;
+		c->prog[l].y = pc;
+	}
+}
+
+struct SRESeq {
+	unsigned char n, lo[4], hi[4];
+};
+
+struct SRESeqs {
+	struct SRESeq *s;
+	size_t n, nmax;
+	srt_bool error;
+};
+
+static void sre_seq_add(struct SRESeqs *q, const char *a, const char *b,
+			const size_t n)
+{
+	size_t m;
+	struct SRESeq *s;
+	if (n > sizeof(s->lo)) { /* not reachable: code points <= U+10FFFF */
+		q->error = S_TRUE;
+		return;
+	}
+	if (q->n == q->nmax) {
+		m = q->nmax ? q->nmax * 2 : 16;
+		s = (struct SRESeq *)s_realloc(q->s, m * sizeof(struct SRESeq));
+		if (!s) {
+			q->error = S_TRUE;
+			return;
+		}
+		q->s = s;
+		q->nmax = m;
+	}
+	s = q->s + q->n++;
+	s->n = (unsigned char)n;
+	memcpy(s->lo, a, n);
+	memcpy(s->hi, b, n);
+}
+
+/*
+ * Code point range to UTF-8 byte range sequences, e.g. [U+0080, U+07FF] is
+ * [C2-DF][80-BF]. Ranges are split until every byte position can be
+ * expressed as a range (same encoded size, and same prefix bits).
+ */
+static void sre_utf8_seq(struct SRESeqs *q, const uint32_t lo,
+			 const uint32_t hi)
+{
+	static const uint32_t lim[3] = {0x7f, 0x7ff, 0xffff};
+	char a[8], b[8];
+	size_t i, n;
+	uint32_t m;
+	if (lo > hi || q->error)
+		return;
+	if (lo <= 0xdfff && hi >= 0xd800) { /* skip UTF-16 surrogates */
+		if (lo < 0xd800)
+			sre_utf8_seq(q, lo, 0xd7ff);
+		if (hi > 0xdfff)
+			sre_utf8_seq(q, 0xe000, hi);
+		return;
+	}
+	for (i = 0; i < 3; i++)
+		if (lo <= lim[i] && hi > lim[i]) {
+			sre_utf8_seq(q, lo, lim[i]);
+			sre_utf8_seq(q, lim[i] + 1, hi);
+			return;
+		}
+	n = sc_wc_to_utf8((int32_t)hi, b, 0, sizeof(b));
+	for (i = 1; i < n; i++) {
+		m = (1U << (6 * i)) - 1;
+		if ((lo & ~m) != (hi & ~m)) {
+			if ((lo & m) != 0) {
+				sre_utf8_seq(q, lo, lo | m);
+				sre_utf8_seq(q, (lo | m) + 1, hi);
+				return;
+			}
+			if ((hi & m) != m) {
+				sre_utf8_seq(q, lo, (hi & ~m) - 1);
+				sre_utf8_seq(q, hi & ~m, hi);
+				return;
+			}
+		}
+	}
+	sc_wc_to_utf8((int32_t)lo, a, 0, sizeof(a));
+	sre_seq_add(q, a, b, n);
+}
+
+static void sre_emit_node(struct SREComp *c, const uint32_t node);
+
+/* Reverse program: text/line start and end assertions are swapped */
+static unsigned sre_rev_assert(const unsigned a)
+{
+	switch (a) {
+	case SRE_A_BEGIN:
+		return SRE_A_END;
+	case SRE_A_END:
+		return SRE_A_BEGIN;
+	case SRE_A_BOL:
+		return SRE_A_EOL;
+	case SRE_A_EOL:
+		return SRE_A_BOL;
+	default:
+		return a;
+	}
+}
+
+/* Class: SPLIT(seq1, SPLIT(seq2, ...)), with all sequences ending at the
+ * same instruction */
+static void sre_emit_class(struct SREComp *c, const struct SRENode *n)
+{
+	struct SRESeqs q;
+	size_t i, j, k;
+	uint32_t split = 0, pc = 0, chain = SRE_NONE;
+	const struct SRERange *rg = c->pa->rg + n->r0;
+	memset(&q, 0, sizeof(q));
+	for (i = 0; i < n->rn; i++)
+		sre_utf8_seq(&q, rg[i].lo, rg[i].hi);
+	if (q.error)
+		c->error = S_TRUE;
+	if (!q.n) /* empty class: never matches */
+		sre_emit(c, SRE_BYTE, 1, 0, 0);
+	for (i = 0; i < q.n && !c->error; i++) {
+		if (i + 1 < q.n)
+			split = sre_emit(c, SRE_SPLIT, 0, 0, 0);
+		for (j = 0; j < q.s[i].n; j++) {
+			k = c->rev ? q.s[i].n - 1 - j : j;
+			pc = sre_emit(c, SRE_BYTE, q.s[i].lo[k], q.s[i].hi[k],
+				      0);
+		}
+		if (c->error)
+			break;
+		c->prog[pc].x = chain;
+		chain = pc;
+		if (i + 1 < q.n)
+			c->prog[split].y = (uint32_t)c->np;
+	}
+	sre_patch(c, chain, (uint32_t)c->np);
+	s_free(q.s);
+}
+
+static srt_bool sre_nullable(const struct SRENode *nodes, const uint32_t node)
+{
+	const struct SRENode *n = nodes + node;
+	uint32_t k;
+	switch (n->type) {
+	case SRE_N_CLASS:
+		return S_FALSE;
+	case SRE_N_CAT:
+		for (k = n->child; k != SRE_NONE; k = nodes[k].next)
+			if (!sre_nullable(nodes, k))
+				return S_FALSE;
+		return S_TRUE;
+	case SRE_N_ALT:
+		for (k = n->child; k != SRE_NONE; k = nodes[k].next)
+			if (sre_nullable(nodes, k))
+				return S_TRUE;
+		return S_FALSE;
+	case SRE_N_GROUP:
+		return sre_nullable(nodes, n->child);
+	case SRE_N_REP:
+		return n->min == 0 || sre_nullable(nodes, n->child);
+	default: /* SRE_N_EMPTY, SRE_N_ASSERT */
+		return S_TRUE;
+	}
+}
+
+static void sre_emit_rep(struct SREComp *c, const struct SRENode *n)
+{
+	uint32_t i, l, pc, opt = SRE_NONE, chain = SRE_NONE;
+	if (n->max == SRE_NONE) {
+		/*
+		 * BEHAVIOR: x* being x nullable is compiled as (x+)?, so an
+		 * empty iteration ends the loop, as in backtracking engines
+		 * (e.g. "(a|)*" matches "" instead of "aa", like Perl/PCRE)
+		 */
+		if (n->min == 0 && sre_nullable(c->pa->nodes, n->child))
+			opt = sre_emit(c, SRE_SPLIT, 0, 0, 0);
+		for (i = 1; i < n->min; i++)
+			sre_emit_node(c, n->child);
+		if (n->min > 0 || opt != SRE_NONE) { /* L: x; SPLIT(L, next) */
+			l = (uint32_t)c->np;
+			sre_emit_node(c, n->child);
+			pc = sre_emit(c, SRE_SPLIT, 0, 0, l);
+			if (!c->error && n->greedy) {
+				c->prog[pc].x = l;
+				c->prog[pc].y = pc + 1;
+			}
+			if (!c->error && opt != SRE_NONE) {
+				c->prog[opt].x = n->greedy ? opt + 1 : pc + 1;
+				c->prog[opt].y = n->greedy ? pc + 1 : opt + 1;
+			}
+		} else { /* L: SPLIT(L + 1, next); x; JMP L */
+			l = sre_emit(c, SRE_SPLIT, 0, 0, 0);
+			sre_emit_node(c, n->child);
+			pc = sre_emit(c, SRE_JMP, 0, 0, 0);
+			if (c->error)
+				return;
+			c->prog[pc].x = l;
+			c->prog[l].y = (uint32_t)c->np;
+			if (!n->greedy) {
+				c->prog[l].x = (uint32_t)c->np;
+				c->prog[l].y = l + 1;
+			}
+		}
+		return;
+	}
+	for (i = 0; i < n->min; i++)
+		sre_emit_node(c, n->child);
+	/* x{0,k}: SPLIT(x, end) x SPLIT(x, end) x ... end */
+	for (; i < n->max && !c->error; i++) {
+		pc = sre_emit(c, SRE_SPLIT, 0, 0, chain);
+		sre_emit_node(c, n->child);
+		chain = pc;
+	}
+	if (n->greedy) {
+		sre_patch_y(c, chain, (uint32_t)c->np);
+		return;
+	}
+	for (pc = chain; pc != SRE_NONE && !c->error; pc = chain) {
+		chain = c->prog[pc].y;
+		c->prog[pc].y = c->prog[pc].x;
+		c->prog[pc].x = (uint32_t)c->np;
+	}
+}
+
+static void sre_emit_node(struct SREComp *c, const uint32_t node)
+{
+	const struct SRENode *nodes = c->pa->nodes, *n = nodes + node;
+	uint32_t k, pc, split, chain = SRE_NONE, *ch;
+	size_t i, nch;
+	unsigned a;
+	if (c->error)
+		return;
+	switch (n->type) {
+	case SRE_N_CLASS:
+		sre_emit_class(c, n);
+		break;
+	case SRE_N_CAT:
+		if (!c->rev) {
+			for (k = n->child; k != SRE_NONE; k = nodes[k].next)
+				sre_emit_node(c, k);
+			break;
+		}
+		for (nch = 0, k = n->child; k != SRE_NONE; k = nodes[k].next)
+			nch++;
+		ch = (uint32_t *)s_malloc(nch * sizeof(uint32_t));
+		if (!ch) {
+			c->error = S_TRUE;
+			break;
+		}
+		for (i = 0, k = n->child; k != SRE_NONE; k = nodes[k].next)
+			ch[i++] = k;
+		while (i-- > 0)
+			sre_emit_node(c, ch[i]);
+		s_free(ch);
+		break;
+	case SRE_N_ALT: /* SPLIT(x1, SPLIT(x2, ...)) */
+		for (k = n->child; k != SRE_NONE && !c->error;
+		     k = nodes[k].next) {
+			if (nodes[k].next == SRE_NONE) {
+				sre_emit_node(c, k);
+				break;
+			}
+			split = sre_emit(c, SRE_SPLIT, 0, 0, 0);
+			sre_emit_node(c, k);
+			pc = sre_emit(c, SRE_JMP, 0, 0, 0);
+			if (c->error)
+				break;
+			c->prog[pc].x = chain;
+			chain = pc;
+			c->prog[split].y = (uint32_t)c->np;
+		}
+		sre_patch(c, chain, (uint32_t)c->np);
+		break;
+	case SRE_N_GROUP:
+		if (!c->rev)
+			sre_emit(c, SRE_SAVE, 0, 0, 2 * n->group);
+		sre_emit_node(c, n->child);
+		if (!c->rev)
+			sre_emit(c, SRE_SAVE, 0, 0, 2 * n->group + 1);
+		break;
+	case SRE_N_ASSERT:
+		a = c->rev ? sre_rev_assert(n->akind) : n->akind;
+		sre_emit(c, SRE_ASSERT, a, 0, 0);
+		break;
+	case SRE_N_REP:
+		sre_emit_rep(c, n);
+		break;
+	default: /* SRE_N_EMPTY */
+		break;
+	}
+}
+
+/*
+ * Work buffers
+ */
+
+static void sre_newgen(struct SRegex *r)
+{
+	if (++r->gen == 0) {
+		memset(r->mark, 0,
+		       S_MAX(r->nprog, r->nrprog) * sizeof(uint32_t));
+		r->gen = 1;
+	}
+}
+
+static srt_bool sre_pike_alloc(struct SRegex *r, const size_t nslots)
+{
+	RETURN_IF(r->pike_slots >= nslots, S_TRUE);
+	s_free(r->tcaps);
+	s_free(r->cur);
+	r->pike_slots = 0;
+	if (!r->tpcs) {
+		r->tpcs = (uint32_t *)s_malloc(2 * r->nprog * sizeof(uint32_t));
+		r->pstack = (struct SREPStack *)s_malloc(
+			(r->nprog + 1) * sizeof(struct SREPStack));
+	}
+	r->tcaps = (size_t *)s_malloc(2 * r->nprog * nslots * sizeof(size_t));
+	r->cur = (size_t *)s_malloc(nslots * sizeof(size_t));
+	RETURN_IF(!r->tpcs || !r->pstack || !r->tcaps || !r->cur, S_FALSE);
+	r->pike_slots = nslots;
+	return S_TRUE;
+}
+
+static size_t sre_prefilter(const struct SRegex *r, const char *s,
+			    const size_t ss, const size_t off)
+{
+	return off + r->prefix_size <= ss
+		       ? ss_find_csum_fast(s, off, ss, r->prefix,
+					   r->prefix_size)
+		       : S_NPOS;
+}
+
+/*
+ * Lazy DFA
+ */
+
+static srt_bool sre_dfa_reset(struct SREDfa *d)
+{
+	size_t i;
+	if (!d->ht) {
+		d->ht = (int32_t *)s_malloc(SRE_DFA_HT_SIZE * sizeof(int32_t));
+		RETURN_IF(!d->ht, S_FALSE);
+	}
+	for (i = 0; i < SRE_DFA_HT_SIZE; i++)
+		d->ht[i] = -1;
+	d->nst = d->pn = d->mem = 0;
+	d->full = S_FALSE;
+	d->init[0] = d->init[1] = SRE_DS_UNK;
+	return S_TRUE;
+}
+
+static int32_t sre_dfa_add(const struct SRegex *r, struct SREDfa *d,
+			   const uint32_t *list, const size_t n,
+			   const unsigned flags)
+{
+	size_t i, k, m, cost;
+	uint32_t h = flags + 1;
+	struct SREDState *st;
+	int32_t *tr;
+	uint32_t *pool;
+	for (i = 0; i < n; i++)
+		h = (h ^ list[i]) * 0x01000193;
+	for (k = h & (SRE_DFA_HT_SIZE - 1); d->ht[k] >= 0;
+	     k = (k + 1) & (SRE_DFA_HT_SIZE - 1)) {
+		st = d->st + d->ht[k];
+		if (st->h == h && st->flags == flags && st->n == n
+		    && (!n
+			|| !memcmp(d->pool + st->off, list,
+				   n * sizeof(uint32_t))))
+			return d->ht[k];
+	}
+	cost = sizeof(struct SREDState) + r->nbclass * sizeof(int32_t)
+	       + n * sizeof(uint32_t);
+	if (d->nst >= SRE_DFA_MAX_STATES || d->mem + cost > SRE_DFA_MAX_MEM)
+		d->full = S_TRUE;
+	if (!d->full && d->nst == d->stmax) {
+		m = d->stmax ? d->stmax * 2 : 16;
+		st = (struct SREDState *)s_realloc(
+			d->st, m * sizeof(struct SREDState));
+		if (st)
+			d->st = st;
+		tr = st ? (int32_t *)s_realloc(d->tr, m * r->nbclass
+							      * sizeof(int32_t))
+			: NULL;
+		if (tr) {
+			d->tr = tr;
+			d->stmax = m;
+		} else {
+			d->full = S_TRUE; /* BEHAVIOR: out of memory */
+		}
+	}
+	if (!d->full && d->pn + n > d->pmax) {
+		m = S_MAX(S_MAX(d->pmax * 2, d->pn + n), 64);
+		pool = (uint32_t *)s_realloc(d->pool, m * sizeof(uint32_t));
+		if (pool) {
+			d->pool = pool;
+			d->pmax = m;
+		} else {
+			d->full = S_TRUE;
+		}
+	}
+	RETURN_IF(d->full, SRE_DS_FULL);
+	if (n)
+		memcpy(d->pool + d->pn, list, n * sizeof(uint32_t));
+	st = d->st + d->nst;
+	st->off = (uint32_t)d->pn;
+	st->n = (uint32_t)n;
+	st->h = h;
+	st->flags = flags;
+	d->pn += n;
+	d->mem += cost;
+	tr = d->tr + d->nst * r->nbclass;
+	for (i = 0; i < r->nbclass; i++)
+		tr[i] = SRE_DS_UNK;
+	d->ht[k] = (int32_t)d->nst;
+	return (int32_t)d->nst++;
+}
+
+/*
+ * Epsilon closure, appending threads to the list in priority order. Only
+ * threads consuming input and pending "end" assertions are kept. Returns
+ * S_TRUE if a match is reached (leftmost-first: lower priority threads
+ * are discarded).
+ */
+static srt_bool sre_dfa_closure(struct SRegex *r, const struct SREDfa *d,
+				uint32_t pc, const srt_bool at_begin,
+				const srt_bool at_end, uint32_t *list,
+				size_t *n)
+{
+	const struct SREInst *in;
+	srt_bool m = S_FALSE;
+	size_t sp = 0;
+	r->stack[sp++] = pc;
+	while (sp > 0) {
+		pc = r->stack[--sp];
+		for (;;) {
+			if (r->mark[pc] == r->gen)
+				break;
+			r->mark[pc] = r->gen;
+			in = d->prog + pc;
+			if (in->op == SRE_SPLIT) {
+				r->stack[sp++] = in->y;
+				pc = in->x;
+				continue;
+			}
+			if (in->op == SRE_JMP || in->op == SRE_SAVE) {
+				pc = in->x;
+				continue;
+			}
+			if (in->op == SRE_ASSERT) {
+				if ((in->lo == SRE_A_BEGIN && at_begin)
+				    || (in->lo == SRE_A_END && at_end)) {
+					pc = in->x;
+					continue;
+				}
+				if (in->lo == SRE_A_END)
+					list[(*n)++] = pc;
+				break;
+			}
+			if (in->op == SRE_MATCH) {
+				RETURN_IF(!d->rev, S_TRUE);
+				m = S_TRUE;
+				break;
+			}
+			list[(*n)++] = pc; /* SRE_BYTE */
+			break;
+		}
+	}
+	return m;
+}
+
+static int32_t sre_dfa_init(struct SRegex *r, struct SREDfa *d,
+			    const srt_bool at_begin)
+{
+	size_t n = 0;
+	int32_t si = d->init[at_begin ? 1 : 0];
+	unsigned f = 0;
+	if (si == SRE_DS_UNK) {
+		sre_newgen(r);
+		if (sre_dfa_closure(r, d, 0, at_begin, S_FALSE, r->list, &n))
+			f = d->rev ? SRE_DF_ISMATCH
+				   : SRE_DF_ISMATCH | SRE_DF_MATCHED;
+		si = sre_dfa_add(r, d, r->list, n, f);
+		if (si >= 0)
+			d->init[at_begin ? 1 : 0] = si;
+	}
+	return si;
+}
+
+static int32_t sre_dfa_step(struct SRegex *r, struct SREDfa *d,
+			    const int32_t si, const unsigned b)
+{
+	const struct SREInst *in;
+	const uint32_t off = d->st[si].off, sn = d->st[si].n;
+	unsigned f = d->st[si].flags & SRE_DF_MATCHED;
+	srt_bool m = S_FALSE;
+	size_t k, n = 0;
+	sre_newgen(r);
+	for (k = 0; k < sn; k++) {
+		in = d->prog + d->pool[off + k];
+		if (in->op == SRE_BYTE && b >= in->lo && b <= in->hi
+		    && sre_dfa_closure(r, d, in->x, S_FALSE, S_FALSE, r->list,
+				       &n)) {
+			m = S_TRUE;
+			if (!d->rev)
+				break;
+		}
+	}
+	/* Unanchored search: new thread, with the lowest priority */
+	if (!d->rev && !f && !m
+	    && sre_dfa_closure(r, d, 0, S_FALSE, S_FALSE, r->list, &n))
+		m = S_TRUE;
+	if (m)
+		f |= d->rev ? SRE_DF_ISMATCH : SRE_DF_ISMATCH | SRE_DF_MATCHED;
+	return sre_dfa_add(r, d, r->list, n, f);
+}
+
+/* Match at the end of the input: pending "end" assertions */
+static srt_bool sre_dfa_eot(struct SRegex *r, const struct SREDfa *d,
+			    const int32_t si, const srt_bool at_begin)
+{
+	const struct SREInst *in;
+	const uint32_t off = d->st[si].off, sn = d->st[si].n;
+	size_t k, n = 0;
+	sre_newgen(r);
+	for (k = 0; k < sn; k++) {
+		in = d->prog + d->pool[off + k];
+		if (in->op == SRE_ASSERT
+		    && sre_dfa_closure(r, d, in->x, at_begin, S_TRUE, r->list,
+				       &n))
+			return S_TRUE;
+	}
+	return S_FALSE;
+}
+
+S_INLINE int32_t sre_dfa_next(struct SRegex *r, struct SREDfa *d,
+			      const int32_t si, const unsigned char b)
+{
+	int32_t *t = d->tr + (size_t)si * r->nbclass + r->bclass[b];
+	if (*t == SRE_DS_UNK) {
+		const int32_t ni = sre_dfa_step(r, d, si, b);
+		/* d->tr could be reallocated */
+		RETURN_IF(ni < 0, ni);
+		t = d->tr + (size_t)si * r->nbclass + r->bclass[b];
+		*t = ni;
+	}
+	return *t;
+}
+
+/* Forward search: end of the leftmost-first match */
+static size_t sre_dfa_fwd(struct SRegex *r, const char *s, const size_t ss,
+			  size_t pos)
+{
+	struct SREDfa *d = &r->fwd;
+	const unsigned char *u = (const unsigned char *)s;
+	size_t e = S_NPOS;
+	int32_t si, init1;
+	RETURN_IF((!d->ht || d->full) && !sre_dfa_reset(d), SRE_FAIL);
+	if (r->prefix_size) {
+		pos = sre_prefilter(r, s, ss, pos);
+		RETURN_IF(pos == S_NPOS, S_NPOS);
+	}
+	init1 = sre_dfa_init(r, d, S_FALSE);
+	si = pos ? init1 : sre_dfa_init(r, d, S_TRUE);
+	RETURN_IF(si < 0 || init1 < 0, SRE_FAIL);
+	if (d->st[si].flags & SRE_DF_ISMATCH)
+		e = pos;
+	for (; pos < ss; pos++) {
+		if (!d->st[si].n
+		    && ((d->st[si].flags & SRE_DF_MATCHED) || !d->st[init1].n))
+			return e; /* no threads left */
+		if (si == init1 && r->prefix_size) {
+			/* No threads in progress: skip to next candidate */
+			pos = sre_prefilter(r, s, ss, pos);
+			RETURN_IF(pos == S_NPOS, S_NPOS);
+		}
+		si = sre_dfa_next(r, d, si, u[pos]);
+		RETURN_IF(si < 0, SRE_FAIL);
+		if (d->st[si].flags & SRE_DF_ISMATCH)
+			e = pos + 1;
+	}
+	if (d->st[si].n && sre_dfa_eot(r, d, si, ss == 0))
+		e = ss;
+	return e;
+}
+
+/* Reverse search, from the match end: start of the longest match */
+static size_t sre_dfa_rev(struct SRegex *r, const char *s, const size_t ss,
+			  const size_t off, size_t pos)
+{
+	struct SREDfa *d = &r->rev;
+	const unsigned char *u = (const unsigned char *)s;
+	size_t b = S_NPOS;
+	int32_t si;
+	RETURN_IF((!d->ht || d->full) && !sre_dfa_reset(d), SRE_FAIL);
+	si = sre_dfa_init(r, d, pos == ss);
+	RETURN_IF(si < 0, SRE_FAIL);
+	if (d->st[si].flags & SRE_DF_ISMATCH)
+		b = pos;
+	for (; pos > off && d->st[si].n; pos--) {
+		si = sre_dfa_next(r, d, si, u[pos - 1]);
+		RETURN_IF(si < 0, SRE_FAIL);
+		if (d->st[si].flags & SRE_DF_ISMATCH)
+			b = pos - 1;
+	}
+	if (!pos && d->st[si].n && sre_dfa_eot(r, d, si, ss == 0))
+		b = 0;
+	return b;
+}
+
+/*
+ * NFA simulation (Pike VM), with sub-match captures
+ */
+
+static srt_bool sre_isw(const unsigned char c)
+{
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')
+	       || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static srt_bool sre_assert(const unsigned a, const char *s, const size_t ss,
+			   const size_t pos)
+{
+	srt_bool w0, w1;
+	switch (a) {
+	case SRE_A_BEGIN:
+		return pos == 0;
+	case SRE_A_END:
+		return pos == ss;
+	case SRE_A_BOL:
+		return pos == 0 || s[pos - 1] == '\n';
+	case SRE_A_EOL:
+		return pos == ss || s[pos] == '\n';
+	default:
+		w0 = pos > 0 && sre_isw((unsigned char)s[pos - 1]);
+		w1 = pos < ss && sre_isw((unsigned char)s[pos]);
+		if (a == SRE_A_WORDB)
+			return w0 != w1;
+		/* BEHAVIOR: \B does not match inside a UTF-8 sequence */
+		return w0 == w1
+		       && (pos == ss || ((unsigned char)s[pos] & 0xc0) != 0x80);
+	}
+}
+
+static void sre_pike_add(struct SRegex *r, uint32_t *pcs, size_t *caps,
+			 size_t *n, uint32_t pc, const char *s,
+			 const size_t ss, const size_t pos,
+			 const size_t nslots)
+{
+	const struct SREInst *in;
+	struct SREPStack *stk = r->pstack;
+	size_t sp = 0, *cur = r->cur;
+	stk[sp].pc = pc;
+	stk[sp++].slot = SRE_NONE;
+	while (sp > 0) {
+		sp--;
+		if (stk[sp].slot != SRE_NONE) { /* restore capture */
+			cur[stk[sp].slot] = stk[sp].v;
+			continue;
+		}
+		pc = stk[sp].pc;
+		for (;;) {
+			if (r->mark[pc] == r->gen)
+				break;
+			r->mark[pc] = r->gen;
+			in = r->prog + pc;
+			if (in->op == SRE_SPLIT) {
+				stk[sp].pc = in->y;
+				stk[sp++].slot = SRE_NONE;
+				pc = in->x;
+				continue;
+			}
+			if (in->op == SRE_JMP) {
+				pc = in->x;
+				continue;
+			}
+			if (in->op == SRE_SAVE) {
+				if (in->y < nslots) {
+					stk[sp].slot = in->y;
+					stk[sp++].v = cur[in->y];
+					cur[in->y] = pos;
+				}
+				pc = in->x;
+				continue;
+			}
+			if (in->op == SRE_ASSERT) {
+				if (sre_assert(in->lo, s, ss, pos)) {
+					pc = in->x;
+					continue;
+				}
+				break;
+			}
+			pcs[*n] = pc; /* SRE_BYTE, SRE_MATCH */
+			memcpy(caps + *n * nslots, cur,
+			       nslots * sizeof(size_t));
+			(*n)++;
+			break;
+		}
+	}
+}
+
+/*
+ * "nonempty": empty matches are skipped (lower priority threads go on),
+ * i.e. the leftmost match consuming at least one byte
+ */
+static size_t sre_pike(struct SRegex *r, const char *s, const size_t ss,
+		       size_t pos, const size_t lim, const srt_bool anchored,
+		       const srt_bool nonempty, const size_t nslots)
+{
+	const struct SREInst *in;
+	const unsigned char *u = (const unsigned char *)s;
+	uint32_t *cp, *np, *tp;
+	size_t *cc, *nc, *tc, cn = 0, nn, k;
+	srt_bool matched = S_FALSE, start = S_TRUE;
+	RETURN_IF(!sre_pike_alloc(r, nslots), S_NPOS); /* BEHAVIOR: OOM */
+	cp = r->tpcs;
+	np = cp + r->nprog;
+	cc = r->tcaps;
+	nc = cc + r->nprog * nslots;
+	sre_newgen(r);
+	for (;;) {
+		if (!matched && (start || !anchored)) {
+			start = S_FALSE;
+			if (!cn && !anchored && r->prefix_size) {
+				pos = sre_prefilter(r, s, ss, pos);
+				if (pos == S_NPOS)
+					break;
+			}
+			for (k = 0; k < nslots; k++)
+				r->cur[k] = S_NPOS;
+			sre_pike_add(r, cp, cc, &cn, 0, s, ss, pos, nslots);
+		}
+		if (!cn && (matched || anchored))
+			break;
+		sre_newgen(r);
+		for (nn = 0, k = 0; k < cn; k++) {
+			in = r->prog + cp[k];
+			if (in->op == SRE_MATCH) {
+				if (nonempty && cc[k * nslots] == pos)
+					continue;
+				/* Lower priority threads are discarded */
+				memcpy(r->m, cc + k * nslots,
+				       nslots * sizeof(size_t));
+				matched = S_TRUE;
+				break;
+			}
+			if (pos < lim && u[pos] >= in->lo && u[pos] <= in->hi) {
+				memcpy(r->cur, cc + k * nslots,
+				       nslots * sizeof(size_t));
+				sre_pike_add(r, np, nc, &nn, in->x, s, ss,
+					     pos + 1, nslots);
+			}
+		}
+		if (pos >= lim)
+			break;
+		pos++;
+		tp = cp;
+		cp = np;
+		np = tp;
+		tc = cc;
+		cc = nc;
+		nc = tc;
+		cn = nn;
+	}
+	return matched ? r->m[0] : S_NPOS;
+}
+
+/*
+ * Compilation
+ */
+
+static void sre_set_prefix(struct SRegex *r, const struct SREParser *pa,
+			   const uint32_t root)
+{
+	size_t l;
+	uint32_t k, c;
+	const struct SRENode *n;
+	k = pa->nodes[root].type == SRE_N_CAT ? pa->nodes[root].child : root;
+	for (; k != SRE_NONE; k = n->next) {
+		n = pa->nodes + k;
+		if (n->type == SRE_N_ASSERT) /* zero-width */
+			continue;
+		if (n->type != SRE_N_CLASS || n->rn != 1
+		    || pa->rg[n->r0].lo != pa->rg[n->r0].hi)
+			break;
+		c = pa->rg[n->r0].lo;
+		l = sc_wc_to_utf8_size((int32_t)c);
+		if (r->prefix_size + l > SRE_MAX_PREFIX)
+			break;
+		sc_wc_to_utf8((int32_t)c, r->prefix, r->prefix_size,
+			      SRE_MAX_PREFIX);
+		r->prefix_size += l;
+	}
+}
+
+static srt_bool sre_init(struct SRegex *r, const struct SREParser *pa,
+			 const uint32_t root)
+{
+	size_t i, n;
+	unsigned char bnd[257];
+	const struct SREInst *in;
+	r->ngroups = pa->ngroups;
+	r->nslots = 2 * (r->ngroups + 1);
+	r->fwd.prog = r->prog;
+	r->rev.prog = r->rprog;
+	r->rev.rev = S_TRUE;
+	/* The DFA supports text start/end assertions, only */
+	memset(bnd, 0, sizeof(bnd));
+	r->dfa_ok = S_TRUE;
+	for (i = 0; i < r->nprog; i++) {
+		in = r->prog + i;
+		if (in->op == SRE_ASSERT && in->lo != SRE_A_BEGIN
+		    && in->lo != SRE_A_END)
+			r->dfa_ok = S_FALSE;
+		if (in->op == SRE_BYTE && in->lo <= in->hi)
+			bnd[in->lo] = bnd[in->hi + 1] = 1;
+	}
+	/* Byte classes: bytes not distinguished by the program */
+	for (r->nbclass = 0, i = 0; i < 256; i++) {
+		if (i > 0 && bnd[i])
+			r->nbclass++;
+		r->bclass[i] = (unsigned char)r->nbclass;
+	}
+	r->nbclass++;
+	sre_set_prefix(r, pa, root);
+	n = S_MAX(r->nprog, r->nrprog);
+	r->mark = (uint32_t *)s_calloc(n, sizeof(uint32_t));
+	r->list = (uint32_t *)s_malloc(n * sizeof(uint32_t));
+	r->stack = (uint32_t *)s_malloc((n + 1) * sizeof(uint32_t));
+	r->m = (size_t *)s_malloc(r->nslots * sizeof(size_t));
+	return r->mark && r->list && r->stack && r->m ? S_TRUE : S_FALSE;
+}
+
+struct SRegex *sre_compile(const char *p, const size_t ps)
+{
+	uint32_t root;
+	struct SREParser pa;
+	struct SREComp c, rc;
+	struct SRegex *r = NULL;
+	RETURN_IF(!p && ps, NULL);
+	memset(&pa, 0, sizeof(pa));
+	memset(&c, 0, sizeof(c));
+	memset(&rc, 0, sizeof(rc));
+	pa.p = p;
+	pa.ps = ps;
+	root = sre_parse_alt(&pa);
+	if (!pa.error && pa.i < ps)
+		pa.error = S_TRUE; /* BEHAVIOR: unbalanced ')' */
+	if (!pa.error) {
+		c.pa = rc.pa = &pa;
+		rc.rev = S_TRUE;
+		sre_emit(&c, SRE_SAVE, 0, 0, 0);
+		sre_emit_node(&c, root);
+		sre_emit(&c, SRE_SAVE, 0, 0, 1);
+		sre_emit(&c, SRE_MATCH, 0, 0, 0);
+		sre_emit_node(&rc, root);
+		sre_emit(&rc, SRE_MATCH, 0, 0, 0);
+		if (!c.error && !rc.error)
+			r = (struct SRegex *)s_calloc(1, sizeof(struct SRegex));
+	}
+	if (r) {
+		r->prog = c.prog;
+		r->nprog = c.np;
+		r->rprog = rc.prog;
+		r->nrprog = rc.np;
+		c.prog = rc.prog = NULL;
+		if (!sre_init(r, &pa, root)) {
+			sre_free(r);
+			r = NULL;
+		}
+	}
+	s_free(c.prog);
+	s_free(rc.prog);
+	s_free(pa.nodes);
+	s_free(pa.rg);
+	return r;
+}
+
+static void sre_dfa_free(struct SREDfa *d)
+{
+	s_free(d->st);
+	s_free(d->tr);
+	s_free(d->ht);
+	s_free(d->pool);
+}
+
+void sre_free(struct SRegex *r)
+{
+	if (r) {
+		s_free(r->prog);
+		s_free(r->rprog);
+		sre_dfa_free(&r->fwd);
+		sre_dfa_free(&r->rev);
+		s_free(r->mark);
+		s_free(r->list);
+		s_free(r->stack);
+		s_free(r->m);
+		s_free(r->tpcs);
+		s_free(r->tcaps);
+		s_free(r->cur);
+		s_free(r->pstack);
+		s_free(r);
+	}
+}
+
+size_t sre_ngroups(const struct SRegex *r)
+{
+	return r ? r->ngroups : 0;
+}
+
+/*
+ * Search
+ */
+
+size_t sre_search(struct SRegex *r, const char *s, const size_t ss,
+		  const size_t off, const size_t ncaps)
+{
+	size_t i, b, e, nslots;
+	RETURN_IF(!r || (!s && ss) || off > ss, S_NPOS);
+	nslots = 2 * S_MIN(S_MAX(ncaps, 1), r->ngroups + 1);
+	for (i = 0; i < r->nslots; i++)
+		r->m[i] = S_NPOS;
+	if (r->dfa_ok) {
+		e = sre_dfa_fwd(r, s, ss, off);
+		RETURN_IF(e == S_NPOS, S_NPOS);
+		b = e != SRE_FAIL ? sre_dfa_rev(r, s, ss, off, e) : SRE_FAIL;
+		if (b != SRE_FAIL && b != S_NPOS) {
+			if (nslots == 2) {
+				r->m[0] = b;
+				r->m[1] = e;
+				return b;
+			}
+			/* Captures: NFA simulation for the matched area */
+			return sre_pike(r, s, ss, b, e, S_TRUE, S_FALSE,
+					nslots);
+		}
+	}
+	/* BEHAVIOR: DFA cache full or not supported: NFA simulation */
+	return sre_pike(r, s, ss, off, ss, S_FALSE, S_FALSE, nslots);
+}
+
+size_t sre_search_nonempty(struct SRegex *r, const char *s, const size_t ss,
+			   const size_t off, const size_t ncaps)
+{
+	size_t i, nslots;
+	RETURN_IF(!r || (!s && ss) || off >= ss, S_NPOS);
+	nslots = 2 * S_MIN(S_MAX(ncaps, 1), r->ngroups + 1);
+	for (i = 0; i < r->nslots; i++)
+		r->m[i] = S_NPOS;
+	return sre_pike(r, s, ss, off, ss, S_FALSE, S_TRUE, nslots);
+}
+
+const size_t *sre_caps(const struct SRegex *r)
+{
+	return r ? r->m : NULL;
+}
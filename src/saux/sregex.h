@@ -0,0 +1,73 @@
+#ifndef SREGEX_H
+#define SREGEX_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * sregex.h
+ *
+ * Linear-time regular expressions (UTF-8).
+ *
+ * Copyright (c) 2015-2018 F. Aragon. All rights reserved.
+ * Released under the BSD 3-Clause License (see the doc/LICENSE)
+ *
+ * Designed to be used by libraries or wrapped by some abstraction (e.g.
+ * srt_string/libsrt), not as general-purpose direct usage.
+ *
+ * Features:
+ *
+ * - O(n) matching time, for any pattern and input (no backtracking).
+ * - Lazily built DFA: a forward pass finds the end of the leftmost match,
+ *   and a reverse pass finds its start. Sub-match captures are computed
+ *   afterwards, only for the matched area, simulating the NFA (Pike VM).
+ * - The DFA cache size is bounded: when full, or when the pattern uses
+ *   assertions not supported by the DFA (\b, \B, multi-line ^ and $), the
+ *   NFA simulation is used, keeping the O(n) time.
+ * - Patterns starting with a literal are searched with the O(n) substring
+ *   search (ssearch.c) before running the automata (prefilter).
+ * - UTF-8 aware: '.', character classes and case-insensitive matching work
+ *   with Unicode code points (case equivalences from schar.c tables).
+ * - Leftmost-first (Perl-like) match semantics.
+ * - Search skipping empty matches (sre_search_nonempty(), e.g. for
+ *   splitting): one NFA simulation pass, instead of searching again after
+ *   every empty match.
+ *
+ * Syntax:
+ *
+ * - Literals, '.' (any character but '\n'), [...] and [^...] classes.
+ * - Escapes: \n \r \t \f \v \e \0 \xHH \x{H...}, and \ + punctuation.
+ * - Class escapes (ASCII): \d \D \w \W \s \S.
+ * - Groups: (...) capturing, (?:...) not capturing.
+ * - Repetition: * + ? {n} {n,} {n,m}, non-greedy if followed by '?'.
+ * - Alternation: |
+ * - Assertions: ^ $ (text start/end, or line start/end if "m" flag is
+ *   set), \A \z (text start/end), \b \B (ASCII word boundary).
+ * - Flags: (?flags) and (?flags:...), flags being i (case-insensitive),
+ *   m (multi-line) and s ('.' matches '\n' too), e.g. "(?i)hello".
+ *
+ * Observations:
+ * - Invalid UTF-8 input bytes are not matched by '.' nor classes.
+ * - Case-insensitive matching is ASCII-only when built with S_MINIMAL
+ *   (no Unicode case tables).
+ * - Limits: 1000 for repetition counts, 1000 for group nesting, and
+ *   32768 for the compiled program size.
+ */
+
+#include "scommon.h"
+
+struct SRegex;
+
+struct SRegex *sre_compile(const char *p, const size_t ps);
+void sre_free(struct SRegex *r);
+size_t sre_ngroups(const struct SRegex *r);
+size_t sre_search(struct SRegex *r, const char *s, const size_t ss,
+		  const size_t off, const size_t ncaps);
+size_t sre_search_nonempty(struct SRegex *r, const char *s, const size_t ss,
+			   const size_t off, const size_t ncaps);
+const size_t *sre_caps(const struct SRegex *r);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+#endif /* SREGEX_H */
@@ -9,6 +9,7 @@
 
 #include "ssearch.h"
 #include "scommon.h"
+#include "schar.h"
 
 /*
  * ss_find_csum_* helpers
@@ -161,3 +162,333 @@ size_t ss_find_csum_fast(const char *s0, const size_t off, const size_t ss,
 #undef S_FIND_CSUM_SEARCH1
 #undef S_FIND_CSUM_SEARCH1
 #undef S_FIND_CSUM_SEARCH2
+
+/*
+ * Approximate search (Levenshtein distance)
+ *
+ * Bit-parallel DP (Myers, with Hyyrö's formulation): each DP column is
+ * stored as two bit vectors (vertical +1/-1 deltas) per 64-row block, so
+ * a text symbol is processed with a few logic and arithmetic operations
+ * per block. Block boundaries propagate the horizontal delta as carry.
+ */
+
+#define SLEV_W 64
+#define SLEV_HBIT ((uint64_t)1 << (SLEV_W - 1))
+#define SLEV_BAD_UTF8 ((uint32_t)0x110000) /* + byte, for invalid UTF-8 */
+
+struct SLevPattern {
+	size_t m, nb, ncps;
+	uint64_t hbit;	   /* last row bit in the last block */
+	uint64_t *peq;	   /* match vectors, symbols < 256 (256 x nb) */
+	uint32_t *cps;	   /* symbols >= 256, sorted */
+	uint64_t *peq_cps; /* match vectors, symbols >= 256 (ncps x nb) */
+	uint64_t *pv, *mv; /* column state (nb) */
+	uint64_t *heap;
+	uint64_t st[256 + 2]; /* single block storage */
+};
+
+static size_t slev_sym(const char *s, const size_t i, const size_t ss,
+		       const srt_bool utf8, uint32_t *c)
+{
+	int32_t u = 0;
+	int err = 0;
+	size_t l;
+	if (!utf8 || (unsigned char)s[i] < 0x80) {
+		*c = (unsigned char)s[i];
+		return 1;
+	}
+	l = sc_utf8_to_wc(s, i, ss, &u, &err);
+	*c = err ? SLEV_BAD_UTF8 + (unsigned char)s[i] : (uint32_t)u;
+	return err ? 1 : l;
+}
+
+/* Symbol ending at i (lo < i) */
+static size_t slev_sym_r(const char *s, const size_t lo, const size_t i,
+			 const srt_bool utf8, uint32_t *c)
+{
+	size_t j = i - 1;
+	if (utf8)
+		for (; j > lo && i - j < SSU8_MAX_SIZE
+		       && ((unsigned char)s[j] & 0xc0) == 0x80;
+		     j--)
+			;
+	if (j + slev_sym(s, j, i, utf8, c) == i)
+		return i - j;
+	*c = utf8 ? SLEV_BAD_UTF8 + (unsigned char)s[i - 1]
+		  : (unsigned char)s[i - 1];
+	return 1;
+}
+
+static size_t slev_count(const char *s, const size_t ss, const srt_bool utf8)
+{
+	uint32_t c;
+	size_t i, n = 0;
+	if (!utf8)
+		return ss;
+	for (i = 0; i < ss; n++)
+		i += slev_sym(s, i, ss, utf8, &c);
+	return n;
+}
+
+static int slev_cmp_cp(const void *a, const void *b)
+{
+	const uint32_t ca = *(const uint32_t *)a, cb = *(const uint32_t *)b;
+	return ca < cb ? -1 : ca > cb ? 1 : 0;
+}
+
+static const uint64_t *slev_peq(const struct SLevPattern *p, const uint32_t c)
+{
+	size_t lo, hi, k;
+	if (c < 256)
+		return p->peq + c * p->nb;
+	for (lo = 0, hi = p->ncps; lo < hi;) {
+		k = (lo + hi) / 2;
+		if (p->cps[k] == c)
+			return p->peq_cps + k * p->nb;
+		if (p->cps[k] < c)
+			lo = k + 1;
+		else
+			hi = k;
+	}
+	return NULL;
+}
+
+static void slev_reset(struct SLevPattern *p)
+{
+	size_t b;
+	for (b = 0; b < p->nb; b++) {
+		p->pv[b] = ~(uint64_t)0;
+		p->mv[b] = 0;
+	}
+}
+
+/* Pattern symbols (optionally reversed) to match bit vectors */
+static srt_bool slev_init(struct SLevPattern *p, const char *t, const size_t ts,
+			  const srt_bool utf8, const srt_bool rev)
+{
+	uint32_t c, *cps = NULL;
+	size_t i, j, l, r, n, mem;
+	uint64_t *v;
+	p->m = slev_count(t, ts, utf8);
+	p->nb = (p->m + SLEV_W - 1) / SLEV_W;
+	p->hbit = (uint64_t)1 << ((p->m - 1) % SLEV_W);
+	p->ncps = 0;
+	p->heap = NULL;
+	if (utf8) { /* symbols >= 256, sorted, without duplicates */
+		cps = (uint32_t *)s_malloc(p->m * sizeof(uint32_t));
+		if (!cps)
+			return S_FALSE;
+		for (i = n = 0; i < ts; i += l)
+			if ((l = slev_sym(t, i, ts, utf8, &c)) && c >= 256)
+				cps[n++] = c;
+		qsort(cps, n, sizeof(uint32_t), slev_cmp_cp);
+		for (i = 0; i < n; i++)
+			if (!p->ncps || cps[p->ncps - 1] != cps[i])
+				cps[p->ncps++] = cps[i];
+	}
+	mem = (256 + p->ncps + 2) * p->nb * sizeof(uint64_t)
+	      + p->ncps * sizeof(uint32_t);
+	if (p->nb == 1 && !p->ncps) {
+		v = p->st;
+	} else {
+		v = p->heap = (uint64_t *)s_malloc(mem);
+		if (!v) {
+			s_free(cps);
+			return S_FALSE;
+		}
+	}
+	p->peq = v;
+	p->peq_cps = v + 256 * p->nb;
+	p->pv = p->peq_cps + p->ncps * p->nb;
+	p->mv = p->pv + p->nb;
+	p->cps = (uint32_t *)(p->mv + p->nb);
+	if (p->ncps)
+		memcpy(p->cps, cps, p->ncps * sizeof(uint32_t));
+	s_free(cps);
+	memset(v, 0, (256 + p->ncps) * p->nb * sizeof(uint64_t));
+	for (i = j = 0; i < ts; i += n, j++) {
+		n = slev_sym(t, i, ts, utf8, &c);
+		r = rev ? p->m - 1 - j : j;
+		v = (uint64_t *)slev_peq(p, c);
+		v[r / SLEV_W] |= (uint64_t)1 << (r % SLEV_W);
+	}
+	slev_reset(p);
+	return S_TRUE;
+}
+
+static void slev_free(struct SLevPattern *p)
+{
+	s_free(p->heap);
+	p->heap = NULL;
+}
+
+/*
+ * Process one text symbol. hin: horizontal delta entering the first row
+ * (0: searching, i.e. D[0][j] = 0; +1: global distance, D[0][j] = j).
+ * Returns the horizontal delta of the last row.
+ */
+static int slev_column(struct SLevPattern *p, const uint32_t c, int hin)
+{
+	int hout;
+	size_t b;
+	const uint64_t *e = slev_peq(p, c);
+	uint64_t eq, pv, mv, xv, xh, ph, mh, hbit;
+	for (b = 0; b < p->nb; b++) {
+		eq = e ? e[b] : 0;
+		pv = p->pv[b];
+		mv = p->mv[b];
+		hbit = b + 1 < p->nb ? SLEV_HBIT : p->hbit;
+		xv = eq | mv;
+		if (hin < 0)
+			eq |= 1;
+		xh = (((eq & pv) + pv) ^ pv) | eq;
+		ph = mv | ~(xh | pv);
+		mh = pv & xh;
+		hout = (ph & hbit) ? 1 : (mh & hbit) ? -1 : 0;
+		ph <<= 1;
+		mh <<= 1;
+		if (hin < 0)
+			mh |= 1;
+		else if (hin > 0)
+			ph |= 1;
+		p->pv[b] = mh | ~(xv | ph);
+		p->mv[b] = ph & xv;
+		hin = hout;
+	}
+	return hin;
+}
+
+S_INLINE size_t slev_add(const size_t score, const int h)
+{
+	return h > 0 ? score + 1 : h < 0 ? score - 1 : score;
+}
+
+S_INLINE srt_bool slev_cont(const char c)
+{
+	return ((unsigned char)c & 0xc0) == 0x80 ? S_TRUE : S_FALSE;
+}
+
+/* Skip common prefix and suffix (whole characters if UTF-8) */
+static void slev_trim(const char **a, size_t *as, const char **b, size_t *bs,
+		      const srt_bool utf8)
+{
+	size_t i, j, n = S_MIN(*as, *bs);
+	for (i = 0; i < n && (*a)[i] == (*b)[i]; i++)
+		;
+	if (utf8)
+		for (; i > 0 && ((i < *as && slev_cont((*a)[i]))
+				 || (i < *bs && slev_cont((*b)[i])));
+		     i--)
+			;
+	*a += i;
+	*b += i;
+	*as -= i;
+	*bs -= i;
+	n -= i;
+	for (j = 0; j < n && (*a)[*as - j - 1] == (*b)[*bs - j - 1]; j++)
+		;
+	if (utf8)
+		for (; j > 0 && slev_cont((*a)[*as - j]); j--)
+			;
+	*as -= j;
+	*bs -= j;
+}
+
+size_t ss_lev_dist(const char *a, const size_t as, const char *b,
+		   const size_t bs, const size_t max_dist, const srt_bool utf8)
+{
+	struct SLevPattern p;
+	uint32_t c;
+	const char *t = a, *x = b, *y;
+	size_t i, j, n, ts = as, xs = bs, score;
+	RETURN_IF((!a && as) || (!b && bs), S_NPOS);
+	slev_trim(&t, &ts, &x, &xs, utf8);
+	if (ts > xs) { /* pattern: the shorter */
+		y = t;
+		t = x;
+		x = y;
+		i = ts;
+		ts = xs;
+		xs = i;
+	}
+	if (!ts) {
+		n = slev_count(x, xs, utf8);
+		return n <= max_dist ? n : S_NPOS;
+	}
+	RETURN_IF(!slev_init(&p, t, ts, utf8, S_FALSE), S_NPOS);
+	n = max_dist != S_NPOS ? slev_count(x, xs, utf8) : 0;
+	score = p.m;
+	if (max_dist != S_NPOS
+	    && (n > p.m ? n - p.m : p.m - n) > max_dist) {
+		slev_free(&p);
+		return S_NPOS;
+	}
+	for (i = j = 0; i < xs; j++) {
+		i += slev_sym(x, i, xs, utf8, &c);
+		score = slev_add(score, slev_column(&p, c, 1));
+		/*
+		 * BEHAVIOR: early exit when over max_dist (the last row of
+		 * the DP matrix can only decrease by 1 per column)
+		 */
+		if (max_dist != S_NPOS && score > max_dist + (n - j - 1)) {
+			score = S_NPOS;
+			break;
+		}
+	}
+	slev_free(&p);
+	return score <= max_dist ? score : S_NPOS;
+}
+
+size_t ss_lev_find(const char *s, const size_t off, const size_t ss,
+		   const char *t, const size_t ts, const size_t max_dist,
+		   const srt_bool utf8, size_t *match_size)
+{
+	struct SLevPattern p;
+	uint32_t c;
+	size_t i, j, l, b, e = S_NPOS, best, score;
+	if (match_size)
+		*match_size = 0;
+	RETURN_IF(!s || !t || !ts || off > ss, S_NPOS);
+	RETURN_IF(!slev_init(&p, t, ts, utf8, S_FALSE), S_NPOS);
+	if (p.m <= max_dist) { /* BEHAVIOR: empty match */
+		slev_free(&p);
+		return off;
+	}
+	/*
+	 * Match end: first position with distance <= max_dist, extended
+	 * while the distance keeps decreasing
+	 */
+	for (i = off, best = score = p.m; i < ss; i += l) {
+		l = slev_sym(s, i, ss, utf8, &c);
+		score = slev_add(score, slev_column(&p, c, 0));
+		if (score <= max_dist && score < best) {
+			best = score;
+			e = i + l;
+			if (!best)
+				break;
+		} else if (e != S_NPOS) {
+			break;
+		}
+	}
+	slev_free(&p);
+	RETURN_IF(e == S_NPOS, S_NPOS);
+	/*
+	 * Match start: reversed pattern, backwards from the match end, the
+	 * leftmost one with distance not over the one of the match end. The
+	 * distance can stay in range after going over it, so the whole band
+	 * is scanned: m + best symbols (a longer match would have more than
+	 * 'best' insertions)
+	 */
+	RETURN_IF(!slev_init(&p, t, ts, utf8, S_TRUE), S_NPOS);
+	for (i = e, j = 0, score = p.m, b = S_NPOS; i > off && j < p.m + best;
+	     i -= l, j++) {
+		l = slev_sym_r(s, off, i, utf8, &c);
+		score = slev_add(score, slev_column(&p, c, 1));
+		if (score <= best)
+			b = i - l;
+	}
+	slev_free(&p);
+	if (match_size)
+		*match_size = e - b;
+	return b;
+}
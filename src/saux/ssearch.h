@@ -106,6 +106,25 @@ extern "C" {
 size_t ss_find_csum_slow(const char *s0, const size_t off, const size_t ss, const char *t, const size_t ts);
 size_t ss_find_csum_fast(const char *s0, const size_t off, const size_t ss, const char *t, const size_t ts);
 
+/*
+ * Approximate search (Levenshtein distance)
+ *
+ * Bit-parallel algorithm (G. Myers, 1999; H. Hyyrö block formulation):
+ * O(n * ceil(m / 64)) time, being m the size of the pattern (the shorter
+ * string, for the distance) and n the size of the text, in bytes, or in
+ * Unicode characters when utf8 is set (invalid UTF-8 bytes are compared as
+ * single characters).
+ *
+ * ss_lev_dist: edit distance, or S_NPOS if over max_dist (the computation
+ * stops as soon as that is known). Use S_NPOS as max_dist for no limit.
+ * ss_lev_find: leftmost approximate occurrence of t in s, i.e. the first
+ * match end with distance <= max_dist (extended while the distance
+ * decreases), and the leftmost start for that end and distance.
+ */
+
+size_t ss_lev_dist(const char *a, const size_t as, const char *b, const size_t bs, const size_t max_dist, const srt_bool utf8);
+size_t ss_lev_find(const char *s, const size_t off, const size_t ss, const char *t, const size_t ts, const size_t max_dist, const srt_bool utf8, size_t *match_size);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -49,6 +49,7 @@
 		if (b[0] > b[2])                                               \
 			SWAPF(b, 0, 2);                                        \
 		SORT2F(b);                                                     \
+		SORT2F(b + 1);                                                 \
 	}
 
 #define BUILD_SORT4(FN, T, SWAPF, SORT2F)                                      \
@@ -58,10 +59,9 @@
 		SORT2F(b + 2);                                                 \
 		if (b[2] < b[0])                                               \
 			SWAPF(b, 0, 2);                                        \
+		if (b[3] < b[1])                                               \
+			SWAPF(b, 1, 3);                                        \
 		SORT2F(b + 1);                                                 \
-		if (b[2] < b[1])                                               \
-			SWAPF(b, 1, 2);                                        \
-		SORT2F(b + 2);                                                 \
 	}
 
 #define BUILD_MSD_RADIX_SORT(FN, T, TC, MSBF, SWPF, S2F, S3F, S4F, OFF)        \
@@ -119,6 +119,75 @@
 			FN##_aux(acc, MSBF(acc), b, elems);                    \
 	}
 
+/*
+ * LSD radix sort (out-of-place): 11-bit digits (3 passes for 32-bit
+ * elements, 6 for 64-bit), with the histograms of all digits computed in
+ * a single pass, and skipping the passes for digits being the same in all
+ * elements. Signed types have the sign bit flipped (OFF), so the order is
+ * kept. "cnt" has room for the histograms, and "tmp" for "elems" elements
+ */
+#define SSORT_LSD_BITS 11
+#define SSORT_LSD_RADIX (1 << SSORT_LSD_BITS)
+#define SSORT_LSD_PASSES(T)                                                    \
+	((sizeof(T) * 8 + SSORT_LSD_BITS - 1) / SSORT_LSD_BITS)
+
+#define BUILD_LSD_RADIX_SORT(FN, T, TC, OFF)                                   \
+	static void FN(T *b, T *tmp, size_t *cnt, size_t elems)                \
+	{                                                                      \
+		T *src = b, *dst = tmp, *t;                                    \
+		TC k;                                                          \
+		size_t i, p, acc, c, *h;                                       \
+		const size_t np = SSORT_LSD_PASSES(T);                         \
+		memset(cnt, 0, np * SSORT_LSD_RADIX * sizeof(size_t));         \
+		for (i = 0; i < elems; i++) {                                  \
+			k = (TC)b[i] ^ (OFF);                                  \
+			for (p = 0; p < np; p++)                               \
+				cnt[p * SSORT_LSD_RADIX                        \
+				    + ((k >> (p * SSORT_LSD_BITS))             \
+				       & (SSORT_LSD_RADIX - 1))]++;            \
+		}                                                              \
+		for (p = 0; p < np; p++) {                                     \
+			h = cnt + p * SSORT_LSD_RADIX;                         \
+			k = ((TC)b[0] ^ (OFF)) >> (p * SSORT_LSD_BITS);        \
+			if (h[k & (SSORT_LSD_RADIX - 1)] == elems)             \
+				continue;                                      \
+			for (i = acc = 0; i < SSORT_LSD_RADIX; i++) {          \
+				c = h[i];                                      \
+				h[i] = acc;                                    \
+				acc += c;                                      \
+			}                                                      \
+			for (i = 0; i < elems; i++) {                          \
+				k = ((TC)src[i] ^ (OFF))                       \
+				    >> (p * SSORT_LSD_BITS);                   \
+				dst[h[k & (SSORT_LSD_RADIX - 1)]++] = src[i];  \
+			}                                                      \
+			t = src;                                               \
+			src = dst;                                             \
+			dst = t;                                               \
+		}                                                              \
+		if (src != b)                                                  \
+			memcpy(b, src, elems * sizeof(T));                     \
+	}
+
+/*
+ * Out-of-place sort, with the temporary buffer and the histograms in the
+ * same allocation (the histograms first, keeping the alignment)
+ */
+#define BUILD_SORT_LSD(FN, T, LSDF)                                            \
+	srt_bool FN(T *b, size_t elems)                                        \
+	{                                                                      \
+		size_t *cnt;                                                   \
+		const size_t hs = SSORT_LSD_PASSES(T) * SSORT_LSD_RADIX        \
+				  * sizeof(size_t);                            \
+		RETURN_IF(!b || elems <= 1, S_TRUE);                           \
+		RETURN_IF(elems > (S_SIZET_MAX - hs) / sizeof(T), S_FALSE);    \
+		cnt = (size_t *)s_malloc(hs + elems * sizeof(T));              \
+		RETURN_IF(!cnt, S_FALSE);                                      \
+		LSDF(b, (T *)((char *)cnt + hs), cnt, elems);                  \
+		s_free(cnt);                                                   \
+		return S_TRUE;                                                 \
+	}
+
 #ifndef S_MINIMAL
 
 /* clang-format off */
@@ -156,14 +225,23 @@ BUILD_MSD_RADIX_SORT(s_msd_radix_sort_i16, int16_t, uint16_t, s_msb16,
 BUILD_MSD_RADIX_SORT(s_msd_radix_sort_u16, uint16_t, uint16_t, s_msb16,
 		     s_swap_u16, s_sort2_u16, s_sort3_u16, s_sort4_u16, 0)
 BUILD_MSD_RADIX_SORT(s_msd_radix_sort_i32, int32_t, uint32_t, s_msb32,
-		     s_swap_i32, s_sort2_i32, s_sort3_i32, s_sort4_i32, 1<<31)
+		     s_swap_i32, s_sort2_i32, s_sort3_i32, s_sort4_i32, 1U<<31)
 BUILD_MSD_RADIX_SORT(s_msd_radix_sort_u32, uint32_t, uint32_t, s_msb32,
 		     s_swap_u32, s_sort2_u32, s_sort3_u32, s_sort4_u32, 0)
 BUILD_MSD_RADIX_SORT(s_msd_radix_sort_i64, int64_t, uint64_t, s_msb64,
 		     s_swap_i64, s_sort2_i64, s_sort3_i64, s_sort4_i64,
-		     1LL<<63)
+		     (uint64_t)1<<63)
 BUILD_MSD_RADIX_SORT(s_msd_radix_sort_u64, uint64_t, uint64_t, s_msb64,
 		     s_swap_u64, s_sort2_u64, s_sort3_u64, s_sort4_u64, 0)
+BUILD_LSD_RADIX_SORT(s_lsd_radix_sort_i32, int32_t, uint32_t, 1U<<31)
+BUILD_LSD_RADIX_SORT(s_lsd_radix_sort_u32, uint32_t, uint32_t, 0)
+BUILD_LSD_RADIX_SORT(s_lsd_radix_sort_i64, int64_t, uint64_t,
+		     (uint64_t)1<<63)
+BUILD_LSD_RADIX_SORT(s_lsd_radix_sort_u64, uint64_t, uint64_t, 0)
+BUILD_SORT_LSD(ssort_lsd_i32, int32_t, s_lsd_radix_sort_i32)
+BUILD_SORT_LSD(ssort_lsd_u32, uint32_t, s_lsd_radix_sort_u32)
+BUILD_SORT_LSD(ssort_lsd_i64, int64_t, s_lsd_radix_sort_i64)
+BUILD_SORT_LSD(ssort_lsd_u64, uint64_t, s_lsd_radix_sort_u64)
 
 /*
  * Sort functions
@@ -21,6 +21,14 @@ extern "C" {
  *     case only happens when having duplicated elements (e.g. if you
  *     sort more than 2^16 16-bit elements, it would start being really O(n),
  *     for that specific case).
+ * - Fast, out-of-place, 32/64-bit integer sort (ssort_lsd_*)
+ *   - Algorithm: LSD radix sort, 11-bit digits (3 passes for 32-bit, 6 for
+ *     64-bit), all histograms computed in one pass, skipping the passes
+ *     for digits that are the same in all elements
+ *   - Space complexity: O(n) (heap allocated; if not available, S_FALSE is
+ *     returned without modifying the input)
+ *   - Time complexity: O(n). 5x faster than the in-place sort for 10^7
+ *     32-bit elements, 2x for 64-bit elements
  *
  * Copyright (c) 2015-2018 F. Aragon. All rights reserved.
  * Released under the BSD 3-Clause License (see the doc/LICENSE)
@@ -36,6 +44,10 @@ void ssort_i32(int32_t *b, size_t elems);
 void ssort_u32(uint32_t *b, size_t elems);
 void ssort_i64(int64_t *b, size_t elems);
 void ssort_u64(uint64_t *b, size_t elems);
+srt_bool ssort_lsd_i32(int32_t *b, size_t elems);
+srt_bool ssort_lsd_u32(uint32_t *b, size_t elems);
+srt_bool ssort_lsd_i64(int64_t *b, size_t elems);
+srt_bool ssort_lsd_u64(uint64_t *b, size_t elems);
 
 #ifdef __cplusplus
 } /* extern "C" { */
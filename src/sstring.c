@@ -12,8 +12,20 @@
 #include "saux/scommon.h"
 #include "saux/senc.h"
 #include "saux/shash.h"
+#include "saux/snorm.h"
+#include "saux/sregex.h"
 #include "saux/ssearch.h"
 
+#ifndef S_MINIMAL
+#ifdef _MSC_VER
+#include <io.h>
+#define S_FD_READ(fd, buf, size) _read(fd, buf, (unsigned)(size))
+#else
+#include <unistd.h>
+#define S_FD_READ(fd, buf, size) read(fd, buf, size)
+#endif
+#endif
+
 /*
  * Togglable optimizations
  *
@@ -163,6 +175,95 @@ static void set_reference_mode(srt_string *s, const srt_bool is_reference,
 	}
 }
 
+#define SS_HASH_CACHED 1
+#define SS_UIDX_CACHED 2
+
+/*
+ * Sparse Unicode code point index: byte offset every SS_UIDX_STEP code
+ * points, stored in the unused allocated space, after the string data
+ * (the index is built only if there is enough space for it)
+ */
+#define SS_UIDX_STEP 64
+#define SS_UIDX_MIN_SIZE 512
+#define SS_UIDX_OFF(ss) (((ss) + 4) & ~(size_t)3) /* after the terminator */
+#define SS_UIDX_MAX_BYTES(ss) (4 * ((ss) / SS_UIDX_STEP + 1))
+
+static srt_bool is_hash_cached(const srt_string *s)
+{
+	return sdx_full_st(&s->d) && (s->d.sub_type & SS_HASH_CACHED) != 0
+		       ? S_TRUE
+		       : S_FALSE;
+}
+
+S_INLINE void set_size(srt_string *s, const size_t size)
+{
+	sdx_set_size((srt_data *)s, size);
+	if (sdx_full_st((srt_data *)s)) /* invalidate hash and index */
+		s->d.sub_type = 0;
+}
+
+/*
+ * Index layout: number of entries (n), followed by n entries, being the
+ * entry i the byte offset of the code point i * SS_UIDX_STEP (32-bit
+ * values, native byte order, unaligned access)
+ */
+static const char *get_uidx(const srt_string *s)
+{
+	char *p, *idx;
+	size_t ss, i, n, actual_n;
+	ss = ss_size(s);
+	RETURN_IF(ss < SS_UIDX_MIN_SIZE || ss > (uint32_t)-1
+			  || !sdx_full_st(&s->d) || ss_is_ref(s),
+		  NULL);
+	RETURN_IF(SS_UIDX_OFF(ss) + SS_UIDX_MAX_BYTES(ss) > ss_max_size(s),
+		  NULL);
+	/*
+	 * BEHAVIOR:
+	 * Constness is kept regarding srt_string internal logical state (see
+	 * ss_len_u()), as the index is stored after the string data.
+	 */
+	p = (char *)ss_get_buffer_r(s);
+	idx = p + SS_UIDX_OFF(ss);
+	RETURN_IF((s->d.sub_type & SS_UIDX_CACHED) != 0, idx);
+	for (i = n = 0; i < ss;) {
+		actual_n = 0;
+		i += sc_unicode_count_to_utf8_size(p, i, ss, SS_UIDX_STEP,
+						   &actual_n);
+		if (actual_n < SS_UIDX_STEP || i >= ss)
+			break;
+		S_ST_U32(idx + 4 * ++n, (uint32_t)i);
+	}
+	S_ST_U32(idx, (uint32_t)n);
+	((srt_string *)s)->d.sub_type |= SS_UIDX_CACHED;
+	return idx;
+}
+
+/*
+ * Byte offset for a given Unicode character offset (string size if out of
+ * range), O(SS_UIDX_STEP) if the code point index is available, O(n) if
+ * not. 'actual_char_off' gets the character offset (useful if out of range)
+ */
+static size_t get_u_off(const srt_string *s, const size_t char_off,
+			size_t *actual_char_off)
+{
+	const char *idx;
+	size_t i, off, coff, actual_n;
+	off = coff = actual_n = 0;
+	if (char_off >= SS_UIDX_STEP && (idx = get_uidx(s)) != NULL) {
+		i = S_MIN(char_off / SS_UIDX_STEP, S_LD_U32(idx));
+		if (i > 0) {
+			off = S_LD_U32(idx + 4 * i);
+			coff = i * SS_UIDX_STEP;
+		}
+	}
+	off += sc_unicode_count_to_utf8_size(ss_get_buffer_r(s), off,
+					     ss_size(s), char_off - coff,
+					     &actual_n);
+	if (actual_char_off)
+		*actual_char_off = coff + actual_n;
+	return off;
+}
+
 S_INLINE size_t get_unicode_size(const srt_string *s)
 {
 	return !s ? 0
@@ -178,7 +279,7 @@ S_INLINE size_t get_str_off(const srt_string *s)
 
 S_INLINE void inc_size(srt_string *s, const size_t inc_size)
 {
-	ss_set_size(s, s_size_t_add(ss_size(s), inc_size, S_NPOS));
+	set_size(s, s_size_t_add(ss_size(s), inc_size, S_NPOS));
 }
 
 static void set_unicode_size(srt_string *s, const size_t unicode_size)
@@ -218,7 +319,7 @@ static srt_string *ss_reset(srt_string *s)
 		set_unicode_size_cached(s, S_TRUE);
 		set_encoding_errors(s, S_FALSE);
 		set_unicode_size(s, 0);
-		ss_set_size(s, 0);
+		set_size(s, 0);
 	}
 	return s;
 }
@@ -302,7 +403,10 @@ static srt_string *ss_cat_aliasing(srt_string **s, const srt_string *s0,
 	return src == s0 ? ss_cat_cn_raw(s, ss_get_buffer(*s), 0, s0_size,
 					 s0_unicode_size)
 			 : ss_cat_cn_raw(s, ss_get_buffer_r(src), 0,
-					 ss_size(src), get_unicode_size(src));
+					 ss_size(src),
+					 is_unicode_size_cached(src)
+						 ? get_unicode_size(src)
+						 : 0);
 }
 
 static size_t get_cmp_size(const srt_string *s1, const srt_string *s2)
@@ -351,7 +455,7 @@ static srt_string *aux_toint(srt_string **s, const srt_bool cat,
 	out_size = s_size_t_add(at, digits, S_NPOS);
 	if (ss_reserve(s, out_size) >= out_size && *s) {
 		memcpy(ss_get_buffer(*s) + at, btmp + off, digits);
-		ss_set_size(*s, out_size);
+		set_size(*s, out_size);
 		inc_unicode_size(*s, digits);
 	}
 	return *s;
@@ -460,13 +564,46 @@ static srt_string *aux_toXcase(srt_string **s, const srt_bool cat,
 		ss_free(&s_bck);
 	}
 	if (*s) {
-		ss_set_size(*s, sso_req);
+		set_size(*s, sso_req);
 		set_unicode_size_cached(*s, is_cached_usize);
 		set_unicode_size(*s, cached_usize);
 	}
 	return ss_check(s);
 }
 
+/*
+ * Unicode normalization and case folding: the quick check avoids the
+ * normalization (and any allocation) when the string is already normalized.
+ */
+static srt_string *aux_normalize(srt_string **s, const enum SNormForm f)
+{
+	size_t ss, out_size;
+	const char *p;
+	srt_string *out;
+	ASSERT_RETURN_IF(!s, ss_void);
+	ss = ss_size(*s);
+	p = ss_get_buffer_r(*s);
+	if (!ss || sn_utf8_quick_check(p, ss, f) == SN_QC_YES)
+		return ss_check(s);
+	out_size = sn_utf8_normalize(p, ss, NULL, f);
+	out = ss_alloc(out_size);
+	if (!out) { /* BEHAVIOR */
+		S_ERROR("not enough memory: can not normalize string");
+		ss_set_alloc_errors(*s);
+		return ss_check(s);
+	}
+	sn_utf8_normalize(p, ss, ss_get_buffer(out), f);
+	set_size(out, out_size);
+	if ((*s)->d.f.ext_buffer) { /* BEHAVIOR: can fail if not enough room */
+		ss_cpy(s, out);
+		ss_free(&out);
+	} else {
+		ss_free(s);
+		*s = out;
+	}
+	return ss_check(s);
+}
+
 /*
  * The conversion runs backwards in order to cover the
  * aliasing case without extra memory allocation nor shift.
@@ -499,7 +636,8 @@ static srt_string *aux_toenc(srt_string **s, const srt_bool cat,
 			 * For functions not supporting aliasing, use a
 			 * copy for the input
 			 */
-			if (f == senc_lz || f == sdec_lz || f == senc_lzh) {
+			if (f == senc_lz || f == sdec_lz || f == senc_lzh
+			    || f == senc_utf16le || f == sdec_utf16le) {
 				ss_cpy(&src_aux, *s);
 				src1 = src_aux;
 			} else
@@ -511,20 +649,14 @@ static srt_string *aux_toenc(srt_string **s, const srt_bool cat,
 		s_out = (unsigned char *)ss_get_buffer(*s) + at;
 		enc_size = f ? f(s_in, in_size, s_out)
 			     : f2(s_in, in_size, s_out, enc_size);
-		if (at == 0) {
-			set_unicode_size_cached(*s, S_TRUE);
-			set_unicode_size(*s, in_size * 2);
-		} else { /* cat */
-			if (is_unicode_size_cached(*s) && at == ss_size(*s))
-				set_unicode_size(*s, get_unicode_size(*s)
-							     + in_size * 2);
-			else
-				set_unicode_size_cached(*s, S_FALSE);
-		}
+		/* BEHAVIOR: Unicode size is computed on demand */
+		set_unicode_size_cached(*s, S_FALSE);
 		out_size = at + enc_size;
-		ss_set_size(*s, out_size);
+		set_size(*s, out_size);
 		if (src_aux)
 			ss_free(&src_aux);
+	} else if (!enc_size && !cat && *s) {
+		ss_clear(*s); /* BEHAVIOR: e.g. empty or invalid input */
 	}
 	return ss_check(s);
 }
@@ -546,11 +678,11 @@ static srt_string *aux_erase(srt_string **s, const srt_bool cat,
 	copy_size = ss0 - off - src_size;
 	if (*s == src) {	      /* BEHAVIOR: aliasing: copy-only */
 		if (off + n >= ss0) { /* tail clean cut */
-			ss_set_size(*s, off);
+			set_size(*s, off);
 		} else {
 			char *ps = ss_get_buffer(*s);
 			memmove(ps + off, ps + off + n, copy_size);
-			ss_set_size(*s, ss0 - n);
+			set_size(*s, ss0 - n);
 		}
 		set_unicode_size_cached(*s, S_FALSE);
 	} else { /* copy or cat */
@@ -560,7 +692,7 @@ static srt_string *aux_erase(srt_string **s, const srt_bool cat,
 			memcpy(po + at, ss_get_buffer_r(src), off);
 			memcpy(po + at + off, ss_get_buffer_r(src) + off + n,
 			       copy_size);
-			ss_set_size(*s, out_size);
+			set_size(*s, out_size);
 			set_unicode_size_cached(*s, S_FALSE);
 		}
 	}
@@ -573,20 +705,20 @@ static srt_string *aux_erase_u(srt_string **s, const srt_bool cat,
 {
 	char *po;
 	const char *ps;
-	size_t sso0, ss0, head_size, actual_n, cus, cut_size, tail_size,
-		out_size, prefix_usize, at;
+	size_t sso0, ss0, head_size, head_n, actual_n, cus, cut_size,
+		tail_size, out_size, prefix_usize, at;
 	ASSERT_RETURN_IF(!s, ss_void);
 	if (!src)
 		src = ss_void;
 	ps = ss_get_buffer_r(src);
 	sso0 = *s ? ss_size(*s) : 0;
 	ss0 = ss_size(src);
-	head_size = sc_unicode_count_to_utf8_size(ps, 0, ss0, char_off, NULL);
+	head_size = get_u_off(src, char_off, &head_n);
 	RETURN_IF(head_size >= ss0, ss_check(s)); /* BEHAVIOR */
-	actual_n = 0;
 	cus = *s ? get_unicode_size(*s) : 0;
-	cut_size =
-		sc_unicode_count_to_utf8_size(ps, head_size, ss0, n, &actual_n);
+	cut_size = get_u_off(src, s_size_t_add(char_off, n, S_NPOS), &actual_n)
+		   - head_size;
+	actual_n -= head_n;
 	tail_size = ss0 - cut_size - head_size;
 	out_size = ss0 - cut_size;
 	prefix_usize = 0;
@@ -602,7 +734,7 @@ static srt_string *aux_erase_u(srt_string **s, const srt_bool cat,
 			memcpy(po + at + head_size,
 			       ss_get_buffer_r(src) + head_size + cut_size,
 			       tail_size);
-			ss_set_size(*s, out_size);
+			set_size(*s, out_size);
 			if (is_unicode_size_cached(*s)
 			    && (at == 0 || at == sso0)) {
 				prefix_usize = get_unicode_size(*s);
@@ -615,7 +747,7 @@ static srt_string *aux_erase_u(srt_string **s, const srt_bool cat,
 		set_unicode_size(*s, prefix_usize + cus - actual_n);
 	else /* BEHAVIOR: unicode char count invalidation */
 		set_unicode_size_cached(*s, S_FALSE);
-	ss_set_size(*s, out_size);
+	set_size(*s, out_size);
 	return ss_check(s);
 }
 
@@ -716,7 +848,7 @@ static srt_string *aux_replace(srt_string **s, const srt_bool cat,
 		*s = out;
 		ss_free(&s_bck);
 	}
-	ss_set_size(*s, (size_t)(o - o0));
+	set_size(*s, (size_t)(o - o0));
 	return *s;
 }
 
@@ -741,7 +873,7 @@ static srt_string *aux_resize(srt_string **s, const srt_bool cat,
 				memcpy(o + at, p, src_size);
 			}
 			memset(o + at + src_size, fill_byte, n - src_size);
-			ss_set_size(*s, out_size);
+			set_size(*s, out_size);
 			set_unicode_size_cached(*s, S_FALSE);
 			/* BEHAVIOR: size cache lost */
 		} /* else: BEHAVIOR: not enough memory */
@@ -750,7 +882,7 @@ static srt_string *aux_resize(srt_string **s, const srt_bool cat,
 			if (!aliasing)
 				memcpy(ss_get_buffer(*s) + at,
 				       ss_get_buffer_r(src), n);
-			ss_set_size(*s, out_size);
+			set_size(*s, out_size);
 			set_unicode_size_cached(*s, S_FALSE);
 			/* BEHAVIOR: size cache lost */
 		} /* else: BEHAVIOR: not enough memory */
@@ -795,9 +927,7 @@ static srt_string *aux_resize_u(srt_string **s, const srt_bool cat,
 		}
 	} else { /* cut */
 		ps = ss_get_buffer_r(src);
-		actual_unicode_count = 0;
-		head_size = sc_unicode_count_to_utf8_size(
-			ps, 0, srcs, u_chars, &actual_unicode_count);
+		head_size = get_u_off(src, u_chars, &actual_unicode_count);
 		SS_OVERFLOW_CHECK(s, at, head_size);
 		out_size = at + head_size;
 		S_ASSERT(u_chars == actual_unicode_count);
@@ -810,7 +940,7 @@ static srt_string *aux_resize_u(srt_string **s, const srt_bool cat,
 				inc_size(*s, head_size);
 			} /* else: BEHAVIOR */
 		} else {  /* cut */
-			ss_set_size(*s, head_size);
+			set_size(*s, head_size);
 			set_unicode_size(*s, actual_unicode_count);
 		}
 	}
@@ -851,7 +981,7 @@ static srt_string *aux_ltrim(srt_string **s, const srt_bool cat,
 				memcpy(pt + at, ps + i, ss - i);
 			else if (i > 0) /* copy: shift data */
 				memmove(pt, ps + i, ss - i);
-			ss_set_size(*s, at + ss - i);
+			set_size(*s, at + ss - i);
 			set_unicode_size(*s, cat_usize + src_usize - i);
 		} /* else: BEHAVIOR */
 	} else {
@@ -891,7 +1021,7 @@ static srt_string *aux_rtrim(srt_string **s, const srt_bool cat,
 			char *pt = ss_get_buffer(*s);
 			if (!aliasing)
 				memcpy(pt + at, ps, copy_size);
-			ss_set_size(*s, out_size);
+			set_size(*s, out_size);
 			set_unicode_size(*s, cat_usize + src_usize - nspaces);
 		} /* else: BEHAVIOR */
 	} else {
@@ -931,7 +1061,7 @@ static ssize_t aux_read(srt_string **s, const srt_bool cat, FILE *h,
 				l0 = (size_t)fread(sc + off, 1, buf_size, h);
 				if (l0 > 0 && !ferror(h)) {
 					off += l0;
-					ss_set_size(*s, off);
+					set_size(*s, off);
 					set_unicode_size_cached(*s, S_FALSE);
 					l = l < 0 ? (ssize_t)l0
 						  : l + (ssize_t)l0;
@@ -993,10 +1123,12 @@ static ssize_t aux_read(srt_string **s, const srt_bool cat, FILE *h,
 	MK_SS_CODEC(ss_##suffix, f1, f2)
 
 MK_SS_DUP_CPY_CAT(enc_b64, senc_b64, NULL)
+MK_SS_DUP_CPY_CAT(enc_b64url, senc_b64url, NULL)
 MK_SS_DUP_CPY_CAT(enc_hex, senc_hex, NULL)
 MK_SS_DUP_CPY_CAT(enc_HEX, senc_HEX, NULL)
 MK_SS_DUP_CPY_CAT(enc_lz, senc_lz, NULL)
 MK_SS_DUP_CPY_CAT(enc_lzh, senc_lzh, NULL)
+MK_SS_DUP_CPY_CAT(enc_utf16le, senc_utf16le, NULL)
 MK_SS_DUP_CPY_CAT(enc_esc_xml, NULL, senc_esc_xml)
 MK_SS_DUP_CPY_CAT(enc_esc_json, NULL, senc_esc_json)
 MK_SS_DUP_CPY_CAT(enc_esc_url, NULL, senc_esc_url)
@@ -1004,8 +1136,12 @@ MK_SS_DUP_CPY_CAT(enc_esc_dquote, NULL, senc_esc_dquote)
 MK_SS_DUP_CPY_CAT(enc_esc_squote, NULL, senc_esc_squote)
 
 MK_SS_DUP_CPY_CAT(dec_b64, sdec_b64, NULL)
+MK_SS_DUP_CPY_CAT(dec_b64_strict, sdec_b64_strict, NULL)
+MK_SS_DUP_CPY_CAT(dec_b64url, sdec_b64url, NULL)
+MK_SS_DUP_CPY_CAT(dec_b64url_strict, sdec_b64url_strict, NULL)
 MK_SS_DUP_CPY_CAT(dec_hex, sdec_hex, NULL)
 MK_SS_DUP_CPY_CAT(dec_lz, sdec_lz, NULL)
+MK_SS_DUP_CPY_CAT(dec_utf16le, sdec_utf16le, NULL)
 MK_SS_DUP_CPY_CAT(dec_esc_xml, sdec_esc_xml, NULL)
 MK_SS_DUP_CPY_CAT(dec_esc_json, sdec_esc_json, NULL)
 MK_SS_DUP_CPY_CAT(dec_esc_url, sdec_esc_url, NULL)
@@ -1044,7 +1180,7 @@ static const srt_string *aux_ss_ref_raw(srt_string_ref *s_ref, const char *buf,
 	s_ref->s.d.f.ext_buffer = 1;
 	s_ref->s.d.f.st_mode = SData_Full;
 	s_ref->cstr = buf;
-	ss_set_size(&s_ref->s, buf_size);
+	set_size(&s_ref->s, buf_size);
 	sd_set_max_size((srt_data *)&s_ref->s, buf_size);
 	set_reference_mode(&s_ref->s, S_TRUE, has_C_terminator);
 	return &s_ref->s;
@@ -1107,6 +1243,18 @@ size_t ss_len_u(const srt_string *s)
 	return cached_uc_size;
 }
 
+srt_bool ss_index_u(srt_string **s)
+{
+	size_t ss, req;
+	ASSERT_RETURN_IF(!s, S_FALSE);
+	RETURN_IF(!*s || ss_is_ref(*s), S_FALSE);
+	ss = ss_size(*s);
+	RETURN_IF(ss < SS_UIDX_MIN_SIZE, S_FALSE);
+	req = SS_UIDX_OFF(ss) + SS_UIDX_MAX_BYTES(ss);
+	RETURN_IF(ss_reserve(s, req) < req, S_FALSE);
+	return get_uidx(*s) ? S_TRUE : S_FALSE;
+}
+
 size_t ss_max(const srt_string *s)
 {
 	return !s ? 0 : s->d.f.ext_buffer ? ss_max_size(s) : SS_RANGE;
@@ -1302,7 +1450,7 @@ srt_string *ss_cpy_substr(srt_string **s, const srt_string *src,
 		RETURN_IF(off >= ss, ss_reset(*s)); /* BEHAVIOR: empty */
 		copy_size = S_MIN(ss - off, n);
 		memmove(ps, ps + off, copy_size);
-		ss_set_size(*s, copy_size);
+		set_size(*s, copy_size);
 		/* BEHAVIOR: cache lost */
 		set_unicode_size_cached(*s, S_FALSE);
 	} else {
@@ -1316,21 +1464,21 @@ srt_string *ss_cpy_substr_u(srt_string **s, const srt_string *src,
 			    const size_t char_off, const size_t n)
 {
 	char *ps;
-	size_t actual_unicode_count, ss, off, n_size, copy_size;
+	size_t actual_unicode_count, head_n, ss, off, n_size, copy_size;
 	RETURN_IF(!s, ss_void);
 	RETURN_IF(!src || !n, ss_reset(*s)); /* BEHAVIOR: empty */
 	if (*s == src) {		     /* aliasing */
-		ps = ss_get_buffer(*s);
-		actual_unicode_count = 0;
 		ss = ss_size(*s);
-		off = sc_unicode_count_to_utf8_size(ps, 0, ss, char_off,
-						    &actual_unicode_count);
-		n_size = sc_unicode_count_to_utf8_size(ps, off, ss, n,
-						       &actual_unicode_count);
+		off = get_u_off(*s, char_off, &head_n);
+		n_size = get_u_off(*s, s_size_t_add(char_off, n, S_NPOS),
+				   &actual_unicode_count)
+			 - off;
+		actual_unicode_count -= head_n;
 		RETURN_IF(off >= ss, ss_reset(*s)); /* BEHAVIOR: empty */
+		ps = ss_get_buffer(*s);
 		copy_size = S_MIN(ss - off, n_size);
 		memmove(ps, ps + off, copy_size);
-		ss_set_size(*s, copy_size);
+		set_size(*s, copy_size);
 		if (n == actual_unicode_count) {
 			set_unicode_size_cached(*s, S_TRUE);
 			set_unicode_size(*s, n);
@@ -1505,7 +1653,8 @@ srt_string *ss_cat_aux(srt_string **s, const srt_string *s1, ...)
 		}
 		va_end(ap);
 		ss0 = *s ? ss_size(s0) : 0;
-		uss0 = s0 ? get_unicode_size(s0) : 0;
+		uss0 = s0 && is_unicode_size_cached(s0) ? get_unicode_size(s0)
+							: 0;
 		if (ss_grow(s, extra_size)) {
 			ss_cat_aliasing(s, s0, ss0, uss0, s1);
 			if (nargs == 1)
@@ -1555,19 +1704,19 @@ srt_string *ss_cat_substr_u(srt_string **s, const srt_string *src,
 			    const size_t char_off, const size_t n)
 {
 	const char *psrc;
-	size_t ssrc, off_size, actual_n, copy_size;
+	size_t ssrc, off_size, head_n, actual_n, copy_size;
 	ASSERT_RETURN_IF(!s, ss_void);
 	if (src) {
 		psrc = ss_get_buffer_r(src);
 		ssrc = ss_size(src);
-		off_size = sc_unicode_count_to_utf8_size(psrc, 0, ssrc,
-							 char_off, NULL);
+		off_size = get_u_off(src, char_off, &head_n);
 		/* BEHAVIOR: cut out of bounds, append nothing */
 		if (off_size >= ssrc)
 			return *s;
-		actual_n = 0;
-		copy_size = sc_unicode_count_to_utf8_size(psrc, off_size, ssrc,
-							  n, &actual_n);
+		copy_size = get_u_off(src, s_size_t_add(char_off, n, S_NPOS),
+				      &actual_n)
+			    - off_size;
+		actual_n -= head_n;
 		ss_cat_cn_raw(s, psrc, off_size, copy_size, actual_n);
 	}
 	return ss_check(s);
@@ -1588,50 +1737,30 @@ srt_string *ss_cat_c_aux(srt_string **s, const char *s1, ...)
 
 srt_string *ss_cat_wn(srt_string **s, const wchar_t *src, const size_t src_size)
 {
-	int32_t uc32;
-	char utf8[SSU8_MAX_SIZE];
-	size_t i, char_count, l;
-	wchar_t h, cl;
+	char *o;
+	size_t out_size, char_count;
 	ASSERT_RETURN_IF(!s, ss_void);
-	if (src && ss_grow(s, src_size * SSU8_MAX_SIZE) && *s) {
-		i = 0;
-		char_count = 0;
-		for (; i < src_size; i++) {
-			if (sizeof(wchar_t) == 2) { /* UTF-16 */
-				h = src[i];
-				/*
-				 * Basic Multilingual Plane (BMP), or
-				 * full Unicode
-				 */
-				if (SSU16_SIMPLE(h)) {
-					uc32 = (int32_t)h;
-				} else {
-					/*
-					 * BEHAVIOR: ignore or cut incomplete
-					 * UTF-16 characters
-					 */
-					if (!SSU16_VALID_HS(h))
-						continue;
-					if (i + 1 == src_size)
-						break;
-					cl = src[i + 1];
-					if (!SSU16_VALID_LS(cl))
-						continue;
-					i++;
-					/*
-					 * Once validated, convert it
-					 */
-					uc32 = SSU16_TO_U32(h, cl);
-				}
-			} else { /* UTF-32 */
-				uc32 = (int32_t)src[i];
-			}
-			l = sc_wc_to_utf8(uc32, utf8, 0, SSU8_MAX_SIZE);
-			memcpy(ss_get_buffer(*s) + ss_size(*s), utf8, l);
-			inc_size(*s, l);
-			char_count++;
+	if (src && src_size > 0) {
+		/*
+		 * BEHAVIOR: ignore or cut incomplete UTF-16 characters
+		 */
+		out_size = sizeof(wchar_t) == 2
+				   ? sc_utf16_to_utf8((const uint16_t *)src,
+						      src_size, NULL, NULL)
+				   : sc_utf32_to_utf8((const uint32_t *)src,
+						      src_size, NULL, NULL);
+		if (ss_grow(s, out_size) >= out_size && *s) {
+			char_count = 0;
+			o = ss_get_buffer(*s) + ss_size(*s);
+			if (sizeof(wchar_t) == 2)
+				sc_utf16_to_utf8((const uint16_t *)src,
+						 src_size, o, &char_count);
+			else
+				sc_utf32_to_utf8((const uint32_t *)src,
+						 src_size, o, &char_count);
+			inc_size(*s, out_size);
+			inc_unicode_size(*s, char_count);
 		}
-		inc_unicode_size(*s, char_count++);
 	}
 	return ss_check(s);
 }
@@ -1770,6 +1899,31 @@ srt_string *ss_toupper(srt_string **s)
 	return aux_toXcase(s, S_FALSE, *s, fsc_toupper);
 }
 
+srt_string *ss_normalize_nfc(srt_string **s)
+{
+	return aux_normalize(s, SN_NFC);
+}
+
+srt_string *ss_normalize_nfd(srt_string **s)
+{
+	return aux_normalize(s, SN_NFD);
+}
+
+srt_string *ss_normalize_nfkc(srt_string **s)
+{
+	return aux_normalize(s, SN_NFKC);
+}
+
+srt_string *ss_normalize_nfkd(srt_string **s)
+{
+	return aux_normalize(s, SN_NFKD);
+}
+
+srt_string *ss_casefold(srt_string **s)
+{
+	return aux_normalize(s, SN_CASEFOLD);
+}
+
 srt_bool ss_set_turkish_mode(const srt_bool enable_turkish_mode)
 {
 	if (enable_turkish_mode) {
@@ -1799,7 +1953,7 @@ srt_string *ss_check(srt_string **s)
 	ssmax = ss_max_size(*s);
 	S_ASSERT(ss <= ssmax);
 	if (ss > ssmax) { /* This should never happen */
-		ss_set_size(*s, ssmax);
+		set_size(*s, ssmax);
 		set_unicode_size_cached(*s, S_FALSE); /* Invalidate cache */
 	}
 	return *s;
@@ -1884,41 +2038,19 @@ const char *ss_to_c(const srt_string *s)
 const wchar_t *ss_to_w(const srt_string *s, wchar_t *o, const size_t nmax,
 		       size_t *n)
 {
-	wchar_t *o_aux = NULL;
-	size_t o_s, i, ss, l;
-	const char *p;
-	int32_t c;
+	size_t o_s;
 	S_ASSERT(s && o && nmax > 0);
-	if (s && o && nmax > 0) {
-		o_s = 0;
-		i = 0;
-		p = ss_get_buffer_r(s);
-		ss = ss_size(s);
-		for (; i < ss && i < nmax;) {
-			c = 0;
-			l = ss_utf8_to_wc(p, i, ss, &c, NULL);
-			if (sizeof(wchar_t) == 2) {
-				if ((c & ~0xffff) == 0) { /* simple */
-					o[o_s++] = (wchar_t)c;
-				} else {		   /* full */
-					if (i + 1 == nmax) /* cut input */
-						break;
-					o[o_s++] = SSU16_HS0 | (c >> 10);
-					o[o_s++] = SSU16_LS0 | (c & 0x3ffff);
-				}
-			} else {
-				o[o_s++] = c;
-			}
-			i += l;
-		}
-		if (o_s == nmax)
-			o_s--;
-		o[o_s] = 0; /* zero-terminated string */
-		if (n)
-			*n = o_s;
-		o_aux = o;
-	}
-	return o_aux ? o_aux : S_NULL_WC; /* Ensure valid string */
+	RETURN_IF(!s || !o || !nmax, S_NULL_WC); /* Ensure valid string */
+	/* BEHAVIOR: characters not fitting in the output buffer are cut */
+	o_s = sizeof(wchar_t) == 2
+		      ? sc_utf8_to_utf16(ss_get_buffer_r(s), ss_size(s),
+					 (uint16_t *)o, nmax - 1, NULL)
+		      : sc_utf8_to_utf32(ss_get_buffer_r(s), ss_size(s),
+					 (uint32_t *)o, nmax - 1, NULL);
+	o[o_s] = 0; /* zero-terminated string */
+	if (n)
+		*n = o_s;
+	return o;
 }
 
 /*
@@ -2069,6 +2201,128 @@ size_t ss_split(const srt_string *src, const srt_string *separator,
 	return nelems;
 }
 
+/*
+ * Approximate search
+ */
+
+size_t ss_edit_distance(const srt_string *s1, const srt_string *s2)
+{
+	return ss_edit_distance_k(s1, s2, S_NPOS);
+}
+
+size_t ss_edit_distance_u(const srt_string *s1, const srt_string *s2)
+{
+	return ss_edit_distance_k_u(s1, s2, S_NPOS);
+}
+
+size_t ss_edit_distance_k(const srt_string *s1, const srt_string *s2,
+			  const size_t max_dist)
+{
+	RETURN_IF(!s1 || !s2, S_NPOS);
+	return ss_lev_dist(ss_get_buffer_r(s1), ss_size(s1),
+			   ss_get_buffer_r(s2), ss_size(s2), max_dist, S_FALSE);
+}
+
+size_t ss_edit_distance_k_u(const srt_string *s1, const srt_string *s2,
+			    const size_t max_dist)
+{
+	RETURN_IF(!s1 || !s2, S_NPOS);
+	return ss_lev_dist(ss_get_buffer_r(s1), ss_size(s1),
+			   ss_get_buffer_r(s2), ss_size(s2), max_dist, S_TRUE);
+}
+
+size_t ss_find_fuzzy(const srt_string *s, const size_t off,
+		     const srt_string *tgt, const size_t max_dist,
+		     size_t *match_size)
+{
+	RETURN_IF(!s || !tgt, S_NPOS);
+	return ss_lev_find(ss_get_buffer_r(s), off, ss_size(s),
+			   ss_get_buffer_r(tgt), ss_size(tgt), max_dist,
+			   S_FALSE, match_size);
+}
+
+size_t ss_find_fuzzy_u(const srt_string *s, const size_t off,
+		       const srt_string *tgt, const size_t max_dist,
+		       size_t *match_size)
+{
+	RETURN_IF(!s || !tgt, S_NPOS);
+	return ss_lev_find(ss_get_buffer_r(s), off, ss_size(s),
+			   ss_get_buffer_r(tgt), ss_size(tgt), max_dist,
+			   S_TRUE, match_size);
+}
+
+/*
+ * Regular expressions
+ */
+
+srt_regex *ss_regex_alloc(const srt_string *pattern)
+{
+	RETURN_IF(!pattern, NULL);
+	return sre_compile(ss_get_buffer_r(pattern), ss_size(pattern));
+}
+
+size_t ss_regex_ngroups(const srt_regex *r)
+{
+	return sre_ngroups(r);
+}
+
+size_t ss_regex_find(const srt_string *s, const size_t off, srt_regex *r,
+		     srt_string_ref caps[], const size_t max_caps)
+{
+	size_t i, m;
+	const size_t *c;
+	const char *p;
+	RETURN_IF(!s || !r, S_NPOS);
+	p = ss_get_buffer_r(s);
+	m = sre_search(r, p, ss_size(s), off, caps ? max_caps : 0);
+	if (m != S_NPOS && caps) {
+		c = sre_caps(r);
+		for (i = 0; i < max_caps; i++) {
+			if (i <= sre_ngroups(r) && c[2 * i] != S_NPOS)
+				ss_ref_buf(&caps[i], p + c[2 * i],
+					   c[2 * i + 1] - c[2 * i]);
+			else /* BEHAVIOR: empty reference if not matched */
+				ss_ref_buf(&caps[i], p + m, 0);
+		}
+	}
+	return m;
+}
+
+size_t ss_regex_split(const srt_string *src, srt_regex *r,
+		      srt_string_ref out_substrings[], const size_t max_refs)
+{
+	size_t i, m, me = 0, nelems = 0;
+	const size_t src_size = ss_size(src);
+	const char *p;
+	RETURN_IF(!src || !r || !src_size, 0);
+	p = ss_get_buffer_r(src);
+	for (i = 0; i < src_size && nelems < max_refs;) {
+		/*
+		 * BEHAVIOR: empty matches are ignored (the leftmost not empty
+		 * match is used, found in one pass, so splitting is O(n))
+		 */
+		m = sre_search(r, p, src_size, i, 1);
+		if (m != S_NPOS && sre_caps(r)[1] == m)
+			m = sre_search_nonempty(r, p, src_size, m, 1);
+		if (m != S_NPOS)
+			me = sre_caps(r)[1];
+		ss_ref_buf(&out_substrings[nelems++], p + i,
+			   (m != S_NPOS ? m : src_size) - i);
+		if (m == S_NPOS) /* no more separators found */
+			break;
+		i = me;
+	}
+	return nelems;
+}
+
+void ss_regex_free(srt_regex **r)
+{
+	if (r) {
+		sre_free(*r);
+		*r = NULL;
+	}
+}
+
 /*
  * Format
  */
@@ -2096,6 +2350,20 @@ int ss_cmp(const srt_string *s1, const srt_string *s2)
 	return ss_ncmp(s1, 0, s2, get_cmp_size(s1, s2));
 }
 
+srt_bool ss_equal(const srt_string *s1, const srt_string *s2)
+{
+	size_t ss;
+	RETURN_IF(s1 == s2, S_TRUE);
+	RETURN_IF(!s1 || !s2, S_FALSE);
+	ss = ss_size(s1);
+	RETURN_IF(ss != ss_size(s2), S_FALSE);
+	RETURN_IF(is_hash_cached(s1) && is_hash_cached(s2)
+			  && s1->hash != s2->hash,
+		  S_FALSE);
+	return !memcmp(ss_get_buffer_r(s1), ss_get_buffer_r(s2), ss) ? S_TRUE
+								    : S_FALSE;
+}
+
 int ss_cmpi(const srt_string *s1, const srt_string *s2)
 {
 	return ss_ncmpi(s1, 0, s2, get_cmp_size(s1, s2));
@@ -2199,7 +2467,7 @@ int ss_popchar(srt_string **s)
 		if (SSU8_VALID_START(s_str[off])) {
 			int u_char = EOF;
 			ss_utf8_to_wc(s_str, off, ss_size(*s), &u_char, *s);
-			ss_set_size(*s, off);
+			set_size(*s, off);
 			dec_unicode_size(*s, 1);
 			return u_char;
 		}
@@ -2227,10 +2495,606 @@ ssize_t ss_write(FILE *handle, const srt_string *s, const size_t offset,
 	return ws > 0 && !ferror(handle) ? (ssize_t)ws : -1;
 }
 
+/*
+ * Line reader
+ */
+
+#define SS_LR_DEF_BUF_SIZE (64 * 1024)
+
+struct SLineReader {
+	FILE *h;
+	int fd;
+	char *buf;
+	size_t buf_size, size, off, scan_off, max_line_size;
+	srt_bool eof, error;
+};
+
+static srt_line_reader *aux_lr_alloc(FILE *h, int fd, size_t buf_size,
+				     size_t max_line_size)
+{
+	srt_line_reader *lr;
+	RETURN_IF(!h && fd < 0, NULL);
+	if (!buf_size)
+		buf_size = SS_LR_DEF_BUF_SIZE;
+	/*
+	 * Room for a max size line plus its "\r\n" terminator, so it is never
+	 * required to grow the buffer when a max line size is given
+	 */
+	if (max_line_size) {
+		RETURN_IF(s_size_t_overflow(max_line_size, 2), NULL);
+		buf_size = S_MAX(buf_size, max_line_size + 2);
+	}
+	lr = (srt_line_reader *)s_malloc(sizeof(srt_line_reader));
+	RETURN_IF(!lr, NULL);
+	lr->buf = (char *)s_malloc(buf_size);
+	if (!lr->buf) {
+		s_free(lr);
+		return NULL;
+	}
+	lr->h = h;
+	lr->fd = fd;
+	lr->buf_size = buf_size;
+	lr->size = lr->off = lr->scan_off = 0;
+	lr->max_line_size = max_line_size;
+	lr->eof = lr->error = S_FALSE;
+	return lr;
+}
+
+srt_line_reader *ss_lr_alloc(FILE *handle, size_t buf_size,
+			     size_t max_line_size)
+{
+	RETURN_IF(!handle, NULL);
+	return aux_lr_alloc(handle, -1, buf_size, max_line_size);
+}
+
+#ifndef S_MINIMAL
+srt_line_reader *ss_lr_alloc_fd(int fd, size_t buf_size, size_t max_line_size)
+{
+	return aux_lr_alloc(NULL, fd, buf_size, max_line_size);
+}
+#endif
+
+/*
+ * Read more data at the buffer tail. If the buffer is full, the pending
+ * (partial) line is moved to the buffer start, or the buffer is grown if
+ * the pending line already takes the whole buffer.
+ */
+static void aux_lr_fill(srt_line_reader *lr)
+{
+	char *b;
+	size_t pending, l, new_size;
+#ifndef S_MINIMAL
+	ssize_t r;
+#endif
+	if (lr->size == lr->buf_size) {
+		pending = lr->size - lr->off;
+		if (lr->off > 0) {
+			memmove(lr->buf, lr->buf + lr->off, pending);
+			lr->scan_off -= lr->off;
+			lr->size = pending;
+			lr->off = 0;
+		} else {
+			new_size = s_size_t_overflow(lr->buf_size, lr->buf_size)
+					   ? 0
+					   : lr->buf_size * 2;
+			b = new_size ? (char *)s_realloc(lr->buf, new_size)
+				     : NULL;
+			if (!b) { /* BEHAVIOR: out of memory */
+				lr->error = lr->eof = S_TRUE;
+				return;
+			}
+			lr->buf = b;
+			lr->buf_size = new_size;
+		}
+	}
+	b = lr->buf + lr->size;
+	l = lr->buf_size - lr->size;
+#ifndef S_MINIMAL
+	if (!lr->h) {
+		r = S_FD_READ(lr->fd, b, l);
+		if (r <= 0) {
+			lr->eof = S_TRUE;
+			lr->error = r < 0 ? S_TRUE : S_FALSE;
+			return;
+		}
+		lr->size += (size_t)r;
+		return;
+	}
+#endif
+	l = fread(b, 1, l, lr->h);
+	if (!l) {
+		lr->eof = S_TRUE;
+		lr->error = ferror(lr->h) ? S_TRUE : S_FALSE;
+		return;
+	}
+	lr->size += l;
+}
+
+const srt_string *ss_lr_next(srt_line_reader *lr, srt_string_ref *line)
+{
+	const char *p, *nl;
+	size_t pending, ls, cr, max_ls;
+	RETURN_IF(!lr || !line, NULL);
+	max_ls = lr->max_line_size;
+	for (;;) {
+		p = lr->buf + lr->off;
+		nl = (const char *)memchr(lr->buf + lr->scan_off, '\n',
+					  lr->size - lr->scan_off);
+		if (nl) {
+			ls = (size_t)(nl - p);
+			cr = ls > 0 && p[ls - 1] == '\r' ? 1 : 0;
+			if (max_ls && ls - cr > max_ls) {
+				lr->off += max_ls;
+				lr->scan_off = (size_t)(nl - lr->buf);
+				return ss_ref_buf(line, p, max_ls);
+			}
+			lr->off += ls + 1;
+			lr->scan_off = lr->off;
+			return ss_ref_buf(line, p, ls - cr);
+		}
+		lr->scan_off = lr->size;
+		pending = lr->size - lr->off;
+		/*
+		 * Being the buffer at least max_ls + 2 bytes, a pending line
+		 * of that size can not be a max size line plus "\r\n"
+		 */
+		if (max_ls && pending >= max_ls + 2) {
+			lr->off += max_ls;
+			return ss_ref_buf(line, p, max_ls);
+		}
+		if (lr->eof) {
+			RETURN_IF(!pending, NULL);
+			/* BEHAVIOR: last line without terminator */
+			ls = max_ls ? S_MIN(pending, max_ls) : pending;
+			lr->off += ls;
+			return ss_ref_buf(line, p, ls);
+		}
+		aux_lr_fill(lr);
+	}
+}
+
+srt_bool ss_lr_error(const srt_line_reader *lr)
+{
+	return !lr || lr->error ? S_TRUE : S_FALSE;
+}
+
+void ss_lr_free(srt_line_reader **lr)
+{
+	if (lr && *lr) {
+		s_free((*lr)->buf);
+		s_free(*lr);
+		*lr = NULL;
+	}
+}
+
+/*
+ * Framed LZ, entropy-coded LZ, delta, and LZ with compression level,
+ * reusable context or dictionary
+ */
+
+enum eAuxLZ {
+	AUX_LZF_ENC,
+	AUX_LZF_DEC,
+	AUX_LZ_LEVEL,
+	AUX_LZ_CTX,
+	AUX_LZ_DICT_ENC,
+	AUX_LZ_DICT_DEC,
+	AUX_LZE_ENC,
+	AUX_LZE_DEC,
+	AUX_LZF_RANGE,
+	AUX_DELTA_ENC,
+	AUX_DELTA_DEC
+};
+
+struct AuxLZ {
+	enum eAuxLZ op;
+	size_t block_size, nthreads;
+	int flags;
+	srt_lz_ctx *ctx;
+	const srt_lz_dict *dict;
+	size_t off, len;
+	const srt_string *base;
+};
+
+static size_t aux_lz_f(const struct AuxLZ *a, const uint8_t *in,
+		       const size_t in_size, uint8_t *o)
+{
+	switch (a->op) {
+	case AUX_LZF_ENC:
+		return senc_lzf(in, in_size, o, a->block_size, a->flags,
+				a->nthreads);
+	case AUX_LZF_DEC:
+		return sdec_lzf(in, in_size, o, a->nthreads);
+	case AUX_LZ_CTX:
+		return senc_lz_ctx(a->ctx, in, in_size, o);
+	case AUX_LZ_DICT_ENC:
+		return senc_lz_dict(a->dict, in, in_size, o);
+	case AUX_LZ_DICT_DEC:
+		return sdec_lz_dict(a->dict, in, in_size, o);
+	case AUX_LZE_ENC:
+		return senc_lze(in, in_size, o, a->flags);
+	case AUX_LZE_DEC:
+		return sdec_lze(in, in_size, o);
+	case AUX_LZF_RANGE:
+		return sdec_lzf_range(in, in_size, o, a->off, a->len);
+	case AUX_DELTA_ENC:
+		return senc_delta((const uint8_t *)ss_get_buffer_r(a->base),
+				  ss_size(a->base), in, in_size, o);
+	case AUX_DELTA_DEC:
+		return sdec_delta((const uint8_t *)ss_get_buffer_r(a->base),
+				  ss_size(a->base), in, in_size, o);
+	default:
+		return senc_lz_level(in, in_size, o, a->flags);
+	}
+}
+
+static srt_string *aux_lz(srt_string **s, const srt_bool cat,
+			  const srt_string *src, const struct AuxLZ *a)
+{
+	size_t n, in_size, at, out_size;
+	const uint8_t *in;
+	srt_string *src_aux = NULL;
+	ASSERT_RETURN_IF(!s, ss_void);
+	if (!src)
+		src = ss_void;
+	if (*s == src) { /* BEHAVIOR: not aliasing safe, using a copy */
+		ss_cpy(&src_aux, src);
+		src = src_aux;
+	}
+	in = (const uint8_t *)ss_get_buffer_r(src);
+	in_size = ss_size(src);
+	at = (cat && *s) ? ss_size(*s) : 0;
+	n = aux_lz_f(a, in, in_size, NULL);
+	out_size = s_size_t_add(at, n, S_NPOS);
+	if (n > 0 && ss_reserve(s, out_size) >= out_size) {
+		n = aux_lz_f(a, in, in_size, (uint8_t *)ss_get_buffer(*s) + at);
+		set_size(*s, at + n);
+		set_unicode_size_cached(*s, S_FALSE);
+	} else if (!cat && *s) {
+		ss_clear(*s); /* BEHAVIOR: e.g. invalid input */
+	}
+	if (src_aux)
+		ss_free(&src_aux);
+	return ss_check(s);
+}
+
+srt_string *ss_enc_lz_level(srt_string **s, const srt_string *src,
+			    const int level)
+{
+	struct AuxLZ a = {AUX_LZ_LEVEL, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.flags = level;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+srt_string *ss_enc_lze(srt_string **s, const srt_string *src, const int level)
+{
+	struct AuxLZ a = {AUX_LZE_ENC, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.flags = level;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+srt_string *ss_dec_lze(srt_string **s, const srt_string *src)
+{
+	struct AuxLZ a = {AUX_LZE_DEC, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+srt_lz_ctx *ss_lz_ctx_alloc(const size_t hash_bits)
+{
+	return senc_lz_ctx_alloc(hash_bits);
+}
+
+srt_string *ss_enc_lz_ctx(srt_string **s, const srt_string *src,
+			  srt_lz_ctx *c)
+{
+	struct AuxLZ a = {AUX_LZ_CTX, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.ctx = c;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+srt_string *ss_cat_enc_lz_ctx(srt_string **s, const srt_string *src,
+			      srt_lz_ctx *c)
+{
+	struct AuxLZ a = {AUX_LZ_CTX, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.ctx = c;
+	return aux_lz(s, S_TRUE, src, &a);
+}
+
+void ss_lz_ctx_free(srt_lz_ctx **c)
+{
+	if (c) {
+		senc_lz_ctx_free(*c);
+		*c = NULL;
+	}
+}
+
+srt_string *ss_lz_dict_train(srt_string **dict, const srt_string *samples,
+			     const size_t *sizes, const size_t nsamples,
+			     const size_t max_size)
+{
+	size_t i, total, out_size = 0;
+	const uint8_t *in;
+	srt_string *src_aux = NULL;
+	ASSERT_RETURN_IF(!dict, ss_void);
+	if (!samples)
+		samples = ss_void;
+	if (*dict == samples) { /* BEHAVIOR: not aliasing safe, using a copy */
+		ss_cpy(&src_aux, samples);
+		samples = src_aux;
+	}
+	in = (const uint8_t *)ss_get_buffer_r(samples);
+	for (i = total = 0; i < nsamples && sizes; i++)
+		total = s_size_t_add(total, sizes[i], S_NPOS);
+	/* BEHAVIOR: sample sizes not matching the samples, empty output */
+	if (total <= ss_size(samples))
+		out_size = senc_lz_dict_train(in, sizes, nsamples, NULL,
+					      max_size);
+	if (out_size > 0 && ss_reserve(dict, out_size) >= out_size) {
+		out_size = senc_lz_dict_train(in, sizes, nsamples,
+					      (uint8_t *)ss_get_buffer(*dict),
+					      max_size);
+		set_size(*dict, out_size);
+		set_unicode_size_cached(*dict, S_FALSE);
+	} else if (*dict) {
+		ss_clear(*dict);
+	}
+	if (src_aux)
+		ss_free(&src_aux);
+	return ss_check(dict);
+}
+
+srt_lz_dict *ss_lz_dict_alloc(const srt_string *dict)
+{
+	RETURN_IF(!dict, NULL);
+	return senc_lz_dict_alloc((const uint8_t *)ss_get_buffer_r(dict),
+				  ss_size(dict));
+}
+
+uint32_t ss_lz_dict_id(const srt_lz_dict *d)
+{
+	return senc_lz_dict_id(d);
+}
+
+void ss_lz_dict_free(srt_lz_dict **d)
+{
+	if (d) {
+		senc_lz_dict_free(*d);
+		*d = NULL;
+	}
+}
+
+srt_string *ss_enc_lz_dict(srt_string **s, const srt_string *src,
+			   const srt_lz_dict *d)
+{
+	struct AuxLZ a = {AUX_LZ_DICT_ENC, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.dict = d;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+srt_string *ss_dec_lz_dict(srt_string **s, const srt_string *src,
+			   const srt_lz_dict *d)
+{
+	struct AuxLZ a = {AUX_LZ_DICT_DEC, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.dict = d;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+static srt_string *aux_delta(srt_string **s, const srt_string *base,
+			     const srt_string *src, const enum eAuxLZ op)
+{
+	srt_string *base_aux = NULL, *r;
+	struct AuxLZ a = {AUX_DELTA_ENC, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.op = op;
+	if (!base)
+		base = ss_void;
+	if (s && *s == base) { /* BEHAVIOR: not aliasing safe, using a copy */
+		ss_cpy(&base_aux, base);
+		base = base_aux;
+	}
+	a.base = base;
+	r = aux_lz(s, S_FALSE, src, &a);
+	if (base_aux)
+		ss_free(&base_aux);
+	return r;
+}
+
+srt_string *ss_enc_delta(srt_string **s, const srt_string *base,
+			 const srt_string *target)
+{
+	return aux_delta(s, base, target, AUX_DELTA_ENC);
+}
+
+srt_string *ss_dec_delta(srt_string **s, const srt_string *base,
+			 const srt_string *delta)
+{
+	return aux_delta(s, base, delta, AUX_DELTA_DEC);
+}
+
+srt_string *ss_enc_lzf(srt_string **s, const srt_string *src,
+		       const size_t block_size, const int flags,
+		       const size_t nthreads)
+{
+	struct AuxLZ a = {AUX_LZF_ENC, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.block_size = block_size;
+	a.nthreads = nthreads;
+	a.flags = flags;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+srt_string *ss_dec_lzf(srt_string **s, const srt_string *src,
+		       const size_t nthreads)
+{
+	struct AuxLZ a = {AUX_LZF_DEC, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.nthreads = nthreads;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+srt_string *ss_dec_lz_range(srt_string **s, const srt_string *src,
+			    const size_t off, const size_t len)
+{
+	struct AuxLZ a = {AUX_LZF_RANGE, 0, 0, 0, NULL, NULL, 0, 0, NULL};
+	a.off = off;
+	a.len = len;
+	return aux_lz(s, S_FALSE, src, &a);
+}
+
+/*
+ * Streaming codecs
+ */
+
+srt_codec *ss_codec_alloc(const enum eSCodec type)
+{
+	return scodec_alloc(type);
+}
+
+srt_codec *ss_codec_alloc_lzf(const enum eSCodec type, const size_t block_size,
+			      const int flags, const size_t nthreads)
+{
+	return scodec_alloc_lzf(type, block_size, flags, nthreads);
+}
+
+/*
+ * Output space is reserved first (output size upper bound, from passing
+ * NULL output), then the output is appended to the string
+ */
+static srt_string *aux_codec(srt_string **s, srt_codec *c,
+			     const srt_string *src, const srt_bool final)
+{
+	size_t in_size, at, out_size;
+	const uint8_t *src_buf;
+	uint8_t *o;
+	ASSERT_RETURN_IF(!s, ss_void);
+	if (!src)
+		src = ss_void;
+	in_size = ss_size(src);
+	src_buf = (const uint8_t *)ss_get_buffer_r(src);
+	at = *s ? ss_size(*s) : 0;
+	out_size = final ? scodec_final(c, NULL)
+			 : scodec_update(c, src_buf, in_size, NULL);
+	out_size = s_size_t_add(at, out_size, S_NPOS);
+	if (ss_reserve(s, out_size) < out_size) {
+		/* BEHAVIOR: the input is not consumed, so the stream is lost */
+		scodec_set_error(c);
+		return ss_check(s);
+	}
+	if (*s == src) /* aliasing: the buffer could be reallocated */
+		src_buf = (const uint8_t *)ss_get_buffer_r(*s);
+	o = (uint8_t *)ss_get_buffer(*s) + at;
+	out_size = at
+		   + (final ? scodec_final(c, o)
+			    : scodec_update(c, src_buf, in_size, o));
+	set_size(*s, out_size);
+	set_unicode_size_cached(*s, S_FALSE);
+	return ss_check(s);
+}
+
+srt_string *ss_codec_update(srt_string **s, srt_codec *c,
+			    const srt_string *src)
+{
+	return aux_codec(s, c, src, S_FALSE);
+}
+
+srt_string *ss_codec_final(srt_string **s, srt_codec *c)
+{
+	return aux_codec(s, c, NULL, S_TRUE);
+}
+
+srt_bool ss_codec_error(const srt_codec *c)
+{
+	return scodec_error(c);
+}
+
+void ss_codec_free(srt_codec **c)
+{
+	if (c) {
+		scodec_free(*c);
+		*c = NULL;
+	}
+}
+
 /*
  * Hashing
  */
 
+uint64_t ss_hash(const srt_string *s)
+{
+	uint64_t h;
+	srt_string *ws;
+	RETURN_IF(!s, S_FNV1A64_INIT);
+	RETURN_IF(is_hash_cached(s), s->hash);
+	h = sh_fnv1a64(S_FNV1A64_INIT, ss_get_buffer_r(s), ss_size(s));
+	/*
+	 * BEHAVIOR:
+	 * Small strings are not cached (no room in the header, and hashing
+	 * them is cheap). References are not cached either, as the
+	 * referenced buffer could be modified externally. Constness is kept
+	 * regarding the string logical state (same as with ss_len_u()).
+	 */
+	if (sdx_full_st(&s->d) && !ss_is_ref(s)) {
+		ws = (srt_string *)s;
+		ws->hash = h;
+		ws->d.sub_type |= SS_HASH_CACHED;
+	}
+	return h;
+}
+
+uint64_t ss_hash64(const srt_string *s)
+{
+	return sh_hash64(0, s ? ss_get_buffer_r(s) : "", ss_size(s));
+}
+
+uint64_t ss_hash64_seed(const srt_string *s, uint64_t seed)
+{
+	return sh_hash64_keyed(seed, s ? ss_get_buffer_r(s) : "", ss_size(s));
+}
+
+uint32_t ss_buzhash(const srt_string *s, size_t off, size_t w)
+{
+	size_t ss = ss_size(s);
+	RETURN_IF(off >= ss, 0);
+	return sh_buzhash(ss_get_buffer_r(s) + off, S_MIN(w, ss - off));
+}
+
+uint32_t ss_buzhash_roll(uint32_t h, int c_out, int c_in, size_t w)
+{
+	return sh_buzhash_roll(h, (uint8_t)c_out, (uint8_t)c_in, w);
+}
+
+size_t ss_cdc_next(const srt_string *s, size_t off, size_t min, size_t avg,
+		   size_t max, srt_bool last)
+{
+	size_t ss = ss_size(s);
+	RETURN_IF(off >= ss, 0);
+	return sh_cdc(ss_get_buffer_r(s) + off, ss - off, min, avg, max, last);
+}
+
+static void aux_cdc_vector(srt_vector **v, size_t reserve)
+{
+	if (!v)
+		return;
+	if (*v)
+		sv_clear(*v);
+	else
+		*v = sv_alloc_t(SV_U64, reserve);
+}
+
+size_t ss_cdc(srt_vector **ends, srt_vector **hashes, const srt_string *s,
+	      size_t min, size_t avg, size_t max)
+{
+	size_t off = 0, n, nchunks = 0;
+	const char *p = ss_get_buffer_r(s);
+	aux_cdc_vector(ends, ss_size(s) / S_MAX(avg, 1) + 1);
+	aux_cdc_vector(hashes, ss_size(s) / S_MAX(avg, 1) + 1);
+	for (; (n = ss_cdc_next(s, off, min, avg, max, S_TRUE)) > 0;
+	     off += n, nchunks++) {
+		if (ends)
+			sv_push_u(ends, off + n);
+		if (hashes)
+			sv_push_u(hashes, sh_hash64(0, p + off, n));
+	}
+	return nchunks;
+}
+
 uint32_t ss_crc32(const srt_string *s)
 {
 	return ss_crc32r(s, 0, 0, S_NPOS);
@@ -2239,25 +3103,83 @@ uint32_t ss_crc32(const srt_string *s)
 uint32_t ss_crc32r(const srt_string *s, uint32_t crc, size_t off1, size_t off2)
 {
 	size_t ss, offx;
-	RETURN_IF(!s || off1 >= off2, 0);
+	/* BEHAVIOR: empty range, checksum not changed (as ss_adler32r()) */
+	RETURN_IF(!s || off1 >= off2, crc);
 	ss = ss_size(s);
-	RETURN_IF(off1 >= ss, 0);
-	offx = off2 == S_NPOS ? ss : off2;
+	RETURN_IF(off1 >= ss, crc);
+	offx = S_MIN(off2, ss);
 	return sh_crc32(crc, ss_get_buffer_r(s) + off1, offx - off1);
 }
 
+uint32_t ss_crc32_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b)
+{
+	return sh_crc32_combine(crc_a, crc_b, len_b);
+}
+
+uint32_t ss_crc32_parallel(const srt_string *s, const size_t nthreads)
+{
+	/* BEHAVIOR: same result as ss_crc32() (e.g. 0 for empty string) */
+	RETURN_IF(!ss_size(s), 0);
+	return sh_crc32_parallel(S_CRC32_INIT, ss_get_buffer_r(s), ss_size(s),
+				 nthreads);
+}
+
+uint32_t ss_crc32c(const srt_string *s)
+{
+	return ss_crc32cr(s, 0, 0, S_NPOS);
+}
+
+uint32_t ss_crc32cr(const srt_string *s, uint32_t crc, size_t off1,
+		    size_t off2)
+{
+	size_t ss, offx;
+	RETURN_IF(!s || off1 >= off2, crc);
+	ss = ss_size(s);
+	RETURN_IF(off1 >= ss, crc);
+	offx = S_MIN(off2, ss);
+	return sh_crc32c(crc, ss_get_buffer_r(s) + off1, offx - off1);
+}
+
+uint32_t ss_crc32c_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b)
+{
+	return sh_crc32c_combine(crc_a, crc_b, len_b);
+}
+
+uint32_t ss_crc32c_parallel(const srt_string *s, const size_t nthreads)
+{
+	/* BEHAVIOR: same result as ss_crc32c() (e.g. 0 for empty string) */
+	RETURN_IF(!ss_size(s), 0);
+	return sh_crc32c_parallel(S_CRC32C_INIT, ss_get_buffer_r(s),
+				  ss_size(s), nthreads);
+}
+
 uint32_t ss_adler32(const srt_string *s)
 {
-	return ss_adler32r(s, 0, 0, S_NPOS);
+	return ss_adler32r(s, S_ADLER32_INIT, 0, S_NPOS);
 }
 
 uint32_t ss_adler32r(const srt_string *s, uint32_t adler, size_t off1,
 		     size_t off2)
 {
 	size_t ss, offx;
-	RETURN_IF(!s || off1 >= off2, 0);
+	/* BEHAVIOR: empty range, same result as zlib (checksum not changed) */
+	RETURN_IF(!s || off1 >= off2, adler);
 	ss = ss_size(s);
-	RETURN_IF(off1 >= ss, 0);
-	offx = off2 == S_NPOS ? ss : off2;
+	RETURN_IF(off1 >= ss, adler);
+	offx = S_MIN(off2, ss);
 	return sh_adler32(adler, ss_get_buffer_r(s) + off1, offx - off1);
 }
+
+uint32_t ss_adler32_combine(uint32_t adler_a, uint32_t adler_b,
+			    uint64_t len_b)
+{
+	return sh_adler32_combine(adler_a, adler_b, len_b);
+}
+
+uint32_t ss_adler32_parallel(const srt_string *s, const size_t nthreads)
+{
+	/* BEHAVIOR: same result as ss_adler32() (e.g. 1 for empty string) */
+	RETURN_IF(!ss_size(s), S_ADLER32_INIT);
+	return sh_adler32_parallel(S_ADLER32_INIT, ss_get_buffer_r(s),
+				   ss_size(s), nthreads);
+}
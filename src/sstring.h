@@ -15,9 +15,13 @@ extern "C" {
  * #DOC interpreted as UTF-8 when calling to the Unicode function ss_len_u(),
  * #DOC and as raw data when calling the functions not using Unicode
  * #DOC interpretation (ss_len()/ss_size()). Strings below 256 bytes take just
- * #DOC 5 bytes for internal structure, and 5 * sizeof(size_t) for bigger
+ * #DOC 5 bytes for internal structure, and 5 * sizeof(size_t) + 8 for bigger
  * #DOC strings. Unicode size is cached between operations, when possible, so
  * #DOC in those cases UTF-8 string length computation would be O(1).
+ * #DOC For strings above 511 bytes having enough unused allocated space
+ * #DOC (see ss_index_u()), a sparse code point index is kept there, so
+ * #DOC Unicode character offset addressing (e.g. ss_dup_substr_u(),
+ * #DOC ss_erase_u(), ss_resize_u()) avoids scanning from the string start.
  *
  * Copyright (c) 2015-2018 F. Aragon. All rights reserved.
  * Released under the BSD 3-Clause License (see the doc/LICENSE)
@@ -40,11 +44,15 @@ extern "C" {
  *	flag2: string has UTF-8 encoding errors (e.g. after some operation)
  *	flag3: string reference (built using ss_cref[a]() or ss_ref[a]())
  *	flag4: string reference with C terminator (built using ss_cref[a]())
+ * - Usage of struct SDataFull 'sub_type' element (full container only):
+ *	bit 0: 'hash' element contains the string hash (see ss_hash())
+ *	bit 1: sparse code point index is stored after the string data
  */
 
 struct SString {
 	struct SDataFull d;
 	size_t unicode_size;
+	uint64_t hash;
 };
 
 struct SStringRef {
@@ -60,7 +68,7 @@ struct SStringRefRW {
 #define SS_RANGE (sizeof(size_t) - sizeof(srt_string))
 #define EMPTY_SS                                                               \
 	{                                                                      \
-		EMPTY_SDataFull, 0                                             \
+		EMPTY_SDataFull, 0, 0                                          \
 	}
 
 /*
@@ -122,7 +130,7 @@ srt_string *ss_shrink(srt_string **s)
 #API: |Get string size|string|string bytes used in UTF8 format|O(1)|1;2|
 size_t ss_size(const srt_string *s)
 
-#NOTAPI: |Set string size (bytes used in UTF8 format)|string;new size|-|O(1)|1;2|
+#NOTAPI: |Set string size (bytes used in UTF8 format), e.g. after writing into the buffer (cached Unicode size and hash get invalidated)|string;new size|-|O(1)|1;2|
 void ss_set_size(srt_string *s, const size_t s)
 
 #API: |Equivalent to ss_size|string|Number of bytes (UTF-8 string length)|O(1)|1;2|
@@ -205,6 +213,9 @@ int ss_at(const srt_string *s, size_t off);
 /* #API: |String length (Unicode)|string|number of Unicode characters|O(1) if cached, O(n) if not previously computed|1;2| */
 size_t ss_len_u(const srt_string *s);
 
+/* #API: |Reserve space for the sparse code point index (one byte offset every 64 Unicode characters, stored in the unused allocated space, and built on demand), avoiding full scans when using Unicode character offsets on long strings|string|S_TRUE: index available; S_FALSE: not available (string below 512 bytes, reference, or not enough memory)|O(n)|1;2| */
+srt_bool ss_index_u(srt_string **s);
+
 /* #API: |Get the maximum possible string size|string|max string size (bytes)|O(1)|1;2| */
 size_t ss_max(const srt_string *s);
 
@@ -259,6 +270,9 @@ srt_string *ss_dup_toupper(const srt_string *src);
 /* #API: |Duplicate string with base64 encoding|string|output result|O(n)|1;2| */
 srt_string *ss_dup_enc_b64(const srt_string *src);
 
+/* #API: |Duplicate string with base64url encoding (URL and filename safe alphabet, no padding)|string|output result|O(n)|1;2| */
+srt_string *ss_dup_enc_b64url(const srt_string *src);
+
 /* #API: |Duplicate string with hex encoding|string|output result|O(n)|1;2| */
 srt_string *ss_dup_enc_hex(const srt_string *src);
 
@@ -271,6 +285,9 @@ srt_string *ss_dup_enc_lz(const srt_string *src);
 /* #API: |Duplicate string with LZ encoding (high compession)|string|output result|O(n)|1;2| */
 srt_string *ss_dup_enc_lzh(const srt_string *src);
 
+/* #API: |Duplicate string with UTF-8 to UTF-16LE encoding|string|output result|O(n)|1;2| */
+srt_string *ss_dup_enc_utf16le(const srt_string *src);
+
 /* #API: |Duplicate string with JSON escape encoding|string|output result|O(n)|1;2| */
 srt_string *ss_dup_enc_esc_json(const srt_string *src);
 
@@ -289,12 +306,24 @@ srt_string *ss_dup_enc_esc_squote(const srt_string *src);
 /* #API: |Duplicate string with base64 decoding|string|output result|O(n)|1;2| */
 srt_string *ss_dup_dec_b64(const srt_string *src);
 
-/* #API: |Duplicate string with hex decoding|string|output result|O(n)|1;2| */
+/* #API: |Duplicate string with strict base64 decoding (empty result if the input is not valid)|string|output result|O(n)|1;2| */
+srt_string *ss_dup_dec_b64_strict(const srt_string *src);
+
+/* #API: |Duplicate string with base64url decoding|string|output result|O(n)|1;2| */
+srt_string *ss_dup_dec_b64url(const srt_string *src);
+
+/* #API: |Duplicate string with strict base64url decoding (empty result if the input is not valid)|string|output result|O(n)|1;2| */
+srt_string *ss_dup_dec_b64url_strict(const srt_string *src);
+
+/* #API: |Duplicate string with hex decoding (empty result if the input has non-hex characters)|string|output result|O(n)|1;2| */
 srt_string *ss_dup_dec_hex(const srt_string *src);
 
 /* #API: |Duplicate string with LZ decoding|string|output result|O(n)|1;2| */
 srt_string *ss_dup_dec_lz(const srt_string *src);
 
+/* #API: |Duplicate string with UTF-16LE to UTF-8 decoding|string|output result|O(n)|1;2| */
+srt_string *ss_dup_dec_utf16le(const srt_string *src);
+
 /* #API: |Duplicate string with JSON escape decoding|string|output result|O(n)|1;2| */
 srt_string *ss_dup_dec_esc_json(const srt_string *src);
 
@@ -383,6 +412,9 @@ srt_string *ss_cpy_toupper(srt_string **s, const srt_string *src);
 /* #API: |Overwrite string with input string base64 encoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_enc_b64(srt_string **s, const srt_string *src);
 
+/* #API: |Overwrite string with input string base64url encoding copy (URL and filename safe alphabet, no padding)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cpy_enc_b64url(srt_string **s, const srt_string *src);
+
 /* #API: |Overwrite string with input string hexadecimal (lowercase) encoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_enc_hex(srt_string **s, const srt_string *src);
 
@@ -395,6 +427,9 @@ srt_string *ss_cpy_enc_lz(srt_string **s, const srt_string *src);
 /* #API: |Overwrite string with input string LZ encoded copy (high compression)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_enc_lzh(srt_string **s, const srt_string *src);
 
+/* #API: |Overwrite string with input string UTF-16LE encoded copy|output string; input string (UTF-8)|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cpy_enc_utf16le(srt_string **s, const srt_string *src);
+
 /* #API: |Overwrite string with input string JSON escape encoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_enc_esc_json(srt_string **s, const srt_string *src);
 
@@ -413,12 +448,24 @@ srt_string *ss_cpy_enc_esc_squote(srt_string **s, const srt_string *src);
 /* #API: |Overwrite string with input string base64 decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_dec_b64(srt_string **s, const srt_string *src);
 
-/* #API: |Overwrite string with input string hexadecimal (lowercase) decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+/* #API: |Overwrite string with input string strict base64 decoding copy (empty string if the input is not valid)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cpy_dec_b64_strict(srt_string **s, const srt_string *src);
+
+/* #API: |Overwrite string with input string base64url decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cpy_dec_b64url(srt_string **s, const srt_string *src);
+
+/* #API: |Overwrite string with input string strict base64url decoding copy (empty string if the input is not valid)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cpy_dec_b64url_strict(srt_string **s, const srt_string *src);
+
+/* #API: |Overwrite string with input string hexadecimal (lowercase or uppercase) decoding copy (empty string if the input has non-hex characters)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_dec_hex(srt_string **s, const srt_string *src);
 
 /* #API: |Overwrite string with input string LZ decoded copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_dec_lz(srt_string **s, const srt_string *src);
 
+/* #API: |Overwrite string with input string UTF-16LE decoded copy (UTF-8 output)|output string; input string (UTF-16LE)|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cpy_dec_utf16le(srt_string **s, const srt_string *src);
+
 /* #API: |Overwrite string with input string JSON escape decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cpy_dec_esc_json(srt_string **s, const srt_string *src);
 
@@ -522,6 +569,9 @@ srt_string *ss_cat_toupper(srt_string **s, const srt_string *src);
 /* #API: |Concatenate string with input string base64 encoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_enc_b64(srt_string **s, const srt_string *src);
 
+/* #API: |Concatenate string with input string base64url encoding copy (URL and filename safe alphabet, no padding)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cat_enc_b64url(srt_string **s, const srt_string *src);
+
 /* #API: |Concatenate string with input string hexadecimal (lowercase) encoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_enc_hex(srt_string **s, const srt_string *src);
 
@@ -534,6 +584,9 @@ srt_string *ss_cat_enc_lz(srt_string **s, const srt_string *src);
 /* #API: |Concatenate string with input string LZ encoded copy (high compression)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_enc_lzh(srt_string **s, const srt_string *src);
 
+/* #API: |Concatenate string with input string UTF-16LE encoded copy|output string; input string (UTF-8)|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cat_enc_utf16le(srt_string **s, const srt_string *src);
+
 /* #API: |Concatenate string with input string JSON escape encoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_enc_esc_json(srt_string **s, const srt_string *src);
 
@@ -552,12 +605,24 @@ srt_string *ss_cat_enc_esc_squote(srt_string **s, const srt_string *src);
 /* #API: |Concatenate string with input string base64 decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_dec_b64(srt_string **s, const srt_string *src);
 
-/* #API: |Concatenate string with input string hexadecimal (lowercase) decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+/* #API: |Concatenate string with input string strict base64 decoding copy (nothing is appended if the input is not valid)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cat_dec_b64_strict(srt_string **s, const srt_string *src);
+
+/* #API: |Concatenate string with input string base64url decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cat_dec_b64url(srt_string **s, const srt_string *src);
+
+/* #API: |Concatenate string with input string strict base64url decoding copy (nothing is appended if the input is not valid)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cat_dec_b64url_strict(srt_string **s, const srt_string *src);
+
+/* #API: |Concatenate string with input string hexadecimal (lowercase or uppercase) decoding copy (nothing is appended if the input has non-hex characters)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_dec_hex(srt_string **s, const srt_string *src);
 
 /* #API: |Concatenate string with input string LZ decoded copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_dec_lz(srt_string **s, const srt_string *src);
 
+/* #API: |Concatenate string with input string UTF-16LE decoded copy (UTF-8 output)|output string; input string (UTF-16LE)|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cat_dec_utf16le(srt_string **s, const srt_string *src);
+
 /* #API: |Concatenate string with input string JSON escape decoding copy|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_cat_dec_esc_json(srt_string **s, const srt_string *src);
 
@@ -619,9 +684,27 @@ srt_string *ss_tolower(srt_string **s);
 /* #API: |Convert string to uppercase|output string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_toupper(srt_string **s);
 
+/* #API: |Unicode normalization: canonical decomposition followed by canonical composition (NFC). If the string is already normalized, it is kept as is (no allocation)|input/output string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_normalize_nfc(srt_string **s);
+
+/* #API: |Unicode normalization: canonical decomposition (NFD). If the string is already normalized, it is kept as is (no allocation)|input/output string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_normalize_nfd(srt_string **s);
+
+/* #API: |Unicode normalization: compatibility decomposition followed by canonical composition (NFKC). If the string is already normalized, it is kept as is (no allocation)|input/output string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_normalize_nfkc(srt_string **s);
+
+/* #API: |Unicode normalization: compatibility decomposition (NFKD). If the string is already normalized, it is kept as is (no allocation)|input/output string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_normalize_nfkd(srt_string **s);
+
+/* #API: |Unicode full case folding (e.g. for caseless matching). If the string has no characters to be folded, it is kept as is (no allocation)|input/output string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_casefold(srt_string **s);
+
 /* #API: |Convert to base64|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_enc_b64(srt_string **s, const srt_string *src);
 
+/* #API: |Convert to base64url (URL and filename safe alphabet, no padding)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_enc_b64url(srt_string **s, const srt_string *src);
+
 /* #API: |Convert to hexadecimal (lowercase)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_enc_hex(srt_string **s, const srt_string *src);
 
@@ -634,6 +717,16 @@ srt_string *ss_enc_lz(srt_string **s, const srt_string *src);
 /* #API: |Convert to LZ (high compression)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_enc_lzh(srt_string **s, const srt_string *src);
 
+/* #API: |Convert to LZ, with compression level: 0 (ss_enc_lz()), 1 (ss_enc_lzh()), 2 to S_LZ_LEVEL_MAX (9): higher compression, slower encoding (same format, decoded with ss_dec_lz(), and same decoding speed)|output string; input string; compression level|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_enc_lz_level(srt_string **s, const srt_string *src,
+			    const int level);
+
+/* #API: |Convert to entropy-coded LZ (LZ parsing with the given compression level, followed by block-wise Huffman coding of literals, lengths and distances): higher compression than ss_enc_lz_level(), slower decoding|output string; input string; compression level (0 to S_LZ_LEVEL_MAX)|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_enc_lze(srt_string **s, const srt_string *src, const int level);
+
+/* #API: |Convert from UTF-8 to UTF-16LE (broken UTF-8 sequences, overlong forms, and surrogates are converted to U+FFFD, one for every maximal subpart of a not valid sequence)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_enc_utf16le(srt_string **s, const srt_string *src);
+
 /* #API: |Convert/escape for JSON encoding|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_enc_esc_json(srt_string **s, const srt_string *src);
 
@@ -652,12 +745,27 @@ srt_string *ss_enc_esc_squote(srt_string **s, const srt_string *src);
 /* #API: |Decode from base64|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_dec_b64(srt_string **s, const srt_string *src);
 
-/* #API: |Decode from hexadecimal (lowercase)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+/* #API: |Decode from base64, strict mode: characters not in the alphabet, wrong padding or size, and non-canonical encoding are rejected (empty string)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_dec_b64_strict(srt_string **s, const srt_string *src);
+
+/* #API: |Decode from base64url (padding is optional)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_dec_b64url(srt_string **s, const srt_string *src);
+
+/* #API: |Decode from base64url, strict mode (empty string if the input is not valid)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_dec_b64url_strict(srt_string **s, const srt_string *src);
+
+/* #API: |Decode from hexadecimal (lowercase or uppercase). If the input has non-hex characters, the output is empty|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_dec_hex(srt_string **s, const srt_string *src);
 
 /* #API: |Decode from LZ|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_dec_lz(srt_string **s, const srt_string *src);
 
+/* #API: |Decode from entropy-coded LZ (empty string if the input is not valid)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_dec_lze(srt_string **s, const srt_string *src);
+
+/* #API: |Convert from UTF-16LE to UTF-8 (unpaired surrogates are ignored)|output string; input string|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_dec_utf16le(srt_string **s, const srt_string *src);
+
 /* #API: |Unescape from JSON encoding|output string; input string|output string reference (optional usage)|O(n)|1;2| */
 srt_string *ss_dec_esc_json(srt_string **s, const srt_string *src);
 
@@ -765,6 +873,65 @@ size_t ss_findr_cn(const srt_string *s, const size_t off, const size_t max_off,
 /* #API: |Split/tokenize: break string by separators|input string; separator; output substring references; number of output substrings|Number of elements|O(n)|1;2| */
 size_t ss_split(const srt_string *src, const srt_string *separator, srt_string_ref out_substrings[], const size_t max_refs);
 
+/*
+ * Approximate search
+ *
+ * Observations:
+ * - Levenshtein (edit) distance: minimum number of single element
+ *   insertions, deletions, and substitutions, for converting one string
+ *   into the other. Bit-parallel computation: O(n * ceil(m / 64)) time,
+ *   being m and n the string sizes (m the shorter one).
+ * - Functions without "_u" suffix work with bytes, and with Unicode
+ *   characters (code points, no normalization) when having "_u" suffix.
+ */
+
+/* #API: |Edit distance (Levenshtein)|string 1; string 2|Edit distance, in bytes|O(n * m / 64)|1;2| */
+size_t ss_edit_distance(const srt_string *s1, const srt_string *s2);
+
+/* #API: |Edit distance (Levenshtein), Unicode|string 1; string 2|Edit distance, in Unicode characters|O(n * m / 64)|1;2| */
+size_t ss_edit_distance_u(const srt_string *s1, const srt_string *s2);
+
+/* #API: |Bounded edit distance (Levenshtein): stops as soon as the distance is known to be over the limit|string 1; string 2; maximum distance|Edit distance, in bytes, or S_NPOS if over the maximum distance|O(n * m / 64)|1;2| */
+size_t ss_edit_distance_k(const srt_string *s1, const srt_string *s2, const size_t max_dist);
+
+/* #API: |Bounded edit distance (Levenshtein), Unicode: stops as soon as the distance is known to be over the limit|string 1; string 2; maximum distance|Edit distance, in Unicode characters, or S_NPOS if over the maximum distance|O(n * m / 64)|1;2| */
+size_t ss_edit_distance_k_u(const srt_string *s1, const srt_string *s2, const size_t max_dist);
+
+/* #API: |Find approximate substring: leftmost match with edit distance <= maximum distance (the match is extended while the distance decreases)|input string; search offset start; target string; maximum edit distance (bytes); match size output (optional: NULL)|Offset location if found, S_NPOS if not found|O(n * m / 64)|1;2| */
+size_t ss_find_fuzzy(const srt_string *s, const size_t off, const srt_string *tgt, const size_t max_dist, size_t *match_size);
+
+/* #API: |Find approximate substring, Unicode: leftmost match with edit distance <= maximum distance (the match is extended while the distance decreases)|input string; search offset start; target string; maximum edit distance (Unicode characters); match size output, in bytes (optional: NULL)|Offset location if found, S_NPOS if not found|O(n * m / 64)|1;2| */
+size_t ss_find_fuzzy_u(const srt_string *s, const size_t off, const srt_string *tgt, const size_t max_dist, size_t *match_size);
+
+/*
+ * Regular expressions
+ *
+ * Observations:
+ * - O(n) search time for any pattern and input (no backtracking): lazily
+ *   built DFA, with NFA simulation fallback. See src/saux/sregex.h for the
+ *   supported syntax.
+ * - Compiled expressions keep a DFA cache (bounded size), so they are not
+ *   "const" when searching, and must not be shared between threads.
+ * - Captures are returned as references into the input string.
+ */
+
+typedef struct SRegex srt_regex;
+
+/* #API: |Compile regular expression|pattern (UTF-8)|compiled regular expression (NULL if syntax error or out of memory)|O(n)|1;2| */
+srt_regex *ss_regex_alloc(const srt_string *pattern);
+
+/* #API: |Number of capture groups|compiled regular expression|number of groups, not counting the whole match (group 0)|O(1)|1;2| */
+size_t ss_regex_ngroups(const srt_regex *r);
+
+/* #API: |Find regular expression leftmost match|input string; search offset start; compiled regular expression; output capture references, i.e. 0: whole match, 1 to n: groups (optional: NULL); number of output capture references|Offset location if found, S_NPOS if not found|O(n)|1;2| */
+size_t ss_regex_find(const srt_string *s, const size_t off, srt_regex *r, srt_string_ref caps[], const size_t max_caps);
+
+/* #API: |Split/tokenize: break string by regular expression matches (empty matches are ignored)|input string; compiled regular expression; output substring references; number of output substrings|Number of elements|O(n)|1;2| */
+size_t ss_regex_split(const srt_string *src, srt_regex *r, srt_string_ref out_substrings[], const size_t max_refs);
+
+/* #API: |Free compiled regular expression|compiled regular expression|-|O(1)|1;2| */
+void ss_regex_free(srt_regex **r);
+
 /*
  * Compare
  */
@@ -772,6 +939,9 @@ size_t ss_split(const srt_string *src, const srt_string *separator, srt_string_r
 /* #API: |String compare|string 1; string 2|0: s1 = s2; < 0: s1 lower than s2; > 0: s1 greater than s2|O(n)|1;2| */
 int ss_cmp(const srt_string *s1, const srt_string *s2);
 
+/* #API: |String equality check (cached hashes, if available, are used for early inequality detection)|string 1; string 2|S_TRUE: s1 = s2; S_FALSE: s1 != s2|O(n)|1;2| */
+srt_bool ss_equal(const srt_string *s1, const srt_string *s2);
+
 /* #API: |Case-insensitive string compare|string 1; string 2|0: s1 = s2; < 0: s1 lower than s2; > 0: s1 greater than s2|O(n)|1;2| */
 int ss_cmpi(const srt_string *s1, const srt_string *s2);
 
@@ -811,22 +981,246 @@ ssize_t ss_read(srt_string **s, FILE *handle, const size_t max_bytes);
 /* #API: |Write to file|output file; string; string offset; bytes to write|written bytes < 0: error|O(n): WARNING: involves external file I/O|1;2| */
 ssize_t ss_write(FILE *handle, const srt_string *s, const size_t offset, const size_t bytes);
 
+/*
+ * Line reader
+ *
+ * Observations:
+ * - Lines are returned as references into the reader internal buffer, so
+ *   they are valid until the next ss_lr_next() or ss_lr_free() call.
+ * - Line terminator ("\n" or "\r\n") is not included in the returned line.
+ * - Data is only moved when a line crosses the end of the buffer (the
+ *   partial line is moved to the buffer start before reading more data).
+ * - If a max line size is given, longer lines are returned split in chunks
+ *   of that size (like fgets() does), so the buffer never grows beyond that.
+ *   Otherwise, the buffer grows as required for holding the longest line.
+ */
+
+typedef struct SLineReader srt_line_reader;
+
+/* #API: |Allocate line reader for a file handle|file handle; buffer size (0 for default: 64KB); max line size (0 for unlimited)|line reader (NULL if out of memory)|O(1)|1;2| */
+srt_line_reader *ss_lr_alloc(FILE *handle, size_t buf_size, size_t max_line_size);
+
+#ifndef S_MINIMAL
+/* #API: |Allocate line reader for a file descriptor|file descriptor; buffer size (0 for default: 64KB); max line size (0 for unlimited)|line reader (NULL if out of memory)|O(1)|1;2| */
+srt_line_reader *ss_lr_alloc_fd(int fd, size_t buf_size, size_t max_line_size);
+#endif
+
+/* #API: |Get next line|line reader; line reference container|line string reference (NULL if no more lines or error)|O(n): WARNING: involves external file I/O|1;2| */
+const srt_string *ss_lr_next(srt_line_reader *lr, srt_string_ref *line);
+
+/* #API: |Check line reader I/O or memory errors|line reader|S_TRUE: error; S_FALSE: no error|O(1)|1;2| */
+srt_bool ss_lr_error(const srt_line_reader *lr);
+
+/* #API: |Free line reader (the file handle or descriptor is not closed)|line reader|-|O(1)|1;2| */
+void ss_lr_free(srt_line_reader **lr);
+
+/*
+ * LZ compression context
+ *
+ * Observations:
+ * - For compressing many small inputs (e.g. records of a few hundred bytes
+ *   or KB): the hash table is allocated once, and it is not cleared between
+ *   calls. Output is decoded with ss_dec_lz(), but it may differ from the
+ *   ss_enc_lz() one (the whole table is used, even for small inputs, so
+ *   compression is usually better).
+ * - Not thread-safe: use one context per thread.
+ */
+
+typedef struct SLZCtx srt_lz_ctx;
+
+/* #API: |Allocate LZ compression context|hash table size in bits (0 for default: 14 bits, i.e. 16384 elements, or 11 bits if built with S_MINIMAL)|context (NULL if out of memory)|O(1)|1;2| */
+srt_lz_ctx *ss_lz_ctx_alloc(const size_t hash_bits);
+
+/* #API: |Convert to LZ, using a compression context|output string; input string; context|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_enc_lz_ctx(srt_string **s, const srt_string *src,
+			  srt_lz_ctx *c);
+
+/* #API: |Append LZ-encoded input, using a compression context|output string; input string; context|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_cat_enc_lz_ctx(srt_string **s, const srt_string *src,
+			      srt_lz_ctx *c);
+
+/* #API: |Free LZ compression context|context|-|O(1)|1;2| */
+void ss_lz_ctx_free(srt_lz_ctx **c);
+
+/*
+ * LZ dictionary
+ *
+ * Observations:
+ * - For compressing small records sharing a lot of content (e.g. JSON log
+ *   lines, or protocol messages), which usually don't compress by
+ *   themselves: references can point to the dictionary, as if every record
+ *   were its continuation.
+ * - The dictionary can be built from record samples (ss_lz_dict_train()),
+ *   and it must be the same for encoding and decoding (the output has a
+ *   32-bit dictionary ID, so using a different one gives no output).
+ * - Read-only after being allocated: it can be used by several threads.
+ */
+
+typedef struct SLZDict srt_lz_dict;
+
+/* #API: |Build LZ dictionary from samples (concatenated), the most frequent content being placed at the dictionary end|output dictionary; samples; sample sizes; number of samples; maximum dictionary size|output dictionary reference (optional usage)|O(n log n)|1;2| */
+srt_string *ss_lz_dict_train(srt_string **dict, const srt_string *samples,
+			     const size_t *sizes, const size_t nsamples,
+			     const size_t max_size);
+
+/* #API: |Allocate LZ dictionary (a copy of the content is done)|dictionary content (at least 4 bytes)|dictionary (NULL if too small or out of memory)|O(n)|1;2| */
+srt_lz_dict *ss_lz_dict_alloc(const srt_string *dict);
+
+/* #API: |Get LZ dictionary ID (CRC-32 of its content)|dictionary|dictionary ID|O(1)|1;2| */
+uint32_t ss_lz_dict_id(const srt_lz_dict *d);
+
+/* #API: |Free LZ dictionary|dictionary|-|O(1)|1;2| */
+void ss_lz_dict_free(srt_lz_dict **d);
+
+/* #API: |Convert to LZ, using a dictionary|output string; input string; dictionary|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_enc_lz_dict(srt_string **s, const srt_string *src,
+			   const srt_lz_dict *d);
+
+/* #API: |Decode from LZ, using a dictionary (empty string if the input is not valid or the dictionary is not the one used for encoding)|output string; input string; dictionary|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_dec_lz_dict(srt_string **s, const srt_string *src,
+			   const srt_lz_dict *d);
+
+/*
+ * Delta (binary diff)
+ *
+ * Observations:
+ * - For updating large buffers that changed slightly (e.g. new versions
+ *   of configuration or data files): the delta is LZ using the base (old
+ *   version) as dictionary, i.e. copy instructions from the base or from
+ *   the target, and inserts of new data, so its size is proportional to
+ *   the changes, and applying it runs at the LZ decoding speed.
+ * - The delta has the base ID (CRC-32), so applying it to a different base
+ *   gives no output.
+ */
+
+/* #API: |Binary delta: encode target as copy/insert instructions using base as reference (empty string if target is empty)|output delta; base; target|output string reference (optional usage)|O(n + m)|1;2| */
+srt_string *ss_enc_delta(srt_string **s, const srt_string *base,
+			 const srt_string *target);
+
+/* #API: |Apply binary delta (empty string if the input is not valid or the base is not the one used for encoding)|output string; base; delta|output string reference (optional usage)|O(n + m)|1;2| */
+srt_string *ss_dec_delta(srt_string **s, const srt_string *base,
+			 const srt_string *delta);
+
+/*
+ * Framed LZ
+ */
+
+/* #API: |Convert to framed LZ (independent blocks, compressed in parallel if built with PTHREAD=1). Flags: S_LZF_CRC32 (CRC-32 per block), S_LZF_HIGH (high compression), S_LZF_ENTROPY (entropy-coded blocks, see ss_enc_lze()), S_LZF_INDEX (block index, for random access: ss_dec_lz_range()), S_LZF_LEVEL(n) (compression level, see ss_enc_lz_level())|output string; input string; block size (0: 1 MiB); flags; maximum number of threads|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_enc_lzf(srt_string **s, const srt_string *src,
+		       const size_t block_size, const int flags,
+		       const size_t nthreads);
+
+/* #API: |Decode from framed LZ, in parallel if built with PTHREAD=1 (empty string if the input is not valid, e.g. CRC-32 error). Concatenated frames (e.g. SC_ENC_LZF stream) are decoded as one|output string; input string; maximum number of threads|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_dec_lzf(srt_string **s, const srt_string *src,
+		       const size_t nthreads);
+
+/* #API: |Decode a range from framed LZ, decompressing only the blocks covering it (O(1) block location if the frame has block index, i.e. S_LZF_INDEX flag; otherwise the block headers before the range are parsed; for concatenated frames, the frames before the range are skipped, parsing their block headers). The input can be a reference to a memory-mapped file (ss_ref_buf())|output string; input string; uncompressed offset; length (clamped to the uncompressed size)|output string reference (optional usage)|O(block size)|1;2| */
+srt_string *ss_dec_lz_range(srt_string **s, const srt_string *src,
+			    const size_t off, const size_t len);
+
+/*
+ * Streaming codecs
+ *
+ * Observations:
+ * - For transforming data not available at once (e.g. reading from a file
+ *   in chunks), with bounded memory usage: only the bytes that can not be
+ *   processed yet are kept (e.g. incomplete base64 quanta or cut escape
+ *   sequences), except for LZ, which works in blocks (see senc.h).
+ * - Same output as the one-shot ss_enc_* and ss_dec_* functions, except
+ *   for LZ, using its own block format (SC_ENC_LZ output is decoded with
+ *   SC_DEC_LZ), and framed LZ, writing one frame every block size x
+ *   threads input bytes (SC_ENC_LZF output is decoded with SC_DEC_LZF,
+ *   ss_dec_lzf(), or ss_dec_lz_range()). For framed LZ, memory usage is
+ *   one frame (e.g. 8 threads and 1 MiB blocks: 8 MiB), and every frame is
+ *   compressed/decompressed in parallel.
+ * - Codec types: SC_ENC_B64, SC_DEC_B64, SC_ENC_B64URL, SC_DEC_B64URL,
+ *   SC_ENC_HEX, SC_ENC_HEX_UPPER, SC_DEC_HEX, SC_ENC_ESC_XML,
+ *   SC_DEC_ESC_XML, SC_ENC_ESC_JSON, SC_DEC_ESC_JSON, SC_ENC_ESC_URL,
+ *   SC_DEC_ESC_URL, SC_ENC_LZ, SC_DEC_LZ, SC_ENC_LZF, SC_DEC_LZF.
+ */
+
+typedef struct SCodec srt_codec;
+
+/* #API: |Allocate streaming codec|codec type (SC_ENC_B64, SC_DEC_B64, etc.)|codec (NULL if out of memory or not valid type)|O(1)|1;2| */
+srt_codec *ss_codec_alloc(const enum eSCodec type);
+
+/* #API: |Allocate framed LZ streaming codec (SC_ENC_LZF output is a sequence of ss_enc_lzf() frames, one every block size x threads input bytes)|codec type (SC_ENC_LZF or SC_DEC_LZF); block size (0: 1 MiB); flags (see ss_enc_lzf()); maximum number of threads|codec (NULL if out of memory or not valid type)|O(1)|1;2| */
+srt_codec *ss_codec_alloc_lzf(const enum eSCodec type, const size_t block_size,
+			      const int flags, const size_t nthreads);
+
+/* #API: |Process input chunk, appending the output|output string; codec; input chunk|output string reference (optional usage)|O(n)|1;2| */
+srt_string *ss_codec_update(srt_string **s, srt_codec *c, const srt_string *src);
+
+/* #API: |Finish the stream, appending the pending output (the codec is reset, so it can be used for a new stream)|output string; codec|output string reference (optional usage)|O(1)|1;2| */
+srt_string *ss_codec_final(srt_string **s, srt_codec *c);
+
+/* #API: |Check codec errors (e.g. not valid input, or out of memory), kept after ss_codec_final()|codec|S_TRUE: error; S_FALSE: no error|O(1)|1;2| */
+srt_bool ss_codec_error(const srt_codec *c);
+
+/* #API: |Free codec|codec|-|O(1)|1;2| */
+void ss_codec_free(srt_codec **c);
+
 /*
  * Hashing
  */
 
+/* #API: |String 64-bit hash (not cryptographic, FNV-1a algorithm), cached for strings using the full container, i.e. above 255 bytes; invalidated on string write access (e.g. mutating ss_* functions or ss_get_buffer()). Use it for strings hashed repeatedly without changes (e.g. long keys looked up many times); for hashing once (e.g. many different or short strings, or large buffers), ss_hash64() is several times faster, as FNV-1a processes one byte per step|string|64-bit hash|O(n); O(1) if cached|1;2| */
+uint64_t ss_hash(const srt_string *s);
+
+/* #API: |String 64-bit hash (not cryptographic, wyhash algorithm: faster and better distributed than ss_hash(), for hash tables, bloom filters, partitioning, etc.), not cached (see ss_hash()), and with a different value than ss_hash(). No hash flooding protection: use ss_hash64_seed() with a secret random seed for untrusted input|string|64-bit hash|O(n)|1;2| */
+uint64_t ss_hash64(const srt_string *s);
+
+/* #API: |String 64-bit keyed hash (see ss_hash64()), every hash secret being derived from the seed. Using a secret random seed, the hash values can not be predicted, preventing hash flooding attacks|string; seed|64-bit hash|O(n)|1;2| */
+uint64_t ss_hash64_seed(const srt_string *s, uint64_t seed);
+
+/* #API: |Buzhash rolling hash of a window (substring), see ss_buzhash_roll()|string; window start offset; window size (in bytes, clamped to the string end)|32-bit hash|O(n)|1;2| */
+uint32_t ss_buzhash(const srt_string *s, size_t off, size_t w);
+
+/* #API: |Buzhash rolling hash: move the window one byte forward|Buzhash of the window; first byte of the window (removed); byte after the window (added); window size (in bytes)|32-bit hash|O(1)|1;2| */
+uint32_t ss_buzhash_roll(uint32_t h, int c_out, int c_in, size_t w);
+
+/* #API: |Content-defined chunking (FastCDC, Gear rolling hash): size of the chunk starting at the given offset. Boundaries depend only on the surrounding content, so an edit changes only the chunks around it (data deduplication). For streams, append data to the string and set "last" to S_FALSE until the end of the stream: 0 is returned if more data is required|string; chunk start offset; minimum chunk size; average chunk size (rounded down to a power of 2); maximum chunk size; S_TRUE: no more data will be appended|chunk size (0: no more chunks, or more data required)|O(n)|1;2| */
+size_t ss_cdc_next(const srt_string *s, size_t off, size_t min, size_t avg, size_t max, srt_bool last);
+
+/* #API: |Content-defined chunking of the whole string (see ss_cdc_next()), with a 64-bit hash per chunk (ss_hash64())|output vector of chunk end offsets (SV_U64, optional: NULL); output vector of chunk hashes (SV_U64, optional: NULL); string; minimum chunk size; average chunk size; maximum chunk size|number of chunks|O(n)|1;2| */
+size_t ss_cdc(srt_vector **ends, srt_vector **hashes, const srt_string *s, size_t min, size_t avg, size_t max);
+
 /* #API: |String CRC-32 checksum|string|32-bit hash|O(n)|1;2| */
 uint32_t ss_crc32(const srt_string *s);
 
 /* #API: |CRC-32 checksum for substring|string; CRC resulting from previous chained CRC calls (use S_CRC32_INIT for the first call); start offset; end offset|32-bit hash|O(n)|1;2| */
 uint32_t ss_crc32r(const srt_string *s, uint32_t crc, size_t off1, size_t off2);
 
-/* #API: |String Adler32 checksum|string|32-bit hash|O(n)|1;2| */
+/* #API: |String CRC-32C (Castagnoli) checksum|string|32-bit hash|O(n)|1;2| */
+uint32_t ss_crc32c(const srt_string *s);
+
+/* #API: |CRC-32C checksum for substring|string; CRC resulting from previous chained CRC calls (use S_CRC32C_INIT for the first call); start offset; end offset|32-bit hash|O(n)|1;2| */
+uint32_t ss_crc32cr(const srt_string *s, uint32_t crc, size_t off1, size_t off2);
+
+/* #API: |CRC-32 of the concatenation of A and B, from their CRC-32 (no data access)|CRC-32 of A; CRC-32 of B; size of B (in bytes)|32-bit hash|O(log n)|1;2| */
+uint32_t ss_crc32_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b);
+
+/* #API: |String CRC-32 checksum, computed in parallel for large strings (1 MiB or more per thread, if built with PTHREAD=1), e.g. for a reference to a memory-mapped file (ss_ref_buf())|string; maximum number of threads|32-bit hash|O(n)|1;2| */
+uint32_t ss_crc32_parallel(const srt_string *s, const size_t nthreads);
+
+/* #API: |CRC-32C of the concatenation of A and B, from their CRC-32C (no data access)|CRC-32C of A; CRC-32C of B; size of B (in bytes)|32-bit hash|O(log n)|1;2| */
+uint32_t ss_crc32c_combine(uint32_t crc_a, uint32_t crc_b, uint64_t len_b);
+
+/* #API: |String CRC-32C checksum, computed in parallel for large strings (see ss_crc32_parallel())|string; maximum number of threads|32-bit hash|O(n)|1;2| */
+uint32_t ss_crc32c_parallel(const srt_string *s, const size_t nthreads);
+
+/* #API: |String Adler32 checksum (S_ADLER32_INIT, i.e. 1, for empty string, as zlib)|string|32-bit hash|O(n)|1;2| */
 uint32_t ss_adler32(const srt_string *s);
 
 /* #API: |Adler32 checksum for substring|string; Adler32 resulting from previous chained Adler32 calls (use S_ADLER32_INIT for the first call); start offset; end offset|32-bit hash|O(n)|1;2| */
 uint32_t ss_adler32r(const srt_string *s, uint32_t adler, size_t off1, size_t off2);
 
+/* #API: |Adler32 of the concatenation of A and B, from their Adler32 (no data access)|Adler32 of A; Adler32 of B; size of B (in bytes)|32-bit hash|O(1)|1;2| */
+uint32_t ss_adler32_combine(uint32_t adler_a, uint32_t adler_b, uint64_t len_b);
+
+/* #API: |String Adler32 checksum, computed in parallel for large strings (see ss_crc32_parallel())|string; maximum number of threads|32-bit hash|O(n)|1;2| */
+uint32_t ss_adler32_parallel(const srt_string *s, const size_t nthreads);
+
 
 /*
  * Inlined functions
@@ -847,6 +1241,8 @@ S_INLINE char *ss_get_buffer(srt_string *s)
 	/*
 	 * Constness breaking will be addressed once the ss_to_c gets fixed.
 	 */
+	if (sdx_full_st((srt_data *)s))
+		s->d.sub_type = 0; /* write access: invalidate cached hash */
 	return ss_is_ref(s) ? ((struct SStringRefRW *)s)->str
 			    : sdx_get_buffer((srt_data *)s);
 }
@@ -857,6 +1253,20 @@ S_INLINE const char *ss_get_buffer_r(const srt_string *s)
 			    : sdx_get_buffer_r((const srt_data *)s);
 }
 
+S_INLINE void ss_set_size(srt_string *s, const size_t size)
+{
+	if (!s)
+		return;
+	sdx_set_size((srt_data *)s, size);
+	/*
+	 * Raw size change (e.g. after writing into the buffer): invalidate
+	 * cached Unicode size, hash, and code point index
+	 */
+	s->d.f.flag1 = 0;
+	if (sdx_full_st((srt_data *)s))
+		s->d.sub_type = 0;
+}
+
 	/*
 	 * Aux
 	 */
@@ -87,28 +87,25 @@ static T_SVLDX svldx_f[SV_LAST_INT + 1] = {
  * Internal functions
  */
 
-#define BUILD_CMP_I(FN, T)                                                     \
-	static int FN(const void *a, const void *b)                            \
-	{                                                                      \
-		int64_t r = *((const T *)a) - *((const T *)b);                 \
-		return r < 0 ? -1 : r > 0 ? 1 : 0;                             \
-	}
-
-#define BUILD_CMP_U(FN, T)                                                     \
+/*
+ * Comparison without subtraction (it could overflow, e.g. for 32/64-bit
+ * elements with opposite signs)
+ */
+#define BUILD_CMP(FN, T)                                                       \
 	static int FN(const void *a, const void *b)                            \
 	{                                                                      \
 		T a2 = *((const T *)a), b2 = *((const T *)b);                  \
 		return a2 < b2 ? -1 : a2 == b2 ? 0 : 1;                        \
 	}
 
-BUILD_CMP_I(__sv_cmp_i8, signed char)
-BUILD_CMP_I(__sv_cmp_i16, short)
-BUILD_CMP_I(__sv_cmp_i32, int)
-BUILD_CMP_I(__sv_cmp_i64, int64_t)
-BUILD_CMP_U(__sv_cmp_u8, unsigned char)
-BUILD_CMP_U(__sv_cmp_u16, unsigned short)
-BUILD_CMP_U(__sv_cmp_u32, unsigned int)
-BUILD_CMP_U(__sv_cmp_u64, uint64_t)
+BUILD_CMP(__sv_cmp_i8, signed char)
+BUILD_CMP(__sv_cmp_i16, short)
+BUILD_CMP(__sv_cmp_i32, int)
+BUILD_CMP(__sv_cmp_i64, int64_t)
+BUILD_CMP(__sv_cmp_u8, unsigned char)
+BUILD_CMP(__sv_cmp_u16, unsigned short)
+BUILD_CMP(__sv_cmp_u32, unsigned int)
+BUILD_CMP(__sv_cmp_u64, uint64_t)
 
 static uint8_t svt_sizes[SV_LAST_INT + 1] = {
 	sizeof(char),		sizeof(unsigned char), sizeof(short),
@@ -453,6 +450,19 @@ srt_vector *sv_resize(srt_vector **v, const size_t n)
 	return aux_resize(v, S_FALSE, (v ? *v : NULL), n);
 }
 
+#ifndef S_MINIMAL
+/*
+ * LSD radix sort for large vectors, using a temporary buffer of the same
+ * size: not for fixed-size (stack or external buffer) vectors
+ */
+#define SV_SORT_LSD_MIN 2048
+
+static srt_bool aux_sort_lsd(const srt_vector *v)
+{
+	return sv_size(v) >= SV_SORT_LSD_MIN && !v->d.f.ext_buffer;
+}
+#endif
+
 srt_vector *sv_sort(srt_vector *v)
 {
 	void *buf;
@@ -476,16 +486,24 @@ srt_vector *sv_sort(srt_vector *v)
 		ssort_u16((uint16_t *)buf, buf_size);
 		break;
 	case SV_I32:
-		ssort_i32((int32_t *)buf, buf_size);
+		if (!aux_sort_lsd(v)
+		    || !ssort_lsd_i32((int32_t *)buf, buf_size))
+			ssort_i32((int32_t *)buf, buf_size);
 		break;
 	case SV_U32:
-		ssort_u32((uint32_t *)buf, buf_size);
+		if (!aux_sort_lsd(v)
+		    || !ssort_lsd_u32((uint32_t *)buf, buf_size))
+			ssort_u32((uint32_t *)buf, buf_size);
 		break;
 	case SV_I64:
-		ssort_i64((int64_t *)buf, buf_size);
+		if (!aux_sort_lsd(v)
+		    || !ssort_lsd_i64((int64_t *)buf, buf_size))
+			ssort_i64((int64_t *)buf, buf_size);
 		break;
 	case SV_U64:
-		ssort_u64((uint64_t *)buf, buf_size);
+		if (!aux_sort_lsd(v)
+		    || !ssort_lsd_u64((uint64_t *)buf, buf_size))
+			ssort_u64((uint64_t *)buf, buf_size);
 		break;
 	default:
 		qsort(buf, buf_size, elem_size, v->vx.cmpf);
@@ -0,0 +1,67 @@
+#!/usr/bin/python3
+#
+# mk_sb64_tables.py
+#
+# Base64 encoding/decoding tables generator (sb64tbl.h)
+#
+# Syntax: utl/mk_sb64_tables.py >src/saux/sb64tbl.h
+#
+# Copyright (c) 2015-2018 F. Aragon. All rights reserved.
+# Released under the BSD 3-Clause License (see the doc/LICENSE)
+#
+
+import sys
+
+ALPHA = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789'
+STD, URL = ALPHA + '+/', ALPHA + '-_'
+
+# Decoding flags (see senc.c)
+FLAG_NV, FLAG_STD, FLAG_URL = 1 << 31, 1 << 30, 1 << 29
+
+
+def out_array(ctype, name, data, fmt):
+    # 80 column lines (tab counts as 8 characters)
+    items = [fmt % x for x in data]
+    per_line = 73 // (max(len(x) for x in items) + 2)
+    print('static const %s %s[%i] = {' % (ctype, name, len(data)))
+    for i in range(0, len(items), per_line):
+        print('\t' + ', '.join(items[i:i + per_line]) + ',')
+    print('};\n')
+
+
+def main():
+    # Encoding: 12-bit input -> 2 characters (first one in the low byte)
+    e12 = [ord(STD[i >> 6]) | ord(STD[i & 63]) << 8 for i in range(4096)]
+    # Decoding: the 6-bit value goes already in its position of the 3 output
+    # bytes (as a little-endian 32-bit word), with flags for invalid and
+    # alphabet-specific characters
+    dec = [FLAG_NV] * 256
+    for v, c in enumerate(STD):
+        dec[ord(c)] = v | (FLAG_STD if v >= 62 else 0)
+    for v, c in enumerate(URL[62:]):
+        dec[ord(c)] = (62 + v) | FLAG_URL
+    put = (lambda v: v << 2,
+           lambda v: v >> 4 | (v & 0xf) << 12,
+           lambda v: v >> 2 << 8 | (v & 3) << 22,
+           lambda v: v << 16)
+    print('/*\n * sb64tbl.h\n *\n * Base64 encoding/decoding tables\n'
+          ' * (python3 utl/mk_sb64_tables.py >src/saux/sb64tbl.h)\n *\n'
+          ' * Copyright (c) 2015-2018 F. Aragon. All rights reserved.\n'
+          ' * Released under the BSD 3-Clause License (see the doc/LICENSE)'
+          '\n */\n')
+    print('#ifndef SB64TBL_H\n#define SB64TBL_H\n')
+    print('/* clang-format off */\n')
+    print('#define SB64_NV 0x%08x' % FLAG_NV)
+    print('#define SB64_STD 0x%08x' % FLAG_STD)
+    print('#define SB64_URL 0x%08x\n' % FLAG_URL)
+    out_array('uint16_t', 'sb64_e12', e12, '0x%04x')
+    for k in range(4):
+        out_array('uint32_t', 'sb64_d%i' % k,
+                  [x if x & FLAG_NV else (x & ~63) | put[k](x & 63)
+                   for x in dec], '0x%08x')
+    print('/* clang-format on */\n')
+    print('#endif /* SB64TBL_H */')
+    sys.stderr.write('tables: %i bytes\n' % (len(e12) * 2 + 4 * 256 * 4))
+
+
+main()
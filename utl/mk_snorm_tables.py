@@ -0,0 +1,202 @@
+#!/usr/bin/python3
+#
+# mk_snorm_tables.py
+#
+# Unicode normalization and case folding tables generator (snormtbl.h)
+#
+# Syntax: utl/mk_snorm_tables.py >src/saux/snormtbl.h
+#
+# The Unicode Character Database used is the one built into the Python
+# interpreter (unicodedata module), so no external files are required.
+#
+# Copyright (c) 2015-2018 F. Aragon. All rights reserved.
+# Released under the BSD 3-Clause License (see the doc/LICENSE)
+#
+
+import sys
+import unicodedata as ud
+
+MAX_CP = 0x110000
+HANGUL_S0, HANGUL_SN = 0xac00, 0xac00 + 11172
+
+# Property bits (see snorm.c)
+CCC_MASK = 0xff
+NFC_QC_MAYBE, NFC_QC_NO = 1 << 8, 1 << 9
+NFKC_QC_MAYBE, NFKC_QC_NO = 1 << 10, 1 << 11
+NFD_QC_NO, NFKD_QC_NO = 1 << 12, 1 << 13
+HAS_FOLD = 1 << 14
+
+
+def is_char(cp):
+    return not 0xd800 <= cp <= 0xdfff
+
+
+def raw_canonical_decomposition(cp):
+    d = ud.decomposition(chr(cp))
+    if not d or d.startswith('<'):
+        return None
+    return [int(x, 16) for x in d.split()]
+
+
+def composition_pairs():
+    pairs = {}
+    for cp in range(MAX_CP):
+        if not is_char(cp) or HANGUL_S0 <= cp < HANGUL_SN:
+            continue
+        d = raw_canonical_decomposition(cp)
+        if d is None or len(d) != 2:
+            continue
+        # Skip composition exclusions and non-starter decompositions
+        if ud.normalize('NFC', chr(cp)) != chr(cp):
+            continue
+        pairs[(d[0], d[1])] = cp
+    return pairs
+
+
+def utf16(s):
+    out = []
+    for ch in s:
+        cp = ord(ch)
+        if cp < 0x10000:
+            out.append(cp)
+        else:
+            cp -= 0x10000
+            out += [0xd800 | (cp >> 10), 0xdc00 | (cp & 0x3ff)]
+    return out
+
+
+class Pool:
+    def __init__(self):
+        self.data, self.index = [], {}
+
+    def add(self, units):
+        key = tuple(units)
+        if key not in self.index:
+            self.index[key] = len(self.data)
+            self.data += units
+        return self.index[key], len(units)
+
+
+def split_blocks(data, shift):
+    blocks, index = {}, []
+    for i in range(0, len(data), 1 << shift):
+        b = tuple(data[i:i + (1 << shift)])
+        if b not in blocks:
+            blocks[b] = len(blocks)
+        index.append(blocks[b])
+    flat = []
+    for b in sorted(blocks.items(), key=lambda x: x[1]):
+        flat += b[0]
+    return index, flat
+
+
+def elem_size(data):
+    return 1 if max(data) < 256 else 2
+
+
+def build_trie(props):
+    # Three-stage lookup table, using the smallest combination
+    best = None
+    for shift2 in range(2, 8):
+        for shift1 in range(2, 8):
+            lim = 1 << (shift1 + shift2)
+            padded = props + [0] * ((lim - len(props) % lim) % lim)
+            i1, s2 = split_blocks(padded, shift2)
+            s0, s1 = split_blocks(i1, shift1)
+            cost = len(s0) * elem_size(s0) + len(s1) * elem_size(s1) + \
+                len(s2) * 2
+            if best is None or cost < best[0]:
+                best = (cost, shift1, shift2, s0, s1, s2)
+    return best
+
+
+def out_array(ctype, name, data, fmt):
+    # 80 column lines (tab counts as 8 characters)
+    items = [fmt % x for x in data]
+    per_line = 73 // (max(len(x) for x in items) + 2)
+    print('static const %s %s[%i] = {' % (ctype, name, len(data)))
+    for i in range(0, len(items), per_line):
+        print('\t' + ', '.join(items[i:i + per_line]) + ',')
+    print('};\n')
+
+
+def main():
+    pairs = composition_pairs()
+    seconds = set(b for (a, b) in pairs.keys())
+    seconds |= set(range(0x1161, 0x1176)) | set(range(0x11a8, 0x11c3))
+    props = []
+    canon, compat, fold = [], [], []
+    pool = Pool()
+    last = 0
+    for cp in range(MAX_CP):
+        p = 0
+        if is_char(cp):
+            c = chr(cp)
+            p = ud.combining(c)
+            nfd, nfkd = ud.normalize('NFD', c), ud.normalize('NFKD', c)
+            if nfd != c:
+                p |= NFD_QC_NO
+            if nfkd != c:
+                p |= NFKD_QC_NO
+            if ud.normalize('NFC', c) != c:
+                p |= NFC_QC_NO
+            elif cp in seconds:
+                p |= NFC_QC_MAYBE
+            if ud.normalize('NFKC', c) != c:
+                p |= NFKC_QC_NO
+            elif cp in seconds:
+                p |= NFKC_QC_MAYBE
+            if c.casefold() != c:
+                p |= HAS_FOLD
+                fold.append((cp,) + pool.add(utf16(c.casefold())))
+            if not HANGUL_S0 <= cp < HANGUL_SN:
+                if nfd != c:
+                    canon.append((cp,) + pool.add(utf16(nfd)))
+                if nfkd != nfd:
+                    compat.append((cp,) + pool.add(utf16(nfkd)))
+        if p:
+            last = cp
+        props.append(p)
+    props = props[:last + 1]
+    cost, shift1, shift2, s0, s1, s2 = build_trie(props)
+    pk = sorted(pairs.keys())
+    print('/*\n * snormtbl.h\n *\n * Unicode %s normalization and case '
+          'folding tables\n * (python3 utl/mk_snorm_tables.py '
+          '>src/saux/snormtbl.h)\n *\n * Copyright (c) 2015-2018 F. Aragon. '
+          'All rights reserved.\n * Released under the BSD 3-Clause License '
+          '(see the doc/LICENSE)\n */\n' % ud.unidata_version)
+    print('#ifndef SNORMTBL_H\n#define SNORMTBL_H\n')
+    print('/* clang-format off */\n')
+    print('#define SN_PROP_LIMIT 0x%x' % (len(s0) << (shift1 + shift2)))
+    print('#define SN_PROP_SHIFT1 %i' % shift1)
+    print('#define SN_PROP_SHIFT2 %i\n' % shift2)
+    # Quick check: UTF-8 bytes below these are known to be normalized
+    for name, mask in (('NFC', NFC_QC_MAYBE | NFC_QC_NO),
+                       ('NFD', NFD_QC_NO),
+                       ('NFKC', NFKC_QC_MAYBE | NFKC_QC_NO),
+                       ('NFKD', NFKD_QC_NO), ('CASEFOLD', HAS_FOLD)):
+        cp = 0x80
+        while not props[cp] & (mask | CCC_MASK):
+            cp += 1
+        print('#define SN_QC_THR_%s 0x%02x' % (name, chr(cp).encode()[0]))
+    print('')
+    out_array('uint%i_t' % (elem_size(s0) * 8), 'sn_prop_s0', s0, '%i')
+    out_array('uint%i_t' % (elem_size(s1) * 8), 'sn_prop_s1', s1, '%i')
+    out_array('uint16_t', 'sn_prop_s2', s2, '0x%04x')
+    out_array('uint16_t', 'sn_pool', pool.data, '0x%04x')
+    # Keys: code point (bits 0-23) and mapping size (bits 24-31)
+    for name, t in (('canon', canon), ('compat', compat), ('fold', fold)):
+        out_array('uint32_t', 'sn_%s_k' % name,
+                  [x[0] | x[2] << 24 for x in t], '0x%08x')
+        out_array('uint16_t', 'sn_%s_off' % name, [x[1] for x in t], '%i')
+    out_array('uint32_t', 'sn_comp_k1', [x[0] for x in pk], '0x%05x')
+    out_array('uint32_t', 'sn_comp_k2', [x[1] for x in pk], '0x%05x')
+    out_array('uint32_t', 'sn_comp_v', [pairs[x] for x in pk], '0x%05x')
+    print('/* clang-format on */\n')
+    print('#endif /* SNORMTBL_H */')
+    sys.stderr.write('tables: %i bytes (trie: %i)\n' % (
+        cost + len(pool.data) * 2 + 6 * (len(canon) + len(compat) +
+                                         len(fold)) + 12 * len(pk), cost))
+
+
+main()